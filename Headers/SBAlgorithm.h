@@ -21,6 +21,7 @@
 #include "SBBidiType.h"
 #include "SBCodepointSequence.h"
 #include "SBParagraph.h"
+#include "SBRun.h"
 
 typedef struct _SBAlgorithm *SBAlgorithmRef;
 
@@ -35,6 +36,51 @@ typedef struct _SBAlgorithm *SBAlgorithmRef;
  */
 SBAlgorithmRef SBAlgorithmCreate(const SBCodepointSequence *codepointSequence);
 
+/**
+ * Creates an algorithm object for the specified code point sequence, taking the bidirectional types
+ * of its code units from the given array instead of determining them from the code points.
+ *
+ * @param codepointSequence
+ *      The code point sequence to apply bidirectional algorithm on.
+ * @param bidiTypes
+ *      An array of bidirectional types, one for each code unit of the string buffer. The types are
+ *      copied, so the array can be freed after the call.
+ * @return
+ *      A reference to an algorithm object if the call was successful, NULL otherwise.
+ * @note
+ *      The types should be the same as would be determined for the code points, with the trailing
+ *      code units of each code point having Boundary Neutral (BN) type; they are not verified. The
+ *      code point sequence is still consulted for paragraph separators, bracket pairs and mirrors.
+ */
+SBAlgorithmRef SBAlgorithmCreateWithTypes(const SBCodepointSequence *codepointSequence,
+    const SBBidiType *bidiTypes);
+
+/**
+ * Creates an algorithm object which works on code points of the specified code point sequence
+ * rather than its code units. The source string inside the code point sequence should not be freed
+ * until the algorithm object is in use.
+ *
+ * The bidirectional types, the paragraph levels and the line runs are kept for each code point
+ * without filling trailing code units with Boundary Neutral (BN) type. It reduces the work for
+ * UTF-8 and UTF-16 strings mostly consisting of multi-unit code points.
+ *
+ * The string is decoded once at creation to determine the types. Apart from them, only the code
+ * unit offset of every 32nd code point is kept, so the algorithm needs a little more than one byte
+ * per code point. In return, the code points needed afterwards for pairing brackets, locating
+ * mirrors and copying the strings of lines are decoded again from the source string, starting at
+ * the nearest kept offset, which makes such accesses slower than with other algorithms.
+ *
+ * @param codepointSequence
+ *      The code point sequence to apply bidirectional algorithm on.
+ * @return
+ *      A reference to an algorithm object if the call was successful, NULL otherwise.
+ * @note
+ *      All offsets and lengths used with the algorithm, its paragraphs and its lines are code point
+ *      indexes, and the strings copied by its lines are encoded in UTF-32. Use
+ *      SBAlgorithmGetCodeUnitOffset or SBAlgorithmConvertRuns to map them back to the source string.
+ */
+SBAlgorithmRef SBAlgorithmCreateCodepointIndexed(const SBCodepointSequence *codepointSequence);
+
 /**
  * Returns a direct pointer to the bidirectional types of code units, stored in the algorithm
  * object.
@@ -47,6 +93,36 @@ SBAlgorithmRef SBAlgorithmCreate(const SBCodepointSequence *codepointSequence);
  */
 const SBBidiType *SBAlgorithmGetBidiTypesPtr(SBAlgorithmRef algorithm);
 
+/**
+ * Returns the offset of a code unit in the source string of the algorithm.
+ *
+ * @param algorithm
+ *      The algorithm object whose source string is considered.
+ * @param stringIndex
+ *      The code point index of an algorithm created with SBAlgorithmCreateCodepointIndexed, which
+ *      may be equal to the number of code points to get the length of source string.
+ * @return
+ *      The offset of the first code unit of the code point in source string, or SBInvalidIndex if
+ *      the index is out of range. The index is returned as it is for other algorithms.
+ */
+SBUInteger SBAlgorithmGetCodeUnitOffset(SBAlgorithmRef algorithm, SBUInteger stringIndex);
+
+/**
+ * Converts the offsets and lengths of runs from code point indexes to code units of the source
+ * string of the algorithm.
+ *
+ * @param algorithm
+ *      The algorithm object from which the runs were obtained.
+ * @param runs
+ *      The runs to convert in place, usually copied from a line of the algorithm.
+ * @param runCount
+ *      The number of runs.
+ * @note
+ *      The runs are left unchanged for algorithms not created with
+ *      SBAlgorithmCreateCodepointIndexed.
+ */
+void SBAlgorithmConvertRuns(SBAlgorithmRef algorithm, SBRun *runs, SBUInteger runCount);
+
 /**
  * Determines the boundary of first paragraph within the specified range.
  *
@@ -72,6 +72,11 @@ enum {
  */
 typedef SBUInt8                     SBBoolean;
 
+/**
+ * A value that indicates an invalid unsigned index.
+ */
+#define SBInvalidIndex              (SBUInteger)(-1)
+
 #define SBUInt8InRange(v, s, e)     \
 (                                   \
     (SBUInt8)((v) - (s))            \
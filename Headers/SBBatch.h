@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _SB_PUBLIC_BATCH_H
+#define _SB_PUBLIC_BATCH_H
+
+#include "SBBase.h"
+#include "SBCodepointSequence.h"
+#include "SBRun.h"
+
+/**
+ * A structure containing the arrays in which the results of a batch are written. Each array holds
+ * the results of all inputs one after another.
+ */
+typedef struct _SBBatchResult {
+    /**
+     * The embedding levels of all code units. The levels of an input start at the sum of string
+     * lengths of the inputs before it. Can be NULL if the levels are not needed.
+     */
+    SBLevel *levels;
+    /**
+     * The visual runs of all inputs, having same size as the levels array. The runs of an input
+     * start at the same index as its levels and their offsets are relative to its own string. Can
+     * be NULL if the runs are not needed.
+     */
+    SBRun *runs;
+    /**
+     * The number of runs of each input. Must be available if the runs are requested.
+     */
+    SBUInteger *runCounts;
+    /**
+     * The resolved base level of each input. Can be NULL if the base levels are not needed.
+     */
+    SBLevel *baseLevels;
+} SBBatchResult;
+
+/**
+ * Resolves the embedding levels and visual runs of many independent strings at once.
+ *
+ * @param inputs
+ *      The code point sequences of the strings to be resolved.
+ * @param count
+ *      The number of code point sequences in the inputs.
+ * @param baseLevel
+ *      The desired base level of each string. It can be SBLevelDefaultLTR, SBLevelDefaultRTL or an
+ *      explicit level.
+ * @param threadCount
+ *      The maximum number of threads that can be used, including the calling one. Pass 1 to
+ *      resolve all inputs on the calling thread. Only the calling thread is used unless the library
+ *      is built with SB_CONFIG_THREADS.
+ * @param result
+ *      The arrays in which the results will be written.
+ * @return
+ *      SBTrue if all inputs were resolved, SBFalse if the memory could not be allocated.
+ * @note
+ *      A single scratch memory is shared by all inputs resolved on the same thread, so no objects
+ *      are created for individual strings.
+ * @note
+ *      Each paragraph of a string is treated as a single line. The levels are the ones of the
+ *      paragraphs, as returned by SBParagraphGetLevelsPtr, while the runs additionally have the
+ *      rule L1 applied and are placed paragraph by paragraph in visual order. The base level of a
+ *      string is the one of its first paragraph.
+ * @note
+ *      An empty or invalid sequence gets zero runs and SBLevelInvalid as its base level.
+ */
+SBBoolean SBResolveBatch(const SBCodepointSequence *inputs, SBUInteger count,
+    SBLevel baseLevel, SBUInteger threadCount, const SBBatchResult *result);
+
+#endif
@@ -23,13 +23,41 @@
 enum {
     SBStringEncodingUTF8 = 0,  /**< An 8-bit representation of Unicode code points. */
     SBStringEncodingUTF16 = 1, /**< 16-bit UTF encoding in native endianness. */
-    SBStringEncodingUTF32 = 2  /**< 32-bit UTF encoding in native endianness. */
+    SBStringEncodingUTF32 = 2, /**< 32-bit UTF encoding in native endianness. */
+    SBStringEncodingLatin1 = 3,       /**< ISO-8859-1, each byte being a code point. */
+    SBStringEncodingUTF16Swapped = 4, /**< 16-bit UTF encoding in opposite of native endianness. */
+    SBStringEncodingUTF32Swapped = 5, /**< 32-bit UTF encoding in opposite of native endianness. */
+
+    /**
+     * A flag to be combined with an encoding, indicating that the string buffer points to an
+     * SBStringChunks structure rather than the code units themselves.
+     */
+    SBStringEncodingChunked = 0x80
 };
 typedef SBUInt32 SBStringEncoding;
 
+/**
+ * A structure describing a piece of a string stored in multiple buffers.
+ */
+typedef struct _SBStringChunk {
+    void *buffer;      /**< The code units of the chunk. */
+    SBUInteger offset; /**< The index to the first code unit of the chunk in the whole text. */
+    SBUInteger length; /**< The number of code units in the chunk. */
+} SBStringChunk;
+
+/**
+ * A structure describing a string whose code units are stored in multiple buffers, such as a piece
+ * table or a rope, so that it can be used without copying it into a single buffer.
+ */
+typedef struct _SBStringChunks {
+    const SBStringChunk *chunks; /**< The chunks covering the text, contiguous and in order. */
+    SBUInteger chunkCount;       /**< The number of chunks. */
+    SBUInteger offset;           /**< The index of the first code unit of the string in the text, usually zero. */
+} SBStringChunks;
+
 typedef struct _SBCodepointSequence {
     SBStringEncoding stringEncoding; /**< The encoding of the string. */
-    void *stringBuffer;              /**< The source string containing the code units. */
+    void *stringBuffer;              /**< The source string containing the code units, or the chunks of it. */
     SBUInteger stringLength;         /**< The length of the string in terms of code units. */
 } SBCodepointSequence;
 
@@ -17,6 +17,51 @@
 #ifndef _SB_PUBLIC_CONFIG_H
 #define _SB_PUBLIC_CONFIG_H
 
+/*
+ * Define SB_CONFIG_ATOMIC_RETAIN to make the reference counting of objects atomic. Algorithm,
+ * paragraph and line objects are never modified after creation, so with this option they can be
+ * retained, read and released by multiple threads at the same time. Paragraph caches can be
+ * shared in the same way if SB_CONFIG_THREADS is also defined. Locators and itemizers keep their
+ * iteration state, so each of them must still be used by one thread at a time.
+ */
+/* #define SB_CONFIG_ATOMIC_RETAIN */
+
+/*
+ * Define SB_CONFIG_THREADS to let paragraph caches be shared by multiple threads and batches be
+ * resolved on multiple threads. It requires POSIX threads, or the Windows API on Windows. Without
+ * it the library has no dependency, a cache must be used by one thread at a time and a batch is
+ * always resolved on the calling thread.
+ */
+/* #define SB_CONFIG_THREADS */
+
+/*
+ * Define SB_CONFIG_MAPPED_FILE to let mapped file objects map files into memory. It requires POSIX
+ * memory mapping, or the Windows API on Windows. Without it the library includes no system header
+ * for files and SBMappedFileCreate always returns NULL.
+ */
+/* #define SB_CONFIG_MAPPED_FILE */
+
+/*
+ * The bidi types are looked up from a three-level trie by default. Define
+ * SB_CONFIG_BIDI_TYPE_PACKED to store them in 5 bits each, which gives the smallest table at the
+ * cost of some shifting, or SB_CONFIG_BIDI_TYPE_TWO_STAGE to use a two-stage table, which needs
+ * the fewest memory accesses at the cost of a larger table. Only one of them can be defined.
+ */
+/* #define SB_CONFIG_BIDI_TYPE_PACKED */
+/* #define SB_CONFIG_BIDI_TYPE_TWO_STAGE */
+
+/*
+ * Define SB_CONFIG_PAIRING_RANGES to look up the mirrors and bracket pairs from a sorted list of
+ * ranges with a binary search instead of a two-level table.
+ */
+/* #define SB_CONFIG_PAIRING_RANGES */
+
+/*
+ * Define SB_CONFIG_ALL_LOOKUP_LAYOUTS to compile every lookup table layout, so that each of them
+ * can be tested against the Unicode data. The configured layouts are still used by the library.
+ */
+/* #define SB_CONFIG_ALL_LOOKUP_LAYOUTS */
+
 /* #define SB_CONFIG_LOG */
 /* #define SB_CONFIG_UNITY */
 
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _SB_PUBLIC_DOCUMENT_H
+#define _SB_PUBLIC_DOCUMENT_H
+
+#include "SBAlgorithm.h"
+#include "SBBase.h"
+#include "SBParagraph.h"
+
+typedef struct _SBDocument *SBDocumentRef;
+
+/**
+ * Creates a document object which resolves the paragraphs of an algorithm on demand, keeping only
+ * a limited number of them in memory.
+ *
+ * @param algorithm
+ *      The algorithm object whose paragraphs will be resolved.
+ * @param baseLevel
+ *      The desired base level of each paragraph. Rules P2-P3 would be ignored if it is neither
+ *      SBLevelDefaultLTR nor SBLevelDefaultRTL.
+ * @param residentCapacity
+ *      The maximum number of resolved paragraphs kept in the document. The least recently used
+ *      ones are released when it is exceeded.
+ * @return
+ *      A reference to a document object, or NULL if the resident capacity is zero.
+ * @note
+ *      The paragraph boundaries are also determined lazily, only as far as the requested offsets
+ *      and indexes need them.
+ * @note
+ *      Unlike the algorithm and its paragraphs, a document changes with each request, so it must
+ *      not be used by multiple threads at the same time.
+ */
+SBDocumentRef SBDocumentCreate(SBAlgorithmRef algorithm, SBLevel baseLevel, SBUInteger residentCapacity);
+
+/**
+ * Returns the number of paragraphs in the document.
+ *
+ * @param document
+ *      The document whose paragraph count is returned.
+ * @note
+ *      The boundaries of all paragraphs are determined by this function, but none of them is
+ *      resolved.
+ */
+SBUInteger SBDocumentGetParagraphCount(SBDocumentRef document);
+
+/**
+ * Returns the index of the paragraph containing a code unit.
+ *
+ * @param document
+ *      The document in which the paragraph is looked up.
+ * @param stringOffset
+ *      The index to a code unit in source string.
+ * @return
+ *      The index of the paragraph containing the code unit, or SBInvalidIndex if the offset is
+ *      outside the string.
+ */
+SBUInteger SBDocumentGetParagraphIndex(SBDocumentRef document, SBUInteger stringOffset);
+
+/**
+ * Returns the range of a paragraph without resolving it.
+ *
+ * @param document
+ *      The document containing the paragraph.
+ * @param paragraphIndex
+ *      The index of the paragraph.
+ * @param paragraphOffset
+ *      A pointer to the variable receiving the index to the first code unit of the paragraph.
+ * @param paragraphLength
+ *      A pointer to the variable receiving the number of code units in the paragraph.
+ * @return
+ *      SBTrue if the paragraph exists, SBFalse if the index is not less than the paragraph count.
+ */
+SBBoolean SBDocumentGetParagraphRange(SBDocumentRef document, SBUInteger paragraphIndex,
+    SBUInteger *paragraphOffset, SBUInteger *paragraphLength);
+
+/**
+ * Returns a paragraph of the document, resolving it if it is not already resident.
+ *
+ * @param document
+ *      The document containing the paragraph.
+ * @param paragraphIndex
+ *      The index of the paragraph.
+ * @return
+ *      A reference to the paragraph object, or NULL if the index is not less than the paragraph
+ *      count or the paragraph could not be resolved.
+ * @note
+ *      The document owns the returned paragraph and may release it on any later request of a
+ *      paragraph. It should be retained in order to keep it for longer.
+ */
+SBParagraphRef SBDocumentGetParagraph(SBDocumentRef document, SBUInteger paragraphIndex);
+
+/**
+ * Returns the number of resolved paragraphs currently kept in the document.
+ *
+ * @param document
+ *      The document whose resident count is returned.
+ */
+SBUInteger SBDocumentGetResidentCount(SBDocumentRef document);
+
+/**
+ * Increments the reference count of a document object.
+ *
+ * @param document
+ *      The document object whose reference count will be incremented.
+ * @return
+ *      The same document object passed in as the parameter.
+ */
+SBDocumentRef SBDocumentRetain(SBDocumentRef document);
+
+/**
+ * Decrements the reference count of a document object. The object will be deallocated when its
+ * reference count reaches zero.
+ *
+ * @param document
+ *      The document object whose reference count will be decremented.
+ */
+void SBDocumentRelease(SBDocumentRef document);
+
+#endif
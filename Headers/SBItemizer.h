@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _SB_PUBLIC_ITEMIZER_H
+#define _SB_PUBLIC_ITEMIZER_H
+
+#include "SBBase.h"
+#include "SBLine.h"
+#include "SBMirrorLocator.h"
+#include "SBScript.h"
+
+typedef struct _SBItemizer *SBItemizerRef;
+
+/**
+ * A structure containing the information about a run of code points having same embedding level
+ * and same script.
+ */
+typedef struct _SBItemAgent {
+    SBUInteger offset;             /**< The index to the first code unit of the item. */
+    SBUInteger length;             /**< The number of code units covering the length of the item. */
+    SBLevel level;                 /**< The embedding level of the item. */
+    SBScript script;               /**< The script of the item. */
+    const SBMirrorAgent *mirrors;  /**< The mirrors of the item, NULL if it has none. */
+    SBUInteger mirrorCount;        /**< The number of mirrors of the item. */
+} SBItemAgent;
+
+/**
+ * Creates an itemizer object which can be used to split a line into items suitable for shaping.
+ *
+ * @return
+ *      A reference to an itemizer object.
+ */
+SBItemizerRef SBItemizerCreate(void);
+
+/**
+ * Loads a line in the itemizer so that its items can be located.
+ *
+ * @param itemizer
+ *      The itemizer in which the line will be loaded.
+ * @param line
+ *      The line which will be loaded in the itemizer.
+ * @param stringBuffer
+ *      The string buffer from which the line's algorithm was created.
+ * @note
+ *      For an algorithm created with SBAlgorithmCreateCodepointIndexed, the string buffer of its
+ *      source code point sequence is expected, and the offsets and lengths of the located items
+ *      are code point indexes.
+ * @note
+ *      The levels of the items are taken from the runs of the line. Only the scripts and the
+ *      mirrors are looked up, for which the code points are decoded from the string buffer, as
+ *      the algorithm keeps their bidirectional types alone.
+ */
+void SBItemizerLoadLine(SBItemizerRef itemizer, SBLineRef line, void *stringBuffer);
+
+/**
+ * Returns the agent containing the information of current located item.
+ *
+ * @param itemizer
+ *      The itemizer whose agent is returned.
+ */
+const SBItemAgent *SBItemizerGetAgent(SBItemizerRef itemizer);
+
+/**
+ * Instructs the itemizer to find next item in the loaded line.
+ *
+ * @param itemizer
+ *      The itemizer whom you want to instruct.
+ * @return
+ *      SBTrue if another item is available, SBFalse otherwise.
+ * @note
+ *      The items are located in logical order. The script of each item is resolved within its
+ *      level run in the same way as SBScriptLocator does for a whole string. The mirrors are only
+ *      collected for items having odd level and remain valid until the next call.
+ * @note
+ *      The itemizer will be reset after locating last item.
+ */
+SBBoolean SBItemizerMoveNext(SBItemizerRef itemizer);
+
+/**
+ * Instructs the itemizer to reset itself so that items of the loaded line can be obtained from the
+ * beginning.
+ *
+ * @param itemizer
+ *      The itemizer whom you want to reset.
+ */
+void SBItemizerReset(SBItemizerRef itemizer);
+
+/**
+ * Increments the reference count of an itemizer object.
+ *
+ * @param itemizer
+ *      The itemizer object whose reference count will be incremented.
+ * @return
+ *      The same itemizer object passed in as the parameter.
+ */
+SBItemizerRef SBItemizerRetain(SBItemizerRef itemizer);
+
+/**
+ * Decrements the reference count of an itemizer object. The object will be deallocated when its
+ * reference count reaches zero.
+ *
+ * @param itemizer
+ *      The itemizer object whose reference count will be decremented.
+ */
+void SBItemizerRelease(SBItemizerRef itemizer);
+
+#endif
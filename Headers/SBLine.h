@@ -62,6 +62,99 @@ SBUInteger SBLineGetRunCount(SBLineRef line);
  */
 const SBRun *SBLineGetRunsPtr(SBLineRef line);
 
+/**
+ * Returns the index of the run containing a code unit of the line.
+ *
+ * @param line
+ *      The line whose run is looked up.
+ * @param stringIndex
+ *      The index to a code unit in source string.
+ * @return
+ *      The index of the run in the array returned by SBLineGetRunsPtr, or SBInvalidIndex if the
+ *      code unit does not lie in the line.
+ * @note
+ *      The run is found by a binary search, so it is cheaper than scanning the runs.
+ */
+SBUInteger SBLineGetRunIndex(SBLineRef line, SBUInteger stringIndex);
+
+/**
+ * Returns the index of the code point displayed immediately to the left of a code point.
+ *
+ * @param line
+ *      The line in which the code point is displayed.
+ * @param stringIndex
+ *      The index to the first code unit of a code point of the line in source string.
+ * @return
+ *      The index to the first code unit of the code point on the left, or SBInvalidIndex if the
+ *      given one is leftmost in the line or does not lie in it.
+ */
+SBUInteger SBLineGetLeftIndex(SBLineRef line, SBUInteger stringIndex);
+
+/**
+ * Returns the index of the code point displayed immediately to the right of a code point.
+ *
+ * @param line
+ *      The line in which the code point is displayed.
+ * @param stringIndex
+ *      The index to the first code unit of a code point of the line in source string.
+ * @return
+ *      The index to the first code unit of the code point on the right, or SBInvalidIndex if the
+ *      given one is rightmost in the line or does not lie in it.
+ */
+SBUInteger SBLineGetRightIndex(SBLineRef line, SBUInteger stringIndex);
+
+/**
+ * Splits a logical range of the line into runs in visual order, which can be used for painting a
+ * selection.
+ *
+ * @param line
+ *      The line whose range is split.
+ * @param selectionOffset
+ *      The index to the first code unit of the selection in source string.
+ * @param selectionLength
+ *      The number of code units covering the length of the selection.
+ * @param runs
+ *      The array in which the selected runs will be written. It must be able to hold as many runs
+ *      as the line has.
+ * @return
+ *      The number of selected runs written in the array.
+ * @note
+ *      The part of selection outside the line is ignored.
+ */
+SBUInteger SBLineGetSelectionRuns(SBLineRef line,
+    SBUInteger selectionOffset, SBUInteger selectionLength, SBRun *runs);
+
+/**
+ * Copies the text of the line into a buffer after replacing the code points of odd level runs with
+ * their mirrors, as described by rule L4 of the algorithm.
+ *
+ * @param line
+ *      The line whose text is copied.
+ * @param buffer
+ *      The buffer in which the mirrored text will be written. It must be able to hold as many code
+ *      units as the length of the line.
+ * @note
+ *      The text is written in the encoding of source string, whose buffer must still be valid. The
+ *      first code unit of the buffer corresponds to the offset of the line.
+ */
+void SBLineCopyMirroredString(SBLineRef line, void *buffer);
+
+/**
+ * Copies the text of the line into a buffer in visual order, with the code points of odd level
+ * runs replaced by their mirrors.
+ *
+ * @param line
+ *      The line whose text is copied.
+ * @param buffer
+ *      The buffer in which the visual text will be written. It must be able to hold as many code
+ *      units as the length of the line.
+ * @note
+ *      The text is written in the encoding of source string, whose buffer must still be valid.
+ *      Combining marks are kept after their base in reversed runs, as described by rule L3 of the
+ *      algorithm.
+ */
+void SBLineCopyVisualString(SBLineRef line, void *buffer);
+
 /**
  * Increments the reference count of a line object.
  *
@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _SB_PUBLIC_MAPPED_FILE_H
+#define _SB_PUBLIC_MAPPED_FILE_H
+
+#include "SBBase.h"
+#include "SBCodepointSequence.h"
+
+typedef struct _SBMappedFile *SBMappedFileRef;
+
+/**
+ * Creates a mapped file object which maps the contents of a file into memory, so that it can be
+ * used as a code point sequence without reading it into a buffer.
+ *
+ * @param filePath
+ *      The path of the file to be mapped.
+ * @param stringEncoding
+ *      The encoding of the text in the file. UTF-16 and UTF-32 text in opposite of native
+ *      endianness can be used with SBStringEncodingUTF16Swapped and SBStringEncodingUTF32Swapped.
+ * @return
+ *      A reference to a mapped file object, or NULL if the file could not be mapped or its size is
+ *      not a multiple of the code unit size.
+ * @note
+ *      A leading byte order mark is excluded from the code point sequence.
+ * @note
+ *      NULL is always returned unless the library is built with SB_CONFIG_MAPPED_FILE.
+ */
+SBMappedFileRef SBMappedFileCreate(const char *filePath, SBStringEncoding stringEncoding);
+
+/**
+ * Provides the code point sequence covering the text of a mapped file.
+ *
+ * @param file
+ *      The mapped file whose code point sequence is provided.
+ * @param codepointSequence
+ *      The code point sequence which will receive the encoding, buffer and length of the text. The
+ *      buffer remains valid as long as the mapped file is alive.
+ */
+void SBMappedFileGetCodepointSequence(SBMappedFileRef file, SBCodepointSequence *codepointSequence);
+
+/**
+ * Increments the reference count of a mapped file object.
+ *
+ * @param file
+ *      The mapped file object whose reference count will be incremented.
+ * @return
+ *      The same mapped file object passed in as the parameter.
+ */
+SBMappedFileRef SBMappedFileRetain(SBMappedFileRef file);
+
+/**
+ * Decrements the reference count of a mapped file object. The file will be unmapped and the object
+ * will be deallocated when its reference count reaches zero.
+ *
+ * @param file
+ *      The mapped file object whose reference count will be decremented.
+ */
+void SBMappedFileRelease(SBMappedFileRef file);
+
+#endif
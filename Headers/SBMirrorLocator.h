@@ -49,6 +49,10 @@ SBMirrorLocatorRef SBMirrorLocatorCreate(void);
  *      The line which will be loaded in the locator.
  * @param stringBuffer
  *      The string buffer from which the line's algorithm was created.
+ * @note
+ *      For an algorithm created with SBAlgorithmCreateCodepointIndexed, the string buffer of its
+ *      source code point sequence is expected, and the indexes of the located mirrors are code
+ *      point indexes.
  */
 void SBMirrorLocatorLoadLine(SBMirrorLocatorRef locator, SBLineRef line, void *stringBuffer);
 
@@ -72,6 +76,27 @@ const SBMirrorAgent *SBMirrorLocatorGetAgent(SBMirrorLocatorRef locator);
  */
 SBBoolean SBMirrorLocatorMoveNext(SBMirrorLocatorRef locator);
 
+/**
+ * Instructs the locator to find the remaining mirrors in the loaded line and copy them into the
+ * given array.
+ *
+ * @param locator
+ *      The locator whom you want to instruct.
+ * @param mirrors
+ *      The array in which the mirrors will be copied.
+ * @param capacity
+ *      The maximum number of mirrors that can be copied into the array.
+ * @return
+ *      The number of mirrors copied into the array.
+ * @note
+ *      The locator continues from its current position, so the mirrors of a long line can be
+ *      obtained by calling this function repeatedly until it returns 0. The agent contains the
+ *      last copied mirror afterwards.
+ * @note
+ *      The locator will be reset when no mirror is left to copy.
+ */
+SBUInteger SBMirrorLocatorCopyMirrors(SBMirrorLocatorRef locator, SBMirrorAgent *mirrors, SBUInteger capacity);
+
 /**
  * Instructs the locator to reset itself so that mirrors of the loaded line can be obatained from
  * the beginning.
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _SB_PUBLIC_PARAGRAPH_CACHE_H
+#define _SB_PUBLIC_PARAGRAPH_CACHE_H
+
+#include "SBAlgorithm.h"
+#include "SBBase.h"
+#include "SBParagraph.h"
+
+typedef struct _SBParagraphCache *SBParagraphCacheRef;
+
+/**
+ * Creates a paragraph cache object which keeps the resolved levels of recently created paragraphs,
+ * so that a paragraph having the same text can be created without resolving it again.
+ *
+ * @param capacity
+ *      The maximum number of paragraphs whose levels are kept in the cache. The least recently
+ *      used ones are discarded when it is exceeded.
+ * @return
+ *      A reference to a paragraph cache object, or NULL if the capacity is zero.
+ * @note
+ *      A cache can be used by multiple threads at the same time if the library is built with
+ *      SB_CONFIG_THREADS.
+ */
+SBParagraphCacheRef SBParagraphCacheCreate(SBUInteger capacity);
+
+/**
+ * Creates a paragraph object in the same way as SBAlgorithmCreateParagraph, taking its levels from
+ * the cache if a paragraph with the same code units, encoding and base level was resolved before.
+ *
+ * @param cache
+ *      The cache in which the levels are looked up and stored.
+ * @param algorithm
+ *      The algorithm object to use for creating the desired paragraph.
+ * @param paragraphOffset
+ *      The index to the first code unit of the paragraph in source string.
+ * @param suggestedLength
+ *      The number of code units covering the suggested length of the paragraph.
+ * @param baseLevel
+ *      The desired base level of the paragraph. Rules P2-P3 would be ignored if it is neither
+ *      SBLevelDefaultLTR nor SBLevelDefaultRTL.
+ * @return
+ *      A reference to a paragraph object if the call was successful, NULL otherwise.
+ * @note
+ *      The paragraph always belongs to the given algorithm; only its levels are shared with the
+ *      cache.
+ * @note
+ *      The cache is not used for an algorithm created with SBAlgorithmCreateWithTypes, as its
+ *      levels depend on the provided types rather than the code units.
+ */
+SBParagraphRef SBParagraphCacheCreateParagraph(SBParagraphCacheRef cache, SBAlgorithmRef algorithm,
+    SBUInteger paragraphOffset, SBUInteger suggestedLength, SBLevel baseLevel);
+
+/**
+ * Returns the number of paragraphs whose levels were found in the cache.
+ *
+ * @param cache
+ *      The cache whose hit count is returned.
+ */
+SBUInteger SBParagraphCacheGetHitCount(SBParagraphCacheRef cache);
+
+/**
+ * Returns the number of paragraphs whose levels were not found in the cache and had to be
+ * resolved.
+ *
+ * @param cache
+ *      The cache whose miss count is returned.
+ */
+SBUInteger SBParagraphCacheGetMissCount(SBParagraphCacheRef cache);
+
+/**
+ * Increments the reference count of a paragraph cache object.
+ *
+ * @param cache
+ *      The paragraph cache object whose reference count will be incremented.
+ * @return
+ *      The same paragraph cache object passed in as the parameter.
+ */
+SBParagraphCacheRef SBParagraphCacheRetain(SBParagraphCacheRef cache);
+
+/**
+ * Decrements the reference count of a paragraph cache object. The object will be deallocated when
+ * its reference count reaches zero.
+ *
+ * @param cache
+ *      The paragraph cache object whose reference count will be decremented.
+ */
+void SBParagraphCacheRelease(SBParagraphCacheRef cache);
+
+#endif
@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _SB_PUBLIC_PARAGRAPH_LOCATOR_H
+#define _SB_PUBLIC_PARAGRAPH_LOCATOR_H
+
+#include "SBBase.h"
+#include "SBCodepointSequence.h"
+#include "SBParagraph.h"
+
+typedef struct _SBParagraphLocator *SBParagraphLocatorRef;
+
+/**
+ * A structure containing the information about a resolved paragraph.
+ */
+typedef struct _SBParagraphAgent {
+    SBUInteger offset;         /**< The index to the first code unit of the paragraph in source string. */
+    SBUInteger length;         /**< The number of code units covering the length of the paragraph. */
+    SBParagraphRef paragraph;  /**< The resolved paragraph, whose offsets start from zero. */
+} SBParagraphAgent;
+
+/**
+ * Creates a paragraph locator object which can be used to resolve the paragraphs of a string one
+ * at a time.
+ *
+ * @return
+ *      A reference to a paragraph locator object.
+ */
+SBParagraphLocatorRef SBParagraphLocatorCreate(void);
+
+/**
+ * Loads a code point sequence in the locator so that its paragraphs can be resolved.
+ *
+ * @param locator
+ *      The locator in which the code point sequence will be loaded.
+ * @param codepointSequence
+ *      The code point sequence which will be loaded in the locator.
+ * @param baseLevel
+ *      The desired base level of each paragraph. Rules P2-P3 would be ignored if it is neither
+ *      SBLevelDefaultLTR nor SBLevelDefaultRTL.
+ */
+void SBParagraphLocatorLoadCodepoints(SBParagraphLocatorRef locator,
+    const SBCodepointSequence *codepointSequence, SBLevel baseLevel);
+
+/**
+ * Returns the agent containing the information of current resolved paragraph.
+ *
+ * @param locator
+ *      The locator whose agent is returned.
+ */
+const SBParagraphAgent *SBParagraphLocatorGetAgent(SBParagraphLocatorRef locator);
+
+/**
+ * Instructs the locator to resolve next paragraph in the loaded code point sequence.
+ *
+ * @param locator
+ *      The locator whom you want to instruct.
+ * @return
+ *      SBTrue if another paragraph is available, SBFalse otherwise.
+ * @note
+ *      Each paragraph is resolved with an algorithm covering only its own code units, so the
+ *      memory in use is bounded by the longest paragraph rather than the whole string. The
+ *      paragraph of the agent is released on next call; it should be retained in order to keep it
+ *      for longer.
+ * @note
+ *      The locator will be reset after resolving last paragraph or if a paragraph could not be
+ *      resolved.
+ */
+SBBoolean SBParagraphLocatorMoveNext(SBParagraphLocatorRef locator);
+
+/**
+ * Instructs the locator to reset itself so that paragraphs of the loaded code point sequence can
+ * be obtained from the beginning.
+ *
+ * @param locator
+ *      The locator whom you want to reset.
+ */
+void SBParagraphLocatorReset(SBParagraphLocatorRef locator);
+
+/**
+ * Increments the reference count of a paragraph locator object.
+ *
+ * @param locator
+ *      The paragraph locator object whose reference count will be incremented.
+ * @return
+ *      The same paragraph locator object passed in as the parameter.
+ */
+SBParagraphLocatorRef SBParagraphLocatorRetain(SBParagraphLocatorRef locator);
+
+/**
+ * Decrements the reference count of a paragraph locator object. The object will be deallocated
+ * when its reference count reaches zero.
+ *
+ * @param locator
+ *      The paragraph locator object whose reference count will be decremented.
+ */
+void SBParagraphLocatorRelease(SBParagraphLocatorRef locator);
+
+#endif
@@ -40,6 +40,20 @@ typedef struct _SBScriptAgent {
  */
 SBScriptLocatorRef SBScriptLocatorCreate(void);
 
+/**
+ * Creates a copy of a script locator object including its loaded code point sequence, current
+ * position and the state of pending paired punctuations.
+ *
+ * @param locator
+ *      The locator which will be copied.
+ * @return
+ *      A reference to a new script locator object.
+ * @note
+ *      The copy can be kept as a saved state and later be given to SBScriptLocatorLoadState in
+ *      order to resume locating script runs from the same position.
+ */
+SBScriptLocatorRef SBScriptLocatorCopy(SBScriptLocatorRef locator);
+
 /**
  * Loads a code point sequence in the locator so that its script runs can be located.
  *
@@ -50,6 +64,38 @@ SBScriptLocatorRef SBScriptLocatorCreate(void);
  */
 void SBScriptLocatorLoadCodepoints(SBScriptLocatorRef locator, const SBCodepointSequence *codepointSequence);
 
+/**
+ * Loads a range of code point sequence in the locator so that its script runs can be located.
+ *
+ * @param locator
+ *      The locator in which the code point sequence will be loaded.
+ * @param codepointSequence
+ *      The code point sequence whose range will be loaded in the locator.
+ * @param rangeOffset
+ *      The index to the first code unit of the range in the code point sequence.
+ * @param rangeLength
+ *      The number of code units covering the length of the range.
+ * @note
+ *      The offsets of located script runs are relative to the start of code point sequence.
+ */
+void SBScriptLocatorLoadCodepointRange(SBScriptLocatorRef locator,
+    const SBCodepointSequence *codepointSequence, SBUInteger rangeOffset, SBUInteger rangeLength);
+
+/**
+ * Loads the position and the state of pending paired punctuations from another locator so that
+ * script runs can be located from where the other locator had reached.
+ *
+ * @param locator
+ *      The locator in which the state will be loaded.
+ * @param source
+ *      The locator, usually a copy saved earlier, whose state will be loaded.
+ * @note
+ *      The code point sequence of the locator is kept as it is, so it can be an edited version of
+ *      the source's one as long as the text before the saved position is unchanged. The saved
+ *      position must lie within the loaded range.
+ */
+void SBScriptLocatorLoadState(SBScriptLocatorRef locator, SBScriptLocatorRef source);
+
 /**
  * Returns the agent containing the information of current located script run.
  *
@@ -70,6 +116,27 @@ const SBScriptAgent *SBScriptLocatorGetAgent(SBScriptLocatorRef locator);
  */
 SBBoolean SBScriptLocatorMoveNext(SBScriptLocatorRef locator);
 
+/**
+ * Instructs the locator to find the remaining script runs in the loaded code point sequence and
+ * copy them into the given array.
+ *
+ * @param locator
+ *      The locator whom you want to instruct.
+ * @param runs
+ *      The array in which the script runs will be copied.
+ * @param capacity
+ *      The maximum number of script runs that can be copied into the array.
+ * @return
+ *      The number of script runs copied into the array.
+ * @note
+ *      The locator continues from its current position, so the runs of a long sequence can be
+ *      obtained by calling this function repeatedly until it returns 0. The agent contains the
+ *      last copied run afterwards.
+ * @note
+ *      The locator will be reset when no script run is left to copy.
+ */
+SBUInteger SBScriptLocatorCopyRuns(SBScriptLocatorRef locator, SBScriptAgent *runs, SBUInteger capacity);
+
 /**
  * Instructs the locator to reset itself so that script runs of the loaded line can be obatained
  * from the beginning.
@@ -19,13 +19,19 @@
 
 #include "SBAlgorithm.h"
 #include "SBBase.h"
+#include "SBBatch.h"
 #include "SBBidiType.h"
 #include "SBCodepoint.h"
 #include "SBCodepointSequence.h"
+#include "SBDocument.h"
 #include "SBGeneralCategory.h"
+#include "SBItemizer.h"
 #include "SBLine.h"
+#include "SBMappedFile.h"
 #include "SBMirrorLocator.h"
 #include "SBParagraph.h"
+#include "SBParagraphCache.h"
+#include "SBParagraphLocator.h"
 #include "SBRun.h"
 #include "SBScript.h"
 #include "SBScriptLocator.h"
@@ -12,5 +12,17 @@
 #include "SBBase.h"
 
 SB_INTERNAL SBBidiType LookupBidiType(SBCodepoint codepoint);
+SB_INTERNAL SBBidiType LookupBidiTypeBMP(SBUInt16 codeunit);
+
+#ifdef SB_CONFIG_ALL_LOOKUP_LAYOUTS
+
+SB_INTERNAL SBBidiType LookupBidiTypeTrie(SBCodepoint codepoint);
+SB_INTERNAL SBBidiType LookupBidiTypeTrieBMP(SBUInt16 codeunit);
+SB_INTERNAL SBBidiType LookupBidiTypePacked(SBCodepoint codepoint);
+SB_INTERNAL SBBidiType LookupBidiTypePackedBMP(SBUInt16 codeunit);
+SB_INTERNAL SBBidiType LookupBidiTypeTwoStage(SBCodepoint codepoint);
+SB_INTERNAL SBBidiType LookupBidiTypeTwoStageBMP(SBUInt16 codeunit);
+
+#endif
 
 #endif
@@ -26,25 +26,73 @@
 #include "SBLog.h"
 #include "IsolatingRun.h"
 
+/* Types which are changed by the rules W1-W3. */
+#define PrefixWeakTypesMask                 \
+(                                           \
+   SBBidiTypeMask(SBBidiTypeAL)             \
+ | SBBidiTypeMask(SBBidiTypeNSM)            \
+ | SBBidiTypeMask(SBBidiTypeEN)             \
+)
+
+/* Types which are changed by the rules W4-W7. */
+#define SuffixWeakTypesMask                 \
+(                                           \
+   SBBidiTypeMask(SBBidiTypeEN)             \
+ | SBBidiTypeMask(SBBidiTypeET)             \
+ | SBBidiTypeMask(SBBidiTypeES)             \
+ | SBBidiTypeMask(SBBidiTypeCS)             \
+)
+
+/* Types which can be neutral after resolving weak types. */
+#define NeutralTypesMask                    \
+(                                           \
+   SBBidiTypeMask(SBBidiTypeNSM)            \
+ | SBBidiTypeMask(SBBidiTypeET)             \
+ | SBBidiTypeMask(SBBidiTypeES)             \
+ | SBBidiTypeMask(SBBidiTypeCS)             \
+ | SBBidiTypeMask(SBBidiTypeWS)             \
+ | SBBidiTypeMask(SBBidiTypeS)              \
+ | SBBidiTypeMask(SBBidiTypeB)              \
+ | SBBidiTypeMask(SBBidiTypeON)             \
+ | SBBidiTypeMask(SBBidiTypeLRI)            \
+ | SBBidiTypeMask(SBBidiTypeRLI)            \
+ | SBBidiTypeMask(SBBidiTypeFSI)            \
+ | SBBidiTypeMask(SBBidiTypePDI)            \
+)
+
+/*
+ * Iterates over the links of an isolating run. The iteration starts from the first link of the base
+ * level run rather than from the roller so that the roller, which is shared by all isolating runs of
+ * the paragraph, is never touched.
+ */
+#define IsolatingRunForEachLink(isolatingRun, chain, link)              \
+    for (link = isolatingRun->baseLevelRun->firstLink;                  \
+         link != chain->roller;                                         \
+         link = BidiChainGetNext(chain, link))
+
 static void ResolveAvailableBracketPairs(IsolatingRunRef isolatingRun);
 
 static void AttachLevelRunLinks(IsolatingRunRef isolatingRun)
 {
     BidiChainRef chain = isolatingRun->bidiChain;
     LevelRunRef baseLevelRun = isolatingRun->baseLevelRun;
+    SBUInt32 typeMask = baseLevelRun->typeMask;
     LevelRunRef current;
     LevelRunRef next;
 
-    isolatingRun->_originalLink = BidiChainGetNext(chain, chain->roller);
-    BidiChainSetNext(chain, chain->roller, baseLevelRun->firstLink);
-
-    /* Iterate over level runs and attach their links to form an isolating run. */
+    /*
+     * Iterate over level runs and attach their links to form an isolating run.
+     * NOTE: Only the links owned by the isolating run are modified here. The last one is terminated
+     *       with the roller which works as a sentinel of type Nil for the rules looking ahead.
+     */
     for (current = baseLevelRun; (next = current->next); current = next) {
         BidiChainSetNext(chain, current->lastLink, next->firstLink);
+        typeMask |= next->typeMask;
     }
     BidiChainSetNext(chain, current->lastLink, chain->roller);
 
     isolatingRun->_lastLevelRun = current;
+    isolatingRun->_typeMask = typeMask;
     isolatingRun->_sos = RunExtrema_SOR(baseLevelRun->extrema);
 
     if (!RunKindIsPartialIsolate(baseLevelRun->kind)) {
@@ -62,14 +110,103 @@ static void AttachOriginalLinks(IsolatingRunRef isolatingRun)
     BidiChainRef chain = isolatingRun->bidiChain;
     LevelRunRef current;
 
-    BidiChainSetNext(chain, chain->roller, isolatingRun->_originalLink);
-
     /* Iterate over level runs and attach original subsequent links. */
     for (current = isolatingRun->baseLevelRun; current; current = current->next) {
         BidiChainSetNext(chain, current->lastLink, current->subsequentLink);
     }
 }
 
+typedef struct _NumberResolver {
+    BidiLink priorLink;
+    SBBidiType w4PriorType;
+    SBBidiType w5PriorType;
+    SBBidiType w7StrongType;
+} NumberResolver, *NumberResolverRef;
+
+static void NumberResolverInitialize(NumberResolverRef resolver, BidiLink roller, SBBidiType sos)
+{
+    resolver->priorLink = roller;
+    resolver->w4PriorType = sos;
+    resolver->w5PriorType = sos;
+    resolver->w7StrongType = sos;
+}
+
+/*
+ * Applies the rules W4-W7 on a link whose next link has already been resolved with the rules W1-W3
+ * and will no longer be merged with it.
+ */
+static void ResolveNumberTypes(BidiChainRef chain, NumberResolverRef resolver, BidiLink link)
+{
+    SBBidiType type = BidiChainGetType(chain, link);
+    SBBidiType nextType = BidiChainGetType(chain, BidiChainGetNext(chain, link));
+    SBBidiType w4PriorType = resolver->w4PriorType;
+
+    /*
+     * Rule W4
+     * NOTE: The extent of the link is checked at the end because it reads the types of in between
+     *       code units. It is only reached if the next link is a number of the same isolating run.
+     */
+    if (SBBidiTypeIsNumberSeparator(type)
+        && SBBidiTypeIsNumber(w4PriorType)
+        && (w4PriorType == nextType)
+        && (w4PriorType == SBBidiTypeEN || type == SBBidiTypeCS)
+        && BidiChainIsSingle(chain, link))
+    {
+        /* Change the current type as well because it can be EN on which W5 depends. */
+        type = w4PriorType;
+        BidiChainSetType(chain, link, type);
+    }
+    resolver->w4PriorType = type;
+
+    /* Rule W5 */
+    if (type == SBBidiTypeET && (resolver->w5PriorType == SBBidiTypeEN || nextType == SBBidiTypeEN)) {
+        /* Change the current type as well because it is EN on which W7 depends. */
+        type = SBBidiTypeEN;
+        BidiChainSetType(chain, link, type);
+    }
+    resolver->w5PriorType = type;
+
+    switch (type) {
+    /* Rule W6 */
+    case SBBidiTypeET:
+    case SBBidiTypeCS:
+    case SBBidiTypeES:
+        BidiChainSetType(chain, link, SBBidiTypeON);
+        break;
+
+    /*
+     * Rule W7
+     * NOTE: W7 is expected to be applied after W6. However this is not the case here. The
+     *       reason is that W6 can only create the type ON which is not tested in W7 by any
+     *       means. So it won't affect the algorithm.
+     */
+    case SBBidiTypeEN:
+        if (resolver->w7StrongType == SBBidiTypeL) {
+            BidiChainSetType(chain, link, SBBidiTypeL);
+        }
+        break;
+
+    /*
+     * Save the strong type for W7.
+     * NOTE: The strong type is expected to be saved after applying W7 because W7 itself creates
+     *       a strong type. However the strong type being saved here is based on the type after
+     *       W5. This won't effect the algorithm because a single link contains all consecutive
+     *       EN types. This means that even if W7 creates a strong type, it will be saved in
+     *       next iteration.
+     */
+    case SBBidiTypeL:
+    case SBBidiTypeR:
+        resolver->w7StrongType = type;
+        break;
+    }
+
+    if (type != SBBidiTypeON && BidiChainGetType(chain, resolver->priorLink) == type) {
+        BidiChainAbandonNext(chain, resolver->priorLink);
+    } else {
+        resolver->priorLink = link;
+    }
+}
+
 static BidiLink ResolveWeakTypes(IsolatingRunRef isolatingRun)
 {
     BidiChainRef chain = isolatingRun->bidiChain;
@@ -81,9 +218,9 @@ static BidiLink ResolveWeakTypes(IsolatingRunRef isolatingRun)
 
     SBBidiType w1PriorType;
     SBBidiType w2StrongType;
-    SBBidiType w4PriorType;
-    SBBidiType w5PriorType;
-    SBBidiType w7StrongType;
+
+    NumberResolver numberResolver;
+    SBBoolean resolvesNumbers;
 
     priorLink = roller;
     sos = isolatingRun->_sos;
@@ -91,7 +228,16 @@ static BidiLink ResolveWeakTypes(IsolatingRunRef isolatingRun)
     w1PriorType = sos;
     w2StrongType = sos;
 
-    BidiChainForEach(chain, roller, link) {
+    NumberResolverInitialize(&numberResolver, roller, sos);
+    /* Rules W4-W7 can only change separators, terminators and numbers. */
+    resolvesNumbers = ((isolatingRun->_typeMask & SuffixWeakTypesMask) != 0);
+
+    /*
+     * NOTE: The rules W4-W7 are applied in the same iteration, one link behind the rules W1-W3. A link
+     *       is handed over to them as soon as it is known that the next link will not be merged
+     *       with it, because they look at the type and the extent of the next link.
+     */
+    IsolatingRunForEachLink(isolatingRun, chain, link) {
         SBBidiType type = BidiChainGetType(chain, link);
         SBBoolean forceMerge = SBFalse;
 
@@ -131,79 +277,20 @@ static BidiLink ResolveWeakTypes(IsolatingRunRef isolatingRun)
         if ((type != SBBidiTypeON && BidiChainGetType(chain, priorLink) == type) || forceMerge) {
             BidiChainAbandonNext(chain, priorLink);
         } else {
+            if (resolvesNumbers && priorLink != roller) {
+                ResolveNumberTypes(chain, &numberResolver, priorLink);
+            }
+
             priorLink = link;
         }
     }
 
-    priorLink = roller;
-    w4PriorType = sos;
-    w5PriorType = sos;
-    w7StrongType = sos;
-
-    BidiChainForEach(chain, roller, link) {
-        SBBidiType type = BidiChainGetType(chain, link);
-        SBBidiType nextType = BidiChainGetType(chain, BidiChainGetNext(chain, link));
-
-        /* Rule W4 */
-        if (BidiChainIsSingle(chain, link)
-            && SBBidiTypeIsNumberSeparator(type)
-            && SBBidiTypeIsNumber(w4PriorType)
-            && (w4PriorType == nextType)
-            && (w4PriorType == SBBidiTypeEN || type == SBBidiTypeCS))
-        {
-            /* Change the current type as well because it can be EN on which W5 depends. */
-            type = w4PriorType;
-            BidiChainSetType(chain, link, type);
-        }
-        w4PriorType = type;
-
-        /* Rule W5 */
-        if (type == SBBidiTypeET && (w5PriorType == SBBidiTypeEN || nextType == SBBidiTypeEN)) {
-            /* Change the current type as well because it is EN on which W7 depends. */
-            type = SBBidiTypeEN;
-            BidiChainSetType(chain, link, type);
+    if (resolvesNumbers) {
+        if (priorLink != roller) {
+            ResolveNumberTypes(chain, &numberResolver, priorLink);
         }
-        w5PriorType = type;
-
-        switch (type) {
-        /* Rule W6 */
-        case SBBidiTypeET:
-        case SBBidiTypeCS:
-        case SBBidiTypeES:
-            BidiChainSetType(chain, link, SBBidiTypeON);
-            break;
 
-        /*
-         * Rule W7
-         * NOTE: W7 is expected to be applied after W6. However this is not the case here. The
-         *       reason is that W6 can only create the type ON which is not tested in W7 by any
-         *       means. So it won't affect the algorithm.
-         */
-        case SBBidiTypeEN:
-            if (w7StrongType == SBBidiTypeL) {
-                BidiChainSetType(chain, link, SBBidiTypeL);
-            }
-            break;
-
-        /*
-         * Save the strong type for W7.
-         * NOTE: The strong type is expected to be saved after applying W7 because W7 itself creates
-         *       a strong type. However the strong type being saved here is based on the type after
-         *       W5. This won't effect the algorithm because a single link contains all consecutive
-         *       EN types. This means that even if W7 creates a strong type, it will be saved in
-         *       next iteration.
-         */
-        case SBBidiTypeL:
-        case SBBidiTypeR:
-            w7StrongType = type;
-            break;
-        }
-
-        if (type != SBBidiTypeON && BidiChainGetType(chain, priorLink) == type) {
-            BidiChainAbandonNext(chain, priorLink);
-        } else {
-            priorLink = link;
-        }
+        return numberResolver.priorLink;
     }
 
     return priorLink;
@@ -215,7 +302,6 @@ static SBBoolean ResolveBrackets(IsolatingRunRef isolatingRun)
     SBUInteger paragraphOffset = isolatingRun->paragraphOffset;
     BracketQueueRef queue = &isolatingRun->_bracketQueue;
     BidiChainRef chain = isolatingRun->bidiChain;
-    BidiLink roller = chain->roller;
     BidiLink link;
 
     BidiLink priorStrongLink;
@@ -226,7 +312,7 @@ static SBBoolean ResolveBrackets(IsolatingRunRef isolatingRun)
 
     BracketQueueReset(queue, SBLevelAsNormalBidiType(runLevel));
 
-    BidiChainForEach(chain, roller, link) {
+    IsolatingRunForEachLink(isolatingRun, chain, link) {
         SBUInteger stringIndex;
         SBCodepoint codepoint;
         SBBidiType type;
@@ -366,10 +452,31 @@ static void ResolveAvailableBracketPairs(IsolatingRunRef isolatingRun)
     }
 }
 
+static void ResolveImplicitLevel(BidiChainRef chain, BidiLink link, SBLevel runLevel)
+{
+    SBBidiType type = BidiChainGetType(chain, link);
+    SBLevel level = BidiChainGetLevel(chain, link);
+
+    SBAssert(SBBidiTypeIsStrongOrNumber(type));
+
+    if ((runLevel & 1) == 0) {
+        /* Rule I1 */
+        if (type == SBBidiTypeR) {
+            BidiChainSetLevel(chain, link, level + 1);
+        } else if (type != SBBidiTypeL) {
+            BidiChainSetLevel(chain, link, level + 2);
+        }
+    } else {
+        /* Rule I2 */
+        if (type != SBBidiTypeR) {
+            BidiChainSetLevel(chain, link, level + 1);
+        }
+    }
+}
+
 static void ResolveNeutrals(IsolatingRunRef isolatingRun)
 {
     BidiChainRef chain = isolatingRun->bidiChain;
-    BidiLink roller = chain->roller;
     BidiLink link;
 
     SBLevel runLevel;
@@ -380,7 +487,11 @@ static void ResolveNeutrals(IsolatingRunRef isolatingRun)
     strongType = isolatingRun->_sos;
     neutralLink = BidiLinkNone;
 
-    BidiChainForEach(chain, roller, link) {
+    /*
+     * NOTE: The implicit levels are resolved in the same iteration, as soon as the final type of a
+     *       link is known.
+     */
+    IsolatingRunForEachLink(isolatingRun, chain, link) {
         SBBidiType type = BidiChainGetType(chain, link);
         SBBidiType nextType;
 
@@ -389,20 +500,22 @@ static void ResolveNeutrals(IsolatingRunRef isolatingRun)
         switch (type) {
         case SBBidiTypeL:
             strongType = SBBidiTypeL;
+            ResolveImplicitLevel(chain, link, runLevel);
             break;
 
         case SBBidiTypeR:
         case SBBidiTypeEN:
         case SBBidiTypeAN:
             strongType = SBBidiTypeR;
+            ResolveImplicitLevel(chain, link, runLevel);
             break;
 
-        case SBBidiTypeB:                           
+        case SBBidiTypeB:
         case SBBidiTypeS:
         case SBBidiTypeWS:
         case SBBidiTypeON:
         case SBBidiTypeLRI:
-        case SBBidiTypeRLI:                         
+        case SBBidiTypeRLI:
         case SBBidiTypeFSI:
         case SBBidiTypePDI:
             if (neutralLink == BidiLinkNone) {
@@ -424,6 +537,8 @@ static void ResolveNeutrals(IsolatingRunRef isolatingRun)
 
                 do {
                     BidiChainSetType(chain, neutralLink, resolvedType);
+                    ResolveImplicitLevel(chain, neutralLink, runLevel);
+
                     neutralLink = BidiChainGetNext(chain, neutralLink);
                 } while (neutralLink != BidiChainGetNext(chain, link));
 
@@ -434,40 +549,28 @@ static void ResolveNeutrals(IsolatingRunRef isolatingRun)
     }
 }
 
+static SBBoolean NeedsImplicitLevels(IsolatingRunRef isolatingRun)
+{
+    SBUInt32 typeMask = isolatingRun->_typeMask;
+    SBLevel runLevel = isolatingRun->baseLevelRun->level;
+
+    /* The levels remain unchanged if all the types agree with the embedding direction. */
+    if ((runLevel & 1) == 0) {
+        return (typeMask & ~SBBidiTypeMask(SBBidiTypeL)) != 0;
+    }
+
+    return (typeMask & ~(SBBidiTypeMask(SBBidiTypeR) | SBBidiTypeMask(SBBidiTypeAL))) != 0;
+}
+
 static void ResolveImplicitLevels(IsolatingRunRef isolatingRun)
 {
     BidiChainRef chain = isolatingRun->bidiChain;
-    BidiLink roller = chain->roller;
     BidiLink link;
 
     SBLevel runLevel = isolatingRun->baseLevelRun->level;
-    
-    if ((runLevel & 1) == 0) {
-        BidiChainForEach(chain, roller, link) {
-            SBBidiType type = BidiChainGetType(chain, link);
-            SBLevel level = BidiChainGetLevel(chain, link);
-            
-            SBAssert(SBBidiTypeIsStrongOrNumber(type));
-            
-            /* Rule I1 */
-            if (type == SBBidiTypeR) {
-                BidiChainSetLevel(chain, link, level + 1);
-            } else if (type != SBBidiTypeL) {
-                BidiChainSetLevel(chain, link, level + 2);
-            }
-        }
-    } else {
-        BidiChainForEach(chain, roller, link) {
-            SBBidiType type = BidiChainGetType(chain, link);
-            SBLevel level = BidiChainGetLevel(chain, link);
-            
-            SBAssert(SBBidiTypeIsStrongOrNumber(type));
-            
-            /* Rule I2 */
-            if (type != SBBidiTypeR) {
-                BidiChainSetLevel(chain, link, level + 1);
-            }
-        }
+
+    IsolatingRunForEachLink(isolatingRun, chain, link) {
+        ResolveImplicitLevel(chain, link, runLevel);
     }
 }
 
@@ -494,32 +597,51 @@ SB_INTERNAL SBBoolean IsolatingRunResolve(IsolatingRunRef isolatingRun)
     SB_LOG_STATEMENT("SOS", 1, SB_LOG_BIDI_TYPE(isolatingRun->_sos));
     SB_LOG_STATEMENT("EOS", 1, SB_LOG_BIDI_TYPE(isolatingRun->_eos));
 
+    /*
+     * NOTE: The rules are skipped if the isolating run does not contain any type on which they can
+     *       make a change. The rules W4-W7 expect the links merged by W1-W3, so both of them are
+     *       applied in a single iteration.
+     */
+
     /* Rules W1-W7 */
-    lastLink = ResolveWeakTypes(isolatingRun);
-    SB_LOG_BLOCK_OPENER("Resolved Weak Types");
-    SB_LOG_STATEMENT("Types", 1, SB_LOG_RUN_TYPES(isolatingRun));
-    SB_LOG_BLOCK_CLOSER();
+    if (isolatingRun->_typeMask & (PrefixWeakTypesMask | SuffixWeakTypesMask)) {
+        lastLink = ResolveWeakTypes(isolatingRun);
+        SB_LOG_BLOCK_OPENER("Resolved Weak Types");
+        SB_LOG_STATEMENT("Types", 1, SB_LOG_RUN_TYPES(isolatingRun));
+        SB_LOG_BLOCK_CLOSER();
+    } else {
+        lastLink = isolatingRun->_lastLevelRun->lastLink;
+    }
 
     /* Rule N0 */
-    if (!ResolveBrackets(isolatingRun)) {
-        return SBFalse;
-    }
+    if (isolatingRun->_typeMask & SBBidiTypeMask(SBBidiTypeON)) {
+        if (!ResolveBrackets(isolatingRun)) {
+            return SBFalse;
+        }
 
-    SB_LOG_BLOCK_OPENER("Resolved Brackets");
-    SB_LOG_STATEMENT("Types", 1, SB_LOG_RUN_TYPES(isolatingRun));
-    SB_LOG_BLOCK_CLOSER();
+        SB_LOG_BLOCK_OPENER("Resolved Brackets");
+        SB_LOG_STATEMENT("Types", 1, SB_LOG_RUN_TYPES(isolatingRun));
+        SB_LOG_BLOCK_CLOSER();
+    }
 
-    /* Rules N1, N2 */
-    ResolveNeutrals(isolatingRun);
-    SB_LOG_BLOCK_OPENER("Resolved Neutrals");
-    SB_LOG_STATEMENT("Types", 1, SB_LOG_RUN_TYPES(isolatingRun));
-    SB_LOG_BLOCK_CLOSER();
+    /* Rules N1, N2, I1, I2 */
+    if (isolatingRun->_typeMask & NeutralTypesMask) {
+        ResolveNeutrals(isolatingRun);
+        SB_LOG_BLOCK_OPENER("Resolved Neutrals");
+        SB_LOG_STATEMENT("Types", 1, SB_LOG_RUN_TYPES(isolatingRun));
+        SB_LOG_BLOCK_CLOSER();
 
+        SB_LOG_BLOCK_OPENER("Resolved Implicit Levels");
+        SB_LOG_STATEMENT("Levels", 1, SB_LOG_RUN_LEVELS(isolatingRun));
+        SB_LOG_BLOCK_CLOSER();
+    }
     /* Rules I1, I2 */
-    ResolveImplicitLevels(isolatingRun);
-    SB_LOG_BLOCK_OPENER("Resolved Implicit Levels");
-    SB_LOG_STATEMENT("Levels", 1, SB_LOG_RUN_LEVELS(isolatingRun));
-    SB_LOG_BLOCK_CLOSER();
+    else if (NeedsImplicitLevels(isolatingRun)) {
+        ResolveImplicitLevels(isolatingRun);
+        SB_LOG_BLOCK_OPENER("Resolved Implicit Levels");
+        SB_LOG_STATEMENT("Levels", 1, SB_LOG_RUN_LEVELS(isolatingRun));
+        SB_LOG_BLOCK_CLOSER();
+    }
 
     /* Re-attach original links. */
     AttachOriginalLinks(isolatingRun);
@@ -33,7 +33,7 @@ typedef struct _IsolatingRun {
     LevelRunRef _lastLevelRun;
     BracketQueue _bracketQueue;
     SBUInteger paragraphOffset;
-    BidiLink _originalLink;
+    SBUInt32 _typeMask;
     SBBidiType _sos;
     SBBidiType _eos;
     SBLevel paragraphLevel;
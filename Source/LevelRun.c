@@ -25,7 +25,7 @@
 
 SB_INTERNAL void LevelRunInitialize(LevelRunRef levelRun,
     BidiChainRef bidiChain, BidiLink firstLink, BidiLink lastLink,
-    SBBidiType sor, SBBidiType eor)
+    SBUInt32 typeMask, SBBidiType sor, SBBidiType eor)
 {
     SBBidiType firstType = BidiChainGetType(bidiChain, firstLink);
     SBBidiType lastType = BidiChainGetType(bidiChain, lastLink);
@@ -34,6 +34,7 @@ SB_INTERNAL void LevelRunInitialize(LevelRunRef levelRun,
     levelRun->firstLink = firstLink;
     levelRun->lastLink = lastLink;
     levelRun->subsequentLink = BidiChainGetNext(bidiChain, lastLink);
+    levelRun->typeMask = typeMask;
     levelRun->extrema = RunExtremaMake(sor, eor);
     levelRun->kind = RunKindMake
                      (
@@ -29,6 +29,7 @@ typedef struct _LevelRun {
     BidiLink firstLink;       /**< First link of the run. */
     BidiLink lastLink;        /**< Last link of the run. */
     BidiLink subsequentLink;  /**< Subsequent link of the run. */
+    SBUInt32 typeMask;        /**< Mask of the bidi types present in the run. */
     RunExtrema extrema;
     RunKind kind;
     SBLevel level;
@@ -36,7 +37,7 @@ typedef struct _LevelRun {
 
 SB_INTERNAL void LevelRunInitialize(LevelRunRef levelRun,
     BidiChainRef bidiChain, BidiLink firstLink, BidiLink lastLink,
-    SBBidiType sor, SBBidiType eor);
+    SBUInt32 typeMask, SBBidiType sor, SBBidiType eor);
 SB_INTERNAL void LevelRunAttach(LevelRunRef levelRun, LevelRunRef next);
 
 #endif
@@ -3,16 +3,32 @@
  * DO NOT EDIT!!
  *
  * REQUIRED MEMORY: (37)+2310+(617*2) = 3618 Bytes
+ * RANGES LAYOUT MEMORY: (37)+(513*2)+513 = 1613 Bytes
  */
 
 #include "PairingLookup.h"
 
+#ifdef SB_CONFIG_ALL_LOOKUP_LAYOUTS
+#define PAIRING_TABLE_LAYOUT
+#define PAIRING_RANGES_LAYOUT
+#define LAYOUT_FUNCTION SB_INTERNAL
+#else
+#ifdef SB_CONFIG_PAIRING_RANGES
+#define PAIRING_RANGES_LAYOUT
+#else
+#define PAIRING_TABLE_LAYOUT
+#endif
+#define LAYOUT_FUNCTION static
+#endif
+
 static const SBInt16 PairDifferences[37] = {
     0,     1,     -1,    2,     -2,    16,    -16,   3,     -3,    2016,  2527,  1923,  1914,  1918,
     2250,  138,   7,     -7,    1824,  2104,  2108,  2106,  1316,  -138,  8,     -8,    -1316,
     -1914, -1918, -1923, -1824, -2016, -2104, -2106, -2108, -2250, -2527
 };
 
+#ifdef PAIRING_TABLE_LAYOUT
+
 static const SBUInt8 PairData[2310] = {
 /* DATA_BLOCK: -- 0x0000..0x0069 -- */
     0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
@@ -224,15 +240,95 @@ static const SBUInt16 PairIndexes[617] = {
     0x00D4, 0x00D4, 0x07DE, 0x0848, 0x08B2
 };
 
-SB_INTERNAL SBCodepoint LookupMirror(SBCodepoint codepoint)
+#endif
+
+#ifdef PAIRING_RANGES_LAYOUT
+
+static const SBUInt16 PairRangeStarts[513] = {
+    0x0000, 0x0028, 0x0029, 0x002A, 0x003C, 0x003D, 0x003E, 0x003F, 0x005B, 0x005C, 0x005D, 0x005E,
+    0x007B, 0x007C, 0x007D, 0x007E, 0x00AB, 0x00AC, 0x00BB, 0x00BC, 0x0F3A, 0x0F3B, 0x0F3C, 0x0F3D,
+    0x0F3E, 0x169B, 0x169C, 0x169D, 0x2039, 0x203A, 0x203B, 0x2045, 0x2046, 0x2047, 0x207D, 0x207E,
+    0x207F, 0x208D, 0x208E, 0x208F, 0x2208, 0x220B, 0x220E, 0x2215, 0x2216, 0x221F, 0x2220, 0x2221,
+    0x2222, 0x2223, 0x2224, 0x2225, 0x223C, 0x223D, 0x223E, 0x2243, 0x2244, 0x2245, 0x2246, 0x224C,
+    0x224D, 0x2252, 0x2253, 0x2254, 0x2255, 0x2256, 0x2264, 0x2265, 0x2266, 0x2267, 0x2268, 0x2269,
+    0x226A, 0x226B, 0x226C, 0x226E, 0x226F, 0x2270, 0x2271, 0x2272, 0x2273, 0x2274, 0x2275, 0x2276,
+    0x2277, 0x2278, 0x2279, 0x227A, 0x227B, 0x227C, 0x227D, 0x227E, 0x227F, 0x2280, 0x2281, 0x2282,
+    0x2283, 0x2284, 0x2285, 0x2286, 0x2287, 0x2288, 0x2289, 0x228A, 0x228B, 0x228C, 0x228F, 0x2290,
+    0x2291, 0x2292, 0x2293, 0x2298, 0x2299, 0x22A2, 0x22A3, 0x22A4, 0x22A6, 0x22A7, 0x22A8, 0x22A9,
+    0x22AA, 0x22AB, 0x22AC, 0x22B0, 0x22B1, 0x22B2, 0x22B3, 0x22B4, 0x22B5, 0x22B6, 0x22B7, 0x22B8,
+    0x22B9, 0x22C9, 0x22CA, 0x22CB, 0x22CC, 0x22CD, 0x22CE, 0x22D0, 0x22D1, 0x22D2, 0x22D6, 0x22D7,
+    0x22D8, 0x22D9, 0x22DA, 0x22DB, 0x22DC, 0x22DD, 0x22DE, 0x22DF, 0x22E0, 0x22E1, 0x22E2, 0x22E3,
+    0x22E4, 0x22E5, 0x22E6, 0x22E7, 0x22E8, 0x22E9, 0x22EA, 0x22EB, 0x22EC, 0x22ED, 0x22EE, 0x22F0,
+    0x22F1, 0x22F2, 0x22F5, 0x22F6, 0x22F8, 0x22FA, 0x22FD, 0x22FF, 0x2308, 0x2309, 0x230A, 0x230B,
+    0x230C, 0x2329, 0x232A, 0x232B, 0x2768, 0x2769, 0x276A, 0x276B, 0x276C, 0x276D, 0x276E, 0x276F,
+    0x2770, 0x2771, 0x2772, 0x2773, 0x2774, 0x2775, 0x2776, 0x27C3, 0x27C4, 0x27C5, 0x27C6, 0x27C7,
+    0x27C8, 0x27C9, 0x27CA, 0x27CB, 0x27CC, 0x27CD, 0x27CE, 0x27D5, 0x27D6, 0x27D7, 0x27DC, 0x27DD,
+    0x27DE, 0x27DF, 0x27E2, 0x27E3, 0x27E4, 0x27E5, 0x27E6, 0x27E7, 0x27E8, 0x27E9, 0x27EA, 0x27EB,
+    0x27EC, 0x27ED, 0x27EE, 0x27EF, 0x27F0, 0x2983, 0x2984, 0x2985, 0x2986, 0x2987, 0x2988, 0x2989,
+    0x298A, 0x298B, 0x298C, 0x298D, 0x298E, 0x298F, 0x2990, 0x2991, 0x2992, 0x2993, 0x2994, 0x2995,
+    0x2996, 0x2997, 0x2998, 0x2999, 0x299B, 0x299C, 0x29A0, 0x29A1, 0x29A3, 0x29A4, 0x29A5, 0x29A6,
+    0x29A8, 0x29A9, 0x29AA, 0x29AB, 0x29AC, 0x29AD, 0x29AE, 0x29AF, 0x29B0, 0x29B8, 0x29B9, 0x29C0,
+    0x29C1, 0x29C2, 0x29C4, 0x29C5, 0x29C6, 0x29CF, 0x29D0, 0x29D1, 0x29D2, 0x29D3, 0x29D4, 0x29D5,
+    0x29D6, 0x29D8, 0x29D9, 0x29DA, 0x29DB, 0x29DC, 0x29E8, 0x29E9, 0x29EA, 0x29F5, 0x29F6, 0x29F8,
+    0x29F9, 0x29FA, 0x29FC, 0x29FD, 0x29FE, 0x2A2B, 0x2A2C, 0x2A2D, 0x2A2E, 0x2A2F, 0x2A34, 0x2A35,
+    0x2A36, 0x2A3C, 0x2A3D, 0x2A3E, 0x2A64, 0x2A65, 0x2A66, 0x2A79, 0x2A7A, 0x2A7B, 0x2A7C, 0x2A7D,
+    0x2A7E, 0x2A7F, 0x2A80, 0x2A81, 0x2A82, 0x2A83, 0x2A84, 0x2A85, 0x2A86, 0x2A87, 0x2A88, 0x2A89,
+    0x2A8A, 0x2A8B, 0x2A8C, 0x2A8D, 0x2A8E, 0x2A8F, 0x2A90, 0x2A91, 0x2A92, 0x2A93, 0x2A94, 0x2A95,
+    0x2A96, 0x2A97, 0x2A98, 0x2A99, 0x2A9A, 0x2A9B, 0x2A9C, 0x2A9D, 0x2A9E, 0x2A9F, 0x2AA0, 0x2AA1,
+    0x2AA2, 0x2AA3, 0x2AA6, 0x2AA7, 0x2AA8, 0x2AA9, 0x2AAA, 0x2AAB, 0x2AAC, 0x2AAD, 0x2AAE, 0x2AAF,
+    0x2AB0, 0x2AB1, 0x2AB2, 0x2AB3, 0x2AB4, 0x2AB5, 0x2AB6, 0x2AB7, 0x2AB8, 0x2AB9, 0x2ABA, 0x2ABB,
+    0x2ABC, 0x2ABD, 0x2ABE, 0x2ABF, 0x2AC0, 0x2AC1, 0x2AC2, 0x2AC3, 0x2AC4, 0x2AC5, 0x2AC6, 0x2AC7,
+    0x2AC8, 0x2AC9, 0x2ACA, 0x2ACB, 0x2ACC, 0x2ACD, 0x2ACE, 0x2ACF, 0x2AD0, 0x2AD1, 0x2AD2, 0x2AD3,
+    0x2AD4, 0x2AD5, 0x2AD6, 0x2AD7, 0x2ADE, 0x2ADF, 0x2AE3, 0x2AE4, 0x2AE5, 0x2AE6, 0x2AEC, 0x2AED,
+    0x2AEE, 0x2AEF, 0x2AF7, 0x2AF8, 0x2AF9, 0x2AFA, 0x2AFB, 0x2BFE, 0x2BFF, 0x2E02, 0x2E03, 0x2E04,
+    0x2E05, 0x2E06, 0x2E09, 0x2E0A, 0x2E0B, 0x2E0C, 0x2E0D, 0x2E0E, 0x2E1C, 0x2E1D, 0x2E1E, 0x2E20,
+    0x2E21, 0x2E22, 0x2E23, 0x2E24, 0x2E25, 0x2E26, 0x2E27, 0x2E28, 0x2E29, 0x2E2A, 0x2E55, 0x2E56,
+    0x2E57, 0x2E58, 0x2E59, 0x2E5A, 0x2E5B, 0x2E5C, 0x2E5D, 0x3008, 0x3009, 0x300A, 0x300B, 0x300C,
+    0x300D, 0x300E, 0x300F, 0x3010, 0x3011, 0x3012, 0x3014, 0x3015, 0x3016, 0x3017, 0x3018, 0x3019,
+    0x301A, 0x301B, 0x301C, 0xFE59, 0xFE5A, 0xFE5B, 0xFE5C, 0xFE5D, 0xFE5E, 0xFE5F, 0xFE64, 0xFE65,
+    0xFE66, 0xFF08, 0xFF09, 0xFF0A, 0xFF1C, 0xFF1D, 0xFF1E, 0xFF1F, 0xFF3B, 0xFF3C, 0xFF3D, 0xFF3E,
+    0xFF5B, 0xFF5C, 0xFF5D, 0xFF5E, 0xFF5F, 0xFF60, 0xFF61, 0xFF62, 0xFF63
+};
+
+static const SBUInt8 PairRangeData[513] = {
+    0,   65,  130, 0,   3,   0,   4,   0,   67,  0,   132, 0,   67,  0,   132, 0,   5,   0,   6,
+    0,   65,  130, 65,  130, 0,   65,  130, 0,   1,   2,   0,   65,  130, 0,   65,  130, 0,   65,
+    130, 0,   7,   8,   0,   9,   0,   10,  11,  12,  13,  0,   14,  0,   1,   2,   0,   15,  0,
+    16,  0,   17,  0,   1,   2,   1,   2,   0,   1,   2,   1,   2,   1,   2,   1,   2,   0,   1,
+    2,   1,   2,   1,   2,   1,   2,   1,   2,   1,   2,   1,   2,   1,   2,   1,   2,   1,   2,
+    1,   2,   1,   2,   1,   2,   1,   2,   1,   2,   0,   1,   2,   1,   2,   0,   18,  0,   1,
+    2,   0,   19,  0,   20,  21,  0,   21,  0,   1,   2,   1,   2,   1,   2,   1,   2,   22,  0,
+    1,   2,   1,   2,   23,  0,   1,   2,   0,   1,   2,   1,   2,   1,   2,   1,   2,   1,   2,
+    1,   2,   1,   2,   1,   2,   1,   2,   1,   2,   1,   2,   1,   2,   0,   1,   2,   24,  0,
+    16,  0,   25,  17,  0,   65,  130, 65,  130, 0,   65,  130, 0,   65,  130, 65,  130, 65,  130,
+    65,  130, 65,  130, 65,  130, 65,  130, 0,   1,   2,   65,  130, 0,   1,   2,   0,   3,   0,
+    4,   0,   1,   2,   0,   26,  1,   2,   0,   1,   2,   1,   2,   65,  130, 65,  130, 65,  130,
+    65,  130, 65,  130, 0,   65,  130, 65,  130, 65,  130, 65,  130, 65,  130, 71,  129, 66,  136,
+    65,  130, 65,  130, 65,  130, 65,  130, 0,   27,  0,   28,  0,   29,  1,   2,   0,   1,   2,
+    1,   2,   1,   2,   1,   2,   0,   30,  0,   1,   2,   0,   1,   2,   0,   1,   2,   1,   2,
+    0,   1,   2,   0,   65,  130, 65,  130, 0,   1,   2,   0,   31,  0,   1,   2,   0,   65,  130,
+    0,   1,   2,   1,   2,   0,   1,   2,   0,   1,   2,   0,   1,   2,   0,   1,   2,   1,   2,
+    1,   2,   1,   2,   1,   2,   1,   2,   1,   2,   1,   2,   1,   2,   1,   2,   1,   2,   1,
+    2,   1,   2,   1,   2,   1,   2,   1,   2,   1,   2,   1,   2,   1,   2,   1,   2,   1,   2,
+    0,   1,   2,   1,   2,   1,   2,   1,   2,   0,   1,   2,   1,   2,   1,   2,   1,   2,   1,
+    2,   1,   2,   1,   2,   1,   2,   1,   2,   1,   2,   1,   2,   1,   2,   1,   2,   1,   2,
+    1,   2,   1,   2,   1,   2,   1,   2,   1,   2,   1,   2,   0,   32,  0,   33,  34,  33,  0,
+    1,   2,   35,  0,   1,   2,   1,   2,   0,   36,  0,   1,   2,   1,   2,   0,   1,   2,   0,
+    1,   2,   0,   1,   2,   0,   1,   2,   65,  130, 65,  130, 65,  130, 65,  130, 0,   65,  130,
+    65,  130, 65,  130, 65,  130, 0,   65,  130, 65,  130, 65,  130, 65,  130, 65,  130, 0,   65,
+    130, 65,  130, 65,  130, 65,  130, 0,   65,  130, 65,  130, 65,  130, 0,   1,   2,   0,   65,
+    130, 0,   3,   0,   4,   0,   67,  0,   132, 0,   67,  0,   132, 0,   65,  130, 0,   65,  130
+};
+
+#endif
+
+#ifdef PAIRING_TABLE_LAYOUT
+
+LAYOUT_FUNCTION SBCodepoint LookupMirrorTable(SBCodepoint codepoint)
 {
     if (codepoint <= 0xFF63) {
         SBInt16 diff = PairDifferences[
-                        PairData[
-                         PairIndexes[
-                              codepoint / 0x06A
-                         ] + (codepoint % 0x06A)
-                        ] & BracketTypeInverseMask
+                        PairData[PairIndexes[codepoint / 0x06A] + (codepoint % 0x06A)] & BracketTypeInverseMask
                        ];
 
         if (diff != 0) {
@@ -243,14 +339,63 @@ SB_INTERNAL SBCodepoint LookupMirror(SBCodepoint codepoint)
     return 0;
 }
 
-SB_INTERNAL SBCodepoint LookupBracketPair(SBCodepoint codepoint, BracketType *type)
+LAYOUT_FUNCTION SBCodepoint LookupBracketPairTable(SBCodepoint codepoint, BracketType *type)
 {
     if (codepoint <= 0xFF63) {
-        SBUInt8 data = PairData[
-                        PairIndexes[
-                             codepoint / 0x06A
-                        ] + (codepoint % 0x06A)
+        SBUInt8 data = PairData[PairIndexes[codepoint / 0x06A] + (codepoint % 0x06A)];
+        *type = (data & BracketTypePrimaryMask);
+
+        if (*type != 0) {
+            SBInt16 diff = PairDifferences[
+                            data & BracketTypeInverseMask
+                           ];
+            return (codepoint + diff);
+        }
+    } else {
+        *type = BracketTypeNone;
+    }
+
+    return 0;
+}
+
+#endif
+
+#ifdef PAIRING_RANGES_LAYOUT
+
+static SBUInt8 SearchPairRange(SBCodepoint codepoint)
+{
+    const SBUInt16 *start = PairRangeStarts;
+    SBUInteger length = 513;
+
+    /* Narrow down the range without branching on the comparison. */
+    while (length > 1) {
+        SBUInteger half = length / 2;
+        start = (start[half] <= codepoint ? start + half : start);
+        length -= half;
+    }
+
+    return PairRangeData[start - PairRangeStarts];
+}
+
+LAYOUT_FUNCTION SBCodepoint LookupMirrorRanges(SBCodepoint codepoint)
+{
+    if (codepoint <= 0xFF63) {
+        SBInt16 diff = PairDifferences[
+                        SearchPairRange(codepoint) & BracketTypeInverseMask
                        ];
+
+        if (diff != 0) {
+            return (codepoint + diff);
+        }
+    }
+
+    return 0;
+}
+
+LAYOUT_FUNCTION SBCodepoint LookupBracketPairRanges(SBCodepoint codepoint, BracketType *type)
+{
+    if (codepoint <= 0xFF63) {
+        SBUInt8 data = SearchPairRange(codepoint);
         *type = (data & BracketTypePrimaryMask);
 
         if (*type != 0) {
@@ -265,3 +410,27 @@ SB_INTERNAL SBCodepoint LookupBracketPair(SBCodepoint codepoint, BracketType *ty
 
     return 0;
 }
+
+#endif
+
+SB_INTERNAL SBCodepoint LookupMirror(SBCodepoint codepoint)
+{
+#ifdef SB_CONFIG_PAIRING_RANGES
+    return LookupMirrorRanges(codepoint);
+#else
+    return LookupMirrorTable(codepoint);
+#endif
+}
+
+SB_INTERNAL SBCodepoint LookupBracketPair(SBCodepoint codepoint, BracketType *type)
+{
+#ifdef SB_CONFIG_PAIRING_RANGES
+    return LookupBracketPairRanges(codepoint, type);
+#else
+    return LookupBracketPairTable(codepoint, type);
+#endif
+}
+
+#undef PAIRING_TABLE_LAYOUT
+#undef PAIRING_RANGES_LAYOUT
+#undef LAYOUT_FUNCTION
@@ -14,4 +14,13 @@
 SB_INTERNAL SBCodepoint LookupMirror(SBCodepoint codepoint);
 SB_INTERNAL SBCodepoint LookupBracketPair(SBCodepoint codepoint, BracketType *bracketType);
 
+#ifdef SB_CONFIG_ALL_LOOKUP_LAYOUTS
+
+SB_INTERNAL SBCodepoint LookupMirrorTable(SBCodepoint codepoint);
+SB_INTERNAL SBCodepoint LookupBracketPairTable(SBCodepoint codepoint, BracketType *bracketType);
+SB_INTERNAL SBCodepoint LookupMirrorRanges(SBCodepoint codepoint);
+SB_INTERNAL SBCodepoint LookupBracketPairRanges(SBCodepoint codepoint, BracketType *bracketType);
+
+#endif
+
 #endif
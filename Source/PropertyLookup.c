@@ -0,0 +1,4646 @@
+/*
+ * Automatically generated by SheenBidiGenerator tool.
+ * DO NOT EDIT!!
+ *
+ * REQUIRED MEMORY: (37*2)+(741*4)+(16976*2)+(3840*2)+(2176*2) = 49022 Bytes
+ */
+
+#include <SBBidiType.h>
+#include <SBGeneralCategory.h>
+#include <SBScript.h>
+
+#include "PropertyLookup.h"
+
+static const SBInt16 PropertyPairDifferences[37] = {
+    0,     1,     -1,    2,     -2,    16,    -16,   3,     -3,    2016,  2527,  1923,  1914,  1918,
+    2250,  138,   7,     -7,    1824,  2104,  2108,  2106,  1316,  -138,  8,     -8,    -1316,
+    -1914, -1918, -1923, -1824, -2016, -2104, -2106, -2108, -2250, -2527
+};
+
+static const PropertyRecord PropertyRecords[741] = {
+    { SBBidiTypeON, SBGeneralCategoryCN, SBScriptZZZZ, 0x00 },
+    { SBBidiTypeBN, SBGeneralCategoryCC, SBScriptZYYY, 0x00 },
+    { SBBidiTypeS, SBGeneralCategoryCC, SBScriptZYYY, 0x00 },
+    { SBBidiTypeB, SBGeneralCategoryCC, SBScriptZYYY, 0x00 },
+    { SBBidiTypeWS, SBGeneralCategoryCC, SBScriptZYYY, 0x00 },
+    { SBBidiTypeWS, SBGeneralCategoryZS, SBScriptZYYY, 0x00 },
+    { SBBidiTypeON, SBGeneralCategoryPO, SBScriptZYYY, 0x00 },
+    { SBBidiTypeET, SBGeneralCategoryPO, SBScriptZYYY, 0x00 },
+    { SBBidiTypeET, SBGeneralCategorySC, SBScriptZYYY, 0x00 },
+    { SBBidiTypeON, SBGeneralCategoryPS, SBScriptZYYY, 0x41 },
+    { SBBidiTypeON, SBGeneralCategoryPE, SBScriptZYYY, 0x82 },
+    { SBBidiTypeES, SBGeneralCategorySM, SBScriptZYYY, 0x00 },
+    { SBBidiTypeCS, SBGeneralCategoryPO, SBScriptZYYY, 0x00 },
+    { SBBidiTypeES, SBGeneralCategoryPD, SBScriptZYYY, 0x00 },
+    { SBBidiTypeEN, SBGeneralCategoryND, SBScriptZYYY, 0x00 },
+    { SBBidiTypeON, SBGeneralCategorySM, SBScriptZYYY, 0x03 },
+    { SBBidiTypeON, SBGeneralCategorySM, SBScriptZYYY, 0x00 },
+    { SBBidiTypeON, SBGeneralCategorySM, SBScriptZYYY, 0x04 },
+    { SBBidiTypeL, SBGeneralCategoryLU, SBScriptLATN, 0x00 },
+    { SBBidiTypeON, SBGeneralCategoryPS, SBScriptZYYY, 0x43 },
+    { SBBidiTypeON, SBGeneralCategoryPE, SBScriptZYYY, 0x84 },
+    { SBBidiTypeON, SBGeneralCategorySK, SBScriptZYYY, 0x00 },
+    { SBBidiTypeON, SBGeneralCategoryPC, SBScriptZYYY, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLL, SBScriptLATN, 0x00 },
+    { SBBidiTypeCS, SBGeneralCategoryZS, SBScriptZYYY, 0x00 },
+    { SBBidiTypeON, SBGeneralCategorySO, SBScriptZYYY, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptLATN, 0x00 },
+    { SBBidiTypeON, SBGeneralCategoryPI, SBScriptZYYY, 0x05 },
+    { SBBidiTypeBN, SBGeneralCategoryCF, SBScriptZYYY, 0x00 },
+    { SBBidiTypeET, SBGeneralCategorySO, SBScriptZYYY, 0x00 },
+    { SBBidiTypeET, SBGeneralCategorySM, SBScriptZYYY, 0x00 },
+    { SBBidiTypeEN, SBGeneralCategoryNO, SBScriptZYYY, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLL, SBScriptZYYY, 0x00 },
+    { SBBidiTypeON, SBGeneralCategoryPF, SBScriptZYYY, 0x06 },
+    { SBBidiTypeON, SBGeneralCategoryNO, SBScriptZYYY, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLT, SBScriptLATN, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLM, SBScriptLATN, 0x00 },
+    { SBBidiTypeON, SBGeneralCategoryLM, SBScriptZYYY, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLM, SBScriptZYYY, 0x00 },
+    { SBBidiTypeON, SBGeneralCategorySK, SBScriptBOPO, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptZINH, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLU, SBScriptGREK, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLL, SBScriptGREK, 0x00 },
+    { SBBidiTypeON, SBGeneralCategorySK, SBScriptGREK, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryCN, SBScriptZZZZ, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLM, SBScriptGREK, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLU, SBScriptCOPT, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLL, SBScriptCOPT, 0x00 },
+    { SBBidiTypeON, SBGeneralCategorySM, SBScriptGREK, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLU, SBScriptCYRL, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLL, SBScriptCYRL, 0x00 },
+    { SBBidiTypeL, SBGeneralCategorySO, SBScriptCYRL, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptCYRL, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryME, SBScriptCYRL, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLU, SBScriptARMN, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLM, SBScriptARMN, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptARMN, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLL, SBScriptARMN, 0x00 },
+    { SBBidiTypeON, SBGeneralCategoryPD, SBScriptARMN, 0x00 },
+    { SBBidiTypeON, SBGeneralCategorySO, SBScriptARMN, 0x00 },
+    { SBBidiTypeET, SBGeneralCategorySC, SBScriptARMN, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptHEBR, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryPD, SBScriptHEBR, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryPO, SBScriptHEBR, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryLO, SBScriptHEBR, 0x00 },
+    { SBBidiTypeAN, SBGeneralCategoryCF, SBScriptARAB, 0x00 },
+    { SBBidiTypeAN, SBGeneralCategoryCF, SBScriptZYYY, 0x00 },
+    { SBBidiTypeON, SBGeneralCategorySM, SBScriptARAB, 0x00 },
+    { SBBidiTypeAL, SBGeneralCategorySM, SBScriptARAB, 0x00 },
+    { SBBidiTypeET, SBGeneralCategoryPO, SBScriptARAB, 0x00 },
+    { SBBidiTypeAL, SBGeneralCategorySC, SBScriptARAB, 0x00 },
+    { SBBidiTypeAL, SBGeneralCategoryPO, SBScriptARAB, 0x00 },
+    { SBBidiTypeON, SBGeneralCategorySO, SBScriptARAB, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptARAB, 0x00 },
+    { SBBidiTypeAL, SBGeneralCategoryPO, SBScriptZYYY, 0x00 },
+    { SBBidiTypeAL, SBGeneralCategoryCF, SBScriptARAB, 0x00 },
+    { SBBidiTypeAL, SBGeneralCategoryLO, SBScriptARAB, 0x00 },
+    { SBBidiTypeAL, SBGeneralCategoryLM, SBScriptZYYY, 0x00 },
+    { SBBidiTypeAN, SBGeneralCategoryND, SBScriptARAB, 0x00 },
+    { SBBidiTypeAN, SBGeneralCategoryPO, SBScriptARAB, 0x00 },
+    { SBBidiTypeAL, SBGeneralCategoryLM, SBScriptARAB, 0x00 },
+    { SBBidiTypeEN, SBGeneralCategoryND, SBScriptARAB, 0x00 },
+    { SBBidiTypeAL, SBGeneralCategorySO, SBScriptARAB, 0x00 },
+    { SBBidiTypeAL, SBGeneralCategoryPO, SBScriptSYRC, 0x00 },
+    { SBBidiTypeAL, SBGeneralCategoryCF, SBScriptSYRC, 0x00 },
+    { SBBidiTypeAL, SBGeneralCategoryLO, SBScriptSYRC, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptSYRC, 0x00 },
+    { SBBidiTypeAL, SBGeneralCategoryLO, SBScriptTHAA, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptTHAA, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryND, SBScriptNKOO, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryLO, SBScriptNKOO, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptNKOO, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryLM, SBScriptNKOO, 0x00 },
+    { SBBidiTypeON, SBGeneralCategorySO, SBScriptNKOO, 0x00 },
+    { SBBidiTypeON, SBGeneralCategoryPO, SBScriptNKOO, 0x00 },
+    { SBBidiTypeR, SBGeneralCategorySC, SBScriptNKOO, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryLO, SBScriptSAMR, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptSAMR, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryLM, SBScriptSAMR, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryPO, SBScriptSAMR, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryLO, SBScriptMAND, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptMAND, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryPO, SBScriptMAND, 0x00 },
+    { SBBidiTypeAL, SBGeneralCategorySK, SBScriptARAB, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptDEVA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptDEVA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptDEVA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptZYYY, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptDEVA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptDEVA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLM, SBScriptDEVA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptBENG, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptBENG, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptBENG, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptBENG, 0x00 },
+    { SBBidiTypeET, SBGeneralCategorySC, SBScriptBENG, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryNO, SBScriptBENG, 0x00 },
+    { SBBidiTypeL, SBGeneralCategorySO, SBScriptBENG, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptBENG, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptGURU, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptGURU, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptGURU, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptGURU, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptGURU, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptGUJR, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptGUJR, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptGUJR, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptGUJR, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptGUJR, 0x00 },
+    { SBBidiTypeET, SBGeneralCategorySC, SBScriptGUJR, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptORYA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptORYA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptORYA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptORYA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategorySO, SBScriptORYA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryNO, SBScriptORYA, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptTAML, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptTAML, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptTAML, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptTAML, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryNO, SBScriptTAML, 0x00 },
+    { SBBidiTypeON, SBGeneralCategorySO, SBScriptTAML, 0x00 },
+    { SBBidiTypeET, SBGeneralCategorySC, SBScriptTAML, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptTELU, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptTELU, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptTELU, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptTELU, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptTELU, 0x00 },
+    { SBBidiTypeON, SBGeneralCategoryNO, SBScriptTELU, 0x00 },
+    { SBBidiTypeL, SBGeneralCategorySO, SBScriptTELU, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptKNDA, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptKNDA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptKNDA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptKNDA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMN, SBScriptKNDA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptKNDA, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptMLYM, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptMLYM, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptMLYM, 0x00 },
+    { SBBidiTypeL, SBGeneralCategorySO, SBScriptMLYM, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryNO, SBScriptMLYM, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptMLYM, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptSINH, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptSINH, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptSINH, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptSINH, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptSINH, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptTHAI, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptTHAI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLM, SBScriptTHAI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptTHAI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptTHAI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptLAOO, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptLAOO, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLM, SBScriptLAOO, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptLAOO, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptTIBT, 0x00 },
+    { SBBidiTypeL, SBGeneralCategorySO, SBScriptTIBT, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptTIBT, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptTIBT, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptTIBT, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryNO, SBScriptTIBT, 0x00 },
+    { SBBidiTypeON, SBGeneralCategoryPS, SBScriptTIBT, 0x41 },
+    { SBBidiTypeON, SBGeneralCategoryPE, SBScriptTIBT, 0x82 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptTIBT, 0x00 },
+    { SBBidiTypeL, SBGeneralCategorySO, SBScriptZYYY, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptMYMR, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptMYMR, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptMYMR, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptMYMR, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptMYMR, 0x00 },
+    { SBBidiTypeL, SBGeneralCategorySO, SBScriptMYMR, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLU, SBScriptGEOR, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLL, SBScriptGEOR, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLM, SBScriptGEOR, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptHANG, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptETHI, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptETHI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptETHI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryNO, SBScriptETHI, 0x00 },
+    { SBBidiTypeON, SBGeneralCategorySO, SBScriptETHI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLU, SBScriptCHER, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLL, SBScriptCHER, 0x00 },
+    { SBBidiTypeON, SBGeneralCategoryPD, SBScriptCANS, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptCANS, 0x00 },
+    { SBBidiTypeL, SBGeneralCategorySO, SBScriptCANS, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptCANS, 0x00 },
+    { SBBidiTypeWS, SBGeneralCategoryZS, SBScriptOGAM, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptOGAM, 0x00 },
+    { SBBidiTypeON, SBGeneralCategoryPS, SBScriptOGAM, 0x41 },
+    { SBBidiTypeON, SBGeneralCategoryPE, SBScriptOGAM, 0x82 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptRUNR, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryNL, SBScriptRUNR, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptTGLG, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptTGLG, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptTGLG, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptHANO, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptHANO, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptHANO, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptBUHD, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptBUHD, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptTAGB, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptTAGB, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptKHMR, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptKHMR, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptKHMR, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptKHMR, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLM, SBScriptKHMR, 0x00 },
+    { SBBidiTypeET, SBGeneralCategorySC, SBScriptKHMR, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptKHMR, 0x00 },
+    { SBBidiTypeON, SBGeneralCategoryNO, SBScriptKHMR, 0x00 },
+    { SBBidiTypeON, SBGeneralCategoryPO, SBScriptMONG, 0x00 },
+    { SBBidiTypeON, SBGeneralCategoryPD, SBScriptMONG, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptMONG, 0x00 },
+    { SBBidiTypeBN, SBGeneralCategoryCF, SBScriptMONG, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptMONG, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptMONG, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLM, SBScriptMONG, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptLIMB, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptLIMB, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptLIMB, 0x00 },
+    { SBBidiTypeON, SBGeneralCategorySO, SBScriptLIMB, 0x00 },
+    { SBBidiTypeON, SBGeneralCategoryPO, SBScriptLIMB, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptLIMB, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptTALE, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptTALU, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptTALU, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryNO, SBScriptTALU, 0x00 },
+    { SBBidiTypeON, SBGeneralCategorySO, SBScriptTALU, 0x00 },
+    { SBBidiTypeON, SBGeneralCategorySO, SBScriptKHMR, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptBUGI, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptBUGI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptBUGI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptBUGI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptLANA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptLANA, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptLANA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptLANA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptLANA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLM, SBScriptLANA, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryME, SBScriptZINH, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptBALI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptBALI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptBALI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptBALI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptBALI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategorySO, SBScriptBALI, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptSUND, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptSUND, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptSUND, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptSUND, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptBATK, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptBATK, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptBATK, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptBATK, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptLEPC, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptLEPC, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptLEPC, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptLEPC, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptLEPC, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptOLCK, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptOLCK, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLM, SBScriptOLCK, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptOLCK, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptSUND, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptZYYY, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptZYYY, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLM, SBScriptCYRL, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLT, SBScriptGREK, 0x00 },
+    { SBBidiTypeBN, SBGeneralCategoryCF, SBScriptZINH, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryCF, SBScriptZYYY, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryCF, SBScriptZYYY, 0x00 },
+    { SBBidiTypeON, SBGeneralCategoryPD, SBScriptZYYY, 0x00 },
+    { SBBidiTypeON, SBGeneralCategoryPI, SBScriptZYYY, 0x00 },
+    { SBBidiTypeON, SBGeneralCategoryPF, SBScriptZYYY, 0x00 },
+    { SBBidiTypeON, SBGeneralCategoryPS, SBScriptZYYY, 0x00 },
+    { SBBidiTypeWS, SBGeneralCategoryZL, SBScriptZYYY, 0x00 },
+    { SBBidiTypeB, SBGeneralCategoryZP, SBScriptZYYY, 0x00 },
+    { SBBidiTypeLRE, SBGeneralCategoryCF, SBScriptZYYY, 0x00 },
+    { SBBidiTypeRLE, SBGeneralCategoryCF, SBScriptZYYY, 0x00 },
+    { SBBidiTypePDF, SBGeneralCategoryCF, SBScriptZYYY, 0x00 },
+    { SBBidiTypeLRO, SBGeneralCategoryCF, SBScriptZYYY, 0x00 },
+    { SBBidiTypeRLO, SBGeneralCategoryCF, SBScriptZYYY, 0x00 },
+    { SBBidiTypeON, SBGeneralCategoryPI, SBScriptZYYY, 0x01 },
+    { SBBidiTypeON, SBGeneralCategoryPF, SBScriptZYYY, 0x02 },
+    { SBBidiTypeCS, SBGeneralCategorySM, SBScriptZYYY, 0x00 },
+    { SBBidiTypeBN, SBGeneralCategoryCN, SBScriptZZZZ, 0x00 },
+    { SBBidiTypeLRI, SBGeneralCategoryCF, SBScriptZYYY, 0x00 },
+    { SBBidiTypeRLI, SBGeneralCategoryCF, SBScriptZYYY, 0x00 },
+    { SBBidiTypeFSI, SBGeneralCategoryCF, SBScriptZYYY, 0x00 },
+    { SBBidiTypePDI, SBGeneralCategoryCF, SBScriptZYYY, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLU, SBScriptZYYY, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryNL, SBScriptLATN, 0x00 },
+    { SBBidiTypeON, SBGeneralCategorySM, SBScriptZYYY, 0x07 },
+    { SBBidiTypeON, SBGeneralCategorySM, SBScriptZYYY, 0x08 },
+    { SBBidiTypeON, SBGeneralCategorySM, SBScriptZYYY, 0x09 },
+    { SBBidiTypeON, SBGeneralCategorySM, SBScriptZYYY, 0x0A },
+    { SBBidiTypeON, SBGeneralCategorySM, SBScriptZYYY, 0x0B },
+    { SBBidiTypeON, SBGeneralCategorySM, SBScriptZYYY, 0x0C },
+    { SBBidiTypeON, SBGeneralCategorySM, SBScriptZYYY, 0x0D },
+    { SBBidiTypeON, SBGeneralCategorySM, SBScriptZYYY, 0x0E },
+    { SBBidiTypeON, SBGeneralCategorySM, SBScriptZYYY, 0x01 },
+    { SBBidiTypeON, SBGeneralCategorySM, SBScriptZYYY, 0x02 },
+    { SBBidiTypeON, SBGeneralCategorySM, SBScriptZYYY, 0x0F },
+    { SBBidiTypeON, SBGeneralCategorySM, SBScriptZYYY, 0x10 },
+    { SBBidiTypeON, SBGeneralCategorySM, SBScriptZYYY, 0x11 },
+    { SBBidiTypeON, SBGeneralCategorySM, SBScriptZYYY, 0x12 },
+    { SBBidiTypeON, SBGeneralCategorySM, SBScriptZYYY, 0x13 },
+    { SBBidiTypeON, SBGeneralCategorySM, SBScriptZYYY, 0x14 },
+    { SBBidiTypeON, SBGeneralCategorySM, SBScriptZYYY, 0x15 },
+    { SBBidiTypeON, SBGeneralCategorySM, SBScriptZYYY, 0x16 },
+    { SBBidiTypeON, SBGeneralCategorySM, SBScriptZYYY, 0x17 },
+    { SBBidiTypeON, SBGeneralCategorySM, SBScriptZYYY, 0x18 },
+    { SBBidiTypeON, SBGeneralCategorySM, SBScriptZYYY, 0x19 },
+    { SBBidiTypeON, SBGeneralCategorySM, SBScriptZYYY, 0x1A },
+    { SBBidiTypeL, SBGeneralCategorySO, SBScriptBRAI, 0x00 },
+    { SBBidiTypeON, SBGeneralCategoryPS, SBScriptZYYY, 0x47 },
+    { SBBidiTypeON, SBGeneralCategoryPE, SBScriptZYYY, 0x81 },
+    { SBBidiTypeON, SBGeneralCategoryPS, SBScriptZYYY, 0x42 },
+    { SBBidiTypeON, SBGeneralCategoryPE, SBScriptZYYY, 0x88 },
+    { SBBidiTypeON, SBGeneralCategorySM, SBScriptZYYY, 0x1B },
+    { SBBidiTypeON, SBGeneralCategorySM, SBScriptZYYY, 0x1C },
+    { SBBidiTypeON, SBGeneralCategorySM, SBScriptZYYY, 0x1D },
+    { SBBidiTypeON, SBGeneralCategorySM, SBScriptZYYY, 0x1E },
+    { SBBidiTypeON, SBGeneralCategorySM, SBScriptZYYY, 0x1F },
+    { SBBidiTypeON, SBGeneralCategorySM, SBScriptZYYY, 0x20 },
+    { SBBidiTypeON, SBGeneralCategorySM, SBScriptZYYY, 0x21 },
+    { SBBidiTypeON, SBGeneralCategorySM, SBScriptZYYY, 0x22 },
+    { SBBidiTypeON, SBGeneralCategorySM, SBScriptZYYY, 0x23 },
+    { SBBidiTypeON, SBGeneralCategorySO, SBScriptZYYY, 0x24 },
+    { SBBidiTypeL, SBGeneralCategoryLU, SBScriptGLAG, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLL, SBScriptGLAG, 0x00 },
+    { SBBidiTypeON, SBGeneralCategorySO, SBScriptCOPT, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptCOPT, 0x00 },
+    { SBBidiTypeON, SBGeneralCategoryPO, SBScriptCOPT, 0x00 },
+    { SBBidiTypeON, SBGeneralCategoryNO, SBScriptCOPT, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptTFNG, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLM, SBScriptTFNG, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptTFNG, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptTFNG, 0x00 },
+    { SBBidiTypeON, SBGeneralCategorySO, SBScriptHANI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLM, SBScriptHANI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryNL, SBScriptHANI, 0x00 },
+    { SBBidiTypeON, SBGeneralCategoryPE, SBScriptZYYY, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptHANG, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptHIRA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLM, SBScriptHIRA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptKANA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLM, SBScriptKANA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptBOPO, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryNO, SBScriptZYYY, 0x00 },
+    { SBBidiTypeL, SBGeneralCategorySO, SBScriptHANG, 0x00 },
+    { SBBidiTypeON, SBGeneralCategorySO, SBScriptHANG, 0x00 },
+    { SBBidiTypeL, SBGeneralCategorySO, SBScriptKANA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptHANI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryCN, SBScriptHANI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptYIII, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLM, SBScriptYIII, 0x00 },
+    { SBBidiTypeON, SBGeneralCategorySO, SBScriptYIII, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptLISU, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLM, SBScriptLISU, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptLISU, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptVAII, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLM, SBScriptVAII, 0x00 },
+    { SBBidiTypeON, SBGeneralCategoryPO, SBScriptVAII, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptVAII, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptCYRL, 0x00 },
+    { SBBidiTypeON, SBGeneralCategoryPO, SBScriptCYRL, 0x00 },
+    { SBBidiTypeON, SBGeneralCategoryLM, SBScriptCYRL, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptBAMU, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryNL, SBScriptBAMU, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptBAMU, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptBAMU, 0x00 },
+    { SBBidiTypeL, SBGeneralCategorySK, SBScriptZYYY, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptSYLO, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptSYLO, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptSYLO, 0x00 },
+    { SBBidiTypeON, SBGeneralCategorySO, SBScriptSYLO, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptPHAG, 0x00 },
+    { SBBidiTypeON, SBGeneralCategoryPO, SBScriptPHAG, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptSAUR, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptSAUR, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptSAUR, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptSAUR, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptSAUR, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptKALI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptKALI, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptKALI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptKALI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptRJNG, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptRJNG, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptRJNG, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptRJNG, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptJAVA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptJAVA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptJAVA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptJAVA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptJAVA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLM, SBScriptMYMR, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptCHAM, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptCHAM, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptCHAM, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptCHAM, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptCHAM, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptTAVT, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptTAVT, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLM, SBScriptTAVT, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptTAVT, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptMTEI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptMTEI, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptMTEI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptMTEI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLM, SBScriptMTEI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptMTEI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryCN, SBScriptHANG, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryCS, SBScriptZZZZ, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryCO, SBScriptZZZZ, 0x00 },
+    { SBBidiTypeES, SBGeneralCategorySM, SBScriptHEBR, 0x00 },
+    { SBBidiTypeON, SBGeneralCategoryCF, SBScriptZYYY, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptLINB, 0x00 },
+    { SBBidiTypeON, SBGeneralCategoryNL, SBScriptGREK, 0x00 },
+    { SBBidiTypeON, SBGeneralCategoryNO, SBScriptGREK, 0x00 },
+    { SBBidiTypeON, SBGeneralCategorySO, SBScriptGREK, 0x00 },
+    { SBBidiTypeL, SBGeneralCategorySO, SBScriptGREK, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptLYCI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptCARI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptITAL, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryNO, SBScriptITAL, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptGOTH, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryNL, SBScriptGOTH, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptPERM, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptPERM, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptUGAR, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptUGAR, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptXPEO, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptXPEO, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryNL, SBScriptXPEO, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLU, SBScriptDSRT, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLL, SBScriptDSRT, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptSHAW, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptOSMA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptOSMA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLU, SBScriptOSGE, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLL, SBScriptOSGE, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptELBA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptAGHB, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptAGHB, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLU, SBScriptVITH, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLL, SBScriptVITH, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptLINA, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryLO, SBScriptCPRT, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryLO, SBScriptARMI, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryPO, SBScriptARMI, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryNO, SBScriptARMI, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryLO, SBScriptPALM, 0x00 },
+    { SBBidiTypeR, SBGeneralCategorySO, SBScriptPALM, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryNO, SBScriptPALM, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryLO, SBScriptNBAT, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryNO, SBScriptNBAT, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryLO, SBScriptHATR, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryNO, SBScriptHATR, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryLO, SBScriptPHNX, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryNO, SBScriptPHNX, 0x00 },
+    { SBBidiTypeON, SBGeneralCategoryPO, SBScriptPHNX, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryLO, SBScriptLYDI, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryPO, SBScriptLYDI, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryLO, SBScriptMERO, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryLO, SBScriptMERC, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryNO, SBScriptMERC, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryLO, SBScriptKHAR, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptKHAR, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryNO, SBScriptKHAR, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryPO, SBScriptKHAR, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryLO, SBScriptSARB, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryNO, SBScriptSARB, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryPO, SBScriptSARB, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryLO, SBScriptNARB, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryNO, SBScriptNARB, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryLO, SBScriptMANI, 0x00 },
+    { SBBidiTypeR, SBGeneralCategorySO, SBScriptMANI, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptMANI, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryNO, SBScriptMANI, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryPO, SBScriptMANI, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryLO, SBScriptAVST, 0x00 },
+    { SBBidiTypeON, SBGeneralCategoryPO, SBScriptAVST, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryLO, SBScriptPRTI, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryNO, SBScriptPRTI, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryLO, SBScriptPHLI, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryNO, SBScriptPHLI, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryLO, SBScriptPHLP, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryPO, SBScriptPHLP, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryNO, SBScriptPHLP, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryLO, SBScriptORKH, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryLU, SBScriptHUNG, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryLL, SBScriptHUNG, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryNO, SBScriptHUNG, 0x00 },
+    { SBBidiTypeAL, SBGeneralCategoryLO, SBScriptROHG, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptROHG, 0x00 },
+    { SBBidiTypeAN, SBGeneralCategoryND, SBScriptROHG, 0x00 },
+    { SBBidiTypeAN, SBGeneralCategoryNO, SBScriptARAB, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryLO, SBScriptYEZI, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptYEZI, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryPD, SBScriptYEZI, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryLO, SBScriptSOGO, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryNO, SBScriptSOGO, 0x00 },
+    { SBBidiTypeAL, SBGeneralCategoryLO, SBScriptSOGD, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptSOGD, 0x00 },
+    { SBBidiTypeAL, SBGeneralCategoryNO, SBScriptSOGD, 0x00 },
+    { SBBidiTypeAL, SBGeneralCategoryPO, SBScriptSOGD, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryLO, SBScriptOUGR, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptOUGR, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryPO, SBScriptOUGR, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryLO, SBScriptCHRS, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryNO, SBScriptCHRS, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryLO, SBScriptELYM, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptBRAH, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptBRAH, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptBRAH, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptBRAH, 0x00 },
+    { SBBidiTypeON, SBGeneralCategoryNO, SBScriptBRAH, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptBRAH, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptKTHI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptKTHI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptKTHI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptKTHI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryCF, SBScriptKTHI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptSORA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptSORA, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptCAKM, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptCAKM, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptCAKM, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptCAKM, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptCAKM, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptMAHJ, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptMAHJ, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptMAHJ, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptSHRD, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptSHRD, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptSHRD, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptSHRD, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptSHRD, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryNO, SBScriptSINH, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptKHOJ, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptKHOJ, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptKHOJ, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptKHOJ, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptMULT, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptMULT, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptSIND, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptSIND, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptSIND, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptSIND, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptGRAN, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptGRAN, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptGRAN, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptNEWA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptNEWA, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptNEWA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptNEWA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptNEWA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptTIRH, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptTIRH, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptTIRH, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptTIRH, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptTIRH, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptSIDD, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptSIDD, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptSIDD, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptSIDD, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptMODI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptMODI, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptMODI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptMODI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptMODI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptTAKR, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptTAKR, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptTAKR, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptTAKR, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptTAKR, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptAHOM, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptAHOM, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptAHOM, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptAHOM, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryNO, SBScriptAHOM, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptAHOM, 0x00 },
+    { SBBidiTypeL, SBGeneralCategorySO, SBScriptAHOM, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptDOGR, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptDOGR, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptDOGR, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptDOGR, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLU, SBScriptWARA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLL, SBScriptWARA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptWARA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryNO, SBScriptWARA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptWARA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptDIAK, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptDIAK, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptDIAK, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptDIAK, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptDIAK, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptNAND, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptNAND, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptNAND, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptNAND, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptZANB, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptZANB, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMN, SBScriptZANB, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptZANB, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptZANB, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptSOYO, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptSOYO, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptSOYO, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptSOYO, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptPAUC, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptBHKS, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptBHKS, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptBHKS, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMN, SBScriptBHKS, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptBHKS, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptBHKS, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryNO, SBScriptBHKS, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptMARC, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptMARC, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptMARC, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptMARC, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptGONM, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptGONM, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptGONM, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptGONG, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptGONG, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptGONG, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptGONG, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptMAKA, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptMAKA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptMAKA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptMAKA, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptKAWI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptKAWI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptKAWI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptKAWI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptKAWI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptTAML, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptXSUX, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryNL, SBScriptXSUX, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptXSUX, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptCPMN, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptCPMN, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptEGYP, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryCF, SBScriptEGYP, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptEGYP, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptHLUW, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptMROO, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptMROO, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptMROO, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptTNSA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptTNSA, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptBASS, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptBASS, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptBASS, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptHMNG, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptHMNG, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptHMNG, 0x00 },
+    { SBBidiTypeL, SBGeneralCategorySO, SBScriptHMNG, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLM, SBScriptHMNG, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptHMNG, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryNO, SBScriptHMNG, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLU, SBScriptMEDF, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLL, SBScriptMEDF, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryNO, SBScriptMEDF, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptMEDF, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptPLRD, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptPLRD, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptPLRD, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLM, SBScriptPLRD, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLM, SBScriptTANG, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLM, SBScriptNSHU, 0x00 },
+    { SBBidiTypeON, SBGeneralCategoryPO, SBScriptHANI, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptKITS, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryMC, SBScriptHANI, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptTANG, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryCN, SBScriptTANG, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptKITS, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptNSHU, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptDUPL, 0x00 },
+    { SBBidiTypeL, SBGeneralCategorySO, SBScriptDUPL, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptDUPL, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptDUPL, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptGREK, 0x00 },
+    { SBBidiTypeL, SBGeneralCategorySM, SBScriptZYYY, 0x00 },
+    { SBBidiTypeL, SBGeneralCategorySO, SBScriptSGNW, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptSGNW, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryPO, SBScriptSGNW, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptGLAG, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptHMNP, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptHMNP, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLM, SBScriptHMNP, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptHMNP, 0x00 },
+    { SBBidiTypeL, SBGeneralCategorySO, SBScriptHMNP, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptTOTO, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptTOTO, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptWCHO, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptWCHO, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptWCHO, 0x00 },
+    { SBBidiTypeET, SBGeneralCategorySC, SBScriptWCHO, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLO, SBScriptNAGM, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryLM, SBScriptNAGM, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptNAGM, 0x00 },
+    { SBBidiTypeL, SBGeneralCategoryND, SBScriptNAGM, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryLO, SBScriptMEND, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryNO, SBScriptMEND, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptMEND, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryLU, SBScriptADLM, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryLL, SBScriptADLM, 0x00 },
+    { SBBidiTypeNSM, SBGeneralCategoryMN, SBScriptADLM, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryLM, SBScriptADLM, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryND, SBScriptADLM, 0x00 },
+    { SBBidiTypeR, SBGeneralCategoryPO, SBScriptADLM, 0x00 },
+    { SBBidiTypeAL, SBGeneralCategoryNO, SBScriptZYYY, 0x00 },
+    { SBBidiTypeAL, SBGeneralCategorySO, SBScriptZYYY, 0x00 },
+    { SBBidiTypeAL, SBGeneralCategorySC, SBScriptZYYY, 0x00 },
+    { SBBidiTypeL, SBGeneralCategorySO, SBScriptHIRA, 0x00 }
+};
+
+static const SBUInt16 PrimaryPropertyData[16976] = {
+/* DATA_BLOCK: -- 0x0000..0x000F -- */
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0003, 0x0002,
+    0x0004, 0x0003, 0x0001, 0x0001,
+/* DATA_BLOCK: -- 0x0010..0x001F -- */
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0003, 0x0003, 0x0003, 0x0002,
+/* DATA_BLOCK: -- 0x0020..0x002F -- */
+    0x0005, 0x0006, 0x0006, 0x0007, 0x0008, 0x0007, 0x0006, 0x0006, 0x0009, 0x000A, 0x0006, 0x000B,
+    0x000C, 0x000D, 0x000C, 0x000C,
+/* DATA_BLOCK: -- 0x0030..0x003F -- */
+    0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000C, 0x0006,
+    0x000F, 0x0010, 0x0011, 0x0006,
+/* DATA_BLOCK: -- 0x0040..0x004F -- */
+    0x0006, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012,
+    0x0012, 0x0012, 0x0012, 0x0012,
+/* DATA_BLOCK: -- 0x0050..0x005F -- */
+    0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0013,
+    0x0006, 0x0014, 0x0015, 0x0016,
+/* DATA_BLOCK: -- 0x0060..0x006F -- */
+    0x0015, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017,
+    0x0017, 0x0017, 0x0017, 0x0017,
+/* DATA_BLOCK: -- 0x0070..0x007F -- */
+    0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0013,
+    0x0010, 0x0014, 0x0010, 0x0001,
+/* DATA_BLOCK: -- 0x0080..0x008F -- */
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0003, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001,
+/* DATA_BLOCK: -- 0x0090..0x009F -- */
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001,
+/* DATA_BLOCK: -- 0x00A0..0x00AF -- */
+    0x0018, 0x0006, 0x0008, 0x0008, 0x0008, 0x0008, 0x0019, 0x0006, 0x0015, 0x0019, 0x001A, 0x001B,
+    0x0010, 0x001C, 0x0019, 0x0015,
+/* DATA_BLOCK: -- 0x00B0..0x00BF -- */
+    0x001D, 0x001E, 0x001F, 0x001F, 0x0015, 0x0020, 0x0006, 0x0006, 0x0015, 0x001F, 0x001A, 0x0021,
+    0x0022, 0x0022, 0x0022, 0x0006,
+/* DATA_BLOCK: -- 0x00C0..0x00CF -- */
+    0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012,
+    0x0012, 0x0012, 0x0012, 0x0012,
+/* DATA_BLOCK: -- 0x00D0..0x00DF -- */
+    0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0010, 0x0012, 0x0012, 0x0012, 0x0012,
+    0x0012, 0x0012, 0x0012, 0x0017,
+/* DATA_BLOCK: -- 0x00E0..0x00EF -- */
+    0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017,
+    0x0017, 0x0017, 0x0017, 0x0017,
+/* DATA_BLOCK: -- 0x00F0..0x00FF -- */
+    0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0010, 0x0017, 0x0017, 0x0017, 0x0017,
+    0x0017, 0x0017, 0x0017, 0x0017,
+/* DATA_BLOCK: -- 0x0100..0x010F -- */
+    0x0012, 0x0017, 0x0012, 0x0017, 0x0012, 0x0017, 0x0012, 0x0017, 0x0012, 0x0017, 0x0012, 0x0017,
+    0x0012, 0x0017, 0x0012, 0x0017,
+/* DATA_BLOCK: -- 0x0110..0x011F -- */
+    0x0012, 0x0017, 0x0012, 0x0017, 0x0012, 0x0017, 0x0012, 0x0017, 0x0017, 0x0012, 0x0017, 0x0012,
+    0x0017, 0x0012, 0x0017, 0x0012,
+/* DATA_BLOCK: -- 0x0120..0x012F -- */
+    0x0017, 0x0012, 0x0017, 0x0012, 0x0017, 0x0012, 0x0017, 0x0012, 0x0017, 0x0017, 0x0012, 0x0017,
+    0x0012, 0x0017, 0x0012, 0x0017,
+/* DATA_BLOCK: -- 0x0130..0x013F -- */
+    0x0012, 0x0017, 0x0012, 0x0017, 0x0012, 0x0017, 0x0012, 0x0017, 0x0012, 0x0012, 0x0017, 0x0012,
+    0x0017, 0x0012, 0x0017, 0x0017,
+/* DATA_BLOCK: -- 0x0140..0x014F -- */
+    0x0017, 0x0012, 0x0012, 0x0017, 0x0012, 0x0017, 0x0012, 0x0012, 0x0017, 0x0012, 0x0012, 0x0012,
+    0x0017, 0x0017, 0x0012, 0x0012,
+/* DATA_BLOCK: -- 0x0150..0x015F -- */
+    0x0012, 0x0012, 0x0017, 0x0012, 0x0012, 0x0017, 0x0012, 0x0012, 0x0012, 0x0017, 0x0017, 0x0017,
+    0x0012, 0x0012, 0x0017, 0x0012,
+/* DATA_BLOCK: -- 0x0160..0x016F -- */
+    0x0012, 0x0017, 0x0012, 0x0017, 0x0012, 0x0017, 0x0012, 0x0012, 0x0017, 0x0012, 0x0017, 0x0017,
+    0x0012, 0x0017, 0x0012, 0x0012,
+/* DATA_BLOCK: -- 0x0170..0x017F -- */
+    0x0017, 0x0012, 0x0012, 0x0012, 0x0017, 0x0012, 0x0017, 0x0012, 0x0012, 0x0017, 0x0017, 0x001A,
+    0x0012, 0x0017, 0x0017, 0x0017,
+/* DATA_BLOCK: -- 0x0180..0x018F -- */
+    0x001A, 0x001A, 0x001A, 0x001A, 0x0012, 0x0023, 0x0017, 0x0012, 0x0023, 0x0017, 0x0012, 0x0023,
+    0x0017, 0x0012, 0x0017, 0x0012,
+/* DATA_BLOCK: -- 0x0190..0x019F -- */
+    0x0017, 0x0012, 0x0017, 0x0012, 0x0017, 0x0012, 0x0017, 0x0012, 0x0017, 0x0012, 0x0017, 0x0012,
+    0x0017, 0x0017, 0x0012, 0x0017,
+/* DATA_BLOCK: -- 0x01A0..0x01AF -- */
+    0x0017, 0x0012, 0x0023, 0x0017, 0x0012, 0x0017, 0x0012, 0x0012, 0x0012, 0x0017, 0x0012, 0x0017,
+    0x0012, 0x0017, 0x0012, 0x0017,
+/* DATA_BLOCK: -- 0x01B0..0x01BF -- */
+    0x0012, 0x0017, 0x0012, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0012, 0x0012,
+    0x0017, 0x0012, 0x0012, 0x0017,
+/* DATA_BLOCK: -- 0x01C0..0x01CF -- */
+    0x0017, 0x0012, 0x0017, 0x0012, 0x0012, 0x0012, 0x0012, 0x0017, 0x0012, 0x0017, 0x0012, 0x0017,
+    0x0012, 0x0017, 0x0012, 0x0017,
+/* DATA_BLOCK: -- 0x01D0..0x01DF -- */
+    0x0017, 0x0017, 0x0017, 0x0017, 0x001A, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017,
+    0x0017, 0x0017, 0x0017, 0x0017,
+/* DATA_BLOCK: -- 0x01E0..0x01EF -- */
+    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0025, 0x0025, 0x0026,
+    0x0026, 0x0026, 0x0026, 0x0026,
+/* DATA_BLOCK: -- 0x01F0..0x01FF -- */
+    0x0026, 0x0026, 0x0015, 0x0015, 0x0015, 0x0015, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025,
+    0x0025, 0x0025, 0x0025, 0x0025,
+/* DATA_BLOCK: -- 0x0200..0x020F -- */
+    0x0026, 0x0026, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015,
+    0x0015, 0x0015, 0x0015, 0x0015,
+/* DATA_BLOCK: -- 0x0210..0x021F -- */
+    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0027, 0x0027,
+    0x0025, 0x0015, 0x0026, 0x0015,
+/* DATA_BLOCK: -- 0x0220..0x022F -- */
+    0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015,
+    0x0015, 0x0015, 0x0015, 0x0015,
+/* DATA_BLOCK: -- 0x0230..0x023F -- */
+    0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028,
+    0x0028, 0x0028, 0x0028, 0x0028,
+/* DATA_BLOCK: -- 0x0240..0x024F -- */
+    0x0029, 0x002A, 0x0029, 0x002A, 0x0025, 0x002B, 0x0029, 0x002A, 0x002C, 0x002C, 0x002D, 0x002A,
+    0x002A, 0x002A, 0x0006, 0x0029,
+/* DATA_BLOCK: -- 0x0250..0x025F -- */
+    0x002C, 0x002C, 0x002C, 0x002C, 0x002B, 0x0015, 0x0029, 0x0006, 0x0029, 0x0029, 0x0029, 0x002C,
+    0x0029, 0x002C, 0x0029, 0x0029,
+/* DATA_BLOCK: -- 0x0260..0x026F -- */
+    0x002A, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029,
+    0x0029, 0x0029, 0x0029, 0x0029,
+/* DATA_BLOCK: -- 0x0270..0x027F -- */
+    0x0029, 0x0029, 0x002C, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029,
+    0x002A, 0x002A, 0x002A, 0x002A,
+/* DATA_BLOCK: -- 0x0280..0x028F -- */
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x002A, 0x002A, 0x002A,
+/* DATA_BLOCK: -- 0x0290..0x029F -- */
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x002A, 0x002A, 0x0029,
+/* DATA_BLOCK: -- 0x02A0..0x02AF -- */
+    0x002A, 0x002A, 0x0029, 0x0029, 0x0029, 0x002A, 0x002A, 0x002A, 0x0029, 0x002A, 0x0029, 0x002A,
+    0x0029, 0x002A, 0x0029, 0x002A,
+/* DATA_BLOCK: -- 0x02B0..0x02BF -- */
+    0x0029, 0x002A, 0x002E, 0x002F, 0x002E, 0x002F, 0x002E, 0x002F, 0x002E, 0x002F, 0x002E, 0x002F,
+    0x002E, 0x002F, 0x002E, 0x002F,
+/* DATA_BLOCK: -- 0x02C0..0x02CF -- */
+    0x002A, 0x002A, 0x002A, 0x002A, 0x0029, 0x002A, 0x0030, 0x0029, 0x002A, 0x0029, 0x0029, 0x002A,
+    0x002A, 0x0029, 0x0029, 0x0029,
+/* DATA_BLOCK: -- 0x02D0..0x02DF -- */
+    0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+    0x0031, 0x0031, 0x0031, 0x0031,
+/* DATA_BLOCK: -- 0x02E0..0x02EF -- */
+    0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032,
+    0x0032, 0x0032, 0x0032, 0x0032,
+/* DATA_BLOCK: -- 0x02F0..0x02FF -- */
+    0x0031, 0x0032, 0x0031, 0x0032, 0x0031, 0x0032, 0x0031, 0x0032, 0x0031, 0x0032, 0x0031, 0x0032,
+    0x0031, 0x0032, 0x0031, 0x0032,
+/* DATA_BLOCK: -- 0x0300..0x030F -- */
+    0x0031, 0x0032, 0x0033, 0x0034, 0x0034, 0x0028, 0x0028, 0x0034, 0x0035, 0x0035, 0x0031, 0x0032,
+    0x0031, 0x0032, 0x0031, 0x0032,
+/* DATA_BLOCK: -- 0x0310..0x031F -- */
+    0x0031, 0x0031, 0x0032, 0x0031, 0x0032, 0x0031, 0x0032, 0x0031, 0x0032, 0x0031, 0x0032, 0x0031,
+    0x0032, 0x0031, 0x0032, 0x0032,
+/* DATA_BLOCK: -- 0x0320..0x032F -- */
+    0x002C, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036,
+    0x0036, 0x0036, 0x0036, 0x0036,
+/* DATA_BLOCK: -- 0x0330..0x033F -- */
+    0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036,
+    0x0036, 0x0036, 0x0036, 0x0036,
+/* DATA_BLOCK: -- 0x0340..0x034F -- */
+    0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x002C, 0x002C, 0x0037, 0x0038, 0x0038,
+    0x0038, 0x0038, 0x0038, 0x0038,
+/* DATA_BLOCK: -- 0x0350..0x035F -- */
+    0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039,
+    0x0039, 0x0039, 0x0039, 0x0039,
+/* DATA_BLOCK: -- 0x0360..0x036F -- */
+    0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0038, 0x003A, 0x002C,
+    0x002C, 0x003B, 0x003B, 0x003C,
+/* DATA_BLOCK: -- 0x0370..0x037F -- */
+    0x002C, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D,
+    0x003D, 0x003D, 0x003D, 0x003D,
+/* DATA_BLOCK: -- 0x0380..0x038F -- */
+    0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D,
+    0x003D, 0x003D, 0x003D, 0x003D,
+/* DATA_BLOCK: -- 0x0390..0x039F -- */
+    0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D,
+    0x003D, 0x003D, 0x003E, 0x003D,
+/* DATA_BLOCK: -- 0x03A0..0x03AF -- */
+    0x003F, 0x003D, 0x003D, 0x003F, 0x003D, 0x003D, 0x003F, 0x003D, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x03B0..0x03BF -- */
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040,
+/* DATA_BLOCK: -- 0x03C0..0x03CF -- */
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x0040,
+/* DATA_BLOCK: -- 0x03D0..0x03DF -- */
+    0x0040, 0x0040, 0x0040, 0x003F, 0x003F, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x03E0..0x03EF -- */
+    0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0042, 0x0043, 0x0043, 0x0044, 0x0045, 0x0045, 0x0046,
+    0x000C, 0x0047, 0x0048, 0x0048,
+/* DATA_BLOCK: -- 0x03F0..0x03FF -- */
+    0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x004A,
+    0x004B, 0x0047, 0x0047, 0x004A,
+/* DATA_BLOCK: -- 0x0400..0x040F -- */
+    0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C,
+    0x004C, 0x004C, 0x004C, 0x004C,
+/* DATA_BLOCK: -- 0x0410..0x041F -- */
+    0x004D, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x0028,
+    0x0028, 0x0028, 0x0028, 0x0028,
+/* DATA_BLOCK: -- 0x0420..0x042F -- */
+    0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049,
+    0x0049, 0x0049, 0x0049, 0x0049,
+/* DATA_BLOCK: -- 0x0430..0x043F -- */
+    0x004E, 0x004E, 0x004E, 0x004E, 0x004E, 0x004E, 0x004E, 0x004E, 0x004E, 0x004E, 0x0045, 0x004F,
+    0x004F, 0x0047, 0x004C, 0x004C,
+/* DATA_BLOCK: -- 0x0440..0x044F -- */
+    0x0028, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C,
+    0x004C, 0x004C, 0x004C, 0x004C,
+/* DATA_BLOCK: -- 0x0450..0x045F -- */
+    0x004C, 0x004C, 0x004C, 0x004C, 0x0047, 0x004C, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049,
+    0x0049, 0x0042, 0x0048, 0x0049,
+/* DATA_BLOCK: -- 0x0460..0x046F -- */
+    0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0050, 0x0050, 0x0049, 0x0049, 0x0048, 0x0049, 0x0049,
+    0x0049, 0x0049, 0x004C, 0x004C,
+/* DATA_BLOCK: -- 0x0470..0x047F -- */
+    0x0051, 0x0051, 0x0051, 0x0051, 0x0051, 0x0051, 0x0051, 0x0051, 0x0051, 0x0051, 0x004C, 0x004C,
+    0x004C, 0x0052, 0x0052, 0x004C,
+/* DATA_BLOCK: -- 0x0480..0x048F -- */
+    0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+    0x0053, 0x0053, 0x002C, 0x0054,
+/* DATA_BLOCK: -- 0x0490..0x049F -- */
+    0x0055, 0x0056, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055,
+/* DATA_BLOCK: -- 0x04A0..0x04AF -- */
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055,
+/* DATA_BLOCK: -- 0x04B0..0x04BF -- */
+    0x0056, 0x0056, 0x0056, 0x0056, 0x0056, 0x0056, 0x0056, 0x0056, 0x0056, 0x0056, 0x0056, 0x0056,
+    0x0056, 0x0056, 0x0056, 0x0056,
+/* DATA_BLOCK: -- 0x04C0..0x04CF -- */
+    0x0056, 0x0056, 0x0056, 0x0056, 0x0056, 0x0056, 0x0056, 0x0056, 0x0056, 0x0056, 0x0056, 0x002C,
+    0x002C, 0x0055, 0x0055, 0x0055,
+/* DATA_BLOCK: -- 0x04D0..0x04DF -- */
+    0x0057, 0x0057, 0x0057, 0x0057, 0x0057, 0x0057, 0x0057, 0x0057, 0x0057, 0x0057, 0x0057, 0x0057,
+    0x0057, 0x0057, 0x0057, 0x0057,
+/* DATA_BLOCK: -- 0x04E0..0x04EF -- */
+    0x0057, 0x0057, 0x0057, 0x0057, 0x0057, 0x0057, 0x0058, 0x0058, 0x0058, 0x0058, 0x0058, 0x0058,
+    0x0058, 0x0058, 0x0058, 0x0058,
+/* DATA_BLOCK: -- 0x04F0..0x04FF -- */
+    0x0058, 0x0057, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x0500..0x050F -- */
+    0x0059, 0x0059, 0x0059, 0x0059, 0x0059, 0x0059, 0x0059, 0x0059, 0x0059, 0x0059, 0x005A, 0x005A,
+    0x005A, 0x005A, 0x005A, 0x005A,
+/* DATA_BLOCK: -- 0x0510..0x051F -- */
+    0x005A, 0x005A, 0x005A, 0x005A, 0x005A, 0x005A, 0x005A, 0x005A, 0x005A, 0x005A, 0x005A, 0x005A,
+    0x005A, 0x005A, 0x005A, 0x005A,
+/* DATA_BLOCK: -- 0x0520..0x052F -- */
+    0x005A, 0x005A, 0x005A, 0x005A, 0x005A, 0x005A, 0x005A, 0x005A, 0x005A, 0x005A, 0x005A, 0x005B,
+    0x005B, 0x005B, 0x005B, 0x005B,
+/* DATA_BLOCK: -- 0x0530..0x053F -- */
+    0x005B, 0x005B, 0x005B, 0x005B, 0x005C, 0x005C, 0x005D, 0x005E, 0x005E, 0x005E, 0x005C, 0x002C,
+    0x002C, 0x005B, 0x005F, 0x005F,
+/* DATA_BLOCK: -- 0x0540..0x054F -- */
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060,
+/* DATA_BLOCK: -- 0x0550..0x055F -- */
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0061, 0x0061, 0x0061, 0x0061, 0x0062, 0x0061,
+    0x0061, 0x0061, 0x0061, 0x0061,
+/* DATA_BLOCK: -- 0x0560..0x056F -- */
+    0x0061, 0x0061, 0x0061, 0x0061, 0x0062, 0x0061, 0x0061, 0x0061, 0x0062, 0x0061, 0x0061, 0x0061,
+    0x0061, 0x0061, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x0570..0x057F -- */
+    0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063,
+    0x0063, 0x0063, 0x0063, 0x002C,
+/* DATA_BLOCK: -- 0x0580..0x058F -- */
+    0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064,
+    0x0064, 0x0064, 0x0064, 0x0064,
+/* DATA_BLOCK: -- 0x0590..0x059F -- */
+    0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0065, 0x0065, 0x0065,
+    0x002C, 0x002C, 0x0066, 0x002C,
+/* DATA_BLOCK: -- 0x05A0..0x05AF -- */
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x05B0..0x05BF -- */
+    0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x0067, 0x004C, 0x004C, 0x004C,
+    0x004C, 0x004C, 0x004C, 0x002C,
+/* DATA_BLOCK: -- 0x05C0..0x05CF -- */
+    0x0041, 0x0041, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x0049, 0x0049, 0x0049, 0x0049,
+    0x0049, 0x0049, 0x0049, 0x0049,
+/* DATA_BLOCK: -- 0x05D0..0x05DF -- */
+    0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x0050, 0x0049, 0x0049,
+    0x0049, 0x0049, 0x0049, 0x0049,
+/* DATA_BLOCK: -- 0x05E0..0x05EF -- */
+    0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049,
+    0x0049, 0x0049, 0x0049, 0x0049,
+/* DATA_BLOCK: -- 0x05F0..0x05FF -- */
+    0x0049, 0x0049, 0x0042, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049,
+    0x0049, 0x0049, 0x0049, 0x0049,
+/* DATA_BLOCK: -- 0x0600..0x060F -- */
+    0x0068, 0x0068, 0x0068, 0x0069, 0x006A, 0x006A, 0x006A, 0x006A, 0x006A, 0x006A, 0x006A, 0x006A,
+    0x006A, 0x006A, 0x006A, 0x006A,
+/* DATA_BLOCK: -- 0x0610..0x061F -- */
+    0x006A, 0x006A, 0x006A, 0x006A, 0x006A, 0x006A, 0x006A, 0x006A, 0x006A, 0x006A, 0x006A, 0x006A,
+    0x006A, 0x006A, 0x006A, 0x006A,
+/* DATA_BLOCK: -- 0x0620..0x062F -- */
+    0x006A, 0x006A, 0x006A, 0x006A, 0x006A, 0x006A, 0x006A, 0x006A, 0x006A, 0x006A, 0x0068, 0x0069,
+    0x0068, 0x006A, 0x0069, 0x0069,
+/* DATA_BLOCK: -- 0x0630..0x063F -- */
+    0x0069, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0069, 0x0069, 0x0069,
+    0x0069, 0x0068, 0x0069, 0x0069,
+/* DATA_BLOCK: -- 0x0640..0x064F -- */
+    0x006A, 0x0028, 0x0028, 0x0028, 0x0028, 0x0068, 0x0068, 0x0068, 0x006A, 0x006A, 0x006A, 0x006A,
+    0x006A, 0x006A, 0x006A, 0x006A,
+/* DATA_BLOCK: -- 0x0650..0x065F -- */
+    0x006A, 0x006A, 0x0068, 0x0068, 0x006B, 0x006B, 0x006C, 0x006C, 0x006C, 0x006C, 0x006C, 0x006C,
+    0x006C, 0x006C, 0x006C, 0x006C,
+/* DATA_BLOCK: -- 0x0660..0x066F -- */
+    0x006D, 0x006E, 0x006A, 0x006A, 0x006A, 0x006A, 0x006A, 0x006A, 0x006A, 0x006A, 0x006A, 0x006A,
+    0x006A, 0x006A, 0x006A, 0x006A,
+/* DATA_BLOCK: -- 0x0670..0x067F -- */
+    0x006F, 0x0070, 0x0071, 0x0071, 0x002C, 0x006F, 0x006F, 0x006F, 0x006F, 0x006F, 0x006F, 0x006F,
+    0x006F, 0x002C, 0x002C, 0x006F,
+/* DATA_BLOCK: -- 0x0680..0x068F -- */
+    0x006F, 0x002C, 0x002C, 0x006F, 0x006F, 0x006F, 0x006F, 0x006F, 0x006F, 0x006F, 0x006F, 0x006F,
+    0x006F, 0x006F, 0x006F, 0x006F,
+/* DATA_BLOCK: -- 0x0690..0x069F -- */
+    0x006F, 0x006F, 0x006F, 0x006F, 0x006F, 0x006F, 0x006F, 0x006F, 0x006F, 0x002C, 0x006F, 0x006F,
+    0x006F, 0x006F, 0x006F, 0x006F,
+/* DATA_BLOCK: -- 0x06A0..0x06AF -- */
+    0x006F, 0x002C, 0x006F, 0x002C, 0x002C, 0x002C, 0x006F, 0x006F, 0x006F, 0x006F, 0x002C, 0x002C,
+    0x0070, 0x006F, 0x0071, 0x0071,
+/* DATA_BLOCK: -- 0x06B0..0x06BF -- */
+    0x0071, 0x0070, 0x0070, 0x0070, 0x0070, 0x002C, 0x002C, 0x0071, 0x0071, 0x002C, 0x002C, 0x0071,
+    0x0071, 0x0070, 0x006F, 0x002C,
+/* DATA_BLOCK: -- 0x06C0..0x06CF -- */
+    0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x0071, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x006F, 0x006F, 0x002C, 0x006F,
+/* DATA_BLOCK: -- 0x06D0..0x06DF -- */
+    0x006F, 0x006F, 0x0070, 0x0070, 0x002C, 0x002C, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072,
+    0x0072, 0x0072, 0x0072, 0x0072,
+/* DATA_BLOCK: -- 0x06E0..0x06EF -- */
+    0x006F, 0x006F, 0x0073, 0x0073, 0x0074, 0x0074, 0x0074, 0x0074, 0x0074, 0x0074, 0x0075, 0x0073,
+    0x006F, 0x0076, 0x0070, 0x002C,
+/* DATA_BLOCK: -- 0x06F0..0x06FF -- */
+    0x002C, 0x0077, 0x0077, 0x0078, 0x002C, 0x0079, 0x0079, 0x0079, 0x0079, 0x0079, 0x0079, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x0079,
+/* DATA_BLOCK: -- 0x0700..0x070F -- */
+    0x0079, 0x002C, 0x002C, 0x0079, 0x0079, 0x0079, 0x0079, 0x0079, 0x0079, 0x0079, 0x0079, 0x0079,
+    0x0079, 0x0079, 0x0079, 0x0079,
+/* DATA_BLOCK: -- 0x0710..0x071F -- */
+    0x0079, 0x0079, 0x0079, 0x0079, 0x0079, 0x0079, 0x0079, 0x0079, 0x0079, 0x002C, 0x0079, 0x0079,
+    0x0079, 0x0079, 0x0079, 0x0079,
+/* DATA_BLOCK: -- 0x0720..0x072F -- */
+    0x0079, 0x002C, 0x0079, 0x0079, 0x002C, 0x0079, 0x0079, 0x002C, 0x0079, 0x0079, 0x002C, 0x002C,
+    0x0077, 0x002C, 0x0078, 0x0078,
+/* DATA_BLOCK: -- 0x0730..0x073F -- */
+    0x0078, 0x0077, 0x0077, 0x002C, 0x002C, 0x002C, 0x002C, 0x0077, 0x0077, 0x002C, 0x002C, 0x0077,
+    0x0077, 0x0077, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x0740..0x074F -- */
+    0x002C, 0x0077, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x0079, 0x0079, 0x0079,
+    0x0079, 0x002C, 0x0079, 0x002C,
+/* DATA_BLOCK: -- 0x0750..0x075F -- */
+    0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x007A, 0x007A, 0x007A, 0x007A, 0x007A, 0x007A,
+    0x007A, 0x007A, 0x007A, 0x007A,
+/* DATA_BLOCK: -- 0x0760..0x076F -- */
+    0x0077, 0x0077, 0x0079, 0x0079, 0x0079, 0x0077, 0x007B, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x0770..0x077F -- */
+    0x002C, 0x007C, 0x007C, 0x007D, 0x002C, 0x007E, 0x007E, 0x007E, 0x007E, 0x007E, 0x007E, 0x007E,
+    0x007E, 0x007E, 0x002C, 0x007E,
+/* DATA_BLOCK: -- 0x0780..0x078F -- */
+    0x007E, 0x007E, 0x002C, 0x007E, 0x007E, 0x007E, 0x007E, 0x007E, 0x007E, 0x007E, 0x007E, 0x007E,
+    0x007E, 0x007E, 0x007E, 0x007E,
+/* DATA_BLOCK: -- 0x0790..0x079F -- */
+    0x007E, 0x007E, 0x007E, 0x007E, 0x007E, 0x007E, 0x007E, 0x007E, 0x007E, 0x002C, 0x007E, 0x007E,
+    0x007E, 0x007E, 0x007E, 0x007E,
+/* DATA_BLOCK: -- 0x07A0..0x07AF -- */
+    0x007E, 0x002C, 0x007E, 0x007E, 0x002C, 0x007E, 0x007E, 0x007E, 0x007E, 0x007E, 0x002C, 0x002C,
+    0x007C, 0x007E, 0x007D, 0x007D,
+/* DATA_BLOCK: -- 0x07B0..0x07BF -- */
+    0x007D, 0x007C, 0x007C, 0x007C, 0x007C, 0x007C, 0x002C, 0x007C, 0x007C, 0x007D, 0x002C, 0x007D,
+    0x007D, 0x007C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x07C0..0x07CF -- */
+    0x007E, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x07D0..0x07DF -- */
+    0x007E, 0x007E, 0x007C, 0x007C, 0x002C, 0x002C, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
+    0x007F, 0x007F, 0x007F, 0x007F,
+/* DATA_BLOCK: -- 0x07E0..0x07EF -- */
+    0x0080, 0x0081, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x007E, 0x007C, 0x007C,
+    0x007C, 0x007C, 0x007C, 0x007C,
+/* DATA_BLOCK: -- 0x07F0..0x07FF -- */
+    0x002C, 0x0082, 0x0083, 0x0083, 0x002C, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+    0x0084, 0x002C, 0x002C, 0x0084,
+/* DATA_BLOCK: -- 0x0800..0x080F -- */
+    0x0084, 0x002C, 0x002C, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+    0x0084, 0x0084, 0x0084, 0x0084,
+/* DATA_BLOCK: -- 0x0810..0x081F -- */
+    0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x002C, 0x0084, 0x0084,
+    0x0084, 0x0084, 0x0084, 0x0084,
+/* DATA_BLOCK: -- 0x0820..0x082F -- */
+    0x0084, 0x002C, 0x0084, 0x0084, 0x002C, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x002C, 0x002C,
+    0x0082, 0x0084, 0x0083, 0x0082,
+/* DATA_BLOCK: -- 0x0830..0x083F -- */
+    0x0083, 0x0082, 0x0082, 0x0082, 0x0082, 0x002C, 0x002C, 0x0083, 0x0083, 0x002C, 0x002C, 0x0083,
+    0x0083, 0x0082, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x0840..0x084F -- */
+    0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x0082, 0x0082, 0x0083, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x0084, 0x0084, 0x002C, 0x0084,
+/* DATA_BLOCK: -- 0x0850..0x085F -- */
+    0x0084, 0x0084, 0x0082, 0x0082, 0x002C, 0x002C, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+    0x0085, 0x0085, 0x0085, 0x0085,
+/* DATA_BLOCK: -- 0x0860..0x086F -- */
+    0x0086, 0x0084, 0x0087, 0x0087, 0x0087, 0x0087, 0x0087, 0x0087, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x0870..0x087F -- */
+    0x002C, 0x002C, 0x0088, 0x0089, 0x002C, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x002C,
+    0x002C, 0x002C, 0x0089, 0x0089,
+/* DATA_BLOCK: -- 0x0880..0x088F -- */
+    0x0089, 0x002C, 0x0089, 0x0089, 0x0089, 0x0089, 0x002C, 0x002C, 0x002C, 0x0089, 0x0089, 0x002C,
+    0x0089, 0x002C, 0x0089, 0x0089,
+/* DATA_BLOCK: -- 0x0890..0x089F -- */
+    0x002C, 0x002C, 0x002C, 0x0089, 0x0089, 0x002C, 0x002C, 0x002C, 0x0089, 0x0089, 0x0089, 0x002C,
+    0x002C, 0x002C, 0x0089, 0x0089,
+/* DATA_BLOCK: -- 0x08A0..0x08AF -- */
+    0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x008A, 0x008A,
+/* DATA_BLOCK: -- 0x08B0..0x08BF -- */
+    0x0088, 0x008A, 0x008A, 0x002C, 0x002C, 0x002C, 0x008A, 0x008A, 0x008A, 0x002C, 0x008A, 0x008A,
+    0x008A, 0x0088, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x08C0..0x08CF -- */
+    0x0089, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x008A, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x08D0..0x08DF -- */
+    0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B,
+    0x008B, 0x008B, 0x008B, 0x008B,
+/* DATA_BLOCK: -- 0x08E0..0x08EF -- */
+    0x008C, 0x008C, 0x008C, 0x008D, 0x008D, 0x008D, 0x008D, 0x008D, 0x008D, 0x008E, 0x008D, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x08F0..0x08FF -- */
+    0x008F, 0x0090, 0x0090, 0x0090, 0x008F, 0x0091, 0x0091, 0x0091, 0x0091, 0x0091, 0x0091, 0x0091,
+    0x0091, 0x002C, 0x0091, 0x0091,
+/* DATA_BLOCK: -- 0x0900..0x090F -- */
+    0x0091, 0x002C, 0x0091, 0x0091, 0x0091, 0x0091, 0x0091, 0x0091, 0x0091, 0x0091, 0x0091, 0x0091,
+    0x0091, 0x0091, 0x0091, 0x0091,
+/* DATA_BLOCK: -- 0x0910..0x091F -- */
+    0x0091, 0x0091, 0x0091, 0x0091, 0x0091, 0x0091, 0x0091, 0x0091, 0x0091, 0x002C, 0x0091, 0x0091,
+    0x0091, 0x0091, 0x0091, 0x0091,
+/* DATA_BLOCK: -- 0x0920..0x092F -- */
+    0x0091, 0x0091, 0x0091, 0x0091, 0x0091, 0x0091, 0x0091, 0x0091, 0x0091, 0x0091, 0x002C, 0x002C,
+    0x008F, 0x0091, 0x008F, 0x008F,
+/* DATA_BLOCK: -- 0x0930..0x093F -- */
+    0x008F, 0x0090, 0x0090, 0x0090, 0x0090, 0x002C, 0x008F, 0x008F, 0x008F, 0x002C, 0x008F, 0x008F,
+    0x008F, 0x008F, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x0940..0x094F -- */
+    0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x008F, 0x008F, 0x002C, 0x0091, 0x0091, 0x0091, 0x002C,
+    0x002C, 0x0091, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x0950..0x095F -- */
+    0x0091, 0x0091, 0x008F, 0x008F, 0x002C, 0x002C, 0x0092, 0x0092, 0x0092, 0x0092, 0x0092, 0x0092,
+    0x0092, 0x0092, 0x0092, 0x0092,
+/* DATA_BLOCK: -- 0x0960..0x096F -- */
+    0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x0093, 0x0094, 0x0094, 0x0094, 0x0094,
+    0x0094, 0x0094, 0x0094, 0x0095,
+/* DATA_BLOCK: -- 0x0970..0x097F -- */
+    0x0096, 0x0097, 0x0098, 0x0098, 0x0099, 0x0096, 0x0096, 0x0096, 0x0096, 0x0096, 0x0096, 0x0096,
+    0x0096, 0x002C, 0x0096, 0x0096,
+/* DATA_BLOCK: -- 0x0980..0x098F -- */
+    0x0096, 0x002C, 0x0096, 0x0096, 0x0096, 0x0096, 0x0096, 0x0096, 0x0096, 0x0096, 0x0096, 0x0096,
+    0x0096, 0x0096, 0x0096, 0x0096,
+/* DATA_BLOCK: -- 0x0990..0x099F -- */
+    0x0096, 0x0096, 0x0096, 0x0096, 0x0096, 0x0096, 0x0096, 0x0096, 0x0096, 0x002C, 0x0096, 0x0096,
+    0x0096, 0x0096, 0x0096, 0x0096,
+/* DATA_BLOCK: -- 0x09A0..0x09AF -- */
+    0x0096, 0x0096, 0x0096, 0x0096, 0x002C, 0x0096, 0x0096, 0x0096, 0x0096, 0x0096, 0x002C, 0x002C,
+    0x0097, 0x0096, 0x0098, 0x009A,
+/* DATA_BLOCK: -- 0x09B0..0x09BF -- */
+    0x0098, 0x0098, 0x0098, 0x0098, 0x0098, 0x002C, 0x009A, 0x0098, 0x0098, 0x002C, 0x0098, 0x0098,
+    0x0097, 0x0097, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x09C0..0x09CF -- */
+    0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x0098, 0x0098, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x0096, 0x0096, 0x002C,
+/* DATA_BLOCK: -- 0x09D0..0x09DF -- */
+    0x0096, 0x0096, 0x0097, 0x0097, 0x002C, 0x002C, 0x009B, 0x009B, 0x009B, 0x009B, 0x009B, 0x009B,
+    0x009B, 0x009B, 0x009B, 0x009B,
+/* DATA_BLOCK: -- 0x09E0..0x09EF -- */
+    0x002C, 0x0096, 0x0096, 0x0098, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x09F0..0x09FF -- */
+    0x009C, 0x009C, 0x009D, 0x009D, 0x009E, 0x009E, 0x009E, 0x009E, 0x009E, 0x009E, 0x009E, 0x009E,
+    0x009E, 0x002C, 0x009E, 0x009E,
+/* DATA_BLOCK: -- 0x0A00..0x0A0F -- */
+    0x009E, 0x002C, 0x009E, 0x009E, 0x009E, 0x009E, 0x009E, 0x009E, 0x009E, 0x009E, 0x009E, 0x009E,
+    0x009E, 0x009E, 0x009E, 0x009E,
+/* DATA_BLOCK: -- 0x0A10..0x0A1F -- */
+    0x009E, 0x009E, 0x009E, 0x009E, 0x009E, 0x009E, 0x009E, 0x009E, 0x009E, 0x009E, 0x009E, 0x009E,
+    0x009E, 0x009E, 0x009E, 0x009E,
+/* DATA_BLOCK: -- 0x0A20..0x0A2F -- */
+    0x009E, 0x009E, 0x009E, 0x009E, 0x009E, 0x009E, 0x009E, 0x009E, 0x009E, 0x009E, 0x009E, 0x009C,
+    0x009C, 0x009E, 0x009D, 0x009D,
+/* DATA_BLOCK: -- 0x0A30..0x0A3F -- */
+    0x009D, 0x009C, 0x009C, 0x009C, 0x009C, 0x002C, 0x009D, 0x009D, 0x009D, 0x002C, 0x009D, 0x009D,
+    0x009D, 0x009C, 0x009E, 0x009F,
+/* DATA_BLOCK: -- 0x0A40..0x0A4F -- */
+    0x002C, 0x002C, 0x002C, 0x002C, 0x009E, 0x009E, 0x009E, 0x009D, 0x00A0, 0x00A0, 0x00A0, 0x00A0,
+    0x00A0, 0x00A0, 0x00A0, 0x009E,
+/* DATA_BLOCK: -- 0x0A50..0x0A5F -- */
+    0x009E, 0x009E, 0x009C, 0x009C, 0x002C, 0x002C, 0x00A1, 0x00A1, 0x00A1, 0x00A1, 0x00A1, 0x00A1,
+    0x00A1, 0x00A1, 0x00A1, 0x00A1,
+/* DATA_BLOCK: -- 0x0A60..0x0A6F -- */
+    0x00A0, 0x00A0, 0x00A0, 0x00A0, 0x00A0, 0x00A0, 0x00A0, 0x00A0, 0x00A0, 0x009F, 0x009E, 0x009E,
+    0x009E, 0x009E, 0x009E, 0x009E,
+/* DATA_BLOCK: -- 0x0A70..0x0A7F -- */
+    0x002C, 0x00A2, 0x00A3, 0x00A3, 0x002C, 0x00A4, 0x00A4, 0x00A4, 0x00A4, 0x00A4, 0x00A4, 0x00A4,
+    0x00A4, 0x00A4, 0x00A4, 0x00A4,
+/* DATA_BLOCK: -- 0x0A80..0x0A8F -- */
+    0x00A4, 0x00A4, 0x00A4, 0x00A4, 0x00A4, 0x00A4, 0x00A4, 0x002C, 0x002C, 0x002C, 0x00A4, 0x00A4,
+    0x00A4, 0x00A4, 0x00A4, 0x00A4,
+/* DATA_BLOCK: -- 0x0A90..0x0A9F -- */
+    0x00A4, 0x00A4, 0x00A4, 0x00A4, 0x00A4, 0x00A4, 0x00A4, 0x00A4, 0x00A4, 0x00A4, 0x00A4, 0x00A4,
+    0x00A4, 0x00A4, 0x00A4, 0x00A4,
+/* DATA_BLOCK: -- 0x0AA0..0x0AAF -- */
+    0x00A4, 0x00A4, 0x002C, 0x00A4, 0x00A4, 0x00A4, 0x00A4, 0x00A4, 0x00A4, 0x00A4, 0x00A4, 0x00A4,
+    0x002C, 0x00A4, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x0AB0..0x0ABF -- */
+    0x00A4, 0x00A4, 0x00A4, 0x00A4, 0x00A4, 0x00A4, 0x00A4, 0x002C, 0x002C, 0x002C, 0x00A2, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x00A3,
+/* DATA_BLOCK: -- 0x0AC0..0x0ACF -- */
+    0x00A3, 0x00A3, 0x00A2, 0x00A2, 0x00A2, 0x002C, 0x00A2, 0x002C, 0x00A3, 0x00A3, 0x00A3, 0x00A3,
+    0x00A3, 0x00A3, 0x00A3, 0x00A3,
+/* DATA_BLOCK: -- 0x0AD0..0x0ADF -- */
+    0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x00A5, 0x00A5, 0x00A5, 0x00A5, 0x00A5, 0x00A5,
+    0x00A5, 0x00A5, 0x00A5, 0x00A5,
+/* DATA_BLOCK: -- 0x0AE0..0x0AEF -- */
+    0x002C, 0x002C, 0x00A3, 0x00A3, 0x00A6, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x0AF0..0x0AFF -- */
+    0x002C, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7,
+    0x00A7, 0x00A7, 0x00A7, 0x00A7,
+/* DATA_BLOCK: -- 0x0B00..0x0B0F -- */
+    0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7,
+    0x00A7, 0x00A7, 0x00A7, 0x00A7,
+/* DATA_BLOCK: -- 0x0B10..0x0B1F -- */
+    0x00A7, 0x00A8, 0x00A7, 0x00A7, 0x00A8, 0x00A8, 0x00A8, 0x00A8, 0x00A8, 0x00A8, 0x00A8, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x0008,
+/* DATA_BLOCK: -- 0x0B20..0x0B2F -- */
+    0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A9, 0x00A8, 0x00A8, 0x00A8, 0x00A8, 0x00A8,
+    0x00A8, 0x00A8, 0x00A8, 0x00AA,
+/* DATA_BLOCK: -- 0x0B30..0x0B3F -- */
+    0x00AB, 0x00AB, 0x00AB, 0x00AB, 0x00AB, 0x00AB, 0x00AB, 0x00AB, 0x00AB, 0x00AB, 0x00AA, 0x00AA,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x0B40..0x0B4F -- */
+    0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x0B50..0x0B5F -- */
+    0x002C, 0x00AC, 0x00AC, 0x002C, 0x00AC, 0x002C, 0x00AC, 0x00AC, 0x00AC, 0x00AC, 0x00AC, 0x002C,
+    0x00AC, 0x00AC, 0x00AC, 0x00AC,
+/* DATA_BLOCK: -- 0x0B60..0x0B6F -- */
+    0x00AC, 0x00AC, 0x00AC, 0x00AC, 0x00AC, 0x00AC, 0x00AC, 0x00AC, 0x00AC, 0x00AC, 0x00AC, 0x00AC,
+    0x00AC, 0x00AC, 0x00AC, 0x00AC,
+/* DATA_BLOCK: -- 0x0B70..0x0B7F -- */
+    0x00AC, 0x00AC, 0x00AC, 0x00AC, 0x002C, 0x00AC, 0x002C, 0x00AC, 0x00AC, 0x00AC, 0x00AC, 0x00AC,
+    0x00AC, 0x00AC, 0x00AC, 0x00AC,
+/* DATA_BLOCK: -- 0x0B80..0x0B8F -- */
+    0x00AC, 0x00AD, 0x00AC, 0x00AC, 0x00AD, 0x00AD, 0x00AD, 0x00AD, 0x00AD, 0x00AD, 0x00AD, 0x00AD,
+    0x00AD, 0x00AC, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x0B90..0x0B9F -- */
+    0x00AC, 0x00AC, 0x00AC, 0x00AC, 0x00AC, 0x002C, 0x00AE, 0x002C, 0x00AD, 0x00AD, 0x00AD, 0x00AD,
+    0x00AD, 0x00AD, 0x00AD, 0x002C,
+/* DATA_BLOCK: -- 0x0BA0..0x0BAF -- */
+    0x00AF, 0x00AF, 0x00AF, 0x00AF, 0x00AF, 0x00AF, 0x00AF, 0x00AF, 0x00AF, 0x00AF, 0x002C, 0x002C,
+    0x00AC, 0x00AC, 0x00AC, 0x00AC,
+/* DATA_BLOCK: -- 0x0BB0..0x0BBF -- */
+    0x00B0, 0x00B1, 0x00B1, 0x00B1, 0x00B2, 0x00B2, 0x00B2, 0x00B2, 0x00B2, 0x00B2, 0x00B2, 0x00B2,
+    0x00B2, 0x00B2, 0x00B2, 0x00B2,
+/* DATA_BLOCK: -- 0x0BC0..0x0BCF -- */
+    0x00B2, 0x00B2, 0x00B2, 0x00B1, 0x00B2, 0x00B1, 0x00B1, 0x00B1, 0x00B3, 0x00B3, 0x00B1, 0x00B1,
+    0x00B1, 0x00B1, 0x00B1, 0x00B1,
+/* DATA_BLOCK: -- 0x0BD0..0x0BDF -- */
+    0x00B4, 0x00B4, 0x00B4, 0x00B4, 0x00B4, 0x00B4, 0x00B4, 0x00B4, 0x00B4, 0x00B4, 0x00B5, 0x00B5,
+    0x00B5, 0x00B5, 0x00B5, 0x00B5,
+/* DATA_BLOCK: -- 0x0BE0..0x0BEF -- */
+    0x00B5, 0x00B5, 0x00B5, 0x00B5, 0x00B1, 0x00B3, 0x00B1, 0x00B3, 0x00B1, 0x00B3, 0x00B6, 0x00B7,
+    0x00B6, 0x00B7, 0x00B8, 0x00B8,
+/* DATA_BLOCK: -- 0x0BF0..0x0BFF -- */
+    0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x002C, 0x00B0, 0x00B0, 0x00B0,
+    0x00B0, 0x00B0, 0x00B0, 0x00B0,
+/* DATA_BLOCK: -- 0x0C00..0x0C0F -- */
+    0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0,
+    0x00B0, 0x00B0, 0x00B0, 0x00B0,
+/* DATA_BLOCK: -- 0x0C10..0x0C1F -- */
+    0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0,
+    0x00B0, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x0C20..0x0C2F -- */
+    0x002C, 0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x00B3,
+    0x00B3, 0x00B3, 0x00B3, 0x00B8,
+/* DATA_BLOCK: -- 0x0C30..0x0C3F -- */
+    0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x00B2, 0x00B3, 0x00B3, 0x00B0, 0x00B0, 0x00B0, 0x00B0,
+    0x00B0, 0x00B3, 0x00B3, 0x00B3,
+/* DATA_BLOCK: -- 0x0C40..0x0C4F -- */
+    0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x002C, 0x00B3, 0x00B3, 0x00B3,
+    0x00B3, 0x00B3, 0x00B3, 0x00B3,
+/* DATA_BLOCK: -- 0x0C50..0x0C5F -- */
+    0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x00B3,
+    0x00B3, 0x00B3, 0x00B3, 0x00B3,
+/* DATA_BLOCK: -- 0x0C60..0x0C6F -- */
+    0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x00B3,
+    0x00B3, 0x002C, 0x00B1, 0x00B1,
+/* DATA_BLOCK: -- 0x0C70..0x0C7F -- */
+    0x00B1, 0x00B1, 0x00B1, 0x00B1, 0x00B1, 0x00B1, 0x00B3, 0x00B1, 0x00B1, 0x00B1, 0x00B1, 0x00B1,
+    0x00B1, 0x002C, 0x00B1, 0x00B1,
+/* DATA_BLOCK: -- 0x0C80..0x0C8F -- */
+    0x00B2, 0x00B2, 0x00B2, 0x00B2, 0x00B2, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B2, 0x00B2, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x0C90..0x0C9F -- */
+    0x00BA, 0x00BA, 0x00BA, 0x00BA, 0x00BA, 0x00BA, 0x00BA, 0x00BA, 0x00BA, 0x00BA, 0x00BA, 0x00BA,
+    0x00BA, 0x00BA, 0x00BA, 0x00BA,
+/* DATA_BLOCK: -- 0x0CA0..0x0CAF -- */
+    0x00BA, 0x00BA, 0x00BA, 0x00BA, 0x00BA, 0x00BA, 0x00BA, 0x00BA, 0x00BA, 0x00BA, 0x00BA, 0x00BB,
+    0x00BB, 0x00BC, 0x00BC, 0x00BC,
+/* DATA_BLOCK: -- 0x0CB0..0x0CBF -- */
+    0x00BC, 0x00BB, 0x00BC, 0x00BC, 0x00BC, 0x00BC, 0x00BC, 0x00BC, 0x00BB, 0x00BC, 0x00BC, 0x00BB,
+    0x00BB, 0x00BC, 0x00BC, 0x00BA,
+/* DATA_BLOCK: -- 0x0CC0..0x0CCF -- */
+    0x00BD, 0x00BD, 0x00BD, 0x00BD, 0x00BD, 0x00BD, 0x00BD, 0x00BD, 0x00BD, 0x00BD, 0x00BE, 0x00BE,
+    0x00BE, 0x00BE, 0x00BE, 0x00BE,
+/* DATA_BLOCK: -- 0x0CD0..0x0CDF -- */
+    0x00BA, 0x00BA, 0x00BA, 0x00BA, 0x00BA, 0x00BA, 0x00BB, 0x00BB, 0x00BC, 0x00BC, 0x00BA, 0x00BA,
+    0x00BA, 0x00BA, 0x00BC, 0x00BC,
+/* DATA_BLOCK: -- 0x0CE0..0x0CEF -- */
+    0x00BC, 0x00BA, 0x00BB, 0x00BB, 0x00BB, 0x00BA, 0x00BA, 0x00BB, 0x00BB, 0x00BB, 0x00BB, 0x00BB,
+    0x00BB, 0x00BB, 0x00BA, 0x00BA,
+/* DATA_BLOCK: -- 0x0CF0..0x0CFF -- */
+    0x00BA, 0x00BC, 0x00BC, 0x00BC, 0x00BC, 0x00BA, 0x00BA, 0x00BA, 0x00BA, 0x00BA, 0x00BA, 0x00BA,
+    0x00BA, 0x00BA, 0x00BA, 0x00BA,
+/* DATA_BLOCK: -- 0x0D00..0x0D0F -- */
+    0x00BA, 0x00BA, 0x00BC, 0x00BB, 0x00BB, 0x00BC, 0x00BC, 0x00BB, 0x00BB, 0x00BB, 0x00BB, 0x00BB,
+    0x00BB, 0x00BC, 0x00BA, 0x00BB,
+/* DATA_BLOCK: -- 0x0D10..0x0D1F -- */
+    0x00BD, 0x00BD, 0x00BD, 0x00BD, 0x00BD, 0x00BD, 0x00BD, 0x00BD, 0x00BD, 0x00BD, 0x00BB, 0x00BB,
+    0x00BB, 0x00BC, 0x00BF, 0x00BF,
+/* DATA_BLOCK: -- 0x0D20..0x0D2F -- */
+    0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+    0x00C0, 0x00C0, 0x00C0, 0x00C0,
+/* DATA_BLOCK: -- 0x0D30..0x0D3F -- */
+    0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x002C, 0x00C0, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x00C0, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x0D40..0x0D4F -- */
+    0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1,
+    0x00C1, 0x00C1, 0x00C1, 0x00C1,
+/* DATA_BLOCK: -- 0x0D50..0x0D5F -- */
+    0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x006B,
+    0x00C2, 0x00C1, 0x00C1, 0x00C1,
+/* DATA_BLOCK: -- 0x0D60..0x0D6F -- */
+    0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3,
+    0x00C3, 0x00C3, 0x00C3, 0x00C3,
+/* DATA_BLOCK: -- 0x0D70..0x0D7F -- */
+    0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4,
+    0x00C4, 0x00C4, 0x00C4, 0x00C4,
+/* DATA_BLOCK: -- 0x0D80..0x0D8F -- */
+    0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x002C, 0x00C4, 0x00C4,
+    0x00C4, 0x00C4, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x0D90..0x0D9F -- */
+    0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x002C, 0x00C4, 0x002C, 0x00C4, 0x00C4,
+    0x00C4, 0x00C4, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x0DA0..0x0DAF -- */
+    0x00C4, 0x002C, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x002C, 0x002C, 0x00C4, 0x00C4, 0x00C4, 0x00C4,
+    0x00C4, 0x00C4, 0x00C4, 0x002C,
+/* DATA_BLOCK: -- 0x0DB0..0x0DBF -- */
+    0x00C4, 0x002C, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x002C, 0x002C, 0x00C4, 0x00C4, 0x00C4, 0x00C4,
+    0x00C4, 0x00C4, 0x00C4, 0x00C4,
+/* DATA_BLOCK: -- 0x0DC0..0x0DCF -- */
+    0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x002C, 0x00C4, 0x00C4, 0x00C4, 0x00C4,
+    0x00C4, 0x00C4, 0x00C4, 0x00C4,
+/* DATA_BLOCK: -- 0x0DD0..0x0DDF -- */
+    0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x002C,
+    0x002C, 0x00C5, 0x00C5, 0x00C5,
+/* DATA_BLOCK: -- 0x0DE0..0x0DEF -- */
+    0x00C6, 0x00C6, 0x00C6, 0x00C6, 0x00C6, 0x00C6, 0x00C6, 0x00C6, 0x00C6, 0x00C7, 0x00C7, 0x00C7,
+    0x00C7, 0x00C7, 0x00C7, 0x00C7,
+/* DATA_BLOCK: -- 0x0DF0..0x0DFF -- */
+    0x00C7, 0x00C7, 0x00C7, 0x00C7, 0x00C7, 0x00C7, 0x00C7, 0x00C7, 0x00C7, 0x00C7, 0x00C7, 0x00C7,
+    0x00C7, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x0E00..0x0E0F -- */
+    0x00C8, 0x00C8, 0x00C8, 0x00C8, 0x00C8, 0x00C8, 0x00C8, 0x00C8, 0x00C8, 0x00C8, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x0E10..0x0E1F -- */
+    0x00C9, 0x00C9, 0x00C9, 0x00C9, 0x00C9, 0x00C9, 0x00C9, 0x00C9, 0x00C9, 0x00C9, 0x00C9, 0x00C9,
+    0x00C9, 0x00C9, 0x00C9, 0x00C9,
+/* DATA_BLOCK: -- 0x0E20..0x0E2F -- */
+    0x00C9, 0x00C9, 0x00C9, 0x00C9, 0x00C9, 0x00C9, 0x002C, 0x002C, 0x00CA, 0x00CA, 0x00CA, 0x00CA,
+    0x00CA, 0x00CA, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x0E30..0x0E3F -- */
+    0x00CB, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+    0x00CC, 0x00CC, 0x00CC, 0x00CC,
+/* DATA_BLOCK: -- 0x0E40..0x0E4F -- */
+    0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+    0x00CC, 0x00CC, 0x00CC, 0x00CC,
+/* DATA_BLOCK: -- 0x0E50..0x0E5F -- */
+    0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+    0x00CC, 0x00CD, 0x00CE, 0x00CC,
+/* DATA_BLOCK: -- 0x0E60..0x0E6F -- */
+    0x00CF, 0x00D0, 0x00D0, 0x00D0, 0x00D0, 0x00D0, 0x00D0, 0x00D0, 0x00D0, 0x00D0, 0x00D0, 0x00D0,
+    0x00D0, 0x00D0, 0x00D0, 0x00D0,
+/* DATA_BLOCK: -- 0x0E70..0x0E7F -- */
+    0x00D0, 0x00D0, 0x00D0, 0x00D0, 0x00D0, 0x00D0, 0x00D0, 0x00D0, 0x00D0, 0x00D0, 0x00D0, 0x00D1,
+    0x00D2, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x0E80..0x0E8F -- */
+    0x00D3, 0x00D3, 0x00D3, 0x00D3, 0x00D3, 0x00D3, 0x00D3, 0x00D3, 0x00D3, 0x00D3, 0x00D3, 0x00D3,
+    0x00D3, 0x00D3, 0x00D3, 0x00D3,
+/* DATA_BLOCK: -- 0x0E90..0x0E9F -- */
+    0x00D3, 0x00D3, 0x00D3, 0x00D3, 0x00D3, 0x00D3, 0x00D3, 0x00D3, 0x00D3, 0x00D3, 0x00D3, 0x006B,
+    0x006B, 0x006B, 0x00D4, 0x00D4,
+/* DATA_BLOCK: -- 0x0EA0..0x0EAF -- */
+    0x00D4, 0x00D3, 0x00D3, 0x00D3, 0x00D3, 0x00D3, 0x00D3, 0x00D3, 0x00D3, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x0EB0..0x0EBF -- */
+    0x00D5, 0x00D5, 0x00D5, 0x00D5, 0x00D5, 0x00D5, 0x00D5, 0x00D5, 0x00D5, 0x00D5, 0x00D5, 0x00D5,
+    0x00D5, 0x00D5, 0x00D5, 0x00D5,
+/* DATA_BLOCK: -- 0x0EC0..0x0ECF -- */
+    0x00D5, 0x00D5, 0x00D6, 0x00D6, 0x00D6, 0x00D7, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x00D5,
+/* DATA_BLOCK: -- 0x0ED0..0x0EDF -- */
+    0x00D8, 0x00D8, 0x00D8, 0x00D8, 0x00D8, 0x00D8, 0x00D8, 0x00D8, 0x00D8, 0x00D8, 0x00D8, 0x00D8,
+    0x00D8, 0x00D8, 0x00D8, 0x00D8,
+/* DATA_BLOCK: -- 0x0EE0..0x0EEF -- */
+    0x00D8, 0x00D8, 0x00D9, 0x00D9, 0x00DA, 0x006B, 0x006B, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x0EF0..0x0EFF -- */
+    0x00DB, 0x00DB, 0x00DB, 0x00DB, 0x00DB, 0x00DB, 0x00DB, 0x00DB, 0x00DB, 0x00DB, 0x00DB, 0x00DB,
+    0x00DB, 0x00DB, 0x00DB, 0x00DB,
+/* DATA_BLOCK: -- 0x0F00..0x0F0F -- */
+    0x00DB, 0x00DB, 0x00DC, 0x00DC, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x0F10..0x0F1F -- */
+    0x00DD, 0x00DD, 0x00DD, 0x00DD, 0x00DD, 0x00DD, 0x00DD, 0x00DD, 0x00DD, 0x00DD, 0x00DD, 0x00DD,
+    0x00DD, 0x002C, 0x00DD, 0x00DD,
+/* DATA_BLOCK: -- 0x0F20..0x0F2F -- */
+    0x00DD, 0x002C, 0x00DE, 0x00DE, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x0F30..0x0F3F -- */
+    0x00DF, 0x00DF, 0x00DF, 0x00DF, 0x00DF, 0x00DF, 0x00DF, 0x00DF, 0x00DF, 0x00DF, 0x00DF, 0x00DF,
+    0x00DF, 0x00DF, 0x00DF, 0x00DF,
+/* DATA_BLOCK: -- 0x0F40..0x0F4F -- */
+    0x00DF, 0x00DF, 0x00DF, 0x00DF, 0x00E0, 0x00E0, 0x00E1, 0x00E0, 0x00E0, 0x00E0, 0x00E0, 0x00E0,
+    0x00E0, 0x00E0, 0x00E1, 0x00E1,
+/* DATA_BLOCK: -- 0x0F50..0x0F5F -- */
+    0x00E1, 0x00E1, 0x00E1, 0x00E1, 0x00E1, 0x00E1, 0x00E0, 0x00E1, 0x00E1, 0x00E0, 0x00E0, 0x00E0,
+    0x00E0, 0x00E0, 0x00E0, 0x00E0,
+/* DATA_BLOCK: -- 0x0F60..0x0F6F -- */
+    0x00E0, 0x00E0, 0x00E0, 0x00E0, 0x00E2, 0x00E2, 0x00E2, 0x00E3, 0x00E2, 0x00E2, 0x00E2, 0x00E4,
+    0x00DF, 0x00E0, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x0F70..0x0F7F -- */
+    0x00E5, 0x00E5, 0x00E5, 0x00E5, 0x00E5, 0x00E5, 0x00E5, 0x00E5, 0x00E5, 0x00E5, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x0F80..0x0F8F -- */
+    0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x0F90..0x0F9F -- */
+    0x00E7, 0x00E7, 0x0006, 0x0006, 0x00E7, 0x0006, 0x00E8, 0x00E7, 0x00E7, 0x00E7, 0x00E7, 0x00E9,
+    0x00E9, 0x00E9, 0x00EA, 0x00E9,
+/* DATA_BLOCK: -- 0x0FA0..0x0FAF -- */
+    0x00EB, 0x00EB, 0x00EB, 0x00EB, 0x00EB, 0x00EB, 0x00EB, 0x00EB, 0x00EB, 0x00EB, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x0FB0..0x0FBF -- */
+    0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC,
+    0x00EC, 0x00EC, 0x00EC, 0x00EC,
+/* DATA_BLOCK: -- 0x0FC0..0x0FCF -- */
+    0x00EC, 0x00EC, 0x00EC, 0x00ED, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC,
+    0x00EC, 0x00EC, 0x00EC, 0x00EC,
+/* DATA_BLOCK: -- 0x0FD0..0x0FDF -- */
+    0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x0FE0..0x0FEF -- */
+    0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00E9, 0x00E9, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC,
+    0x00EC, 0x00EC, 0x00EC, 0x00EC,
+/* DATA_BLOCK: -- 0x0FF0..0x0FFF -- */
+    0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00E9, 0x00EC, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x1000..0x100F -- */
+    0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x1010..0x101F -- */
+    0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE,
+    0x00EE, 0x00EE, 0x00EE, 0x00EE,
+/* DATA_BLOCK: -- 0x1020..0x102F -- */
+    0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE,
+    0x00EE, 0x00EE, 0x00EE, 0x002C,
+/* DATA_BLOCK: -- 0x1030..0x103F -- */
+    0x00EF, 0x00EF, 0x00EF, 0x00F0, 0x00F0, 0x00F0, 0x00F0, 0x00EF, 0x00EF, 0x00F0, 0x00F0, 0x00F0,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x1040..0x104F -- */
+    0x00F0, 0x00F0, 0x00EF, 0x00F0, 0x00F0, 0x00F0, 0x00F0, 0x00F0, 0x00F0, 0x00EF, 0x00EF, 0x00EF,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x1050..0x105F -- */
+    0x00F1, 0x002C, 0x002C, 0x002C, 0x00F2, 0x00F2, 0x00F3, 0x00F3, 0x00F3, 0x00F3, 0x00F3, 0x00F3,
+    0x00F3, 0x00F3, 0x00F3, 0x00F3,
+/* DATA_BLOCK: -- 0x1060..0x106F -- */
+    0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F4,
+    0x00F4, 0x00F4, 0x00F4, 0x00F4,
+/* DATA_BLOCK: -- 0x1070..0x107F -- */
+    0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F4,
+    0x00F4, 0x00F4, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x1080..0x108F -- */
+    0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x1090..0x109F -- */
+    0x00F5, 0x00F5, 0x00F5, 0x00F5, 0x00F5, 0x00F5, 0x00F5, 0x00F5, 0x00F5, 0x00F5, 0x00F5, 0x00F5,
+    0x00F5, 0x00F5, 0x00F5, 0x00F5,
+/* DATA_BLOCK: -- 0x10A0..0x10AF -- */
+    0x00F5, 0x00F5, 0x00F5, 0x00F5, 0x00F5, 0x00F5, 0x00F5, 0x00F5, 0x00F5, 0x00F5, 0x00F5, 0x00F5,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x10B0..0x10BF -- */
+    0x00F5, 0x00F5, 0x00F5, 0x00F5, 0x00F5, 0x00F5, 0x00F5, 0x00F5, 0x00F5, 0x00F5, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x10C0..0x10CF -- */
+    0x00F6, 0x00F6, 0x00F6, 0x00F6, 0x00F6, 0x00F6, 0x00F6, 0x00F6, 0x00F6, 0x00F6, 0x00F7, 0x002C,
+    0x002C, 0x002C, 0x00F8, 0x00F8,
+/* DATA_BLOCK: -- 0x10D0..0x10DF -- */
+    0x00F9, 0x00F9, 0x00F9, 0x00F9, 0x00F9, 0x00F9, 0x00F9, 0x00F9, 0x00F9, 0x00F9, 0x00F9, 0x00F9,
+    0x00F9, 0x00F9, 0x00F9, 0x00F9,
+/* DATA_BLOCK: -- 0x10E0..0x10EF -- */
+    0x00FA, 0x00FA, 0x00FA, 0x00FA, 0x00FA, 0x00FA, 0x00FA, 0x00FA, 0x00FA, 0x00FA, 0x00FA, 0x00FA,
+    0x00FA, 0x00FA, 0x00FA, 0x00FA,
+/* DATA_BLOCK: -- 0x10F0..0x10FF -- */
+    0x00FA, 0x00FA, 0x00FA, 0x00FA, 0x00FA, 0x00FA, 0x00FA, 0x00FB, 0x00FB, 0x00FC, 0x00FC, 0x00FB,
+    0x002C, 0x002C, 0x00FD, 0x00FD,
+/* DATA_BLOCK: -- 0x1100..0x110F -- */
+    0x00FE, 0x00FE, 0x00FE, 0x00FE, 0x00FE, 0x00FE, 0x00FE, 0x00FE, 0x00FE, 0x00FE, 0x00FE, 0x00FE,
+    0x00FE, 0x00FE, 0x00FE, 0x00FE,
+/* DATA_BLOCK: -- 0x1110..0x111F -- */
+    0x00FE, 0x00FE, 0x00FE, 0x00FE, 0x00FE, 0x00FF, 0x0100, 0x00FF, 0x0100, 0x0100, 0x0100, 0x0100,
+    0x0100, 0x0100, 0x0100, 0x002C,
+/* DATA_BLOCK: -- 0x1120..0x112F -- */
+    0x0100, 0x00FF, 0x0100, 0x00FF, 0x00FF, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100,
+    0x0100, 0x00FF, 0x00FF, 0x00FF,
+/* DATA_BLOCK: -- 0x1130..0x113F -- */
+    0x00FF, 0x00FF, 0x00FF, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100,
+    0x0100, 0x002C, 0x002C, 0x0100,
+/* DATA_BLOCK: -- 0x1140..0x114F -- */
+    0x0101, 0x0101, 0x0101, 0x0101, 0x0101, 0x0101, 0x0101, 0x0101, 0x0101, 0x0101, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x1150..0x115F -- */
+    0x0102, 0x0102, 0x0102, 0x0102, 0x0102, 0x0102, 0x0102, 0x0103, 0x0102, 0x0102, 0x0102, 0x0102,
+    0x0102, 0x0102, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x1160..0x116F -- */
+    0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028,
+    0x0028, 0x0028, 0x0104, 0x0028,
+/* DATA_BLOCK: -- 0x1170..0x117F -- */
+    0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028,
+    0x0028, 0x0028, 0x0028, 0x002C,
+/* DATA_BLOCK: -- 0x1180..0x118F -- */
+    0x0105, 0x0105, 0x0105, 0x0105, 0x0106, 0x0107, 0x0107, 0x0107, 0x0107, 0x0107, 0x0107, 0x0107,
+    0x0107, 0x0107, 0x0107, 0x0107,
+/* DATA_BLOCK: -- 0x1190..0x119F -- */
+    0x0107, 0x0107, 0x0107, 0x0107, 0x0107, 0x0107, 0x0107, 0x0107, 0x0107, 0x0107, 0x0107, 0x0107,
+    0x0107, 0x0107, 0x0107, 0x0107,
+/* DATA_BLOCK: -- 0x11A0..0x11AF -- */
+    0x0107, 0x0107, 0x0107, 0x0107, 0x0105, 0x0106, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0106,
+    0x0105, 0x0106, 0x0106, 0x0106,
+/* DATA_BLOCK: -- 0x11B0..0x11BF -- */
+    0x0106, 0x0106, 0x0105, 0x0106, 0x0106, 0x0107, 0x0107, 0x0107, 0x0107, 0x0107, 0x0107, 0x0107,
+    0x0107, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x11C0..0x11CF -- */
+    0x0108, 0x0108, 0x0108, 0x0108, 0x0108, 0x0108, 0x0108, 0x0108, 0x0108, 0x0108, 0x0109, 0x0109,
+    0x0109, 0x0109, 0x0109, 0x0109,
+/* DATA_BLOCK: -- 0x11D0..0x11DF -- */
+    0x0109, 0x010A, 0x010A, 0x010A, 0x010A, 0x010A, 0x010A, 0x010A, 0x010A, 0x010A, 0x010A, 0x0105,
+    0x0105, 0x0105, 0x0105, 0x0105,
+/* DATA_BLOCK: -- 0x11E0..0x11EF -- */
+    0x0105, 0x0105, 0x0105, 0x0105, 0x010A, 0x010A, 0x010A, 0x010A, 0x010A, 0x010A, 0x010A, 0x010A,
+    0x010A, 0x0109, 0x0109, 0x002C,
+/* DATA_BLOCK: -- 0x11F0..0x11FF -- */
+    0x010B, 0x010B, 0x010C, 0x010D, 0x010D, 0x010D, 0x010D, 0x010D, 0x010D, 0x010D, 0x010D, 0x010D,
+    0x010D, 0x010D, 0x010D, 0x010D,
+/* DATA_BLOCK: -- 0x1200..0x120F -- */
+    0x010D, 0x010D, 0x010D, 0x010D, 0x010D, 0x010D, 0x010D, 0x010D, 0x010D, 0x010D, 0x010D, 0x010D,
+    0x010D, 0x010D, 0x010D, 0x010D,
+/* DATA_BLOCK: -- 0x1210..0x121F -- */
+    0x010D, 0x010C, 0x010B, 0x010B, 0x010B, 0x010B, 0x010C, 0x010C, 0x010B, 0x010B, 0x010C, 0x010B,
+    0x010B, 0x010B, 0x010D, 0x010D,
+/* DATA_BLOCK: -- 0x1220..0x122F -- */
+    0x010E, 0x010E, 0x010E, 0x010E, 0x010E, 0x010E, 0x010E, 0x010E, 0x010E, 0x010E, 0x010D, 0x010D,
+    0x010D, 0x010D, 0x010D, 0x010D,
+/* DATA_BLOCK: -- 0x1230..0x123F -- */
+    0x010F, 0x010F, 0x010F, 0x010F, 0x010F, 0x010F, 0x010F, 0x010F, 0x010F, 0x010F, 0x010F, 0x010F,
+    0x010F, 0x010F, 0x010F, 0x010F,
+/* DATA_BLOCK: -- 0x1240..0x124F -- */
+    0x010F, 0x010F, 0x010F, 0x010F, 0x010F, 0x010F, 0x0110, 0x0111, 0x0110, 0x0110, 0x0111, 0x0111,
+    0x0111, 0x0110, 0x0111, 0x0110,
+/* DATA_BLOCK: -- 0x1250..0x125F -- */
+    0x0110, 0x0110, 0x0111, 0x0111, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x0112, 0x0112, 0x0112, 0x0112,
+/* DATA_BLOCK: -- 0x1260..0x126F -- */
+    0x0113, 0x0113, 0x0113, 0x0113, 0x0113, 0x0113, 0x0113, 0x0113, 0x0113, 0x0113, 0x0113, 0x0113,
+    0x0113, 0x0113, 0x0113, 0x0113,
+/* DATA_BLOCK: -- 0x1270..0x127F -- */
+    0x0113, 0x0113, 0x0113, 0x0113, 0x0114, 0x0114, 0x0114, 0x0114, 0x0114, 0x0114, 0x0114, 0x0114,
+    0x0115, 0x0115, 0x0115, 0x0115,
+/* DATA_BLOCK: -- 0x1280..0x128F -- */
+    0x0115, 0x0115, 0x0115, 0x0115, 0x0114, 0x0114, 0x0115, 0x0115, 0x002C, 0x002C, 0x002C, 0x0116,
+    0x0116, 0x0116, 0x0116, 0x0116,
+/* DATA_BLOCK: -- 0x1290..0x129F -- */
+    0x0117, 0x0117, 0x0117, 0x0117, 0x0117, 0x0117, 0x0117, 0x0117, 0x0117, 0x0117, 0x002C, 0x002C,
+    0x002C, 0x0113, 0x0113, 0x0113,
+/* DATA_BLOCK: -- 0x12A0..0x12AF -- */
+    0x0118, 0x0118, 0x0118, 0x0118, 0x0118, 0x0118, 0x0118, 0x0118, 0x0118, 0x0118, 0x0119, 0x0119,
+    0x0119, 0x0119, 0x0119, 0x0119,
+/* DATA_BLOCK: -- 0x12B0..0x12BF -- */
+    0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119,
+    0x0119, 0x0119, 0x0119, 0x0119,
+/* DATA_BLOCK: -- 0x12C0..0x12CF -- */
+    0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x011A, 0x011A, 0x011A, 0x011A,
+    0x011A, 0x011A, 0x011B, 0x011B,
+/* DATA_BLOCK: -- 0x12D0..0x12DF -- */
+    0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x12E0..0x12EF -- */
+    0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x002C,
+    0x002C, 0x00C0, 0x00C0, 0x00C0,
+/* DATA_BLOCK: -- 0x12F0..0x12FF -- */
+    0x011C, 0x011C, 0x011C, 0x011C, 0x011C, 0x011C, 0x011C, 0x011C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x1300..0x130F -- */
+    0x0028, 0x0028, 0x0028, 0x006B, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028,
+    0x0028, 0x0028, 0x0028, 0x0028,
+/* DATA_BLOCK: -- 0x1310..0x131F -- */
+    0x0028, 0x011D, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x011E, 0x011E, 0x011E,
+    0x011E, 0x0028, 0x011E, 0x011E,
+/* DATA_BLOCK: -- 0x1320..0x132F -- */
+    0x011E, 0x011E, 0x011E, 0x011E, 0x0028, 0x011E, 0x011E, 0x011D, 0x0028, 0x0028, 0x011E, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x1330..0x133F -- */
+    0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x0032,
+    0x0024, 0x0024, 0x0024, 0x0024,
+/* DATA_BLOCK: -- 0x1340..0x134F -- */
+    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
+    0x0024, 0x0024, 0x0024, 0x0024,
+/* DATA_BLOCK: -- 0x1350..0x135F -- */
+    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
+    0x0024, 0x002D, 0x002D, 0x002D,
+/* DATA_BLOCK: -- 0x1360..0x136F -- */
+    0x002D, 0x002D, 0x0024, 0x0024, 0x0024, 0x0024, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x0017,
+    0x0017, 0x0017, 0x0017, 0x0017,
+/* DATA_BLOCK: -- 0x1370..0x137F -- */
+    0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x011F, 0x0017, 0x0017, 0x0017,
+    0x0017, 0x0017, 0x0017, 0x0017,
+/* DATA_BLOCK: -- 0x1380..0x138F -- */
+    0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0024,
+    0x0024, 0x0024, 0x0024, 0x0024,
+/* DATA_BLOCK: -- 0x1390..0x139F -- */
+    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
+    0x0024, 0x0024, 0x0024, 0x002D,
+/* DATA_BLOCK: -- 0x13A0..0x13AF -- */
+    0x0012, 0x0017, 0x0012, 0x0017, 0x0012, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017,
+    0x0017, 0x0017, 0x0012, 0x0017,
+/* DATA_BLOCK: -- 0x13B0..0x13BF -- */
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x0029, 0x0029, 0x0029, 0x0029,
+    0x0029, 0x0029, 0x0029, 0x0029,
+/* DATA_BLOCK: -- 0x13C0..0x13CF -- */
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002C, 0x002C, 0x0029, 0x0029, 0x0029, 0x0029,
+    0x0029, 0x0029, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x13D0..0x13DF -- */
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002C, 0x0029, 0x002C, 0x0029,
+    0x002C, 0x0029, 0x002C, 0x0029,
+/* DATA_BLOCK: -- 0x13E0..0x13EF -- */
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x002A, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x13F0..0x13FF -- */
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x0120, 0x0120, 0x0120, 0x0120,
+    0x0120, 0x0120, 0x0120, 0x0120,
+/* DATA_BLOCK: -- 0x1400..0x140F -- */
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002C, 0x002A, 0x002A, 0x0029, 0x0029, 0x0029, 0x0029,
+    0x0120, 0x002B, 0x002A, 0x002B,
+/* DATA_BLOCK: -- 0x1410..0x141F -- */
+    0x002B, 0x002B, 0x002A, 0x002A, 0x002A, 0x002C, 0x002A, 0x002A, 0x0029, 0x0029, 0x0029, 0x0029,
+    0x0120, 0x002B, 0x002B, 0x002B,
+/* DATA_BLOCK: -- 0x1420..0x142F -- */
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002C, 0x002C, 0x002A, 0x002A, 0x0029, 0x0029, 0x0029, 0x0029,
+    0x002C, 0x002B, 0x002B, 0x002B,
+/* DATA_BLOCK: -- 0x1430..0x143F -- */
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x0029, 0x0029, 0x0029, 0x0029,
+    0x0029, 0x002B, 0x002B, 0x002B,
+/* DATA_BLOCK: -- 0x1440..0x144F -- */
+    0x002C, 0x002C, 0x002A, 0x002A, 0x002A, 0x002C, 0x002A, 0x002A, 0x0029, 0x0029, 0x0029, 0x0029,
+    0x0120, 0x002B, 0x002B, 0x002C,
+/* DATA_BLOCK: -- 0x1450..0x145F -- */
+    0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x001C,
+    0x0121, 0x0121, 0x0122, 0x0123,
+/* DATA_BLOCK: -- 0x1460..0x146F -- */
+    0x0124, 0x0124, 0x0124, 0x0124, 0x0124, 0x0124, 0x0006, 0x0006, 0x0125, 0x0126, 0x0127, 0x0125,
+    0x0125, 0x0126, 0x0127, 0x0125,
+/* DATA_BLOCK: -- 0x1470..0x147F -- */
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0128, 0x0129, 0x012A, 0x012B,
+    0x012C, 0x012D, 0x012E, 0x0018,
+/* DATA_BLOCK: -- 0x1480..0x148F -- */
+    0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0006, 0x0006, 0x0006, 0x0006, 0x012F, 0x0130, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0016,
+/* DATA_BLOCK: -- 0x1490..0x149F -- */
+    0x0016, 0x0006, 0x0006, 0x0006, 0x0131, 0x0009, 0x000A, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006,
+/* DATA_BLOCK: -- 0x14A0..0x14AF -- */
+    0x0006, 0x0006, 0x0010, 0x0006, 0x0016, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0005,
+/* DATA_BLOCK: -- 0x14B0..0x14BF -- */
+    0x001C, 0x001C, 0x001C, 0x001C, 0x001C, 0x0132, 0x0133, 0x0134, 0x0135, 0x0136, 0x001C, 0x001C,
+    0x001C, 0x001C, 0x001C, 0x001C,
+/* DATA_BLOCK: -- 0x14C0..0x14CF -- */
+    0x001F, 0x0024, 0x002C, 0x002C, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x000B, 0x000B,
+    0x0010, 0x0009, 0x000A, 0x0024,
+/* DATA_BLOCK: -- 0x14D0..0x14DF -- */
+    0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x000B, 0x000B,
+    0x0010, 0x0009, 0x000A, 0x002C,
+/* DATA_BLOCK: -- 0x14E0..0x14EF -- */
+    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
+    0x0024, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x14F0..0x14FF -- */
+    0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+    0x0008, 0x0008, 0x0008, 0x0008,
+/* DATA_BLOCK: -- 0x1500..0x150F -- */
+    0x0008, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x1510..0x151F -- */
+    0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028,
+    0x0028, 0x0104, 0x0104, 0x0104,
+/* DATA_BLOCK: -- 0x1520..0x152F -- */
+    0x0104, 0x0028, 0x0104, 0x0104, 0x0104, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028,
+    0x0028, 0x0028, 0x0028, 0x0028,
+/* DATA_BLOCK: -- 0x1530..0x153F -- */
+    0x0028, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x1540..0x154F -- */
+    0x0019, 0x0019, 0x0137, 0x0019, 0x0019, 0x0019, 0x0019, 0x0137, 0x0019, 0x0019, 0x0020, 0x0137,
+    0x0137, 0x0137, 0x0020, 0x0020,
+/* DATA_BLOCK: -- 0x1550..0x155F -- */
+    0x0137, 0x0137, 0x0137, 0x0020, 0x0019, 0x0137, 0x0019, 0x0019, 0x0010, 0x0137, 0x0137, 0x0137,
+    0x0137, 0x0137, 0x0019, 0x0019,
+/* DATA_BLOCK: -- 0x1560..0x156F -- */
+    0x0019, 0x0019, 0x0019, 0x0019, 0x0137, 0x0019, 0x0029, 0x0019, 0x0137, 0x0019, 0x0012, 0x0012,
+    0x0137, 0x0137, 0x001D, 0x0020,
+/* DATA_BLOCK: -- 0x1570..0x157F -- */
+    0x0137, 0x0137, 0x0012, 0x0137, 0x0020, 0x011E, 0x011E, 0x011E, 0x011E, 0x0020, 0x0019, 0x0019,
+    0x0020, 0x0020, 0x0137, 0x0137,
+/* DATA_BLOCK: -- 0x1580..0x158F -- */
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0137, 0x0020, 0x0020, 0x0020, 0x0020, 0x0019, 0x0010,
+    0x0019, 0x0019, 0x0017, 0x00B9,
+/* DATA_BLOCK: -- 0x1590..0x159F -- */
+    0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022,
+    0x0022, 0x0022, 0x0022, 0x0022,
+/* DATA_BLOCK: -- 0x15A0..0x15AF -- */
+    0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138,
+    0x0138, 0x0138, 0x0138, 0x0138,
+/* DATA_BLOCK: -- 0x15B0..0x15BF -- */
+    0x0138, 0x0138, 0x0138, 0x0012, 0x0017, 0x0138, 0x0138, 0x0138, 0x0138, 0x0022, 0x0019, 0x0019,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x15C0..0x15CF -- */
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0010, 0x0010,
+    0x0019, 0x0019, 0x0019, 0x0019,
+/* DATA_BLOCK: -- 0x15D0..0x15DF -- */
+    0x0010, 0x0019, 0x0019, 0x0010, 0x0019, 0x0019, 0x0010, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019,
+    0x0019, 0x0019, 0x0010, 0x0019,
+/* DATA_BLOCK: -- 0x15E0..0x15EF -- */
+    0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019,
+    0x0019, 0x0019, 0x0019, 0x0019,
+/* DATA_BLOCK: -- 0x15F0..0x15FF -- */
+    0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019,
+    0x0019, 0x0019, 0x0010, 0x0010,
+/* DATA_BLOCK: -- 0x1600..0x160F -- */
+    0x0019, 0x0019, 0x0010, 0x0019, 0x0010, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019,
+    0x0019, 0x0019, 0x0019, 0x0019,
+/* DATA_BLOCK: -- 0x1610..0x161F -- */
+    0x0019, 0x0019, 0x0019, 0x0019, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010,
+/* DATA_BLOCK: -- 0x1620..0x162F -- */
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0139, 0x0139, 0x0139, 0x013A,
+    0x013A, 0x013A, 0x0010, 0x0010,
+/* DATA_BLOCK: -- 0x1630..0x163F -- */
+    0x0010, 0x0010, 0x000B, 0x001E, 0x0010, 0x013B, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x013C,
+/* DATA_BLOCK: -- 0x1640..0x164F -- */
+    0x013D, 0x013E, 0x013F, 0x0010, 0x0140, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010,
+/* DATA_BLOCK: -- 0x1650..0x165F -- */
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0141, 0x0142, 0x0010, 0x0010,
+/* DATA_BLOCK: -- 0x1660..0x166F -- */
+    0x0010, 0x0010, 0x0010, 0x0143, 0x0010, 0x0144, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0145, 0x0010, 0x0010, 0x0010,
+/* DATA_BLOCK: -- 0x1670..0x167F -- */
+    0x0010, 0x0010, 0x0141, 0x0142, 0x0141, 0x0142, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010,
+/* DATA_BLOCK: -- 0x1680..0x168F -- */
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0141, 0x0142, 0x0141, 0x0142, 0x0141, 0x0142, 0x0141, 0x0142,
+    0x0010, 0x0010, 0x0141, 0x0142,
+/* DATA_BLOCK: -- 0x1690..0x169F -- */
+    0x0141, 0x0142, 0x0141, 0x0142, 0x0141, 0x0142, 0x0141, 0x0142, 0x0141, 0x0142, 0x0141, 0x0142,
+    0x0141, 0x0142, 0x0141, 0x0142,
+/* DATA_BLOCK: -- 0x16A0..0x16AF -- */
+    0x0141, 0x0142, 0x0141, 0x0142, 0x0141, 0x0142, 0x0141, 0x0142, 0x0141, 0x0142, 0x0141, 0x0142,
+    0x0010, 0x0010, 0x0010, 0x0141,
+/* DATA_BLOCK: -- 0x16B0..0x16BF -- */
+    0x0142, 0x0141, 0x0142, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0146, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010,
+/* DATA_BLOCK: -- 0x16C0..0x16CF -- */
+    0x0010, 0x0010, 0x0141, 0x0142, 0x0010, 0x0010, 0x0147, 0x0010, 0x0148, 0x0149, 0x0010, 0x0149,
+    0x0010, 0x0010, 0x0010, 0x0010,
+/* DATA_BLOCK: -- 0x16D0..0x16DF -- */
+    0x0141, 0x0142, 0x0141, 0x0142, 0x0141, 0x0142, 0x0141, 0x0142, 0x014A, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010,
+/* DATA_BLOCK: -- 0x16E0..0x16EF -- */
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0141, 0x0142, 0x0141,
+    0x0142, 0x014B, 0x0010, 0x0010,
+/* DATA_BLOCK: -- 0x16F0..0x16FF -- */
+    0x0141, 0x0142, 0x0010, 0x0010, 0x0010, 0x0010, 0x0141, 0x0142, 0x0141, 0x0142, 0x0141, 0x0142,
+    0x0141, 0x0142, 0x0141, 0x0142,
+/* DATA_BLOCK: -- 0x1700..0x170F -- */
+    0x0141, 0x0142, 0x0141, 0x0142, 0x0141, 0x0142, 0x0141, 0x0142, 0x0141, 0x0142, 0x0141, 0x0142,
+    0x0141, 0x0142, 0x0010, 0x0010,
+/* DATA_BLOCK: -- 0x1710..0x171F -- */
+    0x0141, 0x0142, 0x014C, 0x014C, 0x014C, 0x0010, 0x0144, 0x0144, 0x0010, 0x0010, 0x014D, 0x014D,
+    0x014D, 0x0145, 0x0145, 0x0010,
+/* DATA_BLOCK: -- 0x1720..0x172F -- */
+    0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0009, 0x000A, 0x0009, 0x000A,
+    0x0019, 0x0019, 0x0019, 0x0019,
+/* DATA_BLOCK: -- 0x1730..0x173F -- */
+    0x0010, 0x0010, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0009, 0x000A, 0x0019,
+    0x0019, 0x0019, 0x0019, 0x0019,
+/* DATA_BLOCK: -- 0x1740..0x174F -- */
+    0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9,
+    0x00B9, 0x00B9, 0x00B9, 0x00B9,
+/* DATA_BLOCK: -- 0x1750..0x175F -- */
+    0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9,
+    0x00B9, 0x00B9, 0x00B9, 0x00B9,
+/* DATA_BLOCK: -- 0x1760..0x176F -- */
+    0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x0019,
+    0x0010, 0x0019, 0x0019, 0x0019,
+/* DATA_BLOCK: -- 0x1770..0x177F -- */
+    0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x00B9, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010,
+/* DATA_BLOCK: -- 0x1780..0x178F -- */
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010,
+/* DATA_BLOCK: -- 0x1790..0x179F -- */
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019,
+    0x0019, 0x0019, 0x0019, 0x0019,
+/* DATA_BLOCK: -- 0x17A0..0x17AF -- */
+    0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019,
+    0x0010, 0x0010, 0x0010, 0x0010,
+/* DATA_BLOCK: -- 0x17B0..0x17BF -- */
+    0x0010, 0x0010, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019,
+    0x0019, 0x0019, 0x0019, 0x0019,
+/* DATA_BLOCK: -- 0x17C0..0x17CF -- */
+    0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x17D0..0x17DF -- */
+    0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x17E0..0x17EF -- */
+    0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x001F, 0x001F, 0x001F, 0x001F,
+    0x001F, 0x001F, 0x001F, 0x001F,
+/* DATA_BLOCK: -- 0x17F0..0x17FF -- */
+    0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F,
+    0x00B9, 0x00B9, 0x00B9, 0x00B9,
+/* DATA_BLOCK: -- 0x1800..0x180F -- */
+    0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x0022, 0x0022,
+    0x0022, 0x0022, 0x0022, 0x0022,
+/* DATA_BLOCK: -- 0x1810..0x181F -- */
+    0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0010, 0x0019, 0x0019, 0x0019, 0x0019,
+    0x0019, 0x0019, 0x0019, 0x0019,
+/* DATA_BLOCK: -- 0x1820..0x182F -- */
+    0x0019, 0x0010, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019,
+    0x0019, 0x0019, 0x0019, 0x0019,
+/* DATA_BLOCK: -- 0x1830..0x183F -- */
+    0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010,
+/* DATA_BLOCK: -- 0x1840..0x184F -- */
+    0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019,
+    0x0019, 0x0019, 0x0019, 0x0010,
+/* DATA_BLOCK: -- 0x1850..0x185F -- */
+    0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019,
+    0x00B9, 0x0019, 0x0019, 0x0019,
+/* DATA_BLOCK: -- 0x1860..0x186F -- */
+    0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0009, 0x000A, 0x0009, 0x000A,
+    0x0009, 0x000A, 0x0009, 0x000A,
+/* DATA_BLOCK: -- 0x1870..0x187F -- */
+    0x0009, 0x000A, 0x0009, 0x000A, 0x0009, 0x000A, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022,
+    0x0022, 0x0022, 0x0022, 0x0022,
+/* DATA_BLOCK: -- 0x1880..0x188F -- */
+    0x0022, 0x0022, 0x0022, 0x0022, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019,
+    0x0019, 0x0019, 0x0019, 0x0019,
+/* DATA_BLOCK: -- 0x1890..0x189F -- */
+    0x0010, 0x0010, 0x0010, 0x0141, 0x0142, 0x0009, 0x000A, 0x0010, 0x0141, 0x0142, 0x0010, 0x000F,
+    0x0010, 0x0011, 0x0010, 0x0010,
+/* DATA_BLOCK: -- 0x18A0..0x18AF -- */
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0141, 0x0142, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x014E, 0x0141, 0x0142, 0x0010,
+/* DATA_BLOCK: -- 0x18B0..0x18BF -- */
+    0x0010, 0x0010, 0x0141, 0x0142, 0x0141, 0x0142, 0x0009, 0x000A, 0x0009, 0x000A, 0x0009, 0x000A,
+    0x0009, 0x000A, 0x0009, 0x000A,
+/* DATA_BLOCK: -- 0x18C0..0x18CF -- */
+    0x014F, 0x014F, 0x014F, 0x014F, 0x014F, 0x014F, 0x014F, 0x014F, 0x014F, 0x014F, 0x014F, 0x014F,
+    0x014F, 0x014F, 0x014F, 0x014F,
+/* DATA_BLOCK: -- 0x18D0..0x18DF -- */
+    0x0010, 0x0010, 0x0010, 0x0009, 0x000A, 0x0009, 0x000A, 0x0009, 0x000A, 0x0009, 0x000A, 0x0009,
+    0x000A, 0x0150, 0x0151, 0x0152,
+/* DATA_BLOCK: -- 0x18E0..0x18EF -- */
+    0x0153, 0x0009, 0x000A, 0x0009, 0x000A, 0x0009, 0x000A, 0x0009, 0x000A, 0x0010, 0x0010, 0x0154,
+    0x0010, 0x0010, 0x0010, 0x0010,
+/* DATA_BLOCK: -- 0x18F0..0x18FF -- */
+    0x0155, 0x0010, 0x0010, 0x0156, 0x0141, 0x0142, 0x0010, 0x0010, 0x0141, 0x0142, 0x0141, 0x0142,
+    0x0141, 0x0142, 0x0141, 0x0142,
+/* DATA_BLOCK: -- 0x1900..0x190F -- */
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0157, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010,
+/* DATA_BLOCK: -- 0x1910..0x191F -- */
+    0x0141, 0x0142, 0x0010, 0x0010, 0x0141, 0x0142, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0141,
+/* DATA_BLOCK: -- 0x1920..0x192F -- */
+    0x0142, 0x0141, 0x0142, 0x0010, 0x0141, 0x0142, 0x0010, 0x0010, 0x0009, 0x000A, 0x0009, 0x000A,
+    0x0010, 0x0010, 0x0010, 0x0010,
+/* DATA_BLOCK: -- 0x1930..0x193F -- */
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0141, 0x0142, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010,
+/* DATA_BLOCK: -- 0x1940..0x194F -- */
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0158, 0x0010, 0x0010, 0x0141, 0x0142, 0x0010, 0x0010,
+    0x0009, 0x000A, 0x0010, 0x0010,
+/* DATA_BLOCK: -- 0x1950..0x195F -- */
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0141,
+    0x0142, 0x0141, 0x0142, 0x0010,
+/* DATA_BLOCK: -- 0x1960..0x196F -- */
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0141, 0x0142, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0141, 0x0142, 0x0010, 0x0010,
+/* DATA_BLOCK: -- 0x1970..0x197F -- */
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0141, 0x0142, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010,
+/* DATA_BLOCK: -- 0x1980..0x198F -- */
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0141, 0x0142, 0x0141,
+    0x0142, 0x0141, 0x0142, 0x0141,
+/* DATA_BLOCK: -- 0x1990..0x199F -- */
+    0x0142, 0x0141, 0x0142, 0x0141, 0x0142, 0x0141, 0x0142, 0x0141, 0x0142, 0x0141, 0x0142, 0x0141,
+    0x0142, 0x0141, 0x0142, 0x0141,
+/* DATA_BLOCK: -- 0x19A0..0x19AF -- */
+    0x0142, 0x0141, 0x0142, 0x0010, 0x0010, 0x0010, 0x0141, 0x0142, 0x0141, 0x0142, 0x0141, 0x0142,
+    0x0141, 0x0142, 0x0010, 0x0141,
+/* DATA_BLOCK: -- 0x19B0..0x19BF -- */
+    0x0142, 0x0141, 0x0142, 0x0141, 0x0142, 0x0141, 0x0142, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0159, 0x0010,
+/* DATA_BLOCK: -- 0x19C0..0x19CF -- */
+    0x0010, 0x0010, 0x0010, 0x015A, 0x015B, 0x015A, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0141, 0x0142, 0x015C, 0x0010,
+/* DATA_BLOCK: -- 0x19D0..0x19DF -- */
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0141, 0x0142, 0x0141, 0x0142, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010,
+/* DATA_BLOCK: -- 0x19E0..0x19EF -- */
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0019, 0x0019, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0019, 0x0019, 0x0019,
+/* DATA_BLOCK: -- 0x19F0..0x19FF -- */
+    0x0019, 0x0019, 0x0019, 0x0019, 0x002C, 0x002C, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019,
+    0x0019, 0x0019, 0x0019, 0x0019,
+/* DATA_BLOCK: -- 0x1A00..0x1A0F -- */
+    0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x002C, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019,
+    0x0019, 0x0019, 0x0019, 0x0019,
+/* DATA_BLOCK: -- 0x1A10..0x1A1F -- */
+    0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019,
+    0x0019, 0x0019, 0x015D, 0x0019,
+/* DATA_BLOCK: -- 0x1A20..0x1A2F -- */
+    0x015E, 0x015E, 0x015E, 0x015E, 0x015E, 0x015E, 0x015E, 0x015E, 0x015E, 0x015E, 0x015E, 0x015E,
+    0x015E, 0x015E, 0x015E, 0x015E,
+/* DATA_BLOCK: -- 0x1A30..0x1A3F -- */
+    0x015F, 0x015F, 0x015F, 0x015F, 0x015F, 0x015F, 0x015F, 0x015F, 0x015F, 0x015F, 0x015F, 0x015F,
+    0x015F, 0x015F, 0x015F, 0x015F,
+/* DATA_BLOCK: -- 0x1A40..0x1A4F -- */
+    0x0012, 0x0017, 0x0012, 0x0012, 0x0012, 0x0017, 0x0017, 0x0012, 0x0017, 0x0012, 0x0017, 0x0012,
+    0x0017, 0x0012, 0x0012, 0x0012,
+/* DATA_BLOCK: -- 0x1A50..0x1A5F -- */
+    0x0012, 0x0017, 0x0012, 0x0017, 0x0017, 0x0012, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017,
+    0x0024, 0x0024, 0x0012, 0x0012,
+/* DATA_BLOCK: -- 0x1A60..0x1A6F -- */
+    0x002E, 0x002F, 0x002E, 0x002F, 0x002E, 0x002F, 0x002E, 0x002F, 0x002E, 0x002F, 0x002E, 0x002F,
+    0x002E, 0x002F, 0x002E, 0x002F,
+/* DATA_BLOCK: -- 0x1A70..0x1A7F -- */
+    0x002E, 0x002F, 0x002E, 0x002F, 0x002F, 0x0160, 0x0160, 0x0160, 0x0160, 0x0160, 0x0160, 0x002E,
+    0x002F, 0x002E, 0x002F, 0x0161,
+/* DATA_BLOCK: -- 0x1A80..0x1A8F -- */
+    0x0161, 0x0161, 0x002E, 0x002F, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x0162, 0x0162, 0x0162,
+    0x0162, 0x0163, 0x0162, 0x0162,
+/* DATA_BLOCK: -- 0x1A90..0x1A9F -- */
+    0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x002C, 0x00C1, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x00C1, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x1AA0..0x1AAF -- */
+    0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x0164,
+    0x0164, 0x0164, 0x0164, 0x0164,
+/* DATA_BLOCK: -- 0x1AB0..0x1ABF -- */
+    0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x0165,
+/* DATA_BLOCK: -- 0x1AC0..0x1ACF -- */
+    0x0166, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x0167,
+/* DATA_BLOCK: -- 0x1AD0..0x1ADF -- */
+    0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x1AE0..0x1AEF -- */
+    0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x002C, 0x00C4, 0x00C4, 0x00C4, 0x00C4,
+    0x00C4, 0x00C4, 0x00C4, 0x002C,
+/* DATA_BLOCK: -- 0x1AF0..0x1AFF -- */
+    0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034,
+    0x0034, 0x0034, 0x0034, 0x0034,
+/* DATA_BLOCK: -- 0x1B00..0x1B0F -- */
+    0x0006, 0x0006, 0x012F, 0x0130, 0x012F, 0x0130, 0x0006, 0x0006, 0x0006, 0x012F, 0x0130, 0x0006,
+    0x012F, 0x0130, 0x0006, 0x0006,
+/* DATA_BLOCK: -- 0x1B10..0x1B1F -- */
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0124, 0x0006, 0x0006, 0x0124, 0x0006,
+    0x012F, 0x0130, 0x0006, 0x0006,
+/* DATA_BLOCK: -- 0x1B20..0x1B2F -- */
+    0x012F, 0x0130, 0x0009, 0x000A, 0x0009, 0x000A, 0x0009, 0x000A, 0x0009, 0x000A, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0025,
+/* DATA_BLOCK: -- 0x1B30..0x1B3F -- */
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0124, 0x0124,
+    0x0006, 0x0006, 0x0006, 0x0006,
+/* DATA_BLOCK: -- 0x1B40..0x1B4F -- */
+    0x0124, 0x0006, 0x0127, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006,
+/* DATA_BLOCK: -- 0x1B50..0x1B5F -- */
+    0x0019, 0x0019, 0x0006, 0x0006, 0x0006, 0x0009, 0x000A, 0x0009, 0x000A, 0x0009, 0x000A, 0x0009,
+    0x000A, 0x0124, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x1B60..0x1B6F -- */
+    0x0168, 0x0168, 0x0168, 0x0168, 0x0168, 0x0168, 0x0168, 0x0168, 0x0168, 0x0168, 0x0168, 0x0168,
+    0x0168, 0x0168, 0x0168, 0x0168,
+/* DATA_BLOCK: -- 0x1B70..0x1B7F -- */
+    0x0168, 0x0168, 0x0168, 0x0168, 0x0168, 0x0168, 0x0168, 0x0168, 0x0168, 0x0168, 0x002C, 0x0168,
+    0x0168, 0x0168, 0x0168, 0x0168,
+/* DATA_BLOCK: -- 0x1B80..0x1B8F -- */
+    0x0168, 0x0168, 0x0168, 0x0168, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x1B90..0x1B9F -- */
+    0x0168, 0x0168, 0x0168, 0x0168, 0x0168, 0x0168, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x1BA0..0x1BAF -- */
+    0x0005, 0x0006, 0x0006, 0x0006, 0x0019, 0x0169, 0x011E, 0x016A, 0x0009, 0x000A, 0x0009, 0x000A,
+    0x0009, 0x000A, 0x0009, 0x000A,
+/* DATA_BLOCK: -- 0x1BB0..0x1BBF -- */
+    0x0009, 0x000A, 0x0019, 0x0019, 0x0009, 0x000A, 0x0009, 0x000A, 0x0009, 0x000A, 0x0009, 0x000A,
+    0x0124, 0x0127, 0x016B, 0x016B,
+/* DATA_BLOCK: -- 0x1BC0..0x1BCF -- */
+    0x0019, 0x016A, 0x016A, 0x016A, 0x016A, 0x016A, 0x016A, 0x016A, 0x016A, 0x016A, 0x0028, 0x0028,
+    0x0028, 0x0028, 0x016C, 0x016C,
+/* DATA_BLOCK: -- 0x1BD0..0x1BDF -- */
+    0x0124, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0019, 0x0019, 0x016A, 0x016A, 0x016A, 0x0169,
+    0x011E, 0x0006, 0x0019, 0x0019,
+/* DATA_BLOCK: -- 0x1BE0..0x1BEF -- */
+    0x002C, 0x016D, 0x016D, 0x016D, 0x016D, 0x016D, 0x016D, 0x016D, 0x016D, 0x016D, 0x016D, 0x016D,
+    0x016D, 0x016D, 0x016D, 0x016D,
+/* DATA_BLOCK: -- 0x1BF0..0x1BFF -- */
+    0x016D, 0x016D, 0x016D, 0x016D, 0x016D, 0x016D, 0x016D, 0x016D, 0x016D, 0x016D, 0x016D, 0x016D,
+    0x016D, 0x016D, 0x016D, 0x016D,
+/* DATA_BLOCK: -- 0x1C00..0x1C0F -- */
+    0x016D, 0x016D, 0x016D, 0x016D, 0x016D, 0x016D, 0x016D, 0x002C, 0x002C, 0x0028, 0x0028, 0x0015,
+    0x0015, 0x016E, 0x016E, 0x016D,
+/* DATA_BLOCK: -- 0x1C10..0x1C1F -- */
+    0x0124, 0x016F, 0x016F, 0x016F, 0x016F, 0x016F, 0x016F, 0x016F, 0x016F, 0x016F, 0x016F, 0x016F,
+    0x016F, 0x016F, 0x016F, 0x016F,
+/* DATA_BLOCK: -- 0x1C20..0x1C2F -- */
+    0x016F, 0x016F, 0x016F, 0x016F, 0x016F, 0x016F, 0x016F, 0x016F, 0x016F, 0x016F, 0x016F, 0x016F,
+    0x016F, 0x016F, 0x016F, 0x016F,
+/* DATA_BLOCK: -- 0x1C30..0x1C3F -- */
+    0x016F, 0x016F, 0x016F, 0x016F, 0x016F, 0x016F, 0x016F, 0x016F, 0x016F, 0x016F, 0x016F, 0x0006,
+    0x0026, 0x0170, 0x0170, 0x016F,
+/* DATA_BLOCK: -- 0x1C40..0x1C4F -- */
+    0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x0171, 0x0171, 0x0171, 0x0171, 0x0171, 0x0171, 0x0171,
+    0x0171, 0x0171, 0x0171, 0x0171,
+/* DATA_BLOCK: -- 0x1C50..0x1C5F -- */
+    0x0171, 0x0171, 0x0171, 0x0171, 0x0171, 0x0171, 0x0171, 0x0171, 0x0171, 0x0171, 0x0171, 0x0171,
+    0x0171, 0x0171, 0x0171, 0x0171,
+/* DATA_BLOCK: -- 0x1C60..0x1C6F -- */
+    0x002C, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3,
+    0x00C3, 0x00C3, 0x00C3, 0x00C3,
+/* DATA_BLOCK: -- 0x1C70..0x1C7F -- */
+    0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3,
+    0x00C3, 0x00C3, 0x00C3, 0x002C,
+/* DATA_BLOCK: -- 0x1C80..0x1C8F -- */
+    0x00B9, 0x00B9, 0x0172, 0x0172, 0x0172, 0x0172, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9,
+    0x00B9, 0x00B9, 0x00B9, 0x00B9,
+/* DATA_BLOCK: -- 0x1C90..0x1C9F -- */
+    0x0019, 0x0019, 0x0019, 0x0019, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x0019,
+/* DATA_BLOCK: -- 0x1CA0..0x1CAF -- */
+    0x0173, 0x0173, 0x0173, 0x0173, 0x0173, 0x0173, 0x0173, 0x0173, 0x0173, 0x0173, 0x0173, 0x0173,
+    0x0173, 0x0173, 0x0173, 0x0173,
+/* DATA_BLOCK: -- 0x1CB0..0x1CBF -- */
+    0x0173, 0x0173, 0x0173, 0x0173, 0x0173, 0x0173, 0x0173, 0x0173, 0x0173, 0x0173, 0x0173, 0x0173,
+    0x0173, 0x0174, 0x0174, 0x002C,
+/* DATA_BLOCK: -- 0x1CC0..0x1CCF -- */
+    0x0172, 0x0172, 0x0172, 0x0172, 0x0172, 0x0172, 0x0172, 0x0172, 0x0172, 0x0172, 0x00B9, 0x00B9,
+    0x00B9, 0x00B9, 0x00B9, 0x00B9,
+/* DATA_BLOCK: -- 0x1CD0..0x1CDF -- */
+    0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x0172, 0x0172, 0x0172, 0x0172,
+    0x0172, 0x0172, 0x0172, 0x0172,
+/* DATA_BLOCK: -- 0x1CE0..0x1CEF -- */
+    0x0019, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022,
+    0x0022, 0x0022, 0x0022, 0x0022,
+/* DATA_BLOCK: -- 0x1CF0..0x1CFF -- */
+    0x0173, 0x0173, 0x0173, 0x0173, 0x0173, 0x0173, 0x0173, 0x0173, 0x0173, 0x0173, 0x0173, 0x0173,
+    0x0174, 0x0174, 0x0174, 0x00B9,
+/* DATA_BLOCK: -- 0x1D00..0x1D0F -- */
+    0x00B9, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022,
+    0x0022, 0x0022, 0x0022, 0x0022,
+/* DATA_BLOCK: -- 0x1D10..0x1D1F -- */
+    0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9,
+    0x0019, 0x0019, 0x0019, 0x0019,
+/* DATA_BLOCK: -- 0x1D20..0x1D2F -- */
+    0x0175, 0x0175, 0x0175, 0x0175, 0x0175, 0x0175, 0x0175, 0x0175, 0x0175, 0x0175, 0x0175, 0x0175,
+    0x0175, 0x0175, 0x0175, 0x0175,
+/* DATA_BLOCK: -- 0x1D30..0x1D3F -- */
+    0x0175, 0x0175, 0x0175, 0x0175, 0x0175, 0x0175, 0x0175, 0x0175, 0x0175, 0x0175, 0x0175, 0x0175,
+    0x0175, 0x0175, 0x0175, 0x00B9,
+/* DATA_BLOCK: -- 0x1D40..0x1D4F -- */
+    0x0175, 0x0175, 0x0175, 0x0175, 0x0175, 0x0175, 0x0175, 0x0175, 0x00B9, 0x00B9, 0x00B9, 0x00B9,
+    0x00B9, 0x00B9, 0x00B9, 0x00B9,
+/* DATA_BLOCK: -- 0x1D50..0x1D5F -- */
+    0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x0019, 0x0019, 0x0019, 0x0019, 0x00B9,
+    0x00B9, 0x00B9, 0x00B9, 0x00B9,
+/* DATA_BLOCK: -- 0x1D60..0x1D6F -- */
+    0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9,
+    0x00B9, 0x00B9, 0x0019, 0x0019,
+/* DATA_BLOCK: -- 0x1D70..0x1D7F -- */
+    0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9,
+    0x00B9, 0x00B9, 0x00B9, 0x0019,
+/* DATA_BLOCK: -- 0x1D80..0x1D8F -- */
+    0x0176, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177,
+    0x0177, 0x0177, 0x0177, 0x0177,
+/* DATA_BLOCK: -- 0x1D90..0x1D9F -- */
+    0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177,
+    0x0177, 0x0177, 0x0177, 0x0177,
+/* DATA_BLOCK: -- 0x1DA0..0x1DAF -- */
+    0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177,
+    0x0177, 0x0177, 0x0177, 0x0176,
+/* DATA_BLOCK: -- 0x1DB0..0x1DBF -- */
+    0x0178, 0x0178, 0x0178, 0x0178, 0x0178, 0x0178, 0x0178, 0x0178, 0x0178, 0x0178, 0x0178, 0x0178,
+    0x0178, 0x0178, 0x0178, 0x0178,
+/* DATA_BLOCK: -- 0x1DC0..0x1DCF -- */
+    0x0178, 0x0178, 0x0178, 0x0178, 0x0178, 0x0179, 0x0178, 0x0178, 0x0178, 0x0178, 0x0178, 0x0178,
+    0x0178, 0x0178, 0x0178, 0x0178,
+/* DATA_BLOCK: -- 0x1DD0..0x1DDF -- */
+    0x0178, 0x0178, 0x0178, 0x0178, 0x0178, 0x0178, 0x0178, 0x0178, 0x0178, 0x0178, 0x0178, 0x0178,
+    0x0178, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x1DE0..0x1DEF -- */
+    0x017A, 0x017A, 0x017A, 0x017A, 0x017A, 0x017A, 0x017A, 0x017A, 0x017A, 0x017A, 0x017A, 0x017A,
+    0x017A, 0x017A, 0x017A, 0x017A,
+/* DATA_BLOCK: -- 0x1DF0..0x1DFF -- */
+    0x017A, 0x017A, 0x017A, 0x017A, 0x017A, 0x017A, 0x017A, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x1E00..0x1E0F -- */
+    0x017B, 0x017B, 0x017B, 0x017B, 0x017B, 0x017B, 0x017B, 0x017B, 0x017B, 0x017B, 0x017B, 0x017B,
+    0x017B, 0x017B, 0x017B, 0x017B,
+/* DATA_BLOCK: -- 0x1E10..0x1E1F -- */
+    0x017B, 0x017B, 0x017B, 0x017B, 0x017B, 0x017B, 0x017B, 0x017B, 0x017C, 0x017C, 0x017C, 0x017C,
+    0x017C, 0x017C, 0x017D, 0x017D,
+/* DATA_BLOCK: -- 0x1E20..0x1E2F -- */
+    0x017E, 0x017E, 0x017E, 0x017E, 0x017E, 0x017E, 0x017E, 0x017E, 0x017E, 0x017E, 0x017E, 0x017E,
+    0x017E, 0x017E, 0x017E, 0x017E,
+/* DATA_BLOCK: -- 0x1E30..0x1E3F -- */
+    0x017E, 0x017E, 0x017E, 0x017E, 0x017E, 0x017E, 0x017E, 0x017E, 0x017E, 0x017E, 0x017E, 0x017E,
+    0x017F, 0x0180, 0x0180, 0x0180,
+/* DATA_BLOCK: -- 0x1E40..0x1E4F -- */
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x017E, 0x017E,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x1E50..0x1E5F -- */
+    0x0031, 0x0032, 0x0031, 0x0032, 0x0031, 0x0032, 0x0031, 0x0032, 0x0031, 0x0032, 0x0031, 0x0032,
+    0x0031, 0x0032, 0x0182, 0x0034,
+/* DATA_BLOCK: -- 0x1E60..0x1E6F -- */
+    0x0035, 0x0035, 0x0035, 0x0183, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034,
+    0x0034, 0x0034, 0x0183, 0x0184,
+/* DATA_BLOCK: -- 0x1E70..0x1E7F -- */
+    0x0031, 0x0032, 0x0031, 0x0032, 0x0031, 0x0032, 0x0031, 0x0032, 0x0031, 0x0032, 0x0031, 0x0032,
+    0x011F, 0x011F, 0x0034, 0x0034,
+/* DATA_BLOCK: -- 0x1E80..0x1E8F -- */
+    0x0185, 0x0185, 0x0185, 0x0185, 0x0185, 0x0185, 0x0185, 0x0185, 0x0185, 0x0185, 0x0185, 0x0185,
+    0x0185, 0x0185, 0x0185, 0x0185,
+/* DATA_BLOCK: -- 0x1E90..0x1E9F -- */
+    0x0185, 0x0185, 0x0185, 0x0185, 0x0185, 0x0185, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186,
+    0x0186, 0x0186, 0x0186, 0x0186,
+/* DATA_BLOCK: -- 0x1EA0..0x1EAF -- */
+    0x0187, 0x0187, 0x0188, 0x0188, 0x0188, 0x0188, 0x0188, 0x0188, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x1EB0..0x1EBF -- */
+    0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025,
+    0x0025, 0x0025, 0x0025, 0x0025,
+/* DATA_BLOCK: -- 0x1EC0..0x1ECF -- */
+    0x0015, 0x0015, 0x0012, 0x0017, 0x0012, 0x0017, 0x0012, 0x0017, 0x0012, 0x0017, 0x0012, 0x0017,
+    0x0012, 0x0017, 0x0012, 0x0017,
+/* DATA_BLOCK: -- 0x1ED0..0x1EDF -- */
+    0x0017, 0x0017, 0x0012, 0x0017, 0x0012, 0x0017, 0x0012, 0x0017, 0x0012, 0x0017, 0x0012, 0x0017,
+    0x0012, 0x0017, 0x0012, 0x0017,
+/* DATA_BLOCK: -- 0x1EE0..0x1EEF -- */
+    0x0024, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0012, 0x0017, 0x0012,
+    0x0017, 0x0012, 0x0012, 0x0017,
+/* DATA_BLOCK: -- 0x1EF0..0x1EFF -- */
+    0x0012, 0x0017, 0x0012, 0x0017, 0x0012, 0x0017, 0x0012, 0x0017, 0x0025, 0x0189, 0x0189, 0x0012,
+    0x0017, 0x0012, 0x0017, 0x001A,
+/* DATA_BLOCK: -- 0x1F00..0x1F0F -- */
+    0x0012, 0x0017, 0x0012, 0x0017, 0x0017, 0x0017, 0x0012, 0x0017, 0x0012, 0x0017, 0x0012, 0x0017,
+    0x0012, 0x0017, 0x0012, 0x0017,
+/* DATA_BLOCK: -- 0x1F10..0x1F1F -- */
+    0x0012, 0x0017, 0x0012, 0x0017, 0x0012, 0x0017, 0x0012, 0x0017, 0x0012, 0x0017, 0x0012, 0x0012,
+    0x0012, 0x0012, 0x0012, 0x0017,
+/* DATA_BLOCK: -- 0x1F20..0x1F2F -- */
+    0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0017, 0x0012, 0x0017, 0x0012, 0x0017, 0x0012, 0x0017,
+    0x0012, 0x0017, 0x0012, 0x0017,
+/* DATA_BLOCK: -- 0x1F30..0x1F3F -- */
+    0x0012, 0x0017, 0x0012, 0x0017, 0x0012, 0x0012, 0x0012, 0x0012, 0x0017, 0x0012, 0x0017, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x1F40..0x1F4F -- */
+    0x0012, 0x0017, 0x002C, 0x0017, 0x002C, 0x0017, 0x0012, 0x0017, 0x0012, 0x0017, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x1F50..0x1F5F -- */
+    0x002C, 0x002C, 0x0024, 0x0024, 0x0024, 0x0012, 0x0017, 0x001A, 0x0024, 0x0024, 0x0017, 0x001A,
+    0x001A, 0x001A, 0x001A, 0x001A,
+/* DATA_BLOCK: -- 0x1F60..0x1F6F -- */
+    0x018A, 0x018A, 0x018B, 0x018A, 0x018A, 0x018A, 0x018B, 0x018A, 0x018A, 0x018A, 0x018A, 0x018B,
+    0x018A, 0x018A, 0x018A, 0x018A,
+/* DATA_BLOCK: -- 0x1F70..0x1F7F -- */
+    0x018A, 0x018A, 0x018A, 0x018A, 0x018A, 0x018A, 0x018A, 0x018A, 0x018A, 0x018A, 0x018A, 0x018A,
+    0x018A, 0x018A, 0x018A, 0x018A,
+/* DATA_BLOCK: -- 0x1F80..0x1F8F -- */
+    0x018A, 0x018A, 0x018A, 0x018C, 0x018C, 0x018B, 0x018B, 0x018C, 0x018D, 0x018D, 0x018D, 0x018D,
+    0x018B, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x1F90..0x1F9F -- */
+    0x0172, 0x0172, 0x0172, 0x0172, 0x0172, 0x0172, 0x00B9, 0x00B9, 0x0008, 0x001D, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x1FA0..0x1FAF -- */
+    0x018E, 0x018E, 0x018E, 0x018E, 0x018E, 0x018E, 0x018E, 0x018E, 0x018E, 0x018E, 0x018E, 0x018E,
+    0x018E, 0x018E, 0x018E, 0x018E,
+/* DATA_BLOCK: -- 0x1FB0..0x1FBF -- */
+    0x018E, 0x018E, 0x018E, 0x018E, 0x018F, 0x018F, 0x018F, 0x018F, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x1FC0..0x1FCF -- */
+    0x0190, 0x0190, 0x0191, 0x0191, 0x0191, 0x0191, 0x0191, 0x0191, 0x0191, 0x0191, 0x0191, 0x0191,
+    0x0191, 0x0191, 0x0191, 0x0191,
+/* DATA_BLOCK: -- 0x1FD0..0x1FDF -- */
+    0x0191, 0x0191, 0x0191, 0x0191, 0x0191, 0x0191, 0x0191, 0x0191, 0x0191, 0x0191, 0x0191, 0x0191,
+    0x0191, 0x0191, 0x0191, 0x0191,
+/* DATA_BLOCK: -- 0x1FE0..0x1FEF -- */
+    0x0191, 0x0191, 0x0191, 0x0191, 0x0190, 0x0190, 0x0190, 0x0190, 0x0190, 0x0190, 0x0190, 0x0190,
+    0x0190, 0x0190, 0x0190, 0x0190,
+/* DATA_BLOCK: -- 0x1FF0..0x1FFF -- */
+    0x0190, 0x0190, 0x0190, 0x0190, 0x0192, 0x0192, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x0193, 0x0193,
+/* DATA_BLOCK: -- 0x2000..0x200F -- */
+    0x0194, 0x0194, 0x0194, 0x0194, 0x0194, 0x0194, 0x0194, 0x0194, 0x0194, 0x0194, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2010..0x201F -- */
+    0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068,
+    0x0068, 0x0068, 0x0068, 0x0068,
+/* DATA_BLOCK: -- 0x2020..0x202F -- */
+    0x0068, 0x0068, 0x006A, 0x006A, 0x006A, 0x006A, 0x006A, 0x006A, 0x006D, 0x006D, 0x006D, 0x006A,
+    0x006D, 0x006A, 0x006A, 0x0068,
+/* DATA_BLOCK: -- 0x2030..0x203F -- */
+    0x0195, 0x0195, 0x0195, 0x0195, 0x0195, 0x0195, 0x0195, 0x0195, 0x0195, 0x0195, 0x0196, 0x0196,
+    0x0196, 0x0196, 0x0196, 0x0196,
+/* DATA_BLOCK: -- 0x2040..0x204F -- */
+    0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196,
+    0x0196, 0x0196, 0x0196, 0x0196,
+/* DATA_BLOCK: -- 0x2050..0x205F -- */
+    0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197,
+    0x0197, 0x0197, 0x006B, 0x0198,
+/* DATA_BLOCK: -- 0x2060..0x206F -- */
+    0x0199, 0x0199, 0x0199, 0x0199, 0x0199, 0x0199, 0x0199, 0x0199, 0x0199, 0x0199, 0x0199, 0x0199,
+    0x0199, 0x0199, 0x0199, 0x0199,
+/* DATA_BLOCK: -- 0x2070..0x207F -- */
+    0x0199, 0x0199, 0x0199, 0x0199, 0x0199, 0x0199, 0x0199, 0x019A, 0x019A, 0x019A, 0x019A, 0x019A,
+    0x019A, 0x019A, 0x019A, 0x019A,
+/* DATA_BLOCK: -- 0x2080..0x208F -- */
+    0x019A, 0x019A, 0x019B, 0x019B, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x019C,
+/* DATA_BLOCK: -- 0x2090..0x209F -- */
+    0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3,
+    0x00C3, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x20A0..0x20AF -- */
+    0x019D, 0x019D, 0x019D, 0x019E, 0x019F, 0x019F, 0x019F, 0x019F, 0x019F, 0x019F, 0x019F, 0x019F,
+    0x019F, 0x019F, 0x019F, 0x019F,
+/* DATA_BLOCK: -- 0x20B0..0x20BF -- */
+    0x019F, 0x019F, 0x019F, 0x019F, 0x019F, 0x019F, 0x019F, 0x019F, 0x019F, 0x019F, 0x019F, 0x019F,
+    0x019F, 0x019F, 0x019F, 0x019F,
+/* DATA_BLOCK: -- 0x20C0..0x20CF -- */
+    0x019F, 0x019F, 0x019F, 0x019D, 0x019E, 0x019E, 0x019D, 0x019D, 0x019D, 0x019D, 0x019E, 0x019E,
+    0x019D, 0x019D, 0x019E, 0x019E,
+/* DATA_BLOCK: -- 0x20D0..0x20DF -- */
+    0x019E, 0x01A0, 0x01A0, 0x01A0, 0x01A0, 0x01A0, 0x01A0, 0x01A0, 0x01A0, 0x01A0, 0x01A0, 0x01A0,
+    0x01A0, 0x01A0, 0x002C, 0x0026,
+/* DATA_BLOCK: -- 0x20E0..0x20EF -- */
+    0x01A1, 0x01A1, 0x01A1, 0x01A1, 0x01A1, 0x01A1, 0x01A1, 0x01A1, 0x01A1, 0x01A1, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x01A0, 0x01A0,
+/* DATA_BLOCK: -- 0x20F0..0x20FF -- */
+    0x00BA, 0x00BA, 0x00BA, 0x00BA, 0x00BA, 0x00BC, 0x01A2, 0x00BA, 0x00BA, 0x00BA, 0x00BA, 0x00BA,
+    0x00BA, 0x00BA, 0x00BA, 0x00BA,
+/* DATA_BLOCK: -- 0x2100..0x210F -- */
+    0x00BD, 0x00BD, 0x00BD, 0x00BD, 0x00BD, 0x00BD, 0x00BD, 0x00BD, 0x00BD, 0x00BD, 0x00BA, 0x00BA,
+    0x00BA, 0x00BA, 0x00BA, 0x002C,
+/* DATA_BLOCK: -- 0x2110..0x211F -- */
+    0x01A3, 0x01A3, 0x01A3, 0x01A3, 0x01A3, 0x01A3, 0x01A3, 0x01A3, 0x01A3, 0x01A3, 0x01A3, 0x01A3,
+    0x01A3, 0x01A3, 0x01A3, 0x01A3,
+/* DATA_BLOCK: -- 0x2120..0x212F -- */
+    0x01A3, 0x01A3, 0x01A3, 0x01A3, 0x01A3, 0x01A3, 0x01A3, 0x01A3, 0x01A3, 0x01A4, 0x01A4, 0x01A4,
+    0x01A4, 0x01A4, 0x01A4, 0x01A5,
+/* DATA_BLOCK: -- 0x2130..0x213F -- */
+    0x01A5, 0x01A4, 0x01A4, 0x01A5, 0x01A5, 0x01A4, 0x01A4, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2140..0x214F -- */
+    0x01A3, 0x01A3, 0x01A3, 0x01A4, 0x01A3, 0x01A3, 0x01A3, 0x01A3, 0x01A3, 0x01A3, 0x01A3, 0x01A3,
+    0x01A4, 0x01A5, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2150..0x215F -- */
+    0x01A6, 0x01A6, 0x01A6, 0x01A6, 0x01A6, 0x01A6, 0x01A6, 0x01A6, 0x01A6, 0x01A6, 0x002C, 0x002C,
+    0x01A7, 0x01A7, 0x01A7, 0x01A7,
+/* DATA_BLOCK: -- 0x2160..0x216F -- */
+    0x01A2, 0x00BA, 0x00BA, 0x00BA, 0x00BA, 0x00BA, 0x00BA, 0x00BF, 0x00BF, 0x00BF, 0x00BA, 0x00BB,
+    0x00BC, 0x00BB, 0x00BA, 0x00BA,
+/* DATA_BLOCK: -- 0x2170..0x217F -- */
+    0x01A8, 0x01A8, 0x01A8, 0x01A8, 0x01A8, 0x01A8, 0x01A8, 0x01A8, 0x01A8, 0x01A8, 0x01A8, 0x01A8,
+    0x01A8, 0x01A8, 0x01A8, 0x01A8,
+/* DATA_BLOCK: -- 0x2180..0x218F -- */
+    0x01A9, 0x01A8, 0x01A9, 0x01A9, 0x01A9, 0x01A8, 0x01A8, 0x01A9, 0x01A9, 0x01A8, 0x01A8, 0x01A8,
+    0x01A8, 0x01A8, 0x01A9, 0x01A9,
+/* DATA_BLOCK: -- 0x2190..0x219F -- */
+    0x01A8, 0x01A9, 0x01A8, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x21A0..0x21AF -- */
+    0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x01A8,
+    0x01A8, 0x01AA, 0x01AB, 0x01AB,
+/* DATA_BLOCK: -- 0x21B0..0x21BF -- */
+    0x01AC, 0x01AC, 0x01AC, 0x01AC, 0x01AC, 0x01AC, 0x01AC, 0x01AC, 0x01AC, 0x01AC, 0x01AC, 0x01AD,
+    0x01AE, 0x01AE, 0x01AD, 0x01AD,
+/* DATA_BLOCK: -- 0x21C0..0x21CF -- */
+    0x01AF, 0x01AF, 0x01AC, 0x01B0, 0x01B0, 0x01AD, 0x01AE, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x21D0..0x21DF -- */
+    0x002C, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x002C, 0x002C, 0x00C4, 0x00C4, 0x00C4,
+    0x00C4, 0x00C4, 0x00C4, 0x002C,
+/* DATA_BLOCK: -- 0x21E0..0x21EF -- */
+    0x002C, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x21F0..0x21FF -- */
+    0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0189,
+    0x0024, 0x0024, 0x0024, 0x0024,
+/* DATA_BLOCK: -- 0x2200..0x220F -- */
+    0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x002A, 0x0017, 0x0017, 0x0017, 0x0024, 0x0015, 0x0015,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2210..0x221F -- */
+    0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA,
+    0x00CA, 0x00CA, 0x00CA, 0x00CA,
+/* DATA_BLOCK: -- 0x2220..0x222F -- */
+    0x01AC, 0x01AC, 0x01AC, 0x01AC, 0x01AC, 0x01AC, 0x01AC, 0x01AC, 0x01AC, 0x01AC, 0x01AC, 0x01AC,
+    0x01AC, 0x01AC, 0x01AC, 0x01AC,
+/* DATA_BLOCK: -- 0x2230..0x223F -- */
+    0x01AC, 0x01AC, 0x01AC, 0x01AD, 0x01AD, 0x01AE, 0x01AD, 0x01AD, 0x01AE, 0x01AD, 0x01AD, 0x01AF,
+    0x01AD, 0x01AE, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2240..0x224F -- */
+    0x01B1, 0x01B1, 0x01B1, 0x01B1, 0x01B1, 0x01B1, 0x01B1, 0x01B1, 0x01B1, 0x01B1, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2250..0x225F -- */
+    0x00C3, 0x01B2, 0x01B2, 0x01B2, 0x01B2, 0x01B2, 0x01B2, 0x01B2, 0x01B2, 0x01B2, 0x01B2, 0x01B2,
+    0x01B2, 0x01B2, 0x01B2, 0x01B2,
+/* DATA_BLOCK: -- 0x2260..0x226F -- */
+    0x01B2, 0x01B2, 0x01B2, 0x01B2, 0x01B2, 0x01B2, 0x01B2, 0x01B2, 0x01B2, 0x01B2, 0x01B2, 0x01B2,
+    0x01B2, 0x01B2, 0x01B2, 0x01B2,
+/* DATA_BLOCK: -- 0x2270..0x227F -- */
+    0x01B2, 0x01B2, 0x01B2, 0x00C3, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2280..0x228F -- */
+    0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x002C, 0x002C, 0x002C, 0x002C, 0x00C3,
+    0x00C3, 0x00C3, 0x00C3, 0x00C3,
+/* DATA_BLOCK: -- 0x2290..0x229F -- */
+    0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x22A0..0x22AF -- */
+    0x01B3, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x22B0..0x22BF -- */
+    0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x01B3,
+/* DATA_BLOCK: -- 0x22C0..0x22CF -- */
+    0x01B4, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x22D0..0x22DF -- */
+    0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x01B4,
+/* DATA_BLOCK: -- 0x22E0..0x22EF -- */
+    0x0176, 0x0176, 0x0176, 0x0176, 0x0176, 0x0176, 0x0176, 0x0176, 0x0176, 0x0176, 0x0176, 0x0176,
+    0x0176, 0x0176, 0x0176, 0x0176,
+/* DATA_BLOCK: -- 0x22F0..0x22FF -- */
+    0x0176, 0x0176, 0x0176, 0x0176, 0x0176, 0x0176, 0x0176, 0x0176, 0x0176, 0x0176, 0x0176, 0x0176,
+    0x0176, 0x0176, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2300..0x230F -- */
+    0x0176, 0x0176, 0x0176, 0x0176, 0x0176, 0x0176, 0x0176, 0x0176, 0x0176, 0x0176, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2310..0x231F -- */
+    0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2320..0x232F -- */
+    0x002C, 0x002C, 0x002C, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x0040, 0x003D, 0x0040,
+/* DATA_BLOCK: -- 0x2330..0x233F -- */
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x01B5, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040,
+/* DATA_BLOCK: -- 0x2340..0x234F -- */
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x002C, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x002C, 0x0040, 0x002C,
+/* DATA_BLOCK: -- 0x2350..0x235F -- */
+    0x0040, 0x0040, 0x002C, 0x0040, 0x0040, 0x002C, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040,
+/* DATA_BLOCK: -- 0x2360..0x236F -- */
+    0x004C, 0x004C, 0x0067, 0x0067, 0x0067, 0x0067, 0x0067, 0x0067, 0x0067, 0x0067, 0x0067, 0x0067,
+    0x0067, 0x0067, 0x0067, 0x0067,
+/* DATA_BLOCK: -- 0x2370..0x237F -- */
+    0x0067, 0x0067, 0x0067, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2380..0x238F -- */
+    0x002C, 0x002C, 0x002C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C,
+    0x004C, 0x004C, 0x004C, 0x004C,
+/* DATA_BLOCK: -- 0x2390..0x239F -- */
+    0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C,
+    0x004C, 0x004C, 0x016B, 0x0127,
+/* DATA_BLOCK: -- 0x23A0..0x23AF -- */
+    0x0048, 0x0048, 0x0048, 0x0048, 0x0048, 0x0048, 0x0048, 0x0048, 0x0048, 0x0048, 0x0048, 0x0048,
+    0x0048, 0x0048, 0x0048, 0x0048,
+/* DATA_BLOCK: -- 0x23B0..0x23BF -- */
+    0x002C, 0x002C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C,
+    0x004C, 0x004C, 0x004C, 0x004C,
+/* DATA_BLOCK: -- 0x23C0..0x23CF -- */
+    0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x0048,
+/* DATA_BLOCK: -- 0x23D0..0x23DF -- */
+    0x0132, 0x0132, 0x0132, 0x0132, 0x0132, 0x0132, 0x0132, 0x0132, 0x0132, 0x0132, 0x0132, 0x0132,
+    0x0132, 0x0132, 0x0132, 0x0132,
+/* DATA_BLOCK: -- 0x23E0..0x23EF -- */
+    0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C,
+    0x0046, 0x0048, 0x0048, 0x0048,
+/* DATA_BLOCK: -- 0x23F0..0x23FF -- */
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0127, 0x016B, 0x0006, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2400..0x240F -- */
+    0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028,
+    0x0028, 0x0028, 0x0034, 0x0034,
+/* DATA_BLOCK: -- 0x2410..0x241F -- */
+    0x0006, 0x0124, 0x0124, 0x0016, 0x0016, 0x0127, 0x016B, 0x0127, 0x016B, 0x0127, 0x016B, 0x0127,
+    0x016B, 0x0127, 0x016B, 0x0127,
+/* DATA_BLOCK: -- 0x2420..0x242F -- */
+    0x016B, 0x0127, 0x016B, 0x0127, 0x016B, 0x0006, 0x0006, 0x0127, 0x016B, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0016, 0x0016, 0x0016,
+/* DATA_BLOCK: -- 0x2430..0x243F -- */
+    0x000C, 0x0006, 0x000C, 0x002C, 0x0006, 0x000C, 0x0006, 0x0006, 0x0124, 0x0009, 0x000A, 0x0009,
+    0x000A, 0x0009, 0x000A, 0x0007,
+/* DATA_BLOCK: -- 0x2440..0x244F -- */
+    0x0006, 0x0006, 0x000B, 0x000D, 0x0141, 0x0142, 0x0010, 0x002C, 0x0006, 0x0008, 0x0007, 0x0006,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2450..0x245F -- */
+    0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x002C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C,
+    0x004C, 0x004C, 0x004C, 0x004C,
+/* DATA_BLOCK: -- 0x2460..0x246F -- */
+    0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C,
+    0x004C, 0x002C, 0x002C, 0x001C,
+/* DATA_BLOCK: -- 0x2470..0x247F -- */
+    0x002C, 0x0006, 0x0006, 0x0007, 0x0008, 0x0007, 0x0006, 0x0006, 0x0009, 0x000A, 0x0006, 0x000B,
+    0x000C, 0x000D, 0x000C, 0x000C,
+/* DATA_BLOCK: -- 0x2480..0x248F -- */
+    0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0013,
+    0x0010, 0x0014, 0x0010, 0x0009,
+/* DATA_BLOCK: -- 0x2490..0x249F -- */
+    0x000A, 0x0006, 0x0009, 0x000A, 0x0006, 0x0006, 0x016F, 0x016F, 0x016F, 0x016F, 0x016F, 0x016F,
+    0x016F, 0x016F, 0x016F, 0x016F,
+/* DATA_BLOCK: -- 0x24A0..0x24AF -- */
+    0x0026, 0x016F, 0x016F, 0x016F, 0x016F, 0x016F, 0x016F, 0x016F, 0x016F, 0x016F, 0x016F, 0x016F,
+    0x016F, 0x016F, 0x016F, 0x016F,
+/* DATA_BLOCK: -- 0x24B0..0x24BF -- */
+    0x016F, 0x016F, 0x016F, 0x016F, 0x016F, 0x016F, 0x016F, 0x016F, 0x016F, 0x016F, 0x016F, 0x016F,
+    0x016F, 0x016F, 0x0026, 0x0026,
+/* DATA_BLOCK: -- 0x24C0..0x24CF -- */
+    0x002C, 0x002C, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x002C, 0x002C, 0x00C3, 0x00C3,
+    0x00C3, 0x00C3, 0x00C3, 0x00C3,
+/* DATA_BLOCK: -- 0x24D0..0x24DF -- */
+    0x002C, 0x002C, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x002C, 0x002C, 0x00C3, 0x00C3,
+    0x00C3, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x24E0..0x24EF -- */
+    0x0008, 0x0008, 0x0010, 0x0015, 0x0019, 0x0008, 0x0008, 0x002C, 0x0019, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0019, 0x0019, 0x002C,
+/* DATA_BLOCK: -- 0x24F0..0x24FF -- */
+    0x0132, 0x0132, 0x0132, 0x0132, 0x0132, 0x0132, 0x0132, 0x0132, 0x0132, 0x01B6, 0x01B6, 0x01B6,
+    0x0019, 0x0019, 0x0132, 0x0132,
+/* DATA_BLOCK: -- 0x2500..0x250F -- */
+    0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7,
+    0x002C, 0x01B7, 0x01B7, 0x01B7,
+/* DATA_BLOCK: -- 0x2510..0x251F -- */
+    0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7,
+    0x01B7, 0x01B7, 0x01B7, 0x01B7,
+/* DATA_BLOCK: -- 0x2520..0x252F -- */
+    0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x002C, 0x01B7, 0x01B7, 0x01B7, 0x01B7,
+    0x01B7, 0x01B7, 0x01B7, 0x01B7,
+/* DATA_BLOCK: -- 0x2530..0x253F -- */
+    0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x002C,
+    0x01B7, 0x01B7, 0x002C, 0x01B7,
+/* DATA_BLOCK: -- 0x2540..0x254F -- */
+    0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7,
+    0x01B7, 0x01B7, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2550..0x255F -- */
+    0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2560..0x256F -- */
+    0x006B, 0x0006, 0x006B, 0x002C, 0x002C, 0x002C, 0x002C, 0x0172, 0x0172, 0x0172, 0x0172, 0x0172,
+    0x0172, 0x0172, 0x0172, 0x0172,
+/* DATA_BLOCK: -- 0x2570..0x257F -- */
+    0x0172, 0x0172, 0x0172, 0x0172, 0x0172, 0x0172, 0x0172, 0x0172, 0x0172, 0x0172, 0x0172, 0x0172,
+    0x0172, 0x0172, 0x0172, 0x0172,
+/* DATA_BLOCK: -- 0x2580..0x258F -- */
+    0x0172, 0x0172, 0x0172, 0x0172, 0x002C, 0x002C, 0x002C, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9,
+    0x00B9, 0x00B9, 0x00B9, 0x00B9,
+/* DATA_BLOCK: -- 0x2590..0x259F -- */
+    0x01B8, 0x01B8, 0x01B8, 0x01B8, 0x01B8, 0x01B8, 0x01B8, 0x01B8, 0x01B8, 0x01B8, 0x01B8, 0x01B8,
+    0x01B8, 0x01B8, 0x01B8, 0x01B8,
+/* DATA_BLOCK: -- 0x25A0..0x25AF -- */
+    0x01B8, 0x01B8, 0x01B8, 0x01B8, 0x01B8, 0x01B9, 0x01B9, 0x01B9, 0x01B9, 0x01BA, 0x01BA, 0x01BA,
+    0x01BA, 0x01BA, 0x01BA, 0x01BA,
+/* DATA_BLOCK: -- 0x25B0..0x25BF -- */
+    0x01BA, 0x01BA, 0x01BA, 0x01BA, 0x01BA, 0x01BA, 0x01BA, 0x01BA, 0x01BA, 0x01BA, 0x01B9, 0x01B9,
+    0x01BA, 0x01BB, 0x01BB, 0x002C,
+/* DATA_BLOCK: -- 0x25C0..0x25CF -- */
+    0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019,
+    0x0019, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x25D0..0x25DF -- */
+    0x01BA, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x25E0..0x25EF -- */
+    0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9,
+    0x00B9, 0x0028, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x25F0..0x25FF -- */
+    0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x01BC,
+    0x01BC, 0x01BC, 0x01BC, 0x01BC,
+/* DATA_BLOCK: -- 0x2600..0x260F -- */
+    0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x01BC,
+    0x01BC, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2610..0x261F -- */
+    0x01BD, 0x01BD, 0x01BD, 0x01BD, 0x01BD, 0x01BD, 0x01BD, 0x01BD, 0x01BD, 0x01BD, 0x01BD, 0x01BD,
+    0x01BD, 0x01BD, 0x01BD, 0x01BD,
+/* DATA_BLOCK: -- 0x2620..0x262F -- */
+    0x01BD, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2630..0x263F -- */
+    0x0028, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F,
+    0x001F, 0x001F, 0x001F, 0x001F,
+/* DATA_BLOCK: -- 0x2640..0x264F -- */
+    0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2650..0x265F -- */
+    0x01BE, 0x01BE, 0x01BE, 0x01BE, 0x01BE, 0x01BE, 0x01BE, 0x01BE, 0x01BE, 0x01BE, 0x01BE, 0x01BE,
+    0x01BE, 0x01BE, 0x01BE, 0x01BE,
+/* DATA_BLOCK: -- 0x2660..0x266F -- */
+    0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x01BE, 0x01BE, 0x01BE,
+/* DATA_BLOCK: -- 0x2670..0x267F -- */
+    0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0,
+    0x01C0, 0x01C0, 0x01C0, 0x01C0,
+/* DATA_BLOCK: -- 0x2680..0x268F -- */
+    0x01C0, 0x01C1, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C1, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2690..0x269F -- */
+    0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2,
+    0x01C2, 0x01C2, 0x01C2, 0x01C2,
+/* DATA_BLOCK: -- 0x26A0..0x26AF -- */
+    0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x26B0..0x26BF -- */
+    0x01C4, 0x01C4, 0x01C4, 0x01C4, 0x01C4, 0x01C4, 0x01C4, 0x01C4, 0x01C4, 0x01C4, 0x01C4, 0x01C4,
+    0x01C4, 0x01C4, 0x01C4, 0x01C4,
+/* DATA_BLOCK: -- 0x26C0..0x26CF -- */
+    0x01C4, 0x01C4, 0x01C4, 0x01C4, 0x01C4, 0x01C4, 0x01C4, 0x01C4, 0x01C4, 0x01C4, 0x01C4, 0x01C4,
+    0x01C4, 0x01C4, 0x002C, 0x01C5,
+/* DATA_BLOCK: -- 0x26D0..0x26DF -- */
+    0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6,
+    0x01C6, 0x01C6, 0x01C6, 0x01C6,
+/* DATA_BLOCK: -- 0x26E0..0x26EF -- */
+    0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x002C, 0x002C, 0x002C, 0x002C, 0x01C6, 0x01C6, 0x01C6, 0x01C6,
+    0x01C6, 0x01C6, 0x01C6, 0x01C6,
+/* DATA_BLOCK: -- 0x26F0..0x26FF -- */
+    0x01C7, 0x01C8, 0x01C8, 0x01C8, 0x01C8, 0x01C8, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2700..0x270F -- */
+    0x01C9, 0x01C9, 0x01C9, 0x01C9, 0x01C9, 0x01C9, 0x01C9, 0x01C9, 0x01C9, 0x01C9, 0x01C9, 0x01C9,
+    0x01C9, 0x01C9, 0x01C9, 0x01C9,
+/* DATA_BLOCK: -- 0x2710..0x271F -- */
+    0x01C9, 0x01C9, 0x01C9, 0x01C9, 0x01C9, 0x01C9, 0x01C9, 0x01C9, 0x01CA, 0x01CA, 0x01CA, 0x01CA,
+    0x01CA, 0x01CA, 0x01CA, 0x01CA,
+/* DATA_BLOCK: -- 0x2720..0x272F -- */
+    0x01CA, 0x01CA, 0x01CA, 0x01CA, 0x01CA, 0x01CA, 0x01CA, 0x01CA, 0x01CA, 0x01CA, 0x01CA, 0x01CA,
+    0x01CA, 0x01CA, 0x01CA, 0x01CA,
+/* DATA_BLOCK: -- 0x2730..0x273F -- */
+    0x01CB, 0x01CB, 0x01CB, 0x01CB, 0x01CB, 0x01CB, 0x01CB, 0x01CB, 0x01CB, 0x01CB, 0x01CB, 0x01CB,
+    0x01CB, 0x01CB, 0x01CB, 0x01CB,
+/* DATA_BLOCK: -- 0x2740..0x274F -- */
+    0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC,
+    0x01CC, 0x01CC, 0x01CC, 0x01CC,
+/* DATA_BLOCK: -- 0x2750..0x275F -- */
+    0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC,
+    0x01CC, 0x01CC, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2760..0x276F -- */
+    0x01CD, 0x01CD, 0x01CD, 0x01CD, 0x01CD, 0x01CD, 0x01CD, 0x01CD, 0x01CD, 0x01CD, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2770..0x277F -- */
+    0x01CE, 0x01CE, 0x01CE, 0x01CE, 0x01CE, 0x01CE, 0x01CE, 0x01CE, 0x01CE, 0x01CE, 0x01CE, 0x01CE,
+    0x01CE, 0x01CE, 0x01CE, 0x01CE,
+/* DATA_BLOCK: -- 0x2780..0x278F -- */
+    0x01CE, 0x01CE, 0x01CE, 0x01CE, 0x002C, 0x002C, 0x002C, 0x002C, 0x01CF, 0x01CF, 0x01CF, 0x01CF,
+    0x01CF, 0x01CF, 0x01CF, 0x01CF,
+/* DATA_BLOCK: -- 0x2790..0x279F -- */
+    0x01CF, 0x01CF, 0x01CF, 0x01CF, 0x01CF, 0x01CF, 0x01CF, 0x01CF, 0x01CF, 0x01CF, 0x01CF, 0x01CF,
+    0x01CF, 0x01CF, 0x01CF, 0x01CF,
+/* DATA_BLOCK: -- 0x27A0..0x27AF -- */
+    0x01CF, 0x01CF, 0x01CF, 0x01CF, 0x01CF, 0x01CF, 0x01CF, 0x01CF, 0x01CF, 0x01CF, 0x01CF, 0x01CF,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x27B0..0x27BF -- */
+    0x01D0, 0x01D0, 0x01D0, 0x01D0, 0x01D0, 0x01D0, 0x01D0, 0x01D0, 0x01D0, 0x01D0, 0x01D0, 0x01D0,
+    0x01D0, 0x01D0, 0x01D0, 0x01D0,
+/* DATA_BLOCK: -- 0x27C0..0x27CF -- */
+    0x01D0, 0x01D0, 0x01D0, 0x01D0, 0x01D0, 0x01D0, 0x01D0, 0x01D0, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x27D0..0x27DF -- */
+    0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,
+    0x01D1, 0x01D1, 0x01D1, 0x01D1,
+/* DATA_BLOCK: -- 0x27E0..0x27EF -- */
+    0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x01D2,
+/* DATA_BLOCK: -- 0x27F0..0x27FF -- */
+    0x01D3, 0x01D3, 0x01D3, 0x01D3, 0x01D3, 0x01D3, 0x01D3, 0x01D3, 0x01D3, 0x01D3, 0x01D3, 0x002C,
+    0x01D3, 0x01D3, 0x01D3, 0x01D3,
+/* DATA_BLOCK: -- 0x2800..0x280F -- */
+    0x01D3, 0x01D3, 0x01D3, 0x002C, 0x01D3, 0x01D3, 0x002C, 0x01D4, 0x01D4, 0x01D4, 0x01D4, 0x01D4,
+    0x01D4, 0x01D4, 0x01D4, 0x01D4,
+/* DATA_BLOCK: -- 0x2810..0x281F -- */
+    0x01D4, 0x01D4, 0x002C, 0x01D4, 0x01D4, 0x01D4, 0x01D4, 0x01D4, 0x01D4, 0x01D4, 0x01D4, 0x01D4,
+    0x01D4, 0x01D4, 0x01D4, 0x01D4,
+/* DATA_BLOCK: -- 0x2820..0x282F -- */
+    0x01D4, 0x01D4, 0x002C, 0x01D4, 0x01D4, 0x01D4, 0x01D4, 0x01D4, 0x01D4, 0x01D4, 0x002C, 0x01D4,
+    0x01D4, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2830..0x283F -- */
+    0x01D5, 0x01D5, 0x01D5, 0x01D5, 0x01D5, 0x01D5, 0x01D5, 0x01D5, 0x01D5, 0x01D5, 0x01D5, 0x01D5,
+    0x01D5, 0x01D5, 0x01D5, 0x01D5,
+/* DATA_BLOCK: -- 0x2840..0x284F -- */
+    0x01D5, 0x01D5, 0x01D5, 0x01D5, 0x01D5, 0x01D5, 0x01D5, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2850..0x285F -- */
+    0x01D5, 0x01D5, 0x01D5, 0x01D5, 0x01D5, 0x01D5, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2860..0x286F -- */
+    0x01D5, 0x01D5, 0x01D5, 0x01D5, 0x01D5, 0x01D5, 0x01D5, 0x01D5, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2870..0x287F -- */
+    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x002C, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
+    0x0024, 0x0024, 0x0024, 0x0024,
+/* DATA_BLOCK: -- 0x2880..0x288F -- */
+    0x0024, 0x002C, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2890..0x289F -- */
+    0x01D6, 0x01D6, 0x01D6, 0x01D6, 0x01D6, 0x01D6, 0x002C, 0x002C, 0x01D6, 0x002C, 0x01D6, 0x01D6,
+    0x01D6, 0x01D6, 0x01D6, 0x01D6,
+/* DATA_BLOCK: -- 0x28A0..0x28AF -- */
+    0x01D6, 0x01D6, 0x01D6, 0x01D6, 0x01D6, 0x01D6, 0x01D6, 0x01D6, 0x01D6, 0x01D6, 0x01D6, 0x01D6,
+    0x01D6, 0x01D6, 0x01D6, 0x01D6,
+/* DATA_BLOCK: -- 0x28B0..0x28BF -- */
+    0x01D6, 0x01D6, 0x01D6, 0x01D6, 0x01D6, 0x01D6, 0x002C, 0x01D6, 0x01D6, 0x002C, 0x002C, 0x002C,
+    0x01D6, 0x002C, 0x002C, 0x01D6,
+/* DATA_BLOCK: -- 0x28C0..0x28CF -- */
+    0x01D7, 0x01D7, 0x01D7, 0x01D7, 0x01D7, 0x01D7, 0x01D7, 0x01D7, 0x01D7, 0x01D7, 0x01D7, 0x01D7,
+    0x01D7, 0x01D7, 0x01D7, 0x01D7,
+/* DATA_BLOCK: -- 0x28D0..0x28DF -- */
+    0x01D7, 0x01D7, 0x01D7, 0x01D7, 0x01D7, 0x01D7, 0x002C, 0x01D8, 0x01D9, 0x01D9, 0x01D9, 0x01D9,
+    0x01D9, 0x01D9, 0x01D9, 0x01D9,
+/* DATA_BLOCK: -- 0x28E0..0x28EF -- */
+    0x01DA, 0x01DA, 0x01DA, 0x01DA, 0x01DA, 0x01DA, 0x01DA, 0x01DA, 0x01DA, 0x01DA, 0x01DA, 0x01DA,
+    0x01DA, 0x01DA, 0x01DA, 0x01DA,
+/* DATA_BLOCK: -- 0x28F0..0x28FF -- */
+    0x01DA, 0x01DA, 0x01DA, 0x01DA, 0x01DA, 0x01DA, 0x01DA, 0x01DB, 0x01DB, 0x01DC, 0x01DC, 0x01DC,
+    0x01DC, 0x01DC, 0x01DC, 0x01DC,
+/* DATA_BLOCK: -- 0x2900..0x290F -- */
+    0x01DD, 0x01DD, 0x01DD, 0x01DD, 0x01DD, 0x01DD, 0x01DD, 0x01DD, 0x01DD, 0x01DD, 0x01DD, 0x01DD,
+    0x01DD, 0x01DD, 0x01DD, 0x01DD,
+/* DATA_BLOCK: -- 0x2910..0x291F -- */
+    0x01DD, 0x01DD, 0x01DD, 0x01DD, 0x01DD, 0x01DD, 0x01DD, 0x01DD, 0x01DD, 0x01DD, 0x01DD, 0x01DD,
+    0x01DD, 0x01DD, 0x01DD, 0x002C,
+/* DATA_BLOCK: -- 0x2920..0x292F -- */
+    0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x01DE, 0x01DE, 0x01DE, 0x01DE, 0x01DE,
+    0x01DE, 0x01DE, 0x01DE, 0x01DE,
+/* DATA_BLOCK: -- 0x2930..0x293F -- */
+    0x01DF, 0x01DF, 0x01DF, 0x01DF, 0x01DF, 0x01DF, 0x01DF, 0x01DF, 0x01DF, 0x01DF, 0x01DF, 0x01DF,
+    0x01DF, 0x01DF, 0x01DF, 0x01DF,
+/* DATA_BLOCK: -- 0x2940..0x294F -- */
+    0x01DF, 0x01DF, 0x01DF, 0x002C, 0x01DF, 0x01DF, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x01E0,
+    0x01E0, 0x01E0, 0x01E0, 0x01E0,
+/* DATA_BLOCK: -- 0x2950..0x295F -- */
+    0x01E1, 0x01E1, 0x01E1, 0x01E1, 0x01E1, 0x01E1, 0x01E1, 0x01E1, 0x01E1, 0x01E1, 0x01E1, 0x01E1,
+    0x01E1, 0x01E1, 0x01E1, 0x01E1,
+/* DATA_BLOCK: -- 0x2960..0x296F -- */
+    0x01E1, 0x01E1, 0x01E1, 0x01E1, 0x01E1, 0x01E1, 0x01E2, 0x01E2, 0x01E2, 0x01E2, 0x01E2, 0x01E2,
+    0x002C, 0x002C, 0x002C, 0x01E3,
+/* DATA_BLOCK: -- 0x2970..0x297F -- */
+    0x01E4, 0x01E4, 0x01E4, 0x01E4, 0x01E4, 0x01E4, 0x01E4, 0x01E4, 0x01E4, 0x01E4, 0x01E4, 0x01E4,
+    0x01E4, 0x01E4, 0x01E4, 0x01E4,
+/* DATA_BLOCK: -- 0x2980..0x298F -- */
+    0x01E4, 0x01E4, 0x01E4, 0x01E4, 0x01E4, 0x01E4, 0x01E4, 0x01E4, 0x01E4, 0x01E4, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x01E5,
+/* DATA_BLOCK: -- 0x2990..0x299F -- */
+    0x01E6, 0x01E6, 0x01E6, 0x01E6, 0x01E6, 0x01E6, 0x01E6, 0x01E6, 0x01E6, 0x01E6, 0x01E6, 0x01E6,
+    0x01E6, 0x01E6, 0x01E6, 0x01E6,
+/* DATA_BLOCK: -- 0x29A0..0x29AF -- */
+    0x01E7, 0x01E7, 0x01E7, 0x01E7, 0x01E7, 0x01E7, 0x01E7, 0x01E7, 0x01E7, 0x01E7, 0x01E7, 0x01E7,
+    0x01E7, 0x01E7, 0x01E7, 0x01E7,
+/* DATA_BLOCK: -- 0x29B0..0x29BF -- */
+    0x01E7, 0x01E7, 0x01E7, 0x01E7, 0x01E7, 0x01E7, 0x01E7, 0x01E7, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x01E8, 0x01E8, 0x01E7, 0x01E7,
+/* DATA_BLOCK: -- 0x29C0..0x29CF -- */
+    0x01E8, 0x01E8, 0x01E8, 0x01E8, 0x01E8, 0x01E8, 0x01E8, 0x01E8, 0x01E8, 0x01E8, 0x01E8, 0x01E8,
+    0x01E8, 0x01E8, 0x01E8, 0x01E8,
+/* DATA_BLOCK: -- 0x29D0..0x29DF -- */
+    0x002C, 0x002C, 0x01E8, 0x01E8, 0x01E8, 0x01E8, 0x01E8, 0x01E8, 0x01E8, 0x01E8, 0x01E8, 0x01E8,
+    0x01E8, 0x01E8, 0x01E8, 0x01E8,
+/* DATA_BLOCK: -- 0x29E0..0x29EF -- */
+    0x01E9, 0x01EA, 0x01EA, 0x01EA, 0x002C, 0x01EA, 0x01EA, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x01EA, 0x01EA, 0x01EA, 0x01EA,
+/* DATA_BLOCK: -- 0x29F0..0x29FF -- */
+    0x01E9, 0x01E9, 0x01E9, 0x01E9, 0x002C, 0x01E9, 0x01E9, 0x01E9, 0x002C, 0x01E9, 0x01E9, 0x01E9,
+    0x01E9, 0x01E9, 0x01E9, 0x01E9,
+/* DATA_BLOCK: -- 0x2A00..0x2A0F -- */
+    0x01E9, 0x01E9, 0x01E9, 0x01E9, 0x01E9, 0x01E9, 0x01E9, 0x01E9, 0x01E9, 0x01E9, 0x01E9, 0x01E9,
+    0x01E9, 0x01E9, 0x01E9, 0x01E9,
+/* DATA_BLOCK: -- 0x2A10..0x2A1F -- */
+    0x01E9, 0x01E9, 0x01E9, 0x01E9, 0x01E9, 0x01E9, 0x002C, 0x002C, 0x01EA, 0x01EA, 0x01EA, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x01EA,
+/* DATA_BLOCK: -- 0x2A20..0x2A2F -- */
+    0x01EB, 0x01EB, 0x01EB, 0x01EB, 0x01EB, 0x01EB, 0x01EB, 0x01EB, 0x01EB, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2A30..0x2A3F -- */
+    0x01EC, 0x01EC, 0x01EC, 0x01EC, 0x01EC, 0x01EC, 0x01EC, 0x01EC, 0x01EC, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2A40..0x2A4F -- */
+    0x01ED, 0x01ED, 0x01ED, 0x01ED, 0x01ED, 0x01ED, 0x01ED, 0x01ED, 0x01ED, 0x01ED, 0x01ED, 0x01ED,
+    0x01ED, 0x01ED, 0x01ED, 0x01ED,
+/* DATA_BLOCK: -- 0x2A50..0x2A5F -- */
+    0x01ED, 0x01ED, 0x01ED, 0x01ED, 0x01ED, 0x01ED, 0x01ED, 0x01ED, 0x01ED, 0x01ED, 0x01ED, 0x01ED,
+    0x01ED, 0x01EE, 0x01EE, 0x01EF,
+/* DATA_BLOCK: -- 0x2A60..0x2A6F -- */
+    0x01F0, 0x01F0, 0x01F0, 0x01F0, 0x01F0, 0x01F0, 0x01F0, 0x01F0, 0x01F0, 0x01F0, 0x01F0, 0x01F0,
+    0x01F0, 0x01F0, 0x01F0, 0x01F0,
+/* DATA_BLOCK: -- 0x2A70..0x2A7F -- */
+    0x01F0, 0x01F0, 0x01F0, 0x01F0, 0x01F0, 0x01F0, 0x01F0, 0x01F0, 0x01F0, 0x01F0, 0x01F0, 0x01F0,
+    0x01F0, 0x01F1, 0x01F1, 0x01F1,
+/* DATA_BLOCK: -- 0x2A80..0x2A8F -- */
+    0x01F2, 0x01F2, 0x01F2, 0x01F2, 0x01F2, 0x01F2, 0x01F2, 0x01F2, 0x01F3, 0x01F2, 0x01F2, 0x01F2,
+    0x01F2, 0x01F2, 0x01F2, 0x01F2,
+/* DATA_BLOCK: -- 0x2A90..0x2A9F -- */
+    0x01F2, 0x01F2, 0x01F2, 0x01F2, 0x01F2, 0x01F2, 0x01F2, 0x01F2, 0x01F2, 0x01F2, 0x01F2, 0x01F2,
+    0x01F2, 0x01F2, 0x01F2, 0x01F2,
+/* DATA_BLOCK: -- 0x2AA0..0x2AAF -- */
+    0x01F2, 0x01F2, 0x01F2, 0x01F2, 0x01F2, 0x01F4, 0x01F4, 0x002C, 0x002C, 0x002C, 0x002C, 0x01F5,
+    0x01F5, 0x01F5, 0x01F5, 0x01F5,
+/* DATA_BLOCK: -- 0x2AB0..0x2ABF -- */
+    0x01F6, 0x01F6, 0x01F6, 0x01F6, 0x01F6, 0x01F6, 0x01F6, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2AC0..0x2ACF -- */
+    0x01F7, 0x01F7, 0x01F7, 0x01F7, 0x01F7, 0x01F7, 0x01F7, 0x01F7, 0x01F7, 0x01F7, 0x01F7, 0x01F7,
+    0x01F7, 0x01F7, 0x01F7, 0x01F7,
+/* DATA_BLOCK: -- 0x2AD0..0x2ADF -- */
+    0x01F7, 0x01F7, 0x01F7, 0x01F7, 0x01F7, 0x01F7, 0x002C, 0x002C, 0x002C, 0x01F8, 0x01F8, 0x01F8,
+    0x01F8, 0x01F8, 0x01F8, 0x01F8,
+/* DATA_BLOCK: -- 0x2AE0..0x2AEF -- */
+    0x01F9, 0x01F9, 0x01F9, 0x01F9, 0x01F9, 0x01F9, 0x01F9, 0x01F9, 0x01F9, 0x01F9, 0x01F9, 0x01F9,
+    0x01F9, 0x01F9, 0x01F9, 0x01F9,
+/* DATA_BLOCK: -- 0x2AF0..0x2AFF -- */
+    0x01F9, 0x01F9, 0x01F9, 0x01F9, 0x01F9, 0x01F9, 0x002C, 0x002C, 0x01FA, 0x01FA, 0x01FA, 0x01FA,
+    0x01FA, 0x01FA, 0x01FA, 0x01FA,
+/* DATA_BLOCK: -- 0x2B00..0x2B0F -- */
+    0x01FB, 0x01FB, 0x01FB, 0x01FB, 0x01FB, 0x01FB, 0x01FB, 0x01FB, 0x01FB, 0x01FB, 0x01FB, 0x01FB,
+    0x01FB, 0x01FB, 0x01FB, 0x01FB,
+/* DATA_BLOCK: -- 0x2B10..0x2B1F -- */
+    0x01FB, 0x01FB, 0x01FB, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x01FC, 0x01FC, 0x01FC, 0x01FC,
+    0x01FC, 0x01FC, 0x01FC, 0x01FC,
+/* DATA_BLOCK: -- 0x2B20..0x2B2F -- */
+    0x01FD, 0x01FD, 0x01FD, 0x01FD, 0x01FD, 0x01FD, 0x01FD, 0x01FD, 0x01FD, 0x01FD, 0x01FD, 0x01FD,
+    0x01FD, 0x01FD, 0x01FD, 0x01FD,
+/* DATA_BLOCK: -- 0x2B30..0x2B3F -- */
+    0x01FD, 0x01FD, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x01FE, 0x01FE, 0x01FE,
+    0x01FE, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2B40..0x2B4F -- */
+    0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x01FF, 0x01FF, 0x01FF,
+    0x01FF, 0x01FF, 0x01FF, 0x01FF,
+/* DATA_BLOCK: -- 0x2B50..0x2B5F -- */
+    0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200,
+    0x0200, 0x0200, 0x0200, 0x0200,
+/* DATA_BLOCK: -- 0x2B60..0x2B6F -- */
+    0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2B70..0x2B7F -- */
+    0x0201, 0x0201, 0x0201, 0x0201, 0x0201, 0x0201, 0x0201, 0x0201, 0x0201, 0x0201, 0x0201, 0x0201,
+    0x0201, 0x0201, 0x0201, 0x0201,
+/* DATA_BLOCK: -- 0x2B80..0x2B8F -- */
+    0x0201, 0x0201, 0x0201, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2B90..0x2B9F -- */
+    0x0202, 0x0202, 0x0202, 0x0202, 0x0202, 0x0202, 0x0202, 0x0202, 0x0202, 0x0202, 0x0202, 0x0202,
+    0x0202, 0x0202, 0x0202, 0x0202,
+/* DATA_BLOCK: -- 0x2BA0..0x2BAF -- */
+    0x0202, 0x0202, 0x0202, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x0203, 0x0203,
+    0x0203, 0x0203, 0x0203, 0x0203,
+/* DATA_BLOCK: -- 0x2BB0..0x2BBF -- */
+    0x0204, 0x0204, 0x0204, 0x0204, 0x0204, 0x0204, 0x0204, 0x0204, 0x0204, 0x0204, 0x0204, 0x0204,
+    0x0204, 0x0204, 0x0204, 0x0204,
+/* DATA_BLOCK: -- 0x2BC0..0x2BCF -- */
+    0x0204, 0x0204, 0x0204, 0x0204, 0x0205, 0x0205, 0x0205, 0x0205, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2BD0..0x2BDF -- */
+    0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2BE0..0x2BEF -- */
+    0x0207, 0x0207, 0x0207, 0x0207, 0x0207, 0x0207, 0x0207, 0x0207, 0x0207, 0x0207, 0x0207, 0x0207,
+    0x0207, 0x0207, 0x0207, 0x0207,
+/* DATA_BLOCK: -- 0x2BF0..0x2BFF -- */
+    0x0207, 0x0207, 0x0207, 0x0207, 0x0207, 0x0207, 0x0207, 0x0207, 0x0207, 0x0207, 0x0207, 0x0207,
+    0x0207, 0x0207, 0x0207, 0x002C,
+/* DATA_BLOCK: -- 0x2C00..0x2C0F -- */
+    0x0208, 0x0208, 0x0208, 0x0208, 0x0208, 0x0208, 0x0208, 0x0208, 0x0208, 0x0208, 0x0208, 0x0208,
+    0x0208, 0x0208, 0x0208, 0x0208,
+/* DATA_BLOCK: -- 0x2C10..0x2C1F -- */
+    0x0208, 0x0208, 0x0208, 0x0208, 0x0208, 0x0208, 0x0208, 0x0208, 0x0208, 0x0208, 0x002C, 0x0209,
+    0x0209, 0x020A, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2C20..0x2C2F -- */
+    0x0208, 0x0208, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2C30..0x2C3F -- */
+    0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x0049, 0x0049, 0x0049,
+/* DATA_BLOCK: -- 0x2C40..0x2C4F -- */
+    0x020B, 0x020B, 0x020B, 0x020B, 0x020B, 0x020B, 0x020B, 0x020B, 0x020B, 0x020B, 0x020B, 0x020B,
+    0x020B, 0x020B, 0x020B, 0x020B,
+/* DATA_BLOCK: -- 0x2C50..0x2C5F -- */
+    0x020B, 0x020B, 0x020B, 0x020B, 0x020B, 0x020B, 0x020B, 0x020B, 0x020B, 0x020B, 0x020B, 0x020B,
+    0x020B, 0x020C, 0x020C, 0x020C,
+/* DATA_BLOCK: -- 0x2C60..0x2C6F -- */
+    0x020C, 0x020C, 0x020C, 0x020C, 0x020C, 0x020C, 0x020C, 0x020B, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2C70..0x2C7F -- */
+    0x020D, 0x020D, 0x020D, 0x020D, 0x020D, 0x020D, 0x020D, 0x020D, 0x020D, 0x020D, 0x020D, 0x020D,
+    0x020D, 0x020D, 0x020D, 0x020D,
+/* DATA_BLOCK: -- 0x2C80..0x2C8F -- */
+    0x020D, 0x020D, 0x020D, 0x020D, 0x020D, 0x020D, 0x020E, 0x020E, 0x020E, 0x020E, 0x020E, 0x020E,
+    0x020E, 0x020E, 0x020E, 0x020E,
+/* DATA_BLOCK: -- 0x2C90..0x2C9F -- */
+    0x020E, 0x020F, 0x020F, 0x020F, 0x020F, 0x0210, 0x0210, 0x0210, 0x0210, 0x0210, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2CA0..0x2CAF -- */
+    0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211,
+    0x0211, 0x0211, 0x0211, 0x0211,
+/* DATA_BLOCK: -- 0x2CB0..0x2CBF -- */
+    0x0211, 0x0211, 0x0212, 0x0212, 0x0212, 0x0212, 0x0213, 0x0213, 0x0213, 0x0213, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2CC0..0x2CCF -- */
+    0x0214, 0x0214, 0x0214, 0x0214, 0x0214, 0x0214, 0x0214, 0x0214, 0x0214, 0x0214, 0x0214, 0x0214,
+    0x0214, 0x0214, 0x0214, 0x0214,
+/* DATA_BLOCK: -- 0x2CD0..0x2CDF -- */
+    0x0214, 0x0214, 0x0214, 0x0214, 0x0214, 0x0215, 0x0215, 0x0215, 0x0215, 0x0215, 0x0215, 0x0215,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2CE0..0x2CEF -- */
+    0x0216, 0x0216, 0x0216, 0x0216, 0x0216, 0x0216, 0x0216, 0x0216, 0x0216, 0x0216, 0x0216, 0x0216,
+    0x0216, 0x0216, 0x0216, 0x0216,
+/* DATA_BLOCK: -- 0x2CF0..0x2CFF -- */
+    0x0216, 0x0216, 0x0216, 0x0216, 0x0216, 0x0216, 0x0216, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2D00..0x2D0F -- */
+    0x0217, 0x0218, 0x0217, 0x0219, 0x0219, 0x0219, 0x0219, 0x0219, 0x0219, 0x0219, 0x0219, 0x0219,
+    0x0219, 0x0219, 0x0219, 0x0219,
+/* DATA_BLOCK: -- 0x2D10..0x2D1F -- */
+    0x0219, 0x0219, 0x0219, 0x0219, 0x0219, 0x0219, 0x0219, 0x0219, 0x0219, 0x0219, 0x0219, 0x0219,
+    0x0219, 0x0219, 0x0219, 0x0219,
+/* DATA_BLOCK: -- 0x2D20..0x2D2F -- */
+    0x0219, 0x0219, 0x0219, 0x0219, 0x0219, 0x0219, 0x0219, 0x0219, 0x0218, 0x0218, 0x0218, 0x0218,
+    0x0218, 0x0218, 0x0218, 0x0218,
+/* DATA_BLOCK: -- 0x2D30..0x2D3F -- */
+    0x0218, 0x0218, 0x0218, 0x0218, 0x0218, 0x0218, 0x0218, 0x021A, 0x021A, 0x021A, 0x021A, 0x021A,
+    0x021A, 0x021A, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2D40..0x2D4F -- */
+    0x002C, 0x002C, 0x021B, 0x021B, 0x021B, 0x021B, 0x021B, 0x021B, 0x021B, 0x021B, 0x021B, 0x021B,
+    0x021B, 0x021B, 0x021B, 0x021B,
+/* DATA_BLOCK: -- 0x2D50..0x2D5F -- */
+    0x021B, 0x021B, 0x021B, 0x021B, 0x021B, 0x021B, 0x021C, 0x021C, 0x021C, 0x021C, 0x021C, 0x021C,
+    0x021C, 0x021C, 0x021C, 0x021C,
+/* DATA_BLOCK: -- 0x2D60..0x2D6F -- */
+    0x0218, 0x0219, 0x0219, 0x0218, 0x0218, 0x0219, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x0218,
+/* DATA_BLOCK: -- 0x2D70..0x2D7F -- */
+    0x021D, 0x021D, 0x021E, 0x021F, 0x021F, 0x021F, 0x021F, 0x021F, 0x021F, 0x021F, 0x021F, 0x021F,
+    0x021F, 0x021F, 0x021F, 0x021F,
+/* DATA_BLOCK: -- 0x2D80..0x2D8F -- */
+    0x021F, 0x021F, 0x021F, 0x021F, 0x021F, 0x021F, 0x021F, 0x021F, 0x021F, 0x021F, 0x021F, 0x021F,
+    0x021F, 0x021F, 0x021F, 0x021F,
+/* DATA_BLOCK: -- 0x2D90..0x2D9F -- */
+    0x021E, 0x021E, 0x021E, 0x021D, 0x021D, 0x021D, 0x021D, 0x021E, 0x021E, 0x021D, 0x021D, 0x0220,
+    0x0220, 0x0221, 0x0220, 0x0220,
+/* DATA_BLOCK: -- 0x2DA0..0x2DAF -- */
+    0x0220, 0x0220, 0x021D, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x0221, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2DB0..0x2DBF -- */
+    0x0222, 0x0222, 0x0222, 0x0222, 0x0222, 0x0222, 0x0222, 0x0222, 0x0222, 0x0222, 0x0222, 0x0222,
+    0x0222, 0x0222, 0x0222, 0x0222,
+/* DATA_BLOCK: -- 0x2DC0..0x2DCF -- */
+    0x0222, 0x0222, 0x0222, 0x0222, 0x0222, 0x0222, 0x0222, 0x0222, 0x0222, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2DD0..0x2DDF -- */
+    0x0223, 0x0223, 0x0223, 0x0223, 0x0223, 0x0223, 0x0223, 0x0223, 0x0223, 0x0223, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2DE0..0x2DEF -- */
+    0x0224, 0x0224, 0x0224, 0x0225, 0x0225, 0x0225, 0x0225, 0x0225, 0x0225, 0x0225, 0x0225, 0x0225,
+    0x0225, 0x0225, 0x0225, 0x0225,
+/* DATA_BLOCK: -- 0x2DF0..0x2DFF -- */
+    0x0225, 0x0225, 0x0225, 0x0225, 0x0225, 0x0225, 0x0225, 0x0225, 0x0225, 0x0225, 0x0225, 0x0225,
+    0x0225, 0x0225, 0x0225, 0x0225,
+/* DATA_BLOCK: -- 0x2E00..0x2E0F -- */
+    0x0225, 0x0225, 0x0225, 0x0225, 0x0225, 0x0225, 0x0225, 0x0224, 0x0224, 0x0224, 0x0224, 0x0224,
+    0x0226, 0x0224, 0x0224, 0x0224,
+/* DATA_BLOCK: -- 0x2E10..0x2E1F -- */
+    0x0224, 0x0224, 0x0224, 0x0224, 0x0224, 0x002C, 0x0227, 0x0227, 0x0227, 0x0227, 0x0227, 0x0227,
+    0x0227, 0x0227, 0x0227, 0x0227,
+/* DATA_BLOCK: -- 0x2E20..0x2E2F -- */
+    0x0228, 0x0228, 0x0228, 0x0228, 0x0225, 0x0226, 0x0226, 0x0225, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2E30..0x2E3F -- */
+    0x0229, 0x0229, 0x0229, 0x0229, 0x0229, 0x0229, 0x0229, 0x0229, 0x0229, 0x0229, 0x0229, 0x0229,
+    0x0229, 0x0229, 0x0229, 0x0229,
+/* DATA_BLOCK: -- 0x2E40..0x2E4F -- */
+    0x0229, 0x0229, 0x0229, 0x022A, 0x022B, 0x022B, 0x0229, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2E50..0x2E5F -- */
+    0x022C, 0x022C, 0x022D, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E,
+    0x022E, 0x022E, 0x022E, 0x022E,
+/* DATA_BLOCK: -- 0x2E60..0x2E6F -- */
+    0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E,
+    0x022E, 0x022E, 0x022E, 0x022E,
+/* DATA_BLOCK: -- 0x2E70..0x2E7F -- */
+    0x022E, 0x022E, 0x022E, 0x022D, 0x022D, 0x022D, 0x022C, 0x022C, 0x022C, 0x022C, 0x022C, 0x022C,
+    0x022C, 0x022C, 0x022C, 0x022D,
+/* DATA_BLOCK: -- 0x2E80..0x2E8F -- */
+    0x022D, 0x022E, 0x022E, 0x022E, 0x022E, 0x022F, 0x022F, 0x022F, 0x022F, 0x022C, 0x022C, 0x022C,
+    0x022C, 0x022F, 0x022D, 0x022C,
+/* DATA_BLOCK: -- 0x2E90..0x2E9F -- */
+    0x0230, 0x0230, 0x0230, 0x0230, 0x0230, 0x0230, 0x0230, 0x0230, 0x0230, 0x0230, 0x022E, 0x022F,
+    0x022E, 0x022F, 0x022F, 0x022F,
+/* DATA_BLOCK: -- 0x2EA0..0x2EAF -- */
+    0x002C, 0x0231, 0x0231, 0x0231, 0x0231, 0x0231, 0x0231, 0x0231, 0x0231, 0x0231, 0x0231, 0x0231,
+    0x0231, 0x0231, 0x0231, 0x0231,
+/* DATA_BLOCK: -- 0x2EB0..0x2EBF -- */
+    0x0231, 0x0231, 0x0231, 0x0231, 0x0231, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2EC0..0x2ECF -- */
+    0x0232, 0x0232, 0x0232, 0x0232, 0x0232, 0x0232, 0x0232, 0x0232, 0x0232, 0x0232, 0x0232, 0x0232,
+    0x0232, 0x0232, 0x0232, 0x0232,
+/* DATA_BLOCK: -- 0x2ED0..0x2EDF -- */
+    0x0232, 0x0232, 0x002C, 0x0232, 0x0232, 0x0232, 0x0232, 0x0232, 0x0232, 0x0232, 0x0232, 0x0232,
+    0x0232, 0x0232, 0x0232, 0x0232,
+/* DATA_BLOCK: -- 0x2EE0..0x2EEF -- */
+    0x0232, 0x0232, 0x0232, 0x0232, 0x0232, 0x0232, 0x0232, 0x0232, 0x0232, 0x0232, 0x0232, 0x0232,
+    0x0233, 0x0233, 0x0233, 0x0234,
+/* DATA_BLOCK: -- 0x2EF0..0x2EFF -- */
+    0x0234, 0x0234, 0x0233, 0x0233, 0x0234, 0x0233, 0x0234, 0x0234, 0x0235, 0x0235, 0x0235, 0x0235,
+    0x0235, 0x0235, 0x0234, 0x0232,
+/* DATA_BLOCK: -- 0x2F00..0x2F0F -- */
+    0x0232, 0x0234, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2F10..0x2F1F -- */
+    0x0236, 0x0236, 0x0236, 0x0236, 0x0236, 0x0236, 0x0236, 0x002C, 0x0236, 0x002C, 0x0236, 0x0236,
+    0x0236, 0x0236, 0x002C, 0x0236,
+/* DATA_BLOCK: -- 0x2F20..0x2F2F -- */
+    0x0236, 0x0236, 0x0236, 0x0236, 0x0236, 0x0236, 0x0236, 0x0236, 0x0236, 0x0236, 0x0236, 0x0236,
+    0x0236, 0x0236, 0x002C, 0x0236,
+/* DATA_BLOCK: -- 0x2F30..0x2F3F -- */
+    0x0236, 0x0236, 0x0236, 0x0236, 0x0236, 0x0236, 0x0236, 0x0236, 0x0236, 0x0237, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2F40..0x2F4F -- */
+    0x0238, 0x0238, 0x0238, 0x0238, 0x0238, 0x0238, 0x0238, 0x0238, 0x0238, 0x0238, 0x0238, 0x0238,
+    0x0238, 0x0238, 0x0238, 0x0238,
+/* DATA_BLOCK: -- 0x2F50..0x2F5F -- */
+    0x0238, 0x0238, 0x0238, 0x0238, 0x0238, 0x0238, 0x0238, 0x0238, 0x0238, 0x0238, 0x0238, 0x0238,
+    0x0238, 0x0238, 0x0238, 0x0239,
+/* DATA_BLOCK: -- 0x2F60..0x2F6F -- */
+    0x023A, 0x023A, 0x023A, 0x0239, 0x0239, 0x0239, 0x0239, 0x0239, 0x0239, 0x0239, 0x0239, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2F70..0x2F7F -- */
+    0x023B, 0x023B, 0x023B, 0x023B, 0x023B, 0x023B, 0x023B, 0x023B, 0x023B, 0x023B, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2F80..0x2F8F -- */
+    0x023C, 0x023C, 0x023D, 0x023D, 0x002C, 0x023E, 0x023E, 0x023E, 0x023E, 0x023E, 0x023E, 0x023E,
+    0x023E, 0x002C, 0x002C, 0x023E,
+/* DATA_BLOCK: -- 0x2F90..0x2F9F -- */
+    0x023E, 0x002C, 0x002C, 0x023E, 0x023E, 0x023E, 0x023E, 0x023E, 0x023E, 0x023E, 0x023E, 0x023E,
+    0x023E, 0x023E, 0x023E, 0x023E,
+/* DATA_BLOCK: -- 0x2FA0..0x2FAF -- */
+    0x023E, 0x023E, 0x023E, 0x023E, 0x023E, 0x023E, 0x023E, 0x023E, 0x023E, 0x002C, 0x023E, 0x023E,
+    0x023E, 0x023E, 0x023E, 0x023E,
+/* DATA_BLOCK: -- 0x2FB0..0x2FBF -- */
+    0x023E, 0x002C, 0x023E, 0x023E, 0x002C, 0x023E, 0x023E, 0x023E, 0x023E, 0x023E, 0x002C, 0x0028,
+    0x023C, 0x023E, 0x023D, 0x023D,
+/* DATA_BLOCK: -- 0x2FC0..0x2FCF -- */
+    0x023C, 0x023D, 0x023D, 0x023D, 0x023D, 0x002C, 0x002C, 0x023D, 0x023D, 0x002C, 0x002C, 0x023D,
+    0x023D, 0x023D, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2FD0..0x2FDF -- */
+    0x023E, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x023D, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x023E, 0x023E, 0x023E,
+/* DATA_BLOCK: -- 0x2FE0..0x2FEF -- */
+    0x023E, 0x023E, 0x023D, 0x023D, 0x002C, 0x002C, 0x023C, 0x023C, 0x023C, 0x023C, 0x023C, 0x023C,
+    0x023C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x2FF0..0x2FFF -- */
+    0x023C, 0x023C, 0x023C, 0x023C, 0x023C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3000..0x300F -- */
+    0x023F, 0x023F, 0x023F, 0x023F, 0x023F, 0x023F, 0x023F, 0x023F, 0x023F, 0x023F, 0x023F, 0x023F,
+    0x023F, 0x023F, 0x023F, 0x023F,
+/* DATA_BLOCK: -- 0x3010..0x301F -- */
+    0x023F, 0x023F, 0x023F, 0x023F, 0x023F, 0x0240, 0x0240, 0x0240, 0x0241, 0x0241, 0x0241, 0x0241,
+    0x0241, 0x0241, 0x0241, 0x0241,
+/* DATA_BLOCK: -- 0x3020..0x302F -- */
+    0x0240, 0x0240, 0x0241, 0x0241, 0x0241, 0x0240, 0x0241, 0x023F, 0x023F, 0x023F, 0x023F, 0x0242,
+    0x0242, 0x0242, 0x0242, 0x0242,
+/* DATA_BLOCK: -- 0x3030..0x303F -- */
+    0x0243, 0x0243, 0x0243, 0x0243, 0x0243, 0x0243, 0x0243, 0x0243, 0x0243, 0x0243, 0x0242, 0x0242,
+    0x002C, 0x0242, 0x0241, 0x023F,
+/* DATA_BLOCK: -- 0x3040..0x304F -- */
+    0x023F, 0x023F, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3050..0x305F -- */
+    0x0244, 0x0244, 0x0244, 0x0244, 0x0244, 0x0244, 0x0244, 0x0244, 0x0244, 0x0244, 0x0244, 0x0244,
+    0x0244, 0x0244, 0x0244, 0x0244,
+/* DATA_BLOCK: -- 0x3060..0x306F -- */
+    0x0245, 0x0245, 0x0245, 0x0246, 0x0246, 0x0246, 0x0246, 0x0246, 0x0246, 0x0245, 0x0246, 0x0245,
+    0x0245, 0x0245, 0x0245, 0x0246,
+/* DATA_BLOCK: -- 0x3070..0x307F -- */
+    0x0246, 0x0245, 0x0246, 0x0246, 0x0244, 0x0244, 0x0247, 0x0244, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3080..0x308F -- */
+    0x0248, 0x0248, 0x0248, 0x0248, 0x0248, 0x0248, 0x0248, 0x0248, 0x0248, 0x0248, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3090..0x309F -- */
+    0x0249, 0x0249, 0x0249, 0x0249, 0x0249, 0x0249, 0x0249, 0x0249, 0x0249, 0x0249, 0x0249, 0x0249,
+    0x0249, 0x0249, 0x0249, 0x0249,
+/* DATA_BLOCK: -- 0x30A0..0x30AF -- */
+    0x0249, 0x0249, 0x0249, 0x0249, 0x0249, 0x0249, 0x0249, 0x0249, 0x0249, 0x0249, 0x0249, 0x0249,
+    0x0249, 0x0249, 0x0249, 0x024A,
+/* DATA_BLOCK: -- 0x30B0..0x30BF -- */
+    0x024A, 0x024A, 0x024B, 0x024B, 0x024B, 0x024B, 0x002C, 0x002C, 0x024A, 0x024A, 0x024A, 0x024A,
+    0x024B, 0x024B, 0x024A, 0x024B,
+/* DATA_BLOCK: -- 0x30C0..0x30CF -- */
+    0x024B, 0x024C, 0x024C, 0x024C, 0x024C, 0x024C, 0x024C, 0x024C, 0x024C, 0x024C, 0x024C, 0x024C,
+    0x024C, 0x024C, 0x024C, 0x024C,
+/* DATA_BLOCK: -- 0x30D0..0x30DF -- */
+    0x024C, 0x024C, 0x024C, 0x024C, 0x024C, 0x024C, 0x024C, 0x024C, 0x0249, 0x0249, 0x0249, 0x0249,
+    0x024B, 0x024B, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x30E0..0x30EF -- */
+    0x024D, 0x024D, 0x024D, 0x024D, 0x024D, 0x024D, 0x024D, 0x024D, 0x024D, 0x024D, 0x024D, 0x024D,
+    0x024D, 0x024D, 0x024D, 0x024D,
+/* DATA_BLOCK: -- 0x30F0..0x30FF -- */
+    0x024E, 0x024E, 0x024E, 0x024F, 0x024F, 0x024F, 0x024F, 0x024F, 0x024F, 0x024F, 0x024F, 0x024E,
+    0x024E, 0x024F, 0x024E, 0x024F,
+/* DATA_BLOCK: -- 0x3100..0x310F -- */
+    0x024F, 0x0250, 0x0250, 0x0250, 0x024D, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3110..0x311F -- */
+    0x0251, 0x0251, 0x0251, 0x0251, 0x0251, 0x0251, 0x0251, 0x0251, 0x0251, 0x0251, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3120..0x312F -- */
+    0x00E7, 0x00E7, 0x00E7, 0x00E7, 0x00E7, 0x00E7, 0x00E7, 0x00E7, 0x00E7, 0x00E7, 0x00E7, 0x00E7,
+    0x00E7, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3130..0x313F -- */
+    0x0252, 0x0252, 0x0252, 0x0252, 0x0252, 0x0252, 0x0252, 0x0252, 0x0252, 0x0252, 0x0252, 0x0252,
+    0x0252, 0x0252, 0x0252, 0x0252,
+/* DATA_BLOCK: -- 0x3140..0x314F -- */
+    0x0252, 0x0252, 0x0252, 0x0252, 0x0252, 0x0252, 0x0252, 0x0252, 0x0252, 0x0252, 0x0252, 0x0253,
+    0x0254, 0x0253, 0x0254, 0x0254,
+/* DATA_BLOCK: -- 0x3150..0x315F -- */
+    0x0253, 0x0253, 0x0253, 0x0253, 0x0253, 0x0253, 0x0254, 0x0253, 0x0252, 0x0255, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3160..0x316F -- */
+    0x0256, 0x0256, 0x0256, 0x0256, 0x0256, 0x0256, 0x0256, 0x0256, 0x0256, 0x0256, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3170..0x317F -- */
+    0x0257, 0x0257, 0x0257, 0x0257, 0x0257, 0x0257, 0x0257, 0x0257, 0x0257, 0x0257, 0x0257, 0x0257,
+    0x0257, 0x0257, 0x0257, 0x0257,
+/* DATA_BLOCK: -- 0x3180..0x318F -- */
+    0x0257, 0x0257, 0x0257, 0x0257, 0x0257, 0x0257, 0x0257, 0x0257, 0x0257, 0x0257, 0x0257, 0x002C,
+    0x002C, 0x0258, 0x0258, 0x0258,
+/* DATA_BLOCK: -- 0x3190..0x319F -- */
+    0x0259, 0x0259, 0x0258, 0x0258, 0x0258, 0x0258, 0x0259, 0x0258, 0x0258, 0x0258, 0x0258, 0x0258,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x31A0..0x31AF -- */
+    0x025A, 0x025A, 0x025A, 0x025A, 0x025A, 0x025A, 0x025A, 0x025A, 0x025A, 0x025A, 0x025B, 0x025B,
+    0x025C, 0x025C, 0x025C, 0x025D,
+/* DATA_BLOCK: -- 0x31B0..0x31BF -- */
+    0x0257, 0x0257, 0x0257, 0x0257, 0x0257, 0x0257, 0x0257, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x31C0..0x31CF -- */
+    0x025E, 0x025E, 0x025E, 0x025E, 0x025E, 0x025E, 0x025E, 0x025E, 0x025E, 0x025E, 0x025E, 0x025E,
+    0x025E, 0x025E, 0x025E, 0x025E,
+/* DATA_BLOCK: -- 0x31D0..0x31DF -- */
+    0x025E, 0x025E, 0x025E, 0x025E, 0x025E, 0x025E, 0x025E, 0x025E, 0x025E, 0x025E, 0x025E, 0x025E,
+    0x025F, 0x025F, 0x025F, 0x0260,
+/* DATA_BLOCK: -- 0x31E0..0x31EF -- */
+    0x0260, 0x0260, 0x0260, 0x0260, 0x0260, 0x0260, 0x0260, 0x0260, 0x025F, 0x0260, 0x0260, 0x0261,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x31F0..0x31FF -- */
+    0x0262, 0x0262, 0x0262, 0x0262, 0x0262, 0x0262, 0x0262, 0x0262, 0x0262, 0x0262, 0x0262, 0x0262,
+    0x0262, 0x0262, 0x0262, 0x0262,
+/* DATA_BLOCK: -- 0x3200..0x320F -- */
+    0x0263, 0x0263, 0x0263, 0x0263, 0x0263, 0x0263, 0x0263, 0x0263, 0x0263, 0x0263, 0x0263, 0x0263,
+    0x0263, 0x0263, 0x0263, 0x0263,
+/* DATA_BLOCK: -- 0x3210..0x321F -- */
+    0x0264, 0x0264, 0x0264, 0x0264, 0x0264, 0x0264, 0x0264, 0x0264, 0x0264, 0x0264, 0x0265, 0x0265,
+    0x0265, 0x0265, 0x0265, 0x0265,
+/* DATA_BLOCK: -- 0x3220..0x322F -- */
+    0x0265, 0x0265, 0x0265, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x0266,
+/* DATA_BLOCK: -- 0x3230..0x323F -- */
+    0x0267, 0x0267, 0x0267, 0x0267, 0x0267, 0x0267, 0x0267, 0x002C, 0x002C, 0x0267, 0x002C, 0x002C,
+    0x0267, 0x0267, 0x0267, 0x0267,
+/* DATA_BLOCK: -- 0x3240..0x324F -- */
+    0x0267, 0x0267, 0x0267, 0x0267, 0x002C, 0x0267, 0x0267, 0x002C, 0x0267, 0x0267, 0x0267, 0x0267,
+    0x0267, 0x0267, 0x0267, 0x0267,
+/* DATA_BLOCK: -- 0x3250..0x325F -- */
+    0x0267, 0x0267, 0x0267, 0x0267, 0x0267, 0x0267, 0x0267, 0x0267, 0x0267, 0x0267, 0x0267, 0x0267,
+    0x0267, 0x0267, 0x0267, 0x0267,
+/* DATA_BLOCK: -- 0x3260..0x326F -- */
+    0x0268, 0x0268, 0x0268, 0x0268, 0x0268, 0x0268, 0x002C, 0x0268, 0x0268, 0x002C, 0x002C, 0x0269,
+    0x0269, 0x0268, 0x0269, 0x0267,
+/* DATA_BLOCK: -- 0x3270..0x327F -- */
+    0x0268, 0x0267, 0x0268, 0x0269, 0x026A, 0x026A, 0x026A, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3280..0x328F -- */
+    0x026B, 0x026B, 0x026B, 0x026B, 0x026B, 0x026B, 0x026B, 0x026B, 0x026B, 0x026B, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3290..0x329F -- */
+    0x026C, 0x026C, 0x026C, 0x026C, 0x026C, 0x026C, 0x026C, 0x026C, 0x002C, 0x002C, 0x026C, 0x026C,
+    0x026C, 0x026C, 0x026C, 0x026C,
+/* DATA_BLOCK: -- 0x32A0..0x32AF -- */
+    0x026C, 0x026C, 0x026C, 0x026C, 0x026C, 0x026C, 0x026C, 0x026C, 0x026C, 0x026C, 0x026C, 0x026C,
+    0x026C, 0x026C, 0x026C, 0x026C,
+/* DATA_BLOCK: -- 0x32B0..0x32BF -- */
+    0x026C, 0x026D, 0x026D, 0x026D, 0x026E, 0x026E, 0x026E, 0x026E, 0x002C, 0x002C, 0x026E, 0x026E,
+    0x026D, 0x026D, 0x026D, 0x026D,
+/* DATA_BLOCK: -- 0x32C0..0x32CF -- */
+    0x026E, 0x026C, 0x026F, 0x026C, 0x026D, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x32D0..0x32DF -- */
+    0x0270, 0x0271, 0x0271, 0x0271, 0x0271, 0x0271, 0x0271, 0x0272, 0x0272, 0x0271, 0x0271, 0x0270,
+    0x0270, 0x0270, 0x0270, 0x0270,
+/* DATA_BLOCK: -- 0x32E0..0x32EF -- */
+    0x0270, 0x0270, 0x0270, 0x0270, 0x0270, 0x0270, 0x0270, 0x0270, 0x0270, 0x0270, 0x0270, 0x0270,
+    0x0270, 0x0270, 0x0270, 0x0270,
+/* DATA_BLOCK: -- 0x32F0..0x32FF -- */
+    0x0270, 0x0270, 0x0270, 0x0271, 0x0271, 0x0271, 0x0271, 0x0271, 0x0271, 0x0273, 0x0270, 0x0271,
+    0x0271, 0x0271, 0x0271, 0x0274,
+/* DATA_BLOCK: -- 0x3300..0x330F -- */
+    0x0274, 0x0274, 0x0274, 0x0274, 0x0274, 0x0274, 0x0274, 0x0271, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3310..0x331F -- */
+    0x0275, 0x0276, 0x0276, 0x0276, 0x0276, 0x0276, 0x0276, 0x0277, 0x0277, 0x0276, 0x0276, 0x0276,
+    0x0275, 0x0275, 0x0275, 0x0275,
+/* DATA_BLOCK: -- 0x3320..0x332F -- */
+    0x0275, 0x0275, 0x0275, 0x0275, 0x0275, 0x0275, 0x0275, 0x0275, 0x0275, 0x0275, 0x0275, 0x0275,
+    0x0275, 0x0275, 0x0275, 0x0275,
+/* DATA_BLOCK: -- 0x3330..0x333F -- */
+    0x0275, 0x0275, 0x0275, 0x0275, 0x0275, 0x0275, 0x0275, 0x0275, 0x0275, 0x0275, 0x0276, 0x0276,
+    0x0276, 0x0276, 0x0276, 0x0276,
+/* DATA_BLOCK: -- 0x3340..0x334F -- */
+    0x0276, 0x0276, 0x0276, 0x0276, 0x0276, 0x0276, 0x0276, 0x0277, 0x0276, 0x0276, 0x0278, 0x0278,
+    0x0278, 0x0275, 0x0278, 0x0278,
+/* DATA_BLOCK: -- 0x3350..0x335F -- */
+    0x0278, 0x0278, 0x0278, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3360..0x336F -- */
+    0x0279, 0x0279, 0x0279, 0x0279, 0x0279, 0x0279, 0x0279, 0x0279, 0x0279, 0x0279, 0x0279, 0x0279,
+    0x0279, 0x0279, 0x0279, 0x0279,
+/* DATA_BLOCK: -- 0x3370..0x337F -- */
+    0x0279, 0x0279, 0x0279, 0x0279, 0x0279, 0x0279, 0x0279, 0x0279, 0x0279, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3380..0x338F -- */
+    0x006D, 0x006D, 0x006D, 0x006D, 0x006D, 0x006D, 0x006D, 0x006D, 0x006D, 0x006D, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3390..0x339F -- */
+    0x027A, 0x027A, 0x027A, 0x027A, 0x027A, 0x027A, 0x027A, 0x027A, 0x027A, 0x002C, 0x027A, 0x027A,
+    0x027A, 0x027A, 0x027A, 0x027A,
+/* DATA_BLOCK: -- 0x33A0..0x33AF -- */
+    0x027A, 0x027A, 0x027A, 0x027A, 0x027A, 0x027A, 0x027A, 0x027A, 0x027A, 0x027A, 0x027A, 0x027A,
+    0x027A, 0x027A, 0x027A, 0x027A,
+/* DATA_BLOCK: -- 0x33B0..0x33BF -- */
+    0x027A, 0x027A, 0x027A, 0x027A, 0x027A, 0x027A, 0x027A, 0x027A, 0x027A, 0x027A, 0x027A, 0x027A,
+    0x027A, 0x027A, 0x027A, 0x027B,
+/* DATA_BLOCK: -- 0x33C0..0x33CF -- */
+    0x027C, 0x027C, 0x027C, 0x027C, 0x027C, 0x027C, 0x027C, 0x002C, 0x027C, 0x027C, 0x027C, 0x027C,
+    0x027C, 0x027C, 0x027B, 0x027D,
+/* DATA_BLOCK: -- 0x33D0..0x33DF -- */
+    0x027A, 0x027E, 0x027E, 0x027E, 0x027E, 0x027E, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x33E0..0x33EF -- */
+    0x027F, 0x027F, 0x027F, 0x027F, 0x027F, 0x027F, 0x027F, 0x027F, 0x027F, 0x027F, 0x0280, 0x0280,
+    0x0280, 0x0280, 0x0280, 0x0280,
+/* DATA_BLOCK: -- 0x33F0..0x33FF -- */
+    0x0280, 0x0280, 0x0280, 0x0280, 0x0280, 0x0280, 0x0280, 0x0280, 0x0280, 0x0280, 0x0280, 0x0280,
+    0x0280, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3400..0x340F -- */
+    0x0281, 0x0281, 0x0282, 0x0282, 0x0282, 0x0282, 0x0282, 0x0282, 0x0282, 0x0282, 0x0282, 0x0282,
+    0x0282, 0x0282, 0x0282, 0x0282,
+/* DATA_BLOCK: -- 0x3410..0x341F -- */
+    0x0282, 0x0282, 0x0282, 0x0282, 0x0282, 0x0282, 0x0282, 0x0282, 0x0282, 0x0282, 0x0282, 0x0282,
+    0x0282, 0x0282, 0x0282, 0x0282,
+/* DATA_BLOCK: -- 0x3420..0x342F -- */
+    0x002C, 0x002C, 0x0283, 0x0283, 0x0283, 0x0283, 0x0283, 0x0283, 0x0283, 0x0283, 0x0283, 0x0283,
+    0x0283, 0x0283, 0x0283, 0x0283,
+/* DATA_BLOCK: -- 0x3430..0x343F -- */
+    0x0283, 0x0283, 0x0283, 0x0283, 0x0283, 0x0283, 0x0283, 0x0283, 0x002C, 0x0284, 0x0283, 0x0283,
+    0x0283, 0x0283, 0x0283, 0x0283,
+/* DATA_BLOCK: -- 0x3440..0x344F -- */
+    0x0283, 0x0284, 0x0283, 0x0283, 0x0284, 0x0283, 0x0283, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3450..0x345F -- */
+    0x0285, 0x0285, 0x0285, 0x0285, 0x0285, 0x0285, 0x0285, 0x002C, 0x0285, 0x0285, 0x002C, 0x0285,
+    0x0285, 0x0285, 0x0285, 0x0285,
+/* DATA_BLOCK: -- 0x3460..0x346F -- */
+    0x0285, 0x0285, 0x0285, 0x0285, 0x0285, 0x0285, 0x0285, 0x0285, 0x0285, 0x0285, 0x0285, 0x0285,
+    0x0285, 0x0285, 0x0285, 0x0285,
+/* DATA_BLOCK: -- 0x3470..0x347F -- */
+    0x0285, 0x0286, 0x0286, 0x0286, 0x0286, 0x0286, 0x0286, 0x002C, 0x002C, 0x002C, 0x0286, 0x002C,
+    0x0286, 0x0286, 0x002C, 0x0286,
+/* DATA_BLOCK: -- 0x3480..0x348F -- */
+    0x0286, 0x0286, 0x0286, 0x0286, 0x0286, 0x0286, 0x0285, 0x0286, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3490..0x349F -- */
+    0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x34A0..0x34AF -- */
+    0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x002C, 0x0288, 0x0288, 0x002C, 0x0288, 0x0288,
+    0x0288, 0x0288, 0x0288, 0x0288,
+/* DATA_BLOCK: -- 0x34B0..0x34BF -- */
+    0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288,
+    0x0288, 0x0288, 0x0288, 0x0288,
+/* DATA_BLOCK: -- 0x34C0..0x34CF -- */
+    0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0289, 0x0289,
+    0x0289, 0x0289, 0x0289, 0x002C,
+/* DATA_BLOCK: -- 0x34D0..0x34DF -- */
+    0x028A, 0x028A, 0x002C, 0x0289, 0x0289, 0x028A, 0x0289, 0x028A, 0x0288, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x34E0..0x34EF -- */
+    0x028B, 0x028B, 0x028B, 0x028B, 0x028B, 0x028B, 0x028B, 0x028B, 0x028B, 0x028B, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x34F0..0x34FF -- */
+    0x028C, 0x028C, 0x028C, 0x028C, 0x028C, 0x028C, 0x028C, 0x028C, 0x028C, 0x028C, 0x028C, 0x028C,
+    0x028C, 0x028C, 0x028C, 0x028C,
+/* DATA_BLOCK: -- 0x3500..0x350F -- */
+    0x028C, 0x028C, 0x028C, 0x028D, 0x028D, 0x028E, 0x028E, 0x028F, 0x028F, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3510..0x351F -- */
+    0x0290, 0x0290, 0x0291, 0x0292, 0x0291, 0x0291, 0x0291, 0x0291, 0x0291, 0x0291, 0x0291, 0x0291,
+    0x0291, 0x0291, 0x0291, 0x0291,
+/* DATA_BLOCK: -- 0x3520..0x352F -- */
+    0x0291, 0x002C, 0x0291, 0x0291, 0x0291, 0x0291, 0x0291, 0x0291, 0x0291, 0x0291, 0x0291, 0x0291,
+    0x0291, 0x0291, 0x0291, 0x0291,
+/* DATA_BLOCK: -- 0x3530..0x353F -- */
+    0x0291, 0x0291, 0x0291, 0x0291, 0x0291, 0x0291, 0x0291, 0x0291, 0x0291, 0x0291, 0x0291, 0x0291,
+    0x0291, 0x0291, 0x0291, 0x0291,
+/* DATA_BLOCK: -- 0x3540..0x354F -- */
+    0x0291, 0x0291, 0x0291, 0x0291, 0x0292, 0x0292, 0x0290, 0x0290, 0x0290, 0x0290, 0x0290, 0x002C,
+    0x002C, 0x002C, 0x0292, 0x0292,
+/* DATA_BLOCK: -- 0x3550..0x355F -- */
+    0x0290, 0x0292, 0x0290, 0x0293, 0x0293, 0x0293, 0x0293, 0x0293, 0x0293, 0x0293, 0x0293, 0x0293,
+    0x0293, 0x0293, 0x0293, 0x0293,
+/* DATA_BLOCK: -- 0x3560..0x356F -- */
+    0x0294, 0x0294, 0x0294, 0x0294, 0x0294, 0x0294, 0x0294, 0x0294, 0x0294, 0x0294, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3570..0x357F -- */
+    0x017B, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3580..0x358F -- */
+    0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C,
+    0x008C, 0x008C, 0x008C, 0x008C,
+/* DATA_BLOCK: -- 0x3590..0x359F -- */
+    0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008D, 0x008D, 0x008D, 0x008D, 0x008D, 0x008D, 0x008D,
+    0x008D, 0x008E, 0x008E, 0x008E,
+/* DATA_BLOCK: -- 0x35A0..0x35AF -- */
+    0x008E, 0x008D, 0x008D, 0x008D, 0x008D, 0x008D, 0x008D, 0x008D, 0x008D, 0x008D, 0x008D, 0x008D,
+    0x008D, 0x008D, 0x008D, 0x008D,
+/* DATA_BLOCK: -- 0x35B0..0x35BF -- */
+    0x008D, 0x008D, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x0295,
+/* DATA_BLOCK: -- 0x35C0..0x35CF -- */
+    0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296,
+    0x0296, 0x0296, 0x0296, 0x0296,
+/* DATA_BLOCK: -- 0x35D0..0x35DF -- */
+    0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x35E0..0x35EF -- */
+    0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297,
+    0x0297, 0x0297, 0x0297, 0x0297,
+/* DATA_BLOCK: -- 0x35F0..0x35FF -- */
+    0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297,
+    0x0297, 0x0297, 0x0297, 0x002C,
+/* DATA_BLOCK: -- 0x3600..0x360F -- */
+    0x0298, 0x0298, 0x0298, 0x0298, 0x0298, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3610..0x361F -- */
+    0x0296, 0x0296, 0x0296, 0x0296, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3620..0x362F -- */
+    0x0299, 0x0299, 0x0299, 0x0299, 0x0299, 0x0299, 0x0299, 0x0299, 0x0299, 0x0299, 0x0299, 0x0299,
+    0x0299, 0x0299, 0x0299, 0x0299,
+/* DATA_BLOCK: -- 0x3630..0x363F -- */
+    0x0299, 0x029A, 0x029A, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3640..0x364F -- */
+    0x029B, 0x029B, 0x029B, 0x029B, 0x029B, 0x029B, 0x029B, 0x029B, 0x029B, 0x029B, 0x029B, 0x029B,
+    0x029B, 0x029B, 0x029B, 0x029B,
+/* DATA_BLOCK: -- 0x3650..0x365F -- */
+    0x029C, 0x029C, 0x029C, 0x029C, 0x029C, 0x029C, 0x029C, 0x029C, 0x029C, 0x029C, 0x029C, 0x029C,
+    0x029C, 0x029C, 0x029C, 0x029C,
+/* DATA_BLOCK: -- 0x3660..0x366F -- */
+    0x029D, 0x029B, 0x029B, 0x029B, 0x029B, 0x029B, 0x029B, 0x029D, 0x029D, 0x029D, 0x029D, 0x029D,
+    0x029D, 0x029D, 0x029D, 0x029D,
+/* DATA_BLOCK: -- 0x3670..0x367F -- */
+    0x029D, 0x029D, 0x029D, 0x029D, 0x029D, 0x029D, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3680..0x368F -- */
+    0x029E, 0x029E, 0x029E, 0x029E, 0x029E, 0x029E, 0x029E, 0x029E, 0x029E, 0x029E, 0x029E, 0x029E,
+    0x029E, 0x029E, 0x029E, 0x029E,
+/* DATA_BLOCK: -- 0x3690..0x369F -- */
+    0x029E, 0x029E, 0x029E, 0x029E, 0x029E, 0x029E, 0x029E, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x36A0..0x36AF -- */
+    0x0185, 0x0185, 0x0185, 0x0185, 0x0185, 0x0185, 0x0185, 0x0185, 0x0185, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x36B0..0x36BF -- */
+    0x029F, 0x029F, 0x029F, 0x029F, 0x029F, 0x029F, 0x029F, 0x029F, 0x029F, 0x029F, 0x029F, 0x029F,
+    0x029F, 0x029F, 0x029F, 0x029F,
+/* DATA_BLOCK: -- 0x36C0..0x36CF -- */
+    0x029F, 0x029F, 0x029F, 0x029F, 0x029F, 0x029F, 0x029F, 0x029F, 0x029F, 0x029F, 0x029F, 0x029F,
+    0x029F, 0x029F, 0x029F, 0x002C,
+/* DATA_BLOCK: -- 0x36D0..0x36DF -- */
+    0x02A0, 0x02A0, 0x02A0, 0x02A0, 0x02A0, 0x02A0, 0x02A0, 0x02A0, 0x02A0, 0x02A0, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x02A1, 0x02A1,
+/* DATA_BLOCK: -- 0x36E0..0x36EF -- */
+    0x02A2, 0x02A2, 0x02A2, 0x02A2, 0x02A2, 0x02A2, 0x02A2, 0x02A2, 0x02A2, 0x02A2, 0x02A2, 0x02A2,
+    0x02A2, 0x02A2, 0x02A2, 0x02A2,
+/* DATA_BLOCK: -- 0x36F0..0x36FF -- */
+    0x02A2, 0x02A2, 0x02A2, 0x02A2, 0x02A2, 0x02A2, 0x02A2, 0x02A2, 0x02A2, 0x02A2, 0x02A2, 0x02A2,
+    0x02A2, 0x02A2, 0x02A2, 0x002C,
+/* DATA_BLOCK: -- 0x3700..0x370F -- */
+    0x02A3, 0x02A3, 0x02A3, 0x02A3, 0x02A3, 0x02A3, 0x02A3, 0x02A3, 0x02A3, 0x02A3, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3710..0x371F -- */
+    0x02A4, 0x02A4, 0x02A4, 0x02A4, 0x02A4, 0x02A4, 0x02A4, 0x02A4, 0x02A4, 0x02A4, 0x02A4, 0x02A4,
+    0x02A4, 0x02A4, 0x02A4, 0x02A4,
+/* DATA_BLOCK: -- 0x3720..0x372F -- */
+    0x02A4, 0x02A4, 0x02A4, 0x02A4, 0x02A4, 0x02A4, 0x02A4, 0x02A4, 0x02A4, 0x02A4, 0x02A4, 0x02A4,
+    0x02A4, 0x02A4, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3730..0x373F -- */
+    0x02A5, 0x02A5, 0x02A5, 0x02A5, 0x02A5, 0x02A6, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3740..0x374F -- */
+    0x02A7, 0x02A7, 0x02A7, 0x02A7, 0x02A7, 0x02A7, 0x02A7, 0x02A7, 0x02A7, 0x02A7, 0x02A7, 0x02A7,
+    0x02A7, 0x02A7, 0x02A7, 0x02A7,
+/* DATA_BLOCK: -- 0x3750..0x375F -- */
+    0x02A8, 0x02A8, 0x02A8, 0x02A8, 0x02A8, 0x02A8, 0x02A8, 0x02A9, 0x02A9, 0x02A9, 0x02A9, 0x02A9,
+    0x02AA, 0x02AA, 0x02AA, 0x02AA,
+/* DATA_BLOCK: -- 0x3760..0x376F -- */
+    0x02AB, 0x02AB, 0x02AB, 0x02AB, 0x02A9, 0x02AA, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3770..0x377F -- */
+    0x02AC, 0x02AC, 0x02AC, 0x02AC, 0x02AC, 0x02AC, 0x02AC, 0x02AC, 0x02AC, 0x02AC, 0x002C, 0x02AD,
+    0x02AD, 0x02AD, 0x02AD, 0x02AD,
+/* DATA_BLOCK: -- 0x3780..0x378F -- */
+    0x02AD, 0x02AD, 0x002C, 0x02A7, 0x02A7, 0x02A7, 0x02A7, 0x02A7, 0x02A7, 0x02A7, 0x02A7, 0x02A7,
+    0x02A7, 0x02A7, 0x02A7, 0x02A7,
+/* DATA_BLOCK: -- 0x3790..0x379F -- */
+    0x02A7, 0x02A7, 0x02A7, 0x02A7, 0x02A7, 0x02A7, 0x02A7, 0x02A7, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x02A7, 0x02A7, 0x02A7,
+/* DATA_BLOCK: -- 0x37A0..0x37AF -- */
+    0x02AE, 0x02AE, 0x02AE, 0x02AE, 0x02AE, 0x02AE, 0x02AE, 0x02AE, 0x02AE, 0x02AE, 0x02AE, 0x02AE,
+    0x02AE, 0x02AE, 0x02AE, 0x02AE,
+/* DATA_BLOCK: -- 0x37B0..0x37BF -- */
+    0x02AF, 0x02AF, 0x02AF, 0x02AF, 0x02AF, 0x02AF, 0x02AF, 0x02AF, 0x02AF, 0x02AF, 0x02AF, 0x02AF,
+    0x02AF, 0x02AF, 0x02AF, 0x02AF,
+/* DATA_BLOCK: -- 0x37C0..0x37CF -- */
+    0x02B0, 0x02B0, 0x02B0, 0x02B0, 0x02B0, 0x02B0, 0x02B0, 0x02B0, 0x02B0, 0x02B0, 0x02B0, 0x02B0,
+    0x02B0, 0x02B0, 0x02B0, 0x02B0,
+/* DATA_BLOCK: -- 0x37D0..0x37DF -- */
+    0x02B0, 0x02B0, 0x02B0, 0x02B0, 0x02B0, 0x02B0, 0x02B0, 0x02B1, 0x02B1, 0x02B1, 0x02B1, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x37E0..0x37EF -- */
+    0x02B2, 0x02B2, 0x02B2, 0x02B2, 0x02B2, 0x02B2, 0x02B2, 0x02B2, 0x02B2, 0x02B2, 0x02B2, 0x02B2,
+    0x02B2, 0x02B2, 0x02B2, 0x02B2,
+/* DATA_BLOCK: -- 0x37F0..0x37FF -- */
+    0x02B2, 0x02B2, 0x02B2, 0x02B2, 0x02B2, 0x02B2, 0x02B2, 0x02B2, 0x02B2, 0x02B2, 0x02B2, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x02B3,
+/* DATA_BLOCK: -- 0x3800..0x380F -- */
+    0x02B2, 0x02B4, 0x02B4, 0x02B4, 0x02B4, 0x02B4, 0x02B4, 0x02B4, 0x02B4, 0x02B4, 0x02B4, 0x02B4,
+    0x02B4, 0x02B4, 0x02B4, 0x02B4,
+/* DATA_BLOCK: -- 0x3810..0x381F -- */
+    0x02B4, 0x02B4, 0x02B4, 0x02B4, 0x02B4, 0x02B4, 0x02B4, 0x02B4, 0x02B4, 0x02B4, 0x02B4, 0x02B4,
+    0x02B4, 0x02B4, 0x02B4, 0x02B4,
+/* DATA_BLOCK: -- 0x3820..0x382F -- */
+    0x02B4, 0x02B4, 0x02B4, 0x02B4, 0x02B4, 0x02B4, 0x02B4, 0x02B4, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x02B3,
+/* DATA_BLOCK: -- 0x3830..0x383F -- */
+    0x02B3, 0x02B3, 0x02B3, 0x02B5, 0x02B5, 0x02B5, 0x02B5, 0x02B5, 0x02B5, 0x02B5, 0x02B5, 0x02B5,
+    0x02B5, 0x02B5, 0x02B5, 0x02B5,
+/* DATA_BLOCK: -- 0x3840..0x384F -- */
+    0x02B6, 0x02B7, 0x02B8, 0x0169, 0x02B9, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3850..0x385F -- */
+    0x02BA, 0x02BA, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3860..0x386F -- */
+    0x02BB, 0x02BC, 0x02BC, 0x02BC, 0x02BC, 0x02BC, 0x02BC, 0x02BC, 0x02BC, 0x02BC, 0x02BC, 0x02BC,
+    0x02BC, 0x02BC, 0x02BC, 0x02BC,
+/* DATA_BLOCK: -- 0x3870..0x387F -- */
+    0x02BC, 0x02BC, 0x02BC, 0x02BC, 0x02BC, 0x02BC, 0x02BC, 0x02BC, 0x02BC, 0x02BC, 0x02BC, 0x02BC,
+    0x02BC, 0x02BC, 0x02BC, 0x02BC,
+/* DATA_BLOCK: -- 0x3880..0x388F -- */
+    0x02BC, 0x02BC, 0x02BC, 0x02BC, 0x02BC, 0x02BC, 0x02BC, 0x02BB, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3890..0x389F -- */
+    0x02BB, 0x02BB, 0x02BB, 0x02BB, 0x02BB, 0x02BB, 0x02BB, 0x02BB, 0x02BB, 0x02BB, 0x02BB, 0x02BB,
+    0x02BB, 0x02BB, 0x02BB, 0x02BB,
+/* DATA_BLOCK: -- 0x38A0..0x38AF -- */
+    0x02BD, 0x02BD, 0x02BD, 0x02BD, 0x02BD, 0x02BD, 0x02BD, 0x02BD, 0x02BD, 0x02BD, 0x02BD, 0x02BD,
+    0x02BD, 0x02BD, 0x02BD, 0x02BD,
+/* DATA_BLOCK: -- 0x38B0..0x38BF -- */
+    0x02BD, 0x02BD, 0x02BD, 0x02BD, 0x02BD, 0x02BD, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x38C0..0x38CF -- */
+    0x02BB, 0x02BC, 0x02BC, 0x02BC, 0x02BC, 0x02BC, 0x02BC, 0x02BC, 0x02BB, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x38D0..0x38DF -- */
+    0x0170, 0x0170, 0x0170, 0x0170, 0x002C, 0x0170, 0x0170, 0x0170, 0x0170, 0x0170, 0x0170, 0x0170,
+    0x002C, 0x0170, 0x0170, 0x002C,
+/* DATA_BLOCK: -- 0x38E0..0x38EF -- */
+    0x016F, 0x016D, 0x016D, 0x016D, 0x016D, 0x016D, 0x016D, 0x016D, 0x016D, 0x016D, 0x016D, 0x016D,
+    0x016D, 0x016D, 0x016D, 0x016D,
+/* DATA_BLOCK: -- 0x38F0..0x38FF -- */
+    0x016F, 0x016F, 0x016F, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3900..0x390F -- */
+    0x002C, 0x002C, 0x016D, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3910..0x391F -- */
+    0x016D, 0x016D, 0x016D, 0x002C, 0x002C, 0x016F, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3920..0x392F -- */
+    0x002C, 0x002C, 0x002C, 0x002C, 0x016F, 0x016F, 0x016F, 0x016F, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3930..0x393F -- */
+    0x02BE, 0x02BE, 0x02BE, 0x02BE, 0x02BE, 0x02BE, 0x02BE, 0x02BE, 0x02BE, 0x02BE, 0x02BE, 0x02BE,
+    0x02BE, 0x02BE, 0x02BE, 0x02BE,
+/* DATA_BLOCK: -- 0x3940..0x394F -- */
+    0x02BE, 0x02BE, 0x02BE, 0x02BE, 0x02BE, 0x02BE, 0x02BE, 0x02BE, 0x02BE, 0x02BE, 0x02BE, 0x02BE,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3950..0x395F -- */
+    0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF,
+    0x02BF, 0x02BF, 0x02BF, 0x02BF,
+/* DATA_BLOCK: -- 0x3960..0x396F -- */
+    0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3970..0x397F -- */
+    0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF,
+    0x02BF, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3980..0x398F -- */
+    0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3990..0x399F -- */
+    0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x002C, 0x002C,
+    0x02C0, 0x02C1, 0x02C1, 0x02C2,
+/* DATA_BLOCK: -- 0x39A0..0x39AF -- */
+    0x001C, 0x001C, 0x001C, 0x001C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x39B0..0x39BF -- */
+    0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028,
+    0x0028, 0x0028, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x39C0..0x39CF -- */
+    0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x39D0..0x39DF -- */
+    0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x39E0..0x39EF -- */
+    0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x39F0..0x39FF -- */
+    0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x002C, 0x002C, 0x00B9, 0x00B9, 0x00B9,
+    0x00B9, 0x00B9, 0x00B9, 0x00B9,
+/* DATA_BLOCK: -- 0x3A00..0x3A0F -- */
+    0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x011D, 0x011D, 0x0028, 0x0028, 0x0028, 0x00B9, 0x00B9,
+    0x00B9, 0x011D, 0x011D, 0x011D,
+/* DATA_BLOCK: -- 0x3A10..0x3A1F -- */
+    0x011D, 0x011D, 0x011D, 0x001C, 0x001C, 0x001C, 0x001C, 0x001C, 0x001C, 0x001C, 0x001C, 0x0028,
+    0x0028, 0x0028, 0x0028, 0x0028,
+/* DATA_BLOCK: -- 0x3A20..0x3A2F -- */
+    0x0028, 0x0028, 0x0028, 0x00B9, 0x00B9, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028,
+    0x00B9, 0x00B9, 0x00B9, 0x00B9,
+/* DATA_BLOCK: -- 0x3A30..0x3A3F -- */
+    0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x0028, 0x0028,
+    0x0028, 0x0028, 0x00B9, 0x00B9,
+/* DATA_BLOCK: -- 0x3A40..0x3A4F -- */
+    0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x0019, 0x0019, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3A50..0x3A5F -- */
+    0x01BA, 0x01BA, 0x01BA, 0x01BA, 0x01BA, 0x01BA, 0x01BA, 0x01BA, 0x01BA, 0x01BA, 0x01BA, 0x01BA,
+    0x01BA, 0x01BA, 0x01BA, 0x01BA,
+/* DATA_BLOCK: -- 0x3A60..0x3A6F -- */
+    0x01BA, 0x01BA, 0x02C3, 0x02C3, 0x02C3, 0x01BA, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3A70..0x3A7F -- */
+    0x0172, 0x0172, 0x0172, 0x0172, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3A80..0x3A8F -- */
+    0x0172, 0x0172, 0x0172, 0x0172, 0x0172, 0x0172, 0x0172, 0x0172, 0x0172, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3A90..0x3A9F -- */
+    0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137,
+    0x0137, 0x0137, 0x0137, 0x0137,
+/* DATA_BLOCK: -- 0x3AA0..0x3AAF -- */
+    0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020,
+/* DATA_BLOCK: -- 0x3AB0..0x3ABF -- */
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020,
+/* DATA_BLOCK: -- 0x3AC0..0x3ACF -- */
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137,
+    0x0137, 0x0137, 0x0137, 0x0137,
+/* DATA_BLOCK: -- 0x3AD0..0x3ADF -- */
+    0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137,
+    0x0137, 0x0137, 0x0020, 0x0020,
+/* DATA_BLOCK: -- 0x3AE0..0x3AEF -- */
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x002C, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020,
+/* DATA_BLOCK: -- 0x3AF0..0x3AFF -- */
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0137, 0x0137, 0x0137, 0x0137,
+    0x0137, 0x0137, 0x0137, 0x0137,
+/* DATA_BLOCK: -- 0x3B00..0x3B0F -- */
+    0x0137, 0x0137, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020,
+/* DATA_BLOCK: -- 0x3B10..0x3B1F -- */
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0137, 0x002C, 0x0137, 0x0137,
+/* DATA_BLOCK: -- 0x3B20..0x3B2F -- */
+    0x002C, 0x002C, 0x0137, 0x002C, 0x002C, 0x0137, 0x0137, 0x002C, 0x002C, 0x0137, 0x0137, 0x0137,
+    0x0137, 0x002C, 0x0137, 0x0137,
+/* DATA_BLOCK: -- 0x3B30..0x3B3F -- */
+    0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0020, 0x0020, 0x0020, 0x0020, 0x002C, 0x0020,
+    0x002C, 0x0020, 0x0020, 0x0020,
+/* DATA_BLOCK: -- 0x3B40..0x3B4F -- */
+    0x0020, 0x0020, 0x0020, 0x0020, 0x002C, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020,
+/* DATA_BLOCK: -- 0x3B50..0x3B5F -- */
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0137, 0x0137, 0x002C, 0x0137, 0x0137, 0x0137, 0x0137, 0x002C,
+    0x002C, 0x0137, 0x0137, 0x0137,
+/* DATA_BLOCK: -- 0x3B60..0x3B6F -- */
+    0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x002C, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137,
+    0x0137, 0x002C, 0x0020, 0x0020,
+/* DATA_BLOCK: -- 0x3B70..0x3B7F -- */
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0137, 0x0137, 0x002C, 0x0137,
+    0x0137, 0x0137, 0x0137, 0x002C,
+/* DATA_BLOCK: -- 0x3B80..0x3B8F -- */
+    0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x002C, 0x0137, 0x002C, 0x002C, 0x002C, 0x0137, 0x0137,
+    0x0137, 0x0137, 0x0137, 0x0137,
+/* DATA_BLOCK: -- 0x3B90..0x3B9F -- */
+    0x0137, 0x002C, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020,
+/* DATA_BLOCK: -- 0x3BA0..0x3BAF -- */
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0137, 0x0137, 0x0137, 0x0137,
+/* DATA_BLOCK: -- 0x3BB0..0x3BBF -- */
+    0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020,
+/* DATA_BLOCK: -- 0x3BC0..0x3BCF -- */
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x002C, 0x002C, 0x0137, 0x0137, 0x0137, 0x0137,
+    0x0137, 0x0137, 0x0137, 0x0137,
+/* DATA_BLOCK: -- 0x3BD0..0x3BDF -- */
+    0x0137, 0x02C4, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020,
+/* DATA_BLOCK: -- 0x3BE0..0x3BEF -- */
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0010,
+    0x0020, 0x0020, 0x0020, 0x0020,
+/* DATA_BLOCK: -- 0x3BF0..0x3BFF -- */
+    0x0020, 0x0020, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137,
+    0x0137, 0x0137, 0x0137, 0x0137,
+/* DATA_BLOCK: -- 0x3C00..0x3C0F -- */
+    0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x02C4,
+    0x0020, 0x0020, 0x0020, 0x0020,
+/* DATA_BLOCK: -- 0x3C10..0x3C1F -- */
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0137, 0x0137, 0x0137, 0x0137,
+/* DATA_BLOCK: -- 0x3C20..0x3C2F -- */
+    0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x02C4, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020,
+/* DATA_BLOCK: -- 0x3C30..0x3C3F -- */
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0010,
+/* DATA_BLOCK: -- 0x3C40..0x3C4F -- */
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137,
+    0x0137, 0x0137, 0x0137, 0x0137,
+/* DATA_BLOCK: -- 0x3C50..0x3C5F -- */
+    0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137,
+    0x0137, 0x0137, 0x0137, 0x02C4,
+/* DATA_BLOCK: -- 0x3C60..0x3C6F -- */
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0010, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020,
+/* DATA_BLOCK: -- 0x3C70..0x3C7F -- */
+    0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x02C4, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020,
+/* DATA_BLOCK: -- 0x3C80..0x3C8F -- */
+    0x0020, 0x0020, 0x0020, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0137, 0x0020,
+    0x002C, 0x002C, 0x000E, 0x000E,
+/* DATA_BLOCK: -- 0x3C90..0x3C9F -- */
+    0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E,
+    0x000E, 0x000E, 0x000E, 0x000E,
+/* DATA_BLOCK: -- 0x3CA0..0x3CAF -- */
+    0x02C5, 0x02C5, 0x02C5, 0x02C5, 0x02C5, 0x02C5, 0x02C5, 0x02C5, 0x02C5, 0x02C5, 0x02C5, 0x02C5,
+    0x02C5, 0x02C5, 0x02C5, 0x02C5,
+/* DATA_BLOCK: -- 0x3CB0..0x3CBF -- */
+    0x02C6, 0x02C6, 0x02C6, 0x02C6, 0x02C6, 0x02C6, 0x02C6, 0x02C6, 0x02C6, 0x02C6, 0x02C6, 0x02C6,
+    0x02C6, 0x02C6, 0x02C6, 0x02C6,
+/* DATA_BLOCK: -- 0x3CC0..0x3CCF -- */
+    0x02C6, 0x02C6, 0x02C6, 0x02C6, 0x02C6, 0x02C6, 0x02C6, 0x02C5, 0x02C5, 0x02C5, 0x02C5, 0x02C6,
+    0x02C6, 0x02C6, 0x02C6, 0x02C6,
+/* DATA_BLOCK: -- 0x3CD0..0x3CDF -- */
+    0x02C6, 0x02C6, 0x02C6, 0x02C6, 0x02C6, 0x02C6, 0x02C6, 0x02C6, 0x02C6, 0x02C6, 0x02C6, 0x02C6,
+    0x02C6, 0x02C5, 0x02C5, 0x02C5,
+/* DATA_BLOCK: -- 0x3CE0..0x3CEF -- */
+    0x02C5, 0x02C5, 0x02C5, 0x02C5, 0x02C5, 0x02C6, 0x02C5, 0x02C5, 0x02C5, 0x02C5, 0x02C5, 0x02C5,
+    0x02C5, 0x02C5, 0x02C5, 0x02C5,
+/* DATA_BLOCK: -- 0x3CF0..0x3CFF -- */
+    0x02C5, 0x02C5, 0x02C5, 0x02C5, 0x02C6, 0x02C5, 0x02C5, 0x02C7, 0x02C7, 0x02C7, 0x02C7, 0x02C7,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3D00..0x3D0F -- */
+    0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x02C6,
+    0x02C6, 0x02C6, 0x02C6, 0x02C6,
+/* DATA_BLOCK: -- 0x3D10..0x3D1F -- */
+    0x002C, 0x02C6, 0x02C6, 0x02C6, 0x02C6, 0x02C6, 0x02C6, 0x02C6, 0x02C6, 0x02C6, 0x02C6, 0x02C6,
+    0x02C6, 0x02C6, 0x02C6, 0x02C6,
+/* DATA_BLOCK: -- 0x3D20..0x3D2F -- */
+    0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x001A, 0x0017,
+    0x0017, 0x0017, 0x0017, 0x0017,
+/* DATA_BLOCK: -- 0x3D30..0x3D3F -- */
+    0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017,
+    0x0017, 0x0017, 0x0017, 0x002C,
+/* DATA_BLOCK: -- 0x3D40..0x3D4F -- */
+    0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3D50..0x3D5F -- */
+    0x02C8, 0x02C8, 0x02C8, 0x02C8, 0x02C8, 0x02C8, 0x02C8, 0x002C, 0x02C8, 0x02C8, 0x02C8, 0x02C8,
+    0x02C8, 0x02C8, 0x02C8, 0x02C8,
+/* DATA_BLOCK: -- 0x3D60..0x3D6F -- */
+    0x02C8, 0x02C8, 0x02C8, 0x02C8, 0x02C8, 0x02C8, 0x02C8, 0x02C8, 0x02C8, 0x002C, 0x002C, 0x02C8,
+    0x02C8, 0x02C8, 0x02C8, 0x02C8,
+/* DATA_BLOCK: -- 0x3D70..0x3D7F -- */
+    0x02C8, 0x02C8, 0x002C, 0x02C8, 0x02C8, 0x002C, 0x02C8, 0x02C8, 0x02C8, 0x02C8, 0x02C8, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3D80..0x3D8F -- */
+    0x011F, 0x011F, 0x011F, 0x011F, 0x011F, 0x011F, 0x011F, 0x011F, 0x011F, 0x011F, 0x011F, 0x011F,
+    0x011F, 0x011F, 0x011F, 0x011F,
+/* DATA_BLOCK: -- 0x3D90..0x3D9F -- */
+    0x011F, 0x011F, 0x011F, 0x011F, 0x011F, 0x011F, 0x011F, 0x011F, 0x011F, 0x011F, 0x011F, 0x011F,
+    0x011F, 0x011F, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3DA0..0x3DAF -- */
+    0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x0034,
+/* DATA_BLOCK: -- 0x3DB0..0x3DBF -- */
+    0x02C9, 0x02C9, 0x02C9, 0x02C9, 0x02C9, 0x02C9, 0x02C9, 0x02C9, 0x02C9, 0x02C9, 0x02C9, 0x02C9,
+    0x02C9, 0x02C9, 0x02C9, 0x02C9,
+/* DATA_BLOCK: -- 0x3DC0..0x3DCF -- */
+    0x02C9, 0x02C9, 0x02C9, 0x02C9, 0x02C9, 0x02C9, 0x02C9, 0x02C9, 0x02C9, 0x02C9, 0x02C9, 0x02C9,
+    0x02C9, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3DD0..0x3DDF -- */
+    0x02CA, 0x02CA, 0x02CA, 0x02CA, 0x02CA, 0x02CA, 0x02CA, 0x02CB, 0x02CB, 0x02CB, 0x02CB, 0x02CB,
+    0x02CB, 0x02CB, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3DE0..0x3DEF -- */
+    0x02CC, 0x02CC, 0x02CC, 0x02CC, 0x02CC, 0x02CC, 0x02CC, 0x02CC, 0x02CC, 0x02CC, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x02C9, 0x02CD,
+/* DATA_BLOCK: -- 0x3DF0..0x3DFF -- */
+    0x02CE, 0x02CE, 0x02CE, 0x02CE, 0x02CE, 0x02CE, 0x02CE, 0x02CE, 0x02CE, 0x02CE, 0x02CE, 0x02CE,
+    0x02CE, 0x02CE, 0x02CE, 0x02CE,
+/* DATA_BLOCK: -- 0x3E00..0x3E0F -- */
+    0x02CE, 0x02CE, 0x02CE, 0x02CE, 0x02CE, 0x02CE, 0x02CE, 0x02CE, 0x02CE, 0x02CE, 0x02CE, 0x02CE,
+    0x02CE, 0x02CE, 0x02CF, 0x002C,
+/* DATA_BLOCK: -- 0x3E10..0x3E1F -- */
+    0x02D0, 0x02D0, 0x02D0, 0x02D0, 0x02D0, 0x02D0, 0x02D0, 0x02D0, 0x02D0, 0x02D0, 0x02D0, 0x02D0,
+    0x02D0, 0x02D0, 0x02D0, 0x02D0,
+/* DATA_BLOCK: -- 0x3E20..0x3E2F -- */
+    0x02D0, 0x02D0, 0x02D0, 0x02D0, 0x02D0, 0x02D0, 0x02D0, 0x02D0, 0x02D0, 0x02D0, 0x02D0, 0x02D0,
+    0x02D1, 0x02D1, 0x02D1, 0x02D1,
+/* DATA_BLOCK: -- 0x3E30..0x3E3F -- */
+    0x02D2, 0x02D2, 0x02D2, 0x02D2, 0x02D2, 0x02D2, 0x02D2, 0x02D2, 0x02D2, 0x02D2, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x02D3,
+/* DATA_BLOCK: -- 0x3E40..0x3E4F -- */
+    0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4,
+    0x02D4, 0x02D4, 0x02D4, 0x02D4,
+/* DATA_BLOCK: -- 0x3E50..0x3E5F -- */
+    0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D5,
+    0x02D6, 0x02D6, 0x02D6, 0x02D6,
+/* DATA_BLOCK: -- 0x3E60..0x3E6F -- */
+    0x02D7, 0x02D7, 0x02D7, 0x02D7, 0x02D7, 0x02D7, 0x02D7, 0x02D7, 0x02D7, 0x02D7, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3E70..0x3E7F -- */
+    0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x002C, 0x00C4, 0x00C4, 0x00C4, 0x00C4,
+    0x002C, 0x00C4, 0x00C4, 0x002C,
+/* DATA_BLOCK: -- 0x3E80..0x3E8F -- */
+    0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4,
+    0x00C4, 0x00C4, 0x00C4, 0x002C,
+/* DATA_BLOCK: -- 0x3E90..0x3E9F -- */
+    0x02D8, 0x02D8, 0x02D8, 0x02D8, 0x02D8, 0x02D8, 0x02D8, 0x02D8, 0x02D8, 0x02D8, 0x02D8, 0x02D8,
+    0x02D8, 0x02D8, 0x02D8, 0x02D8,
+/* DATA_BLOCK: -- 0x3EA0..0x3EAF -- */
+    0x02D8, 0x02D8, 0x02D8, 0x02D8, 0x02D8, 0x002C, 0x002C, 0x02D9, 0x02D9, 0x02D9, 0x02D9, 0x02D9,
+    0x02D9, 0x02D9, 0x02D9, 0x02D9,
+/* DATA_BLOCK: -- 0x3EB0..0x3EBF -- */
+    0x02DA, 0x02DA, 0x02DA, 0x02DA, 0x02DA, 0x02DA, 0x02DA, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3EC0..0x3ECF -- */
+    0x02DB, 0x02DB, 0x02DB, 0x02DB, 0x02DB, 0x02DB, 0x02DB, 0x02DB, 0x02DB, 0x02DB, 0x02DB, 0x02DB,
+    0x02DB, 0x02DB, 0x02DB, 0x02DB,
+/* DATA_BLOCK: -- 0x3ED0..0x3EDF -- */
+    0x02DB, 0x02DB, 0x02DC, 0x02DC, 0x02DC, 0x02DC, 0x02DC, 0x02DC, 0x02DC, 0x02DC, 0x02DC, 0x02DC,
+    0x02DC, 0x02DC, 0x02DC, 0x02DC,
+/* DATA_BLOCK: -- 0x3EE0..0x3EEF -- */
+    0x02DC, 0x02DC, 0x02DC, 0x02DC, 0x02DC, 0x02DC, 0x02DC, 0x02DC, 0x02DC, 0x02DC, 0x02DC, 0x02DC,
+    0x02DC, 0x02DC, 0x02DC, 0x02DC,
+/* DATA_BLOCK: -- 0x3EF0..0x3EFF -- */
+    0x02DC, 0x02DC, 0x02DC, 0x02DC, 0x02DD, 0x02DD, 0x02DD, 0x02DD, 0x02DD, 0x02DD, 0x02DD, 0x02DE,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3F00..0x3F0F -- */
+    0x02DF, 0x02DF, 0x02DF, 0x02DF, 0x02DF, 0x02DF, 0x02DF, 0x02DF, 0x02DF, 0x02DF, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x02E0, 0x02E0,
+/* DATA_BLOCK: -- 0x3F10..0x3F1F -- */
+    0x002C, 0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1,
+    0x02E1, 0x02E1, 0x02E1, 0x02E1,
+/* DATA_BLOCK: -- 0x3F20..0x3F2F -- */
+    0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1,
+    0x02E1, 0x02E1, 0x02E1, 0x02E1,
+/* DATA_BLOCK: -- 0x3F30..0x3F3F -- */
+    0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1,
+    0x02E2, 0x02E1, 0x02E1, 0x02E1,
+/* DATA_BLOCK: -- 0x3F40..0x3F4F -- */
+    0x02E3, 0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3F50..0x3F5F -- */
+    0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1,
+    0x02E1, 0x02E1, 0x02E2, 0x02E1,
+/* DATA_BLOCK: -- 0x3F60..0x3F6F -- */
+    0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1, 0x02E1,
+    0x02E1, 0x02E1, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3F70..0x3F7F -- */
+    0x004C, 0x004C, 0x004C, 0x004C, 0x002C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C,
+    0x004C, 0x004C, 0x004C, 0x004C,
+/* DATA_BLOCK: -- 0x3F80..0x3F8F -- */
+    0x002C, 0x004C, 0x004C, 0x002C, 0x004C, 0x002C, 0x002C, 0x004C, 0x002C, 0x004C, 0x004C, 0x004C,
+    0x004C, 0x004C, 0x004C, 0x004C,
+/* DATA_BLOCK: -- 0x3F90..0x3F9F -- */
+    0x004C, 0x004C, 0x004C, 0x002C, 0x004C, 0x004C, 0x004C, 0x004C, 0x002C, 0x004C, 0x002C, 0x004C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x3FA0..0x3FAF -- */
+    0x002C, 0x002C, 0x004C, 0x002C, 0x002C, 0x002C, 0x002C, 0x004C, 0x002C, 0x004C, 0x002C, 0x004C,
+    0x002C, 0x004C, 0x004C, 0x004C,
+/* DATA_BLOCK: -- 0x3FB0..0x3FBF -- */
+    0x002C, 0x004C, 0x004C, 0x002C, 0x004C, 0x002C, 0x002C, 0x004C, 0x002C, 0x004C, 0x002C, 0x004C,
+    0x002C, 0x004C, 0x002C, 0x004C,
+/* DATA_BLOCK: -- 0x3FC0..0x3FCF -- */
+    0x002C, 0x004C, 0x004C, 0x002C, 0x004C, 0x002C, 0x002C, 0x004C, 0x004C, 0x004C, 0x004C, 0x002C,
+    0x004C, 0x004C, 0x004C, 0x004C,
+/* DATA_BLOCK: -- 0x3FD0..0x3FDF -- */
+    0x004C, 0x004C, 0x004C, 0x002C, 0x004C, 0x004C, 0x004C, 0x004C, 0x002C, 0x004C, 0x004C, 0x004C,
+    0x004C, 0x002C, 0x004C, 0x002C,
+/* DATA_BLOCK: -- 0x3FE0..0x3FEF -- */
+    0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x002C, 0x004C,
+    0x004C, 0x004C, 0x004C, 0x004C,
+/* DATA_BLOCK: -- 0x3FF0..0x3FFF -- */
+    0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x4000..0x400F -- */
+    0x002C, 0x004C, 0x004C, 0x004C, 0x002C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x002C, 0x004C,
+    0x004C, 0x004C, 0x004C, 0x004C,
+/* DATA_BLOCK: -- 0x4010..0x401F -- */
+    0x0043, 0x0043, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x4020..0x402F -- */
+    0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x4030..0x403F -- */
+    0x0019, 0x0019, 0x0019, 0x0019, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x4040..0x404F -- */
+    0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019,
+    0x0019, 0x0019, 0x0019, 0x002C,
+/* DATA_BLOCK: -- 0x4050..0x405F -- */
+    0x002C, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019,
+    0x0019, 0x0019, 0x0019, 0x0019,
+/* DATA_BLOCK: -- 0x4060..0x406F -- */
+    0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x4070..0x407F -- */
+    0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x0022,
+    0x0022, 0x0019, 0x0019, 0x0019,
+/* DATA_BLOCK: -- 0x4080..0x408F -- */
+    0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x0019, 0x0019,
+    0x0019, 0x0019, 0x0019, 0x0019,
+/* DATA_BLOCK: -- 0x4090..0x409F -- */
+    0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9,
+    0x00B9, 0x0019, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x40A0..0x40AF -- */
+    0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9,
+    0x00B9, 0x00B9, 0x00B9, 0x00B9,
+/* DATA_BLOCK: -- 0x40B0..0x40BF -- */
+    0x02E4, 0x00B9, 0x00B9, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x40C0..0x40CF -- */
+    0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x40D0..0x40DF -- */
+    0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x40E0..0x40EF -- */
+    0x00B9, 0x00B9, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x40F0..0x40FF -- */
+    0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0015,
+    0x0015, 0x0015, 0x0015, 0x0015,
+/* DATA_BLOCK: -- 0x4100..0x410F -- */
+    0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x0019, 0x0019, 0x0019, 0x0019,
+/* DATA_BLOCK: -- 0x4110..0x411F -- */
+    0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x002C, 0x002C, 0x002C, 0x002C, 0x0019,
+    0x0019, 0x0019, 0x0019, 0x0019,
+/* DATA_BLOCK: -- 0x4120..0x412F -- */
+    0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x4130..0x413F -- */
+    0x0019, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x4140..0x414F -- */
+    0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x4150..0x415F -- */
+    0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019,
+    0x0019, 0x0019, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x4160..0x416F -- */
+    0x0019, 0x0019, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x4170..0x417F -- */
+    0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x4180..0x418F -- */
+    0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019,
+    0x0019, 0x0019, 0x002C, 0x0019,
+/* DATA_BLOCK: -- 0x4190..0x419F -- */
+    0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x0019, 0x0019,
+/* DATA_BLOCK: -- 0x41A0..0x41AF -- */
+    0x0019, 0x0019, 0x0019, 0x002C, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019,
+    0x0019, 0x0019, 0x0019, 0x0019,
+/* DATA_BLOCK: -- 0x41B0..0x41BF -- */
+    0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x41C0..0x41CF -- */
+    0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x0132, 0x0132,
+/* DATA_BLOCK: -- 0x41D0..0x41DF -- */
+    0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0176, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x41E0..0x41EF -- */
+    0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177,
+    0x0177, 0x0176, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x41F0..0x41FF -- */
+    0x0177, 0x0176, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x4200..0x420F -- */
+    0x0176, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x4210..0x421F -- */
+    0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0176, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C,
+/* DATA_BLOCK: -- 0x4220..0x422F -- */
+    0x0132, 0x001C, 0x0132, 0x0132, 0x0132, 0x0132, 0x0132, 0x0132, 0x0132, 0x0132, 0x0132, 0x0132,
+    0x0132, 0x0132, 0x0132, 0x0132,
+/* DATA_BLOCK: -- 0x4230..0x423F -- */
+    0x001C, 0x001C, 0x001C, 0x001C, 0x001C, 0x001C, 0x001C, 0x001C, 0x001C, 0x001C, 0x001C, 0x001C,
+    0x001C, 0x001C, 0x001C, 0x001C,
+/* DATA_BLOCK: -- 0x4240..0x424F -- */
+    0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x01B4, 0x0132, 0x0132
+};
+
+static const SBUInt16 MainPropertyIndexes[3840] = {
+/* INDEX_BLOCK: -- 0x0000..0x001F -- */
+    0x0000, 0x0010, 0x0020, 0x0030, 0x0040, 0x0050, 0x0060, 0x0070, 0x0080, 0x0090, 0x00A0, 0x00B0,
+    0x00C0, 0x00D0, 0x00E0, 0x00F0, 0x0100, 0x0100, 0x0100, 0x0110, 0x0120, 0x0100, 0x0100, 0x0130,
+    0x0140, 0x0150, 0x0160, 0x0170, 0x0180, 0x0190, 0x0100, 0x01A0,
+/* INDEX_BLOCK: -- 0x0020..0x003F -- */
+    0x0100, 0x0100, 0x0100, 0x01B0, 0x01C0, 0x00E0, 0x00E0, 0x00E0, 0x00E0, 0x01D0, 0x00E0, 0x01E0,
+    0x01F0, 0x0200, 0x0210, 0x0220, 0x0230, 0x0230, 0x0230, 0x0230, 0x0230, 0x0230, 0x0230, 0x0240,
+    0x0250, 0x0260, 0x0270, 0x0280, 0x0290, 0x02A0, 0x02B0, 0x02C0,
+/* INDEX_BLOCK: -- 0x0040..0x005F -- */
+    0x02D0, 0x02D0, 0x02D0, 0x02E0, 0x02E0, 0x02E0, 0x02F0, 0x02F0, 0x0300, 0x02F0, 0x02F0, 0x02F0,
+    0x0310, 0x02F0, 0x02F0, 0x02F0, 0x02F0, 0x02F0, 0x02F0, 0x0320, 0x0330, 0x0340, 0x0350, 0x0350,
+    0x0360, 0x0370, 0x0380, 0x0390, 0x03A0, 0x03B0, 0x03C0, 0x03D0,
+/* INDEX_BLOCK: -- 0x0060..0x007F -- */
+    0x03E0, 0x03F0, 0x0400, 0x0400, 0x0410, 0x0420, 0x0430, 0x0440, 0x0400, 0x0400, 0x0400, 0x0400,
+    0x0400, 0x0450, 0x0460, 0x0470, 0x0480, 0x0490, 0x04A0, 0x04B0, 0x04C0, 0x0400, 0x0400, 0x0400,
+    0x04D0, 0x04D0, 0x04E0, 0x04F0, 0x0500, 0x0510, 0x0520, 0x0530,
+/* INDEX_BLOCK: -- 0x0080..0x009F -- */
+    0x0540, 0x0550, 0x0560, 0x0570, 0x0580, 0x0590, 0x05A0, 0x0400, 0x05B0, 0x05C0, 0x0400, 0x0400,
+    0x05D0, 0x05E0, 0x05F0, 0x05E0, 0x0600, 0x0610, 0x0610, 0x0620, 0x0630, 0x0640, 0x0650, 0x0660,
+    0x0670, 0x0680, 0x0690, 0x06A0, 0x06B0, 0x06C0, 0x06D0, 0x06E0,
+/* INDEX_BLOCK: -- 0x00A0..0x00BF -- */
+    0x06F0, 0x0700, 0x0710, 0x0720, 0x0730, 0x0740, 0x0750, 0x0760, 0x0770, 0x0780, 0x0790, 0x07A0,
+    0x07B0, 0x07C0, 0x07D0, 0x07E0, 0x07F0, 0x0800, 0x0810, 0x0820, 0x0830, 0x0840, 0x0850, 0x0860,
+    0x0870, 0x0880, 0x0890, 0x08A0, 0x08B0, 0x08C0, 0x08D0, 0x08E0,
+/* INDEX_BLOCK: -- 0x00C0..0x00DF -- */
+    0x08F0, 0x0900, 0x0910, 0x0920, 0x0930, 0x0940, 0x0950, 0x0960, 0x0970, 0x0980, 0x0990, 0x09A0,
+    0x09B0, 0x09C0, 0x09D0, 0x09E0, 0x09F0, 0x0A00, 0x0A10, 0x0A20, 0x0A30, 0x0A40, 0x0A50, 0x0A60,
+    0x0A70, 0x0A80, 0x0A90, 0x0AA0, 0x0AB0, 0x0AC0, 0x0AD0, 0x0AE0,
+/* INDEX_BLOCK: -- 0x00E0..0x00FF -- */
+    0x0AF0, 0x0B00, 0x0B00, 0x0B10, 0x0B20, 0x0B30, 0x0B40, 0x0B40, 0x0B50, 0x0B60, 0x0B70, 0x0B80,
+    0x0B90, 0x0BA0, 0x0B40, 0x0B40, 0x0BB0, 0x0BC0, 0x0BD0, 0x0BE0, 0x0BF0, 0x0C00, 0x0C10, 0x0C20,
+    0x0C30, 0x0C40, 0x0C50, 0x0C60, 0x0C70, 0x0C80, 0x0B40, 0x0B40,
+/* INDEX_BLOCK: -- 0x0100..0x011F -- */
+    0x0C90, 0x0C90, 0x0CA0, 0x0CB0, 0x0CC0, 0x0CD0, 0x0CE0, 0x0CF0, 0x0D00, 0x0D10, 0x0D20, 0x0D20,
+    0x0D30, 0x0D40, 0x0D40, 0x0D50, 0x0D60, 0x0D60, 0x0D60, 0x0D60, 0x0D60, 0x0D60, 0x0D60, 0x0D60,
+    0x0D60, 0x0D60, 0x0D60, 0x0D60, 0x0D60, 0x0D60, 0x0D60, 0x0D60,
+/* INDEX_BLOCK: -- 0x0120..0x013F -- */
+    0x0D70, 0x0D70, 0x0D70, 0x0D70, 0x0D80, 0x0D90, 0x0D70, 0x0D70, 0x0D80, 0x0D70, 0x0D70, 0x0DA0,
+    0x0DB0, 0x0DC0, 0x0D70, 0x0D70, 0x0D70, 0x0DB0, 0x0D70, 0x0D70, 0x0D70, 0x0DD0, 0x0DE0, 0x0DF0,
+    0x0D70, 0x0E00, 0x0E10, 0x0E10, 0x0E10, 0x0E10, 0x0E10, 0x0E20,
+/* INDEX_BLOCK: -- 0x0140..0x015F -- */
+    0x0E30, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40,
+    0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40,
+    0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40,
+/* INDEX_BLOCK: -- 0x0160..0x017F -- */
+    0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E50, 0x0E40, 0x0E60, 0x0E70, 0x0E80, 0x0E80,
+    0x0E80, 0x0E80, 0x0E90, 0x0EA0, 0x0EB0, 0x0EC0, 0x0ED0, 0x0EE0, 0x0EF0, 0x0F00, 0x0F10, 0x0F20,
+    0x0F30, 0x0F30, 0x0F30, 0x0F40, 0x0F50, 0x0F60, 0x0F70, 0x0F80,
+/* INDEX_BLOCK: -- 0x0180..0x019F -- */
+    0x0F90, 0x0FA0, 0x0FB0, 0x0FB0, 0x0FC0, 0x0FB0, 0x0FB0, 0x0FD0, 0x0FE0, 0x0FB0, 0x0FF0, 0x0E40,
+    0x0E40, 0x0E40, 0x0E40, 0x1000, 0x1010, 0x1020, 0x1030, 0x1040, 0x1050, 0x1060, 0x1070, 0x1080,
+    0x1090, 0x1090, 0x10A0, 0x1090, 0x10B0, 0x10C0, 0x10D0, 0x10D0,
+/* INDEX_BLOCK: -- 0x01A0..0x01BF -- */
+    0x10E0, 0x10F0, 0x1100, 0x1100, 0x1100, 0x1110, 0x1120, 0x1130, 0x1140, 0x1140, 0x1150, 0x1160,
+    0x1170, 0x0B40, 0x0B40, 0x0B40, 0x1180, 0x1190, 0x1190, 0x11A0, 0x11B0, 0x11C0, 0x11D0, 0x11E0,
+    0x11F0, 0x1200, 0x1210, 0x1220, 0x1230, 0x1230, 0x1240, 0x1250,
+/* INDEX_BLOCK: -- 0x01C0..0x01DF -- */
+    0x1260, 0x1260, 0x1270, 0x1280, 0x1290, 0x12A0, 0x12B0, 0x12C0, 0x12D0, 0x0D20, 0x0D20, 0x12E0,
+    0x12F0, 0x1300, 0x1310, 0x1320, 0x00E0, 0x00E0, 0x1330, 0x1340, 0x1340, 0x1350, 0x1360, 0x1370,
+    0x00E0, 0x1380, 0x1340, 0x1390, 0x0230, 0x0230, 0x0230, 0x0230,
+/* INDEX_BLOCK: -- 0x01E0..0x01FF -- */
+    0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x13A0, 0x0100, 0x0100,
+    0x0100, 0x0100, 0x0100, 0x0100, 0x13B0, 0x13C0, 0x13B0, 0x13B0, 0x13C0, 0x13D0, 0x13B0, 0x13E0,
+    0x13F0, 0x13F0, 0x13F0, 0x1400, 0x1410, 0x1420, 0x1430, 0x1440,
+/* INDEX_BLOCK: -- 0x0200..0x021F -- */
+    0x1450, 0x1460, 0x1470, 0x1480, 0x1490, 0x14A0, 0x14B0, 0x14C0, 0x14D0, 0x14E0, 0x14F0, 0x14F0,
+    0x1500, 0x1510, 0x1520, 0x1530, 0x1540, 0x1550, 0x1560, 0x1570, 0x1580, 0x1590, 0x15A0, 0x15A0,
+    0x15B0, 0x15C0, 0x15D0, 0x15E0, 0x15F0, 0x1600, 0x15E0, 0x1610,
+/* INDEX_BLOCK: -- 0x0220..0x023F -- */
+    0x1620, 0x1630, 0x1640, 0x1650, 0x1660, 0x1670, 0x1680, 0x1690, 0x16A0, 0x16B0, 0x16C0, 0x16D0,
+    0x16E0, 0x16F0, 0x1700, 0x1710, 0x1720, 0x15E0, 0x1730, 0x1740, 0x1750, 0x1750, 0x1750, 0x1760,
+    0x15E0, 0x1770, 0x1780, 0x1790, 0x15E0, 0x17A0, 0x17B0, 0x15E0,
+/* INDEX_BLOCK: -- 0x0240..0x025F -- */
+    0x15E0, 0x15E0, 0x17C0, 0x0B40, 0x17D0, 0x0B40, 0x1590, 0x1590, 0x17E0, 0x17F0, 0x1750, 0x1750,
+    0x1750, 0x1750, 0x1800, 0x1590, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0,
+    0x15E0, 0x15E0, 0x15E0, 0x1810, 0x1820, 0x15E0, 0x15E0, 0x1830,
+/* INDEX_BLOCK: -- 0x0260..0x027F -- */
+    0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x1840, 0x15E0, 0x15E0, 0x15E0, 0x1850, 0x15E0,
+    0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x1860, 0x1870,
+    0x1590, 0x1880, 0x15E0, 0x15E0, 0x1890, 0x18A0, 0x18B0, 0x1780,
+/* INDEX_BLOCK: -- 0x0280..0x029F -- */
+    0x18C0, 0x18C0, 0x18C0, 0x18C0, 0x18C0, 0x18C0, 0x18C0, 0x18C0, 0x18C0, 0x18C0, 0x18C0, 0x18C0,
+    0x18C0, 0x18C0, 0x18C0, 0x18C0, 0x1780, 0x1780, 0x1780, 0x1780, 0x1780, 0x1780, 0x1780, 0x1780,
+    0x18D0, 0x18E0, 0x18F0, 0x1900, 0x1910, 0x1920, 0x1930, 0x1940,
+/* INDEX_BLOCK: -- 0x02A0..0x02BF -- */
+    0x1780, 0x1780, 0x1950, 0x1960, 0x1780, 0x1780, 0x1970, 0x1980, 0x1990, 0x1990, 0x19A0, 0x1990,
+    0x1990, 0x19B0, 0x19C0, 0x19D0, 0x15E0, 0x15E0, 0x15E0, 0x1780, 0x19E0, 0x15E0, 0x15E0, 0x19F0,
+    0x15E0, 0x1A00, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x1A10,
+/* INDEX_BLOCK: -- 0x02C0..0x02DF -- */
+    0x1A20, 0x1A20, 0x1A20, 0x1A30, 0x1A30, 0x1A30, 0x1A40, 0x1A50, 0x1A60, 0x1A60, 0x1A60, 0x1A60,
+    0x1A60, 0x1A60, 0x1A70, 0x1A80, 0x0D40, 0x0D40, 0x1A90, 0x1AA0, 0x1AA0, 0x1AA0, 0x1AB0, 0x1AC0,
+    0x0D70, 0x1AD0, 0x1AE0, 0x1AE0, 0x1AE0, 0x1AE0, 0x1AF0, 0x1AF0,
+/* INDEX_BLOCK: -- 0x02E0..0x02FF -- */
+    0x1B00, 0x1B10, 0x1B20, 0x1B30, 0x1B40, 0x1B50, 0x0B40, 0x0B40, 0x1B60, 0x1B70, 0x1B60, 0x1B60,
+    0x1B60, 0x1B60, 0x1B60, 0x1B80, 0x1B60, 0x1B60, 0x1B60, 0x1B60, 0x1B60, 0x1B60, 0x1B60, 0x1B60,
+    0x1B60, 0x1B60, 0x1B60, 0x1B60, 0x1B60, 0x1B90, 0x0B40, 0x15E0,
+/* INDEX_BLOCK: -- 0x0300..0x031F -- */
+    0x1BA0, 0x1BB0, 0x1BC0, 0x1BD0, 0x1BE0, 0x1BF0, 0x1BF0, 0x1BF0, 0x1BF0, 0x1C00, 0x1C10, 0x1C20,
+    0x1C20, 0x1C20, 0x1C20, 0x1C30, 0x1C40, 0x1C50, 0x1C50, 0x1C60, 0x0D60, 0x0D60, 0x0D60, 0x0D60,
+    0x1C70, 0x1C80, 0x1C50, 0x1C50, 0x15E0, 0x15E0, 0x1C90, 0x1C20,
+/* INDEX_BLOCK: -- 0x0320..0x033F -- */
+    0x1CA0, 0x1CB0, 0x1CC0, 0x1750, 0x1CD0, 0x1CE0, 0x1CA0, 0x1CF0, 0x1CC0, 0x1750, 0x1750, 0x1D00,
+    0x1D10, 0x1D20, 0x1D20, 0x1D30, 0x1D20, 0x1D20, 0x1D20, 0x1D20, 0x1D20, 0x1D40, 0x1750, 0x1D50,
+    0x1750, 0x1750, 0x1750, 0x1750, 0x1750, 0x1D60, 0x1750, 0x1D70,
+/* INDEX_BLOCK: -- 0x0340..0x035F -- */
+    0x1D80, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90,
+    0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90,
+    0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90,
+/* INDEX_BLOCK: -- 0x0360..0x037F -- */
+    0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90,
+    0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90,
+    0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90,
+/* INDEX_BLOCK: -- 0x0380..0x039F -- */
+    0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90,
+    0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90,
+    0x1D90, 0x1D90, 0x1D90, 0x1DA0, 0x15E0, 0x15E0, 0x15E0, 0x15E0,
+/* INDEX_BLOCK: -- 0x03A0..0x03BF -- */
+    0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90,
+    0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90,
+    0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1DA0,
+/* INDEX_BLOCK: -- 0x03C0..0x03DF -- */
+    0x1DB0, 0x1DC0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0,
+    0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0,
+    0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0,
+/* INDEX_BLOCK: -- 0x03E0..0x03FF -- */
+    0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0,
+    0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0,
+    0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0,
+/* INDEX_BLOCK: -- 0x0400..0x041F -- */
+    0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DB0, 0x1DD0, 0x1DE0, 0x1DE0, 0x1DE0,
+    0x1DF0, 0x1E00, 0x1E00, 0x1E10, 0x1E20, 0x1E20, 0x1E20, 0x1E20, 0x1E20, 0x1E20, 0x1E20, 0x1E20,
+    0x1E20, 0x1E20, 0x1E20, 0x1E20, 0x1E20, 0x1E20, 0x1E20, 0x1E20,
+/* INDEX_BLOCK: -- 0x0420..0x043F -- */
+    0x1E30, 0x1E20, 0x1E40, 0x0B40, 0x02F0, 0x02F0, 0x1E50, 0x1E60, 0x02F0, 0x1E70, 0x1E80, 0x1E80,
+    0x1E80, 0x1E80, 0x1E90, 0x1EA0, 0x0220, 0x1EB0, 0x1EC0, 0x1ED0, 0x0100, 0x0100, 0x0100, 0x1EE0,
+    0x1EF0, 0x1F00, 0x1F10, 0x1F20, 0x1F30, 0x1F40, 0x0B40, 0x1F50,
+/* INDEX_BLOCK: -- 0x0440..0x045F -- */
+    0x1F60, 0x1F70, 0x1F80, 0x1F90, 0x1FA0, 0x1FA0, 0x1FA0, 0x1FB0, 0x1FC0, 0x1FD0, 0x1FD0, 0x1FE0,
+    0x1FF0, 0x2000, 0x2010, 0x2020, 0x2030, 0x2040, 0x2050, 0x2060, 0x2070, 0x2080, 0x0D60, 0x2090,
+    0x20A0, 0x20B0, 0x20B0, 0x20C0, 0x20D0, 0x20E0, 0x20F0, 0x2100,
+/* INDEX_BLOCK: -- 0x0460..0x047F -- */
+    0x2110, 0x2110, 0x2120, 0x2130, 0x2140, 0x2150, 0x0C90, 0x2160, 0x2170, 0x2170, 0x2170, 0x2180,
+    0x2190, 0x21A0, 0x21B0, 0x21C0, 0x21D0, 0x21E0, 0x1AE0, 0x00E0, 0x00E0, 0x21F0, 0x2200, 0x2210,
+    0x2210, 0x2210, 0x2210, 0x2210, 0x2220, 0x2220, 0x2230, 0x2240,
+/* INDEX_BLOCK: -- 0x0480..0x049F -- */
+    0x2250, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260,
+    0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260,
+    0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260,
+/* INDEX_BLOCK: -- 0x04A0..0x04BF -- */
+    0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260,
+    0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260,
+    0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260,
+/* INDEX_BLOCK: -- 0x04C0..0x04DF -- */
+    0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260,
+    0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260, 0x2260,
+    0x2260, 0x2260, 0x2270, 0x0D60, 0x2280, 0x0D60, 0x0D60, 0x2290,
+/* INDEX_BLOCK: -- 0x04E0..0x04FF -- */
+    0x22A0, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+/* INDEX_BLOCK: -- 0x0500..0x051F -- */
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x22B0,
+    0x22A0, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x22B0,
+/* INDEX_BLOCK: -- 0x0520..0x053F -- */
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x22B0,
+/* INDEX_BLOCK: -- 0x0540..0x055F -- */
+    0x22C0, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+/* INDEX_BLOCK: -- 0x0560..0x057F -- */
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+/* INDEX_BLOCK: -- 0x0580..0x059F -- */
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x22D0, 0x22E0, 0x22E0, 0x22E0, 0x22E0, 0x22E0, 0x22E0, 0x22E0, 0x22E0,
+    0x22E0, 0x22E0, 0x22E0, 0x22E0, 0x22E0, 0x22E0, 0x22E0, 0x22E0,
+/* INDEX_BLOCK: -- 0x05A0..0x05BF -- */
+    0x22E0, 0x22E0, 0x22E0, 0x22E0, 0x22E0, 0x22E0, 0x22F0, 0x22E0, 0x22E0, 0x22E0, 0x22E0, 0x22E0,
+    0x22E0, 0x2300, 0x0B40, 0x0B40, 0x2310, 0x2320, 0x2330, 0x2340, 0x2350, 0x0400, 0x0400, 0x0400,
+    0x0400, 0x0400, 0x0400, 0x2360, 0x2370, 0x2380, 0x0400, 0x0400,
+/* INDEX_BLOCK: -- 0x05C0..0x05DF -- */
+    0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400,
+    0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x2390, 0x23A0, 0x0400, 0x0400, 0x0400,
+    0x0400, 0x23B0, 0x0400, 0x0400, 0x23C0, 0x23D0, 0x23D0, 0x23E0,
+/* INDEX_BLOCK: -- 0x05E0..0x05FF -- */
+    0x0230, 0x23F0, 0x2400, 0x2410, 0x2420, 0x2430, 0x2440, 0x2450, 0x0400, 0x0400, 0x0400, 0x0400,
+    0x0400, 0x0400, 0x0400, 0x2460, 0x2470, 0x0030, 0x0040, 0x0050, 0x0060, 0x2480, 0x2490, 0x24A0,
+    0x1C20, 0x24B0, 0x0D60, 0x1C70, 0x24C0, 0x24D0, 0x24E0, 0x24F0,
+/* INDEX_BLOCK: -- 0x0600..0x061F -- */
+    0x2500, 0x2510, 0x2520, 0x2530, 0x2540, 0x2540, 0x0B40, 0x0B40, 0x2510, 0x2510, 0x2510, 0x2510,
+    0x2510, 0x2510, 0x2510, 0x2550, 0x2560, 0x2570, 0x2570, 0x2580, 0x2590, 0x2590, 0x2590, 0x25A0,
+    0x25B0, 0x25C0, 0x25D0, 0x0B40, 0x0B40, 0x1750, 0x1750, 0x25E0,
+/* INDEX_BLOCK: -- 0x0620..0x063F -- */
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x25F0, 0x2600, 0x2610, 0x2610,
+    0x2610, 0x2620, 0x2630, 0x2640, 0x2650, 0x2650, 0x2660, 0x2670, 0x2680, 0x2690, 0x2690, 0x26A0,
+    0x26B0, 0x26C0, 0x26D0, 0x26D0, 0x26E0, 0x26F0, 0x0B40, 0x0B40,
+/* INDEX_BLOCK: -- 0x0640..0x065F -- */
+    0x2700, 0x2700, 0x2710, 0x2720, 0x2720, 0x2730, 0x2730, 0x2730, 0x2740, 0x2750, 0x2760, 0x2770,
+    0x2770, 0x2780, 0x2790, 0x27A0, 0x27B0, 0x27B0, 0x27C0, 0x27D0, 0x27D0, 0x27D0, 0x27E0, 0x27F0,
+    0x27F0, 0x2800, 0x2810, 0x2820, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+/* INDEX_BLOCK: -- 0x0660..0x067F -- */
+    0x2830, 0x2830, 0x2830, 0x2830, 0x2830, 0x2830, 0x2830, 0x2830, 0x2830, 0x2830, 0x2830, 0x2830,
+    0x2830, 0x2830, 0x2830, 0x2830, 0x2830, 0x2830, 0x2830, 0x2840, 0x2830, 0x2850, 0x2860, 0x0B40,
+    0x2870, 0x1340, 0x1340, 0x2880, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+/* INDEX_BLOCK: -- 0x0680..0x069F -- */
+    0x2890, 0x28A0, 0x28A0, 0x28B0, 0x28C0, 0x28D0, 0x28E0, 0x28F0, 0x2900, 0x2910, 0x2920, 0x0B40,
+    0x0B40, 0x0B40, 0x2930, 0x2940, 0x2950, 0x2960, 0x2970, 0x2980, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x2990, 0x2990, 0x29A0, 0x29B0, 0x29C0, 0x29D0, 0x29C0, 0x29C0,
+/* INDEX_BLOCK: -- 0x06A0..0x06BF -- */
+    0x29E0, 0x29F0, 0x2A00, 0x2A10, 0x2A20, 0x2A30, 0x2A40, 0x2A50, 0x2A60, 0x2A70, 0x0B40, 0x0B40,
+    0x2A80, 0x2A90, 0x2AA0, 0x2AB0, 0x2AC0, 0x2AC0, 0x2AC0, 0x2AD0, 0x2AE0, 0x2AF0, 0x2B00, 0x2B10,
+    0x2B20, 0x2B30, 0x2B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+/* INDEX_BLOCK: -- 0x06C0..0x06DF -- */
+    0x2B50, 0x2B50, 0x2B50, 0x2B50, 0x2B60, 0x0B40, 0x0B40, 0x0B40, 0x2B70, 0x2B70, 0x2B70, 0x2B80,
+    0x2B90, 0x2B90, 0x2B90, 0x2BA0, 0x2BB0, 0x2BB0, 0x2BC0, 0x2BD0, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+/* INDEX_BLOCK: -- 0x06E0..0x06FF -- */
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x2BE0, 0x2BF0, 0x2C00, 0x2C00, 0x2C10, 0x2C20,
+    0x0B40, 0x0B40, 0x0B40, 0x2C30, 0x2C40, 0x2C50, 0x2C60, 0x2C70, 0x2C80, 0x2C90, 0x0B40, 0x2CA0,
+    0x2CB0, 0x0B40, 0x0B40, 0x2CC0, 0x2CD0, 0x0B40, 0x2CE0, 0x2CF0,
+/* INDEX_BLOCK: -- 0x0700..0x071F -- */
+    0x2D00, 0x2D10, 0x2D10, 0x2D20, 0x2D30, 0x2D40, 0x2D50, 0x2D60, 0x2D70, 0x2D80, 0x2D80, 0x2D90,
+    0x2DA0, 0x2DB0, 0x2DC0, 0x2DD0, 0x2DE0, 0x2DF0, 0x2E00, 0x2E10, 0x2E20, 0x2E30, 0x2E30, 0x2E40,
+    0x2E50, 0x2E60, 0x2E60, 0x2E70, 0x2E80, 0x2E90, 0x2EA0, 0x2EB0,
+/* INDEX_BLOCK: -- 0x0720..0x073F -- */
+    0x2EC0, 0x2ED0, 0x2EE0, 0x2EF0, 0x2F00, 0x0B40, 0x0B40, 0x0B40, 0x2F10, 0x2F20, 0x2F30, 0x2F40,
+    0x2F40, 0x2F50, 0x2F60, 0x2F70, 0x2F80, 0x2F90, 0x2FA0, 0x2FB0, 0x2FC0, 0x2FD0, 0x2FE0, 0x2FF0,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+/* INDEX_BLOCK: -- 0x0740..0x075F -- */
+    0x3000, 0x3000, 0x3000, 0x3010, 0x3020, 0x3030, 0x3040, 0x0B40, 0x3050, 0x3050, 0x3050, 0x3060,
+    0x3070, 0x3080, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x3090, 0x3090, 0x30A0, 0x30B0, 0x30C0, 0x30D0, 0x0B40, 0x0B40,
+/* INDEX_BLOCK: -- 0x0760..0x077F -- */
+    0x30E0, 0x30E0, 0x30E0, 0x30F0, 0x3100, 0x3110, 0x3120, 0x0B40, 0x3130, 0x3130, 0x3140, 0x3150,
+    0x3160, 0x0B40, 0x0B40, 0x0B40, 0x3170, 0x3180, 0x3190, 0x31A0, 0x31B0, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+/* INDEX_BLOCK: -- 0x0780..0x079F -- */
+    0x31C0, 0x31C0, 0x31D0, 0x31E0, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x31F0, 0x31F0,
+    0x3200, 0x3200, 0x3210, 0x3220, 0x3230, 0x3240, 0x3250, 0x3260, 0x3270, 0x3280, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x3290, 0x32A0, 0x32A0, 0x32B0, 0x32C0, 0x0B40,
+/* INDEX_BLOCK: -- 0x07A0..0x07BF -- */
+    0x32D0, 0x32E0, 0x32E0, 0x32F0, 0x3300, 0x3310, 0x3320, 0x3320, 0x3330, 0x3340, 0x3350, 0x0E40,
+    0x3360, 0x3360, 0x3360, 0x3370, 0x3380, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+/* INDEX_BLOCK: -- 0x07C0..0x07DF -- */
+    0x3390, 0x33A0, 0x33B0, 0x33C0, 0x33D0, 0x33E0, 0x33F0, 0x3400, 0x3410, 0x3420, 0x3430, 0x3440,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x3450, 0x3460, 0x3460, 0x3470, 0x3480, 0x3490, 0x34A0, 0x34B0,
+    0x34C0, 0x34D0, 0x34E0, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+/* INDEX_BLOCK: -- 0x07E0..0x07FF -- */
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x34F0, 0x3500, 0x3510, 0x3520, 0x3530, 0x3540, 0x3550, 0x3560, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x3570, 0x3580, 0x3590, 0x35A0, 0x35B0,
+/* INDEX_BLOCK: -- 0x0800..0x081F -- */
+    0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0,
+    0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0,
+    0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0,
+/* INDEX_BLOCK: -- 0x0820..0x083F -- */
+    0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0,
+    0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0,
+    0x35C0, 0x35D0, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+/* INDEX_BLOCK: -- 0x0840..0x085F -- */
+    0x35E0, 0x35E0, 0x35E0, 0x35E0, 0x35E0, 0x35E0, 0x35F0, 0x3600, 0x35C0, 0x35C0, 0x35C0, 0x35C0,
+    0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x35C0, 0x3610, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+/* INDEX_BLOCK: -- 0x0860..0x087F -- */
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x3620, 0x3620, 0x3620, 0x3620, 0x3620, 0x3620, 0x3630,
+/* INDEX_BLOCK: -- 0x0880..0x089F -- */
+    0x3640, 0x3640, 0x3640, 0x3640, 0x3640, 0x3640, 0x3640, 0x3640, 0x3640, 0x3640, 0x3640, 0x3640,
+    0x3640, 0x3640, 0x3640, 0x3640, 0x3640, 0x3640, 0x3640, 0x3640, 0x3640, 0x3640, 0x3640, 0x3640,
+    0x3640, 0x3640, 0x3640, 0x3640, 0x3640, 0x3640, 0x3640, 0x3640,
+/* INDEX_BLOCK: -- 0x08A0..0x08BF -- */
+    0x3640, 0x3640, 0x3640, 0x3650, 0x3660, 0x3670, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+/* INDEX_BLOCK: -- 0x08C0..0x08DF -- */
+    0x3680, 0x3680, 0x3680, 0x3680, 0x3680, 0x3680, 0x3680, 0x3680, 0x3680, 0x3680, 0x3680, 0x3680,
+    0x3680, 0x3680, 0x3680, 0x3680, 0x3680, 0x3680, 0x3680, 0x3680, 0x3680, 0x3680, 0x3680, 0x3680,
+    0x3680, 0x3680, 0x3680, 0x3680, 0x3680, 0x3680, 0x3680, 0x3680,
+/* INDEX_BLOCK: -- 0x08E0..0x08FF -- */
+    0x3680, 0x3680, 0x3680, 0x3680, 0x3690, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+/* INDEX_BLOCK: -- 0x0900..0x091F -- */
+    0x1E80, 0x1E80, 0x1E80, 0x1E80, 0x1E80, 0x1E80, 0x1E80, 0x1E80, 0x1E80, 0x1E80, 0x1E80, 0x1E80,
+    0x1E80, 0x1E80, 0x1E80, 0x1E80, 0x1E80, 0x1E80, 0x1E80, 0x1E80, 0x1E80, 0x1E80, 0x1E80, 0x1E80,
+    0x1E80, 0x1E80, 0x1E80, 0x1E80, 0x1E80, 0x1E80, 0x1E80, 0x1E80,
+/* INDEX_BLOCK: -- 0x0920..0x093F -- */
+    0x1E80, 0x1E80, 0x1E80, 0x36A0, 0x36B0, 0x36C0, 0x36D0, 0x36E0, 0x36E0, 0x36E0, 0x36E0, 0x36F0,
+    0x3700, 0x3710, 0x3720, 0x3730, 0x3740, 0x3740, 0x3740, 0x3750, 0x3760, 0x3770, 0x3780, 0x3790,
+    0x3740, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+/* INDEX_BLOCK: -- 0x0940..0x095F -- */
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x37A0, 0x37A0, 0x37B0, 0x37B0, 0x37C0, 0x37D0, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x37E0, 0x37E0, 0x37E0, 0x37E0, 0x37F0, 0x3800, 0x3810, 0x3810,
+    0x3820, 0x3830, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x3840, 0x3850,
+/* INDEX_BLOCK: -- 0x0960..0x097F -- */
+    0x3860, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870,
+    0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870,
+    0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870,
+/* INDEX_BLOCK: -- 0x0980..0x099F -- */
+    0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870,
+    0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870,
+    0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870,
+/* INDEX_BLOCK: -- 0x09A0..0x09BF -- */
+    0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870,
+    0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870,
+    0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3880,
+/* INDEX_BLOCK: -- 0x09C0..0x09DF -- */
+    0x3890, 0x3890, 0x3890, 0x3890, 0x3890, 0x3890, 0x3890, 0x3890, 0x3890, 0x3890, 0x3890, 0x3890,
+    0x3890, 0x3890, 0x3890, 0x3890, 0x3890, 0x3890, 0x3890, 0x3890, 0x3890, 0x3890, 0x3890, 0x3890,
+    0x3890, 0x3890, 0x3890, 0x3890, 0x3890, 0x3890, 0x3890, 0x3890,
+/* INDEX_BLOCK: -- 0x09E0..0x09FF -- */
+    0x3890, 0x3890, 0x3890, 0x3890, 0x3890, 0x3890, 0x3890, 0x3890, 0x3890, 0x3890, 0x3890, 0x3890,
+    0x3890, 0x3890, 0x3890, 0x3890, 0x38A0, 0x38A0, 0x38A0, 0x38A0, 0x38A0, 0x38A0, 0x38A0, 0x38A0,
+    0x38A0, 0x38A0, 0x38A0, 0x38A0, 0x38A0, 0x38A0, 0x38A0, 0x38A0,
+/* INDEX_BLOCK: -- 0x0A00..0x0A1F -- */
+    0x38A0, 0x38A0, 0x38A0, 0x38A0, 0x38A0, 0x38A0, 0x38A0, 0x38A0, 0x38A0, 0x38A0, 0x38A0, 0x38A0,
+    0x38A0, 0x38B0, 0x0B40, 0x0B40, 0x38C0, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+/* INDEX_BLOCK: -- 0x0A20..0x0A3F -- */
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x38D0,
+/* INDEX_BLOCK: -- 0x0A40..0x0A5F -- */
+    0x38E0, 0x1BF0, 0x1BF0, 0x1BF0, 0x1BF0, 0x1BF0, 0x1BF0, 0x1BF0, 0x1BF0, 0x1BF0, 0x1BF0, 0x1BF0,
+    0x1BF0, 0x1BF0, 0x1BF0, 0x1BF0, 0x1BF0, 0x1BF0, 0x38F0, 0x3900, 0x0B40, 0x3910, 0x3920, 0x3930,
+    0x3930, 0x3930, 0x3930, 0x3930, 0x3930, 0x3930, 0x3930, 0x3930,
+/* INDEX_BLOCK: -- 0x0A60..0x0A7F -- */
+    0x3930, 0x3930, 0x3930, 0x3930, 0x3930, 0x3930, 0x3930, 0x3930, 0x3930, 0x3930, 0x3930, 0x3930,
+    0x3930, 0x3930, 0x3930, 0x3940, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+/* INDEX_BLOCK: -- 0x0A80..0x0A9F -- */
+    0x3950, 0x3950, 0x3950, 0x3950, 0x3950, 0x3950, 0x3960, 0x3970, 0x3980, 0x3990, 0x39A0, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+/* INDEX_BLOCK: -- 0x0AA0..0x0ABF -- */
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0230, 0x0230, 0x39B0, 0x0230, 0x39C0, 0x1750, 0x1750, 0x1750,
+    0x1750, 0x1750, 0x1750, 0x1750, 0x39D0, 0x0B40, 0x0B40, 0x0B40,
+/* INDEX_BLOCK: -- 0x0AC0..0x0ADF -- */
+    0x1750, 0x1750, 0x1750, 0x1750, 0x1750, 0x1750, 0x1750, 0x1750, 0x1750, 0x1750, 0x1750, 0x1750,
+    0x1750, 0x1750, 0x1750, 0x39E0, 0x1750, 0x1750, 0x39F0, 0x1750, 0x1750, 0x1750, 0x3A00, 0x3A10,
+    0x3A20, 0x1750, 0x3A30, 0x1750, 0x1750, 0x1750, 0x3A40, 0x0B40,
+/* INDEX_BLOCK: -- 0x0AE0..0x0AFF -- */
+    0x3A50, 0x3A50, 0x3A50, 0x3A50, 0x3A60, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x2570, 0x3A70, 0x2570, 0x3A70, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x17C0, 0x2570, 0x3A80,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+/* INDEX_BLOCK: -- 0x0B00..0x0B1F -- */
+    0x3A90, 0x3AA0, 0x3AB0, 0x3AC0, 0x3AD0, 0x3AE0, 0x3AF0, 0x3A90, 0x3B00, 0x3B10, 0x3B20, 0x3B30,
+    0x3B40, 0x3A90, 0x3AA0, 0x3AB0, 0x3B50, 0x3B60, 0x3AB0, 0x3B70, 0x3B80, 0x3B90, 0x3BA0, 0x3A90,
+    0x3BB0, 0x3AB0, 0x3A90, 0x3AA0, 0x3AB0, 0x3AC0, 0x3AD0, 0x3AB0,
+/* INDEX_BLOCK: -- 0x0B20..0x0B3F -- */
+    0x3AF0, 0x3A90, 0x3B00, 0x3BA0, 0x3A90, 0x3BB0, 0x3AB0, 0x3A90, 0x3AA0, 0x3AB0, 0x3BC0, 0x3A90,
+    0x3BD0, 0x3BE0, 0x3BF0, 0x3C00, 0x3AB0, 0x3C10, 0x3A90, 0x3C20, 0x3C30, 0x3C40, 0x3C50, 0x3AB0,
+    0x3C60, 0x3A90, 0x3C70, 0x3AB0, 0x3C80, 0x3C90, 0x3C90, 0x3C90,
+/* INDEX_BLOCK: -- 0x0B40..0x0B5F -- */
+    0x3CA0, 0x3CA0, 0x3CA0, 0x3CA0, 0x3CA0, 0x3CA0, 0x3CA0, 0x3CA0, 0x3CA0, 0x3CA0, 0x3CA0, 0x3CA0,
+    0x3CA0, 0x3CA0, 0x3CA0, 0x3CA0, 0x3CA0, 0x3CA0, 0x3CA0, 0x3CA0, 0x3CA0, 0x3CA0, 0x3CA0, 0x3CA0,
+    0x3CA0, 0x3CA0, 0x3CA0, 0x3CA0, 0x3CA0, 0x3CA0, 0x3CA0, 0x3CA0,
+/* INDEX_BLOCK: -- 0x0B60..0x0B7F -- */
+    0x3CB0, 0x3CB0, 0x3CB0, 0x3CC0, 0x3CB0, 0x3CB0, 0x3CD0, 0x3CE0, 0x3CF0, 0x3D00, 0x3D10, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+/* INDEX_BLOCK: -- 0x0B80..0x0B9F -- */
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x3D20, 0x3D30, 0x3D40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+/* INDEX_BLOCK: -- 0x0BA0..0x0BBF -- */
+    0x3D50, 0x3D60, 0x3D70, 0x3D80, 0x3D80, 0x3D80, 0x3D90, 0x0B40, 0x3DA0, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x3DB0, 0x3DB0, 0x3DC0, 0x3DD0, 0x3DE0, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+/* INDEX_BLOCK: -- 0x0BC0..0x0BDF -- */
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x3DF0, 0x3E00, 0x0B40,
+    0x3E10, 0x3E10, 0x3E20, 0x3E30, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+/* INDEX_BLOCK: -- 0x0BE0..0x0BFF -- */
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x3E40, 0x3E50, 0x3E60, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+/* INDEX_BLOCK: -- 0x0C00..0x0C1F -- */
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x3E70, 0x3E80,
+/* INDEX_BLOCK: -- 0x0C20..0x0C3F -- */
+    0x3E90, 0x3E90, 0x3E90, 0x3E90, 0x3E90, 0x3E90, 0x3E90, 0x3E90, 0x3E90, 0x3E90, 0x3E90, 0x3E90,
+    0x3EA0, 0x3EB0, 0x0B40, 0x0B40, 0x3EC0, 0x3EC0, 0x3ED0, 0x3EE0, 0x3EF0, 0x3F00, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+/* INDEX_BLOCK: -- 0x0C40..0x0C5F -- */
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x3F10, 0x3F20, 0x3F20, 0x3F30, 0x3F40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x3F10, 0x3F20, 0x3F50, 0x3F60, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+/* INDEX_BLOCK: -- 0x0C60..0x0C7F -- */
+    0x3F70, 0x0400, 0x3F80, 0x3F90, 0x3FA0, 0x3FB0, 0x3FC0, 0x3FD0, 0x3FE0, 0x3FF0, 0x4000, 0x3FF0,
+    0x0B40, 0x0B40, 0x0B40, 0x4010, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+/* INDEX_BLOCK: -- 0x0C80..0x0C9F -- */
+    0x15E0, 0x15E0, 0x4020, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x4030, 0x4040, 0x4050,
+    0x4050, 0x4050, 0x15E0, 0x4060, 0x4070, 0x1750, 0x1D70, 0x1750, 0x1750, 0x1750, 0x4080, 0x1750,
+    0x1750, 0x1750, 0x4090, 0x0B40, 0x0B40, 0x0B40, 0x40A0, 0x1750,
+/* INDEX_BLOCK: -- 0x0CA0..0x0CBF -- */
+    0x40B0, 0x1750, 0x1750, 0x40C0, 0x40D0, 0x40E0, 0x4060, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0,
+    0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x40F0,
+/* INDEX_BLOCK: -- 0x0CC0..0x0CDF -- */
+    0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0,
+    0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0,
+    0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0,
+/* INDEX_BLOCK: -- 0x0CE0..0x0CFF -- */
+    0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0,
+    0x15E0, 0x4100, 0x25C0, 0x25C0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x4110,
+    0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x4120, 0x4020, 0x4130,
+/* INDEX_BLOCK: -- 0x0D00..0x0D1F -- */
+    0x4020, 0x15E0, 0x15E0, 0x15E0, 0x4140, 0x4120, 0x15E0, 0x15E0, 0x4140, 0x15E0, 0x4150, 0x4160,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0,
+    0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0,
+/* INDEX_BLOCK: -- 0x0D20..0x0D3F -- */
+    0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x4030, 0x4150, 0x25C0, 0x4170, 0x15E0, 0x15E0, 0x4180,
+    0x4190, 0x4020, 0x4170, 0x4170, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0, 0x15E0,
+    0x15E0, 0x41A0, 0x15E0, 0x15E0, 0x17D0, 0x0B40, 0x0B40, 0x41B0,
+/* INDEX_BLOCK: -- 0x0D40..0x0D5F -- */
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x41C0,
+/* INDEX_BLOCK: -- 0x0D60..0x0D7F -- */
+    0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90,
+    0x1D90, 0x1DA0, 0x0B40, 0x0B40, 0x1D80, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90,
+    0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90,
+/* INDEX_BLOCK: -- 0x0D80..0x0D9F -- */
+    0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90,
+    0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x41D0, 0x1D80, 0x1D90, 0x1D90, 0x1D90,
+    0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90,
+/* INDEX_BLOCK: -- 0x0DA0..0x0DBF -- */
+    0x1D90, 0x41E0, 0x1D80, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90,
+    0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90,
+    0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90,
+/* INDEX_BLOCK: -- 0x0DC0..0x0DDF -- */
+    0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x41F0, 0x1D80,
+    0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90,
+    0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90,
+/* INDEX_BLOCK: -- 0x0DE0..0x0DFF -- */
+    0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90,
+    0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90,
+    0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x4200, 0x1D80,
+/* INDEX_BLOCK: -- 0x0E00..0x0E1F -- */
+    0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x41E0, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+/* INDEX_BLOCK: -- 0x0E20..0x0E3F -- */
+    0x22E0, 0x22E0, 0x22E0, 0x22E0, 0x22E0, 0x22E0, 0x22E0, 0x22E0, 0x22E0, 0x22E0, 0x22E0, 0x22E0,
+    0x22E0, 0x22E0, 0x22E0, 0x22E0, 0x22E0, 0x22E0, 0x22E0, 0x22E0, 0x22E0, 0x22E0, 0x22E0, 0x22E0,
+    0x22E0, 0x22E0, 0x22E0, 0x22E0, 0x22E0, 0x22E0, 0x22E0, 0x22E0,
+/* INDEX_BLOCK: -- 0x0E40..0x0E5F -- */
+    0x22E0, 0x22F0, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+/* INDEX_BLOCK: -- 0x0E60..0x0E7F -- */
+    0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90,
+    0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x4210, 0x1D80, 0x1D90, 0x1D90,
+    0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90,
+/* INDEX_BLOCK: -- 0x0E80..0x0E9F -- */
+    0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90,
+    0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90, 0x1D90,
+    0x1D90, 0x1D90, 0x1DA0, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+/* INDEX_BLOCK: -- 0x0EA0..0x0EBF -- */
+    0x4220, 0x23D0, 0x4230, 0x4230, 0x4230, 0x4230, 0x4230, 0x4230, 0x23D0, 0x23D0, 0x23D0, 0x23D0,
+    0x23D0, 0x23D0, 0x23D0, 0x23D0, 0x0230, 0x0230, 0x0230, 0x0230, 0x0230, 0x0230, 0x0230, 0x0230,
+    0x0230, 0x0230, 0x0230, 0x0230, 0x0230, 0x0230, 0x0230, 0x23D0,
+/* INDEX_BLOCK: -- 0x0EC0..0x0EDF -- */
+    0x23D0, 0x23D0, 0x23D0, 0x23D0, 0x23D0, 0x23D0, 0x23D0, 0x23D0, 0x23D0, 0x23D0, 0x23D0, 0x23D0,
+    0x23D0, 0x23D0, 0x23D0, 0x23D0, 0x23D0, 0x23D0, 0x23D0, 0x23D0, 0x23D0, 0x23D0, 0x23D0, 0x23D0,
+    0x23D0, 0x23D0, 0x23D0, 0x23D0, 0x23D0, 0x23D0, 0x23D0, 0x23D0,
+/* INDEX_BLOCK: -- 0x0EE0..0x0EFF -- */
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+    0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x4240
+};
+
+static const SBUInt16 BranchPropertyIndexes[2176] = {
+    0x0000, 0x0020, 0x0040, 0x0060, 0x0080, 0x00A0, 0x00C0, 0x00E0, 0x0100, 0x0120, 0x0140, 0x0160,
+    0x0180, 0x01A0, 0x01C0, 0x01E0, 0x0200, 0x0220, 0x0240, 0x0260, 0x0280, 0x02A0, 0x02C0, 0x02E0,
+    0x0300, 0x0320, 0x0340, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360,
+    0x0360, 0x0360, 0x0380, 0x0340, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360,
+    0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360,
+    0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360,
+    0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x03A0, 0x03C0, 0x03E0, 0x0400, 0x0420,
+    0x0440, 0x0460, 0x0480, 0x04A0, 0x04A0, 0x04A0, 0x04A0, 0x04A0, 0x04A0, 0x04A0, 0x04A0, 0x04A0,
+    0x04A0, 0x04A0, 0x04A0, 0x04A0, 0x04A0, 0x04A0, 0x04A0, 0x04A0, 0x04A0, 0x04A0, 0x04A0, 0x04C0,
+    0x04E0, 0x0500, 0x04E0, 0x0520, 0x0540, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0580, 0x05A0, 0x05C0, 0x05E0, 0x0600, 0x0620, 0x0640, 0x0660,
+    0x0680, 0x06A0, 0x06C0, 0x06E0, 0x0700, 0x0720, 0x0740, 0x0760, 0x0780, 0x07A0, 0x07C0, 0x07E0,
+    0x0800, 0x0820, 0x0840, 0x0560, 0x0560, 0x0560, 0x0560, 0x0860, 0x0880, 0x0880, 0x08A0, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x08C0, 0x08E0, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0900, 0x0920, 0x0560, 0x0940, 0x0960, 0x0980, 0x0980, 0x0980, 0x0980, 0x0980, 0x0980, 0x0980,
+    0x0980, 0x0980, 0x0980, 0x09A0, 0x09C0, 0x09E0, 0x0A00, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0A20,
+    0x0A40, 0x0A60, 0x0560, 0x0560, 0x0560, 0x0560, 0x0A80, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0AA0, 0x0AC0, 0x0AE0, 0x0B00, 0x0B20, 0x0B40, 0x0B60, 0x0560, 0x0B80,
+    0x0BA0, 0x0BC0, 0x0BE0, 0x0C00, 0x0C20, 0x0560, 0x0C40, 0x0C60, 0x0C80, 0x0CA0, 0x0CC0, 0x0CE0,
+    0x0D00, 0x0D20, 0x0560, 0x0D40, 0x0340, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360,
+    0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360,
+    0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360,
+    0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360,
+    0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360,
+    0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360,
+    0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360,
+    0x0360, 0x0360, 0x0360, 0x0D60, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0D80,
+    0x0DA0, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0DC0,
+    0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360,
+    0x0360, 0x0DE0, 0x0360, 0x0E00, 0x0560, 0x0560, 0x0560, 0x0560, 0x0E20, 0x0E40, 0x0560, 0x0D40,
+    0x0340, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0E60, 0x0360, 0x0360,
+    0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0E80, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0D40, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0D40, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0D40,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0D40, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0D40, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0D40,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0D40, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0D40, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0D40,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0D40, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0D40, 0x0EA0, 0x0EC0, 0x0EC0, 0x0EC0, 0x0EC0, 0x0EC0, 0x0EC0, 0x0EC0,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0D40,
+    0x0540, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0EE0, 0x0540, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560, 0x0560,
+    0x0560, 0x0560, 0x0560, 0x0EE0
+};
+
+SB_INTERNAL const PropertyRecord *LookupProperties(SBCodepoint codepoint)
+{
+    if (codepoint <= 0x10FFFF) {
+        return &PropertyRecords[
+                 PrimaryPropertyData[
+                  MainPropertyIndexes[
+                   BranchPropertyIndexes[
+                        codepoint / 0x0200
+                   ] + (codepoint % 0x0200) / 0x0010
+                  ] + codepoint % 0x0010
+                 ]
+                ];
+    }
+
+    return &PropertyRecords[0];
+}
+
+SB_INTERNAL SBCodepoint PropertyRecordGetMirror(const PropertyRecord *record, SBCodepoint codepoint)
+{
+    SBInt16 diff = PropertyPairDifferences[
+                    record->pairing & BracketTypeInverseMask
+                   ];
+
+    if (diff != 0) {
+        return (codepoint + diff);
+    }
+
+    return 0;
+}
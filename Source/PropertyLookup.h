@@ -0,0 +1,29 @@
+/*
+ * Automatically generated by SheenBidiGenerator tool.
+ * DO NOT EDIT!!
+ */
+
+#ifndef _SB_INTERNAL_PROPERTY_LOOKUP_H
+#define _SB_INTERNAL_PROPERTY_LOOKUP_H
+
+#include <SBConfig.h>
+
+#include "BracketType.h"
+#include "SBBase.h"
+
+typedef struct _PropertyRecord {
+    SBUInt8 bidiType;          /**< Bidirectional type of the code point. */
+    SBUInt8 generalCategory;   /**< General category of the code point. */
+    SBUInt8 script;            /**< Script of the code point. */
+    SBUInt8 pairing;           /**< Bracket type and mirror difference index. */
+} PropertyRecord;
+
+#define PropertyRecordGetBracketType(record)   \
+(                                              \
+    (record)->pairing & BracketTypePrimaryMask \
+)
+
+SB_INTERNAL const PropertyRecord *LookupProperties(SBCodepoint codepoint);
+SB_INTERNAL SBCodepoint PropertyRecordGetMirror(const PropertyRecord *record, SBCodepoint codepoint);
+
+#endif
@@ -17,6 +17,7 @@
 #include <SBConfig.h>
 #include <stddef.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "BidiTypeLookup.h"
 #include "SBBase.h"
@@ -25,17 +26,19 @@
 #include "SBParagraph.h"
 #include "SBAlgorithm.h"
 
-static SBAlgorithmRef AllocateAlgorithm(SBUInteger stringLength)
+static SBAlgorithmRef AllocateAlgorithm(SBUInteger stringLength, SBUInteger rangeSize, void **rangeMemory)
 {
     const SBUInteger sizeAlgorithm = sizeof(SBAlgorithm);
+    const SBUInteger sizeRange     = rangeSize;
     const SBUInteger sizeTypes     = sizeof(SBBidiType) * stringLength;
-    const SBUInteger sizeMemory    = sizeAlgorithm + sizeTypes;
+    const SBUInteger sizeMemory    = sizeAlgorithm + sizeRange + sizeTypes;
 
     void *pointer = malloc(sizeMemory);
 
     if (pointer) {
         const SBUInteger offsetAlgorithm = 0;
-        const SBUInteger offsetTypes     = offsetAlgorithm + sizeAlgorithm;
+        const SBUInteger offsetRange     = offsetAlgorithm + sizeAlgorithm;
+        const SBUInteger offsetTypes     = offsetRange + sizeRange;
 
         SBUInt8 *memory = (SBUInt8 *)pointer;
         SBAlgorithmRef algorithm = (SBAlgorithmRef)(memory + offsetAlgorithm);
@@ -43,6 +46,10 @@ static SBAlgorithmRef AllocateAlgorithm(SBUInteger stringLength)
 
         algorithm->fixedTypes = fixedTypes;
 
+        if (rangeMemory) {
+            *rangeMemory = memory + offsetRange;
+        }
+
         return algorithm;
     }
 
@@ -56,21 +63,61 @@ static void DisposeAlgorithm(SBAlgorithmRef algorithm)
 
 static void DetermineBidiTypes(const SBCodepointSequence *sequence, SBBidiType *types)
 {
+    SBCodepoint codepoints[SBCodepointSequenceBlockSize];
     SBUInteger stringIndex = 0;
     SBUInteger firstIndex = 0;
     SBCodepoint codepoint;
 
-    while ((codepoint = SBCodepointSequenceGetCodepointAt(sequence, &stringIndex)) != SBCodepointInvalid) {
-        types[firstIndex] = LookupBidiType(codepoint);
+    while (stringIndex < sequence->stringLength) {
+        SBUInteger blockLength = SBCodepointSequenceDecodeBlock(sequence, stringIndex, codepoints);
+        SBUInteger blockLimit;
+
+        if (blockLength) {
+            SBUInteger index;
+
+            /*
+             * The block is valid and lies in BMP, so look up its code points directly. Only the
+             * code units having no code point get 'BN' type.
+             */
+            for (index = 0; index < blockLength; index++) {
+                codepoint = codepoints[index];
+                types[stringIndex + index] = (codepoint != SBCodepointInvalid
+                                              ? LookupBidiTypeBMP((SBUInt16)codepoint) : SBBidiTypeBN);
+            }
 
-        /* Subsequent code units get 'BN' type. */
-        while (++firstIndex < stringIndex) {
-            types[firstIndex] = SBBidiTypeBN;
+            stringIndex += blockLength;
+            continue;
         }
+
+        blockLimit = stringIndex + SBCodepointSequenceBlockSize;
+
+        /* Decode the rest of the block one code point at a time before trying the next one. */
+        do {
+            firstIndex = stringIndex;
+            codepoint = SBCodepointSequenceGetCodepointAt(sequence, &stringIndex);
+            types[firstIndex] = LookupBidiType(codepoint);
+
+            /* Subsequent code units get 'BN' type. */
+            while (++firstIndex < stringIndex) {
+                types[firstIndex] = SBBidiTypeBN;
+            }
+        } while (stringIndex < blockLimit && stringIndex < sequence->stringLength);
     }
 }
 
-static SBAlgorithmRef CreateAlgorithm(const SBCodepointSequence *codepointSequence)
+SB_INTERNAL void SBAlgorithmInitialize(SBAlgorithmRef algorithm,
+    const SBCodepointSequence *codepointSequence, SBBidiType *types)
+{
+    algorithm->codepointSequence = *codepointSequence;
+    algorithm->fixedTypes = types;
+    algorithm->hasProvidedTypes = SBFalse;
+    algorithm->retainCount = 1;
+
+    DetermineBidiTypes(codepointSequence, types);
+}
+
+static SBAlgorithmRef CreateAlgorithm(const SBCodepointSequence *codepointSequence,
+    const SBBidiType *bidiTypes)
 {
     SBUInteger stringLength = codepointSequence->stringLength;
     SBAlgorithmRef algorithm;
@@ -79,13 +126,19 @@ static SBAlgorithmRef CreateAlgorithm(const SBCodepointSequence *codepointSequen
     SB_LOG_STATEMENT("Codepoints", 1, SB_LOG_CODEPOINT_SEQUENCE(codepointSequence));
     SB_LOG_BLOCK_CLOSER();
 
-    algorithm = AllocateAlgorithm(stringLength);
+    algorithm = AllocateAlgorithm(stringLength, 0, NULL);
 
     if (algorithm) {
-        algorithm->codepointSequence = *codepointSequence;
-        algorithm->retainCount = 1;
-
-        DetermineBidiTypes(codepointSequence, algorithm->fixedTypes);
+        if (bidiTypes) {
+            algorithm->codepointSequence = *codepointSequence;
+            algorithm->hasProvidedTypes = SBTrue;
+            algorithm->retainCount = 1;
+
+            /* The types are already known, so skip decoding the whole string. */
+            memcpy(algorithm->fixedTypes, bidiTypes, sizeof(SBBidiType) * stringLength);
+        } else {
+            SBAlgorithmInitialize(algorithm, codepointSequence, algorithm->fixedTypes);
+        }
 
         SB_LOG_BLOCK_OPENER("Determined Types");
         SB_LOG_STATEMENT("Types",  1, SB_LOG_BIDI_TYPES_ARRAY(algorithm->fixedTypes, stringLength));
@@ -100,17 +153,187 @@ static SBAlgorithmRef CreateAlgorithm(const SBCodepointSequence *codepointSequen
 SBAlgorithmRef SBAlgorithmCreate(const SBCodepointSequence *codepointSequence)
 {
     if (SBCodepointSequenceIsValid(codepointSequence)) {
-        return CreateAlgorithm(codepointSequence);
+        return CreateAlgorithm(codepointSequence, NULL);
+    }
+
+    return NULL;
+}
+
+SBAlgorithmRef SBAlgorithmCreateWithTypes(const SBCodepointSequence *codepointSequence,
+    const SBBidiType *bidiTypes)
+{
+    if (bidiTypes && SBCodepointSequenceIsValid(codepointSequence)) {
+        return CreateAlgorithm(codepointSequence, bidiTypes);
     }
 
     return NULL;
 }
 
+/*
+ * Determines the types of code points while decoding the string only once, keeping the offset of
+ * every SBCodepointIndexInterval-th code point along with the end of the string if needed.
+ */
+static SBUInteger DetermineIndexedTypes(const SBCodepointSequence *sequence,
+    SBBidiType *types, SBUInteger *unitOffsets)
+{
+    SBCodepoint codepoints[SBCodepointSequenceBlockSize];
+    SBUInteger stringIndex = 0;
+    SBUInteger count = 0;
+
+    while (stringIndex < sequence->stringLength) {
+        SBUInteger blockLength = SBCodepointSequenceDecodeBlock(sequence, stringIndex, codepoints);
+        SBUInteger blockLimit;
+
+        if (blockLength) {
+            SBUInteger index;
+
+            /* Only the code units having a code point get a type. */
+            for (index = 0; index < blockLength; index++) {
+                SBCodepoint codepoint = codepoints[index];
+
+                if (codepoint != SBCodepointInvalid) {
+                    if ((count % SBCodepointIndexInterval) == 0) {
+                        unitOffsets[count / SBCodepointIndexInterval] = stringIndex + index;
+                    }
+
+                    types[count++] = LookupBidiTypeBMP((SBUInt16)codepoint);
+                }
+            }
+
+            stringIndex += blockLength;
+            continue;
+        }
+
+        blockLimit = stringIndex + SBCodepointSequenceBlockSize;
+
+        /* Decode the rest of the block one code point at a time before trying the next one. */
+        do {
+            if ((count % SBCodepointIndexInterval) == 0) {
+                unitOffsets[count / SBCodepointIndexInterval] = stringIndex;
+            }
+
+            types[count++] = LookupBidiType(SBCodepointSequenceGetCodepointAt(sequence, &stringIndex));
+        } while (stringIndex < blockLimit && stringIndex < sequence->stringLength);
+    }
+
+    if ((count % SBCodepointIndexInterval) == 0) {
+        unitOffsets[count / SBCodepointIndexInterval] = stringIndex;
+    }
+
+    return count;
+}
+
+static SBAlgorithmRef CreateIndexedAlgorithm(const SBCodepointSequence *codepointSequence)
+{
+    SBUInteger stringLength = codepointSequence->stringLength;
+    SBUInteger sizeOffsets = sizeof(SBUInteger) * ((stringLength / SBCodepointIndexInterval) + 1);
+    SBAlgorithmRef algorithm;
+    void *memory;
+
+    /* There cannot be more code points than code units, so reserve the memory for the latter. */
+    algorithm = AllocateAlgorithm(stringLength, sizeOffsets, &memory);
+
+    if (algorithm) {
+        SBUInteger *unitOffsets = (SBUInteger *)memory;
+        SBUInteger codepointCount = DetermineIndexedTypes(codepointSequence, algorithm->fixedTypes, unitOffsets);
+
+        if (codepointCount < stringLength) {
+            SBUInteger sizeUsed = sizeof(SBUInteger) * ((codepointCount / SBCodepointIndexInterval) + 1);
+            SBUInteger offsetOffsets = (SBUInt8 *)unitOffsets - (SBUInt8 *)algorithm;
+            SBAlgorithmRef shrunk;
+
+            /* Move the types right after the used offsets and give back the rest of the memory. */
+            memmove((SBUInt8 *)unitOffsets + sizeUsed, algorithm->fixedTypes,
+                    sizeof(SBBidiType) * codepointCount);
+
+            shrunk = realloc(algorithm, offsetOffsets + sizeUsed + (sizeof(SBBidiType) * codepointCount));
+            if (shrunk) {
+                algorithm = shrunk;
+            }
+
+            unitOffsets = (SBUInteger *)((SBUInt8 *)algorithm + offsetOffsets);
+            algorithm->fixedTypes = (SBBidiType *)((SBUInt8 *)unitOffsets + sizeUsed);
+        }
+
+        algorithm->codepointIndex.source = *codepointSequence;
+        algorithm->codepointIndex.unitOffsets = unitOffsets;
+
+        /* Present the source string to the rest of the algorithm as UTF-32 code points. */
+        algorithm->codepointSequence.stringEncoding = SBStringEncodingUTF32 | SBStringEncodingIndexed;
+        algorithm->codepointSequence.stringBuffer = &algorithm->codepointIndex;
+        algorithm->codepointSequence.stringLength = codepointCount;
+        algorithm->hasProvidedTypes = SBFalse;
+        algorithm->retainCount = 1;
+    }
+
+    return algorithm;
+}
+
+SBAlgorithmRef SBAlgorithmCreateCodepointIndexed(const SBCodepointSequence *codepointSequence)
+{
+    if (SBCodepointSequenceIsValid(codepointSequence)) {
+        return CreateIndexedAlgorithm(codepointSequence);
+    }
+
+    return NULL;
+}
+
+SB_INTERNAL SBAlgorithmRef SBAlgorithmCreateWithRange(const SBCodepointSequence *codepointSequence,
+    SBUInteger stringOffset, SBUInteger stringLength)
+{
+    SBUInteger rangeSize = SBCodepointSequenceGetRangeSize(codepointSequence);
+    SBAlgorithmRef algorithm;
+    void *rangeMemory;
+
+    /* Keep the description of the range along with the algorithm, so that it lives as long. */
+    algorithm = AllocateAlgorithm(stringLength, rangeSize, &rangeMemory);
+
+    if (algorithm) {
+        SBCodepointSequence range;
+
+        SBCodepointSequenceMakeRange(codepointSequence, stringOffset, stringLength, rangeMemory, &range);
+        SBAlgorithmInitialize(algorithm, &range, algorithm->fixedTypes);
+    }
+
+    return algorithm;
+}
+
 const SBBidiType *SBAlgorithmGetBidiTypesPtr(SBAlgorithmRef algorithm)
 {
     return algorithm->fixedTypes;
 }
 
+SBUInteger SBAlgorithmGetCodeUnitOffset(SBAlgorithmRef algorithm, SBUInteger stringIndex)
+{
+    if (!SBCodepointSequenceIsIndexed(&algorithm->codepointSequence)) {
+        return stringIndex;
+    }
+
+    if (stringIndex > algorithm->codepointSequence.stringLength) {
+        return SBInvalidIndex;
+    }
+
+    return SBCodepointIndexGetUnitOffset(&algorithm->codepointIndex, stringIndex);
+}
+
+void SBAlgorithmConvertRuns(SBAlgorithmRef algorithm, SBRun *runs, SBUInteger runCount)
+{
+    SBUInteger index;
+
+    if (!SBCodepointSequenceIsIndexed(&algorithm->codepointSequence)) {
+        return;
+    }
+
+    for (index = 0; index < runCount; index++) {
+        SBRun *run = &runs[index];
+        SBUInteger start = SBAlgorithmGetCodeUnitOffset(algorithm, run->offset);
+        SBUInteger end = SBAlgorithmGetCodeUnitOffset(algorithm, run->offset + run->length);
+
+        run->offset = start;
+        run->length = end - start;
+    }
+}
+
 SB_INTERNAL SBUInteger SBAlgorithmGetSeparatorLength(SBAlgorithmRef algorithm, SBUInteger separatorIndex)
 {
     const SBCodepointSequence *codepointSequence = &algorithm->codepointSequence;
@@ -189,7 +412,7 @@ SBParagraphRef SBAlgorithmCreateParagraph(SBAlgorithmRef algorithm,
 SBAlgorithmRef SBAlgorithmRetain(SBAlgorithmRef algorithm)
 {
     if (algorithm) {
-        algorithm->retainCount += 1;
+        SBRetainCountIncrement(&algorithm->retainCount);
     }
 
     return algorithm;
@@ -197,7 +420,7 @@ SBAlgorithmRef SBAlgorithmRetain(SBAlgorithmRef algorithm)
 
 void SBAlgorithmRelease(SBAlgorithmRef algorithm)
 {
-    if (algorithm && --algorithm->retainCount == 0) {
+    if (algorithm && SBRetainCountDecrement(&algorithm->retainCount) == 0) {
         DisposeAlgorithm(algorithm);
     }
 }
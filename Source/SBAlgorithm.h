@@ -23,12 +23,22 @@
 #include <SBCodepointSequence.h>
 #include <SBConfig.h>
 
+#include "SBCodepointSequence.h"
+
 typedef struct _SBAlgorithm {
     SBCodepointSequence codepointSequence;
+    SBCodepointIndex codepointIndex;
     SBBidiType *fixedTypes;
+    SBBoolean hasProvidedTypes;
     SBUInteger retainCount;
 } SBAlgorithm;
 
+SB_INTERNAL SBAlgorithmRef SBAlgorithmCreateWithRange(const SBCodepointSequence *codepointSequence,
+    SBUInteger stringOffset, SBUInteger stringLength);
+
+SB_INTERNAL void SBAlgorithmInitialize(SBAlgorithmRef algorithm,
+    const SBCodepointSequence *codepointSequence, SBBidiType *types);
+
 SB_INTERNAL SBUInteger SBAlgorithmGetSeparatorLength(SBAlgorithmRef algorithm, SBUInteger separatorIndex);
 
 #endif
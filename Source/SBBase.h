@@ -24,10 +24,30 @@
 #include <SBGeneralCategory.h>
 #include <SBScript.h>
 
-/**
- * A value that indicates an invalid unsigned index.
- */
-#define SBInvalidIndex  (SBUInteger)(-1)
+#ifdef SB_CONFIG_ATOMIC_RETAIN
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#if defined(_WIN64)
+#define SBRetainCountIncrement(count)   ((SBUInteger)_InterlockedIncrement64((volatile __int64 *)(count)))
+#define SBRetainCountDecrement(count)   ((SBUInteger)_InterlockedDecrement64((volatile __int64 *)(count)))
+#else
+#define SBRetainCountIncrement(count)   ((SBUInteger)_InterlockedIncrement((volatile long *)(count)))
+#define SBRetainCountDecrement(count)   ((SBUInteger)_InterlockedDecrement((volatile long *)(count)))
+#endif
+#elif defined(__GNUC__) || defined(__clang__)
+#define SBRetainCountIncrement(count)   __atomic_add_fetch(count, 1, __ATOMIC_RELAXED)
+#define SBRetainCountDecrement(count)   __atomic_sub_fetch(count, 1, __ATOMIC_ACQ_REL)
+#else
+#error "SB_CONFIG_ATOMIC_RETAIN is not supported by this compiler."
+#endif
+
+#else
+
+#define SBRetainCountIncrement(count)   (*(count) += 1)
+#define SBRetainCountDecrement(count)   (*(count) -= 1)
+
+#endif
 
 SB_INTERNAL void SBUIntegerNormalizeRange(SBUInteger actualLength,
     SBUInteger *rangeOffset, SBUInteger *rangeLength);
@@ -96,6 +116,8 @@ SB_INTERNAL SBBoolean SBUIntegerVerifyRange(SBUInteger actualLength,
 #define SBBidiTypeIsIsolateTerminator(t)    SBBidiTypeIsEqual(t, SBBidiTypePDI)
 #define SBBidiTypeIsNeutralOrIsolate(t)     SBUInt8InRange(t, SBBidiTypeWS, SBBidiTypePDI)
 
+#define SBBidiTypeMask(t)                   ((SBUInt32)1 << (t))
+
 
 #define SBCodepointMax                      0x10FFFF
 #define SBCodepointInRange(v, s, e)         SBUInt32InRange(v, s, e)
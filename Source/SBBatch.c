@@ -0,0 +1,303 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <SBConfig.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "SBAlgorithm.h"
+#include "SBBase.h"
+#include "SBCodepointSequence.h"
+#include "SBLine.h"
+#include "SBMutex.h"
+#include "SBParagraph.h"
+#include "SBThread.h"
+#include "SBBatch.h"
+
+/* The number of inputs claimed by a thread at once. */
+#define BatchChunkSize      32
+
+#define AlignedSize(size)   (((size) + sizeof(void *) - 1) & ~(sizeof(void *) - 1))
+
+typedef struct _BatchContext {
+    const SBCodepointSequence *inputs;
+    const SBBatchResult *result;
+    SBUInteger count;
+    SBUInteger maxLength;
+    SBLevel baseLevel;
+    SBMutex mutex;
+    SBUInteger nextIndex;
+    SBUInteger nextUnit;
+    SBBoolean isFailed;
+} BatchContext, *BatchContextRef;
+
+#ifdef SB_CONFIG_THREADS
+
+typedef struct _BatchWorker {
+    SBThread thread;
+    BatchContextRef context;
+} BatchWorker;
+
+#endif
+
+static void *AllocateScratch(SBUInteger maxLength)
+{
+    const SBUInteger sizeParagraph = AlignedSize(SBParagraphGetScratchSize(maxLength));
+    const SBUInteger sizeLine      = SBLineGetScratchSize(maxLength);
+    const SBUInteger sizeTypes     = sizeof(SBBidiType) * maxLength;
+
+    return malloc(sizeParagraph + sizeLine + sizeTypes);
+}
+
+static SBBoolean ResolveInput(const SBCodepointSequence *input, SBLevel baseLevel,
+    void *scratch, SBUInteger maxLength, SBLevel *levels, SBRun *runs,
+    SBUInteger *runCount, SBLevel *resolvedLevel)
+{
+    const SBUInteger sizeParagraph = AlignedSize(SBParagraphGetScratchSize(maxLength));
+    const SBUInteger sizeLine      = SBLineGetScratchSize(maxLength);
+
+    SBUInt8 *memory = (SBUInt8 *)scratch;
+    void *paragraphScratch = memory;
+    void *lineScratch = memory + sizeParagraph;
+    SBBidiType *types = (SBBidiType *)(memory + sizeParagraph + sizeLine);
+    SBUInteger stringLength = input->stringLength;
+    SBUInteger paragraphOffset = 0;
+    SBAlgorithm algorithm;
+
+    *runCount = 0;
+    *resolvedLevel = SBLevelInvalid;
+
+    if (!SBCodepointSequenceIsValid(input)) {
+        return SBTrue;
+    }
+
+    SBAlgorithmInitialize(&algorithm, input, types);
+
+    while (paragraphOffset < stringLength) {
+        SBUInteger paragraphLength;
+        SBLevel paragraphLevel = baseLevel;
+        SBLevel *paragraphLevels;
+
+        SBAlgorithmGetParagraphBoundary(&algorithm, paragraphOffset,
+            stringLength - paragraphOffset, &paragraphLength, NULL);
+
+        if (!SBParagraphResolveLevels(&algorithm, paragraphOffset, paragraphLength,
+                &paragraphLevel, paragraphScratch, &paragraphLevels)) {
+            return SBFalse;
+        }
+
+        if (paragraphOffset == 0) {
+            *resolvedLevel = paragraphLevel;
+        }
+
+        if (levels) {
+            memcpy(levels + paragraphOffset, paragraphLevels, sizeof(SBLevel) * paragraphLength);
+        }
+
+        if (runs) {
+            *runCount += SBLineResolveRuns(types + paragraphOffset, paragraphLevels,
+                paragraphOffset, paragraphLength, paragraphLevel, lineScratch, runs + *runCount);
+        }
+
+        paragraphOffset += paragraphLength;
+    }
+
+    return SBTrue;
+}
+
+static SBBoolean ResolveRange(BatchContextRef context, void *scratch,
+    SBUInteger firstIndex, SBUInteger limitIndex, SBUInteger unitOffset)
+{
+    const SBBatchResult *result = context->result;
+    SBUInteger index;
+
+    for (index = firstIndex; index < limitIndex; index++) {
+        const SBCodepointSequence *input = &context->inputs[index];
+        SBLevel *levels = (result->levels ? result->levels + unitOffset : NULL);
+        SBRun *runs = (result->runs ? result->runs + unitOffset : NULL);
+        SBUInteger runCount;
+        SBLevel resolvedLevel;
+
+        if (!ResolveInput(input, context->baseLevel, scratch, context->maxLength,
+                levels, runs, &runCount, &resolvedLevel)) {
+            return SBFalse;
+        }
+
+        if (result->runCounts) {
+            result->runCounts[index] = runCount;
+        }
+        if (result->baseLevels) {
+            result->baseLevels[index] = resolvedLevel;
+        }
+
+        unitOffset += input->stringLength;
+    }
+
+    return SBTrue;
+}
+
+#ifdef SB_CONFIG_THREADS
+
+/*
+ * Claims the next chunk from the cursor shared by all threads. It is work sharing rather than work
+ * stealing: there are no queues per thread, and a thread running out of work takes the next chunk
+ * of the cursor instead of taking it from another thread. As the inputs are independent and cheap
+ * to hand out, a single cursor balances uneven inputs equally well.
+ */
+static SBBoolean ClaimChunk(BatchContextRef context,
+    SBUInteger *firstIndex, SBUInteger *limitIndex, SBUInteger *unitOffset)
+{
+    SBBoolean isClaimed = SBFalse;
+
+    SBMutexLock(&context->mutex);
+
+    if (!context->isFailed && context->nextIndex < context->count) {
+        SBUInteger index = context->nextIndex;
+        SBUInteger limit = index + BatchChunkSize;
+
+        if (limit > context->count) {
+            limit = context->count;
+        }
+
+        *firstIndex = index;
+        *limitIndex = limit;
+        *unitOffset = context->nextUnit;
+
+        for (; index < limit; index++) {
+            context->nextUnit += context->inputs[index].stringLength;
+        }
+        context->nextIndex = limit;
+
+        isClaimed = SBTrue;
+    }
+
+    SBMutexUnlock(&context->mutex);
+
+    return isClaimed;
+}
+
+static void ResolveChunks(BatchContextRef context, void *scratch)
+{
+    SBUInteger firstIndex;
+    SBUInteger limitIndex;
+    SBUInteger unitOffset;
+
+    while (ClaimChunk(context, &firstIndex, &limitIndex, &unitOffset)) {
+        if (!ResolveRange(context, scratch, firstIndex, limitIndex, unitOffset)) {
+            SBMutexLock(&context->mutex);
+            context->isFailed = SBTrue;
+            SBMutexUnlock(&context->mutex);
+            break;
+        }
+    }
+}
+
+static void RunWorker(void *argument)
+{
+    BatchContextRef context = ((BatchWorker *)argument)->context;
+    void *scratch = AllocateScratch(context->maxLength);
+
+    /* Leave the inputs for other threads if the scratch could not be allocated. */
+    if (scratch) {
+        ResolveChunks(context, scratch);
+        free(scratch);
+    }
+}
+
+static SBBoolean ResolveConcurrently(BatchContextRef context, void *scratch, SBUInteger threadCount)
+{
+    BatchWorker *workers = malloc(sizeof(BatchWorker) * (threadCount - 1));
+    SBUInteger startedCount = 0;
+    SBUInteger index;
+
+    if (!workers || !SBMutexInitialize(&context->mutex)) {
+        free(workers);
+        return ResolveRange(context, scratch, 0, context->count, 0);
+    }
+
+    context->nextIndex = 0;
+    context->nextUnit = 0;
+    context->isFailed = SBFalse;
+
+    for (index = 0; index < threadCount - 1; index++) {
+        workers[startedCount].context = context;
+
+        if (SBThreadStart(&workers[startedCount].thread, RunWorker, &workers[startedCount])) {
+            startedCount += 1;
+        }
+    }
+
+    /* The calling thread takes part as well, so all inputs get resolved even if no thread started. */
+    ResolveChunks(context, scratch);
+
+    for (index = 0; index < startedCount; index++) {
+        SBThreadJoin(&workers[index].thread);
+    }
+
+    SBMutexFinalize(&context->mutex);
+    free(workers);
+
+    return !context->isFailed;
+}
+
+#endif
+
+SBBoolean SBResolveBatch(const SBCodepointSequence *inputs, SBUInteger count,
+    SBLevel baseLevel, SBUInteger threadCount, const SBBatchResult *result)
+{
+    SBBoolean isSucceeded = SBFalse;
+    BatchContext context;
+    SBUInteger chunkCount;
+    SBUInteger index;
+    void *scratch;
+
+    context.inputs = inputs;
+    context.result = result;
+    context.count = count;
+    context.maxLength = 0;
+    context.baseLevel = baseLevel;
+
+    for (index = 0; index < count; index++) {
+        if (inputs[index].stringLength > context.maxLength) {
+            context.maxLength = inputs[index].stringLength;
+        }
+    }
+
+    /* There is no benefit of having more threads than the chunks of inputs. */
+    chunkCount = (count + BatchChunkSize - 1) / BatchChunkSize;
+    if (threadCount > chunkCount) {
+        threadCount = chunkCount;
+    }
+
+    scratch = AllocateScratch(context.maxLength);
+
+    if (scratch) {
+#ifdef SB_CONFIG_THREADS
+        if (threadCount > 1) {
+            isSucceeded = ResolveConcurrently(&context, scratch, threadCount);
+        } else
+#endif
+        {
+            isSucceeded = ResolveRange(&context, scratch, 0, count, 0);
+        }
+
+        free(scratch);
+    }
+
+    return isSucceeded;
+}
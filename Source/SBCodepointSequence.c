@@ -18,10 +18,24 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "SBAssert.h"
 #include "SBBase.h"
 #include "SBCodepointSequence.h"
+#include "SBDispatch.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SB_USE_SSE2
+#endif
+
+#ifdef SB_DISPATCH_X86
+#include <immintrin.h>
+#endif
+
+/* The number of code units around an index which a chunked sequence provides for decoding. */
+#define ChunkWindowRadius   8
 
 typedef struct {
     SBUInt8 valid;
@@ -75,20 +89,35 @@ static const SBUInt8 UTF8LookupTable[256] = {
 
 static SBCodepoint GetUTF8CodepointAt(const SBCodepointSequence *codepointSequence, SBUInteger *stringIndex);
 static SBCodepoint GetUTF8CodepointBefore(const SBCodepointSequence *codepointSequence, SBUInteger *stringIndex);
-static SBCodepoint GetUTF16CodepointAt(const SBCodepointSequence *codepointSequence, SBUInteger *stringIndex);
-static SBCodepoint GetUTF16CodepointBefore(const SBCodepointSequence *codepointSequence, SBUInteger *stringIndex);
-static SBCodepoint GetUTF32CodepointAt(const SBCodepointSequence *codepointSequence, SBUInteger *stringIndex);
-static SBCodepoint GetUTF32CodepointBefore(const SBCodepointSequence *codepointSequence, SBUInteger *stringIndex);
+static SBCodepoint GetUTF16CodepointAt(const SBCodepointSequence *codepointSequence, SBUInteger *stringIndex,
+    SBBoolean swapped);
+static SBCodepoint GetUTF16CodepointBefore(const SBCodepointSequence *codepointSequence, SBUInteger *stringIndex,
+    SBBoolean swapped);
+static SBCodepoint GetUTF32CodepointAt(const SBCodepointSequence *codepointSequence, SBUInteger *stringIndex,
+    SBBoolean swapped);
+static SBCodepoint GetUTF32CodepointBefore(const SBCodepointSequence *codepointSequence, SBUInteger *stringIndex,
+    SBBoolean swapped);
+static void PutUTF8Codepoint(SBUInt8 *buffer, SBUInteger index, SBCodepoint codepoint);
+static void PutUTF16Codepoint(SBUInt16 *buffer, SBUInteger index, SBCodepoint codepoint, SBBoolean swapped);
+
+#define SwapUInt16(value) \
+    ((SBUInt16)(((value) << 8) | ((value) >> 8)))
+#define SwapUInt32(value) \
+    ((((value) & 0xFF) << 24) | (((value) & 0xFF00) << 8) \
+     | (((value) >> 8) & 0xFF00) | (((value) >> 24) & 0xFF))
 
 SB_INTERNAL SBBoolean SBCodepointSequenceIsValid(const SBCodepointSequence *codepointSequence)
 {
-    if (codepointSequence) {
+    if (codepointSequence && !SBCodepointSequenceIsIndexed(codepointSequence)) {
         SBBoolean encodingValid = SBFalse;
 
-        switch (codepointSequence->stringEncoding) {
+        switch (SBCodepointSequenceGetEncoding(codepointSequence)) {
         case SBStringEncodingUTF8:
         case SBStringEncodingUTF16:
         case SBStringEncodingUTF32:
+        case SBStringEncodingLatin1:
+        case SBStringEncodingUTF16Swapped:
+        case SBStringEncodingUTF32Swapped:
             encodingValid = SBTrue;
             break;
         }
@@ -99,6 +128,298 @@ SB_INTERNAL SBBoolean SBCodepointSequenceIsValid(const SBCodepointSequence *code
     return SBFalse;
 }
 
+SB_INTERNAL const void *SBCodepointSequenceGetSourceBuffer(const SBCodepointSequence *codepointSequence)
+{
+    if (SBCodepointSequenceIsIndexed(codepointSequence)) {
+        /* Give the buffer which the caller provided rather than the internal index. */
+        const SBCodepointIndex *codepointIndex = codepointSequence->stringBuffer;
+        return codepointIndex->source.stringBuffer;
+    }
+
+    return codepointSequence->stringBuffer;
+}
+
+SB_INTERNAL SBUInteger SBCodepointSequenceGetUnitSize(const SBCodepointSequence *codepointSequence)
+{
+    switch (SBCodepointSequenceGetEncoding(codepointSequence)) {
+    case SBStringEncodingUTF8:
+    case SBStringEncodingLatin1:
+        return sizeof(SBUInt8);
+
+    case SBStringEncodingUTF16:
+    case SBStringEncodingUTF16Swapped:
+        return sizeof(SBUInt16);
+
+    case SBStringEncodingUTF32:
+    case SBStringEncodingUTF32Swapped:
+        return sizeof(SBUInt32);
+    }
+
+    return 0;
+}
+
+SB_INTERNAL void SBCodepointSequencePutCodepoint(const SBCodepointSequence *codepointSequence,
+    void *buffer, SBUInteger index, SBCodepoint codepoint)
+{
+    switch (SBCodepointSequenceGetEncoding(codepointSequence)) {
+    case SBStringEncodingUTF8:
+        PutUTF8Codepoint(buffer, index, codepoint);
+        break;
+
+    case SBStringEncodingUTF16:
+        PutUTF16Codepoint(buffer, index, codepoint, SBFalse);
+        break;
+
+    case SBStringEncodingUTF32:
+        ((SBUInt32 *)buffer)[index] = codepoint;
+        break;
+
+    case SBStringEncodingLatin1:
+        /* A code point outside of Latin-1 cannot be represented, so keep the original one. */
+        if (codepoint <= 0xFF) {
+            ((SBUInt8 *)buffer)[index] = (SBUInt8)codepoint;
+        }
+        break;
+
+    case SBStringEncodingUTF16Swapped:
+        PutUTF16Codepoint(buffer, index, codepoint, SBTrue);
+        break;
+
+    case SBStringEncodingUTF32Swapped:
+        ((SBUInt32 *)buffer)[index] = SwapUInt32(codepoint);
+        break;
+    }
+}
+
+static SBUInteger LocateChunk(const SBStringChunks *text, SBUInteger textIndex)
+{
+    SBUInteger low = 0;
+    SBUInteger high = text->chunkCount;
+
+    while (low < high) {
+        SBUInteger mid = low + (high - low) / 2;
+        const SBStringChunk *chunk = &text->chunks[mid];
+
+        if (textIndex < chunk->offset) {
+            high = mid;
+        } else if (textIndex >= chunk->offset + chunk->length) {
+            low = mid + 1;
+        } else {
+            return mid;
+        }
+    }
+
+    return SBInvalidIndex;
+}
+
+static void CopyChunkUnits(const SBStringChunks *text, SBUInteger unitSize,
+    SBUInteger textIndex, SBUInteger length, SBUInt8 *destination)
+{
+    SBUInteger chunkIndex = LocateChunk(text, textIndex);
+
+    while (length > 0 && chunkIndex < text->chunkCount) {
+        const SBStringChunk *chunk = &text->chunks[chunkIndex];
+        SBUInteger innerOffset = textIndex - chunk->offset;
+        SBUInteger count = chunk->length - innerOffset;
+
+        if (count > length) {
+            count = length;
+        }
+
+        memcpy(destination, (const SBUInt8 *)chunk->buffer + (innerOffset * unitSize), count * unitSize);
+
+        destination += count * unitSize;
+        textIndex += count;
+        length -= count;
+        chunkIndex += 1;
+    }
+}
+
+/*
+ * Sets up a flat sequence around a string index of a chunked sequence. None of the decoders looks
+ * farther than the window radius from the index, so a code point decoded from the window is the
+ * same as if the whole string was contiguous.
+ */
+static SBBoolean LoadChunkWindow(const SBCodepointSequence *sequence, SBUInteger stringIndex,
+    SBUInt32 *units, SBCodepointSequence *window, SBUInteger *windowOffset)
+{
+    const SBStringChunks *text = sequence->stringBuffer;
+    SBUInteger unitSize = SBCodepointSequenceGetUnitSize(sequence);
+    SBUInteger startIndex = (stringIndex > ChunkWindowRadius ? stringIndex - ChunkWindowRadius : 0);
+    SBUInteger limitIndex = stringIndex + ChunkWindowRadius;
+    SBUInteger chunkIndex;
+
+    if (limitIndex > sequence->stringLength) {
+        limitIndex = sequence->stringLength;
+    }
+
+    chunkIndex = LocateChunk(text, text->offset + startIndex);
+    if (chunkIndex == SBInvalidIndex || unitSize == 0) {
+        return SBFalse;
+    }
+
+    window->stringEncoding = SBCodepointSequenceGetEncoding(sequence);
+
+    {
+        const SBStringChunk *chunk = &text->chunks[chunkIndex];
+        SBUInteger chunkStart = chunk->offset;
+        SBUInteger chunkLimit = chunk->offset + chunk->length;
+
+        /* Keep the parts of the chunk outside the string hidden from the decoders. */
+        if (chunkStart < text->offset) {
+            chunkStart = text->offset;
+        }
+        if (chunkLimit > text->offset + sequence->stringLength) {
+            chunkLimit = text->offset + sequence->stringLength;
+        }
+
+        if (text->offset + limitIndex <= chunkLimit) {
+            /* The whole window lies in a single chunk, so decode right from it. */
+            window->stringBuffer = (SBUInt8 *)chunk->buffer + ((chunkStart - chunk->offset) * unitSize);
+            window->stringLength = chunkLimit - chunkStart;
+            *windowOffset = chunkStart - text->offset;
+
+            return SBTrue;
+        }
+    }
+
+    /* The window spans multiple chunks, so gather its code units. */
+    CopyChunkUnits(text, unitSize, text->offset + startIndex, limitIndex - startIndex, (SBUInt8 *)units);
+
+    window->stringBuffer = units;
+    window->stringLength = limitIndex - startIndex;
+    *windowOffset = startIndex;
+
+    return SBTrue;
+}
+
+static SBCodepoint GetChunkedCodepointBefore(const SBCodepointSequence *sequence, SBUInteger *stringIndex)
+{
+    SBUInt32 units[ChunkWindowRadius * 2];
+    SBCodepointSequence window;
+    SBUInteger windowOffset;
+    SBCodepoint codepoint = SBCodepointInvalid;
+
+    if (LoadChunkWindow(sequence, *stringIndex, units, &window, &windowOffset)) {
+        SBUInteger windowIndex = *stringIndex - windowOffset;
+
+        codepoint = SBCodepointSequenceGetCodepointBefore(&window, &windowIndex);
+        *stringIndex = windowOffset + windowIndex;
+    }
+
+    return codepoint;
+}
+
+static SBCodepoint GetChunkedCodepointAt(const SBCodepointSequence *sequence, SBUInteger *stringIndex)
+{
+    SBUInt32 units[ChunkWindowRadius * 2];
+    SBCodepointSequence window;
+    SBUInteger windowOffset;
+    SBCodepoint codepoint = SBCodepointInvalid;
+
+    if (LoadChunkWindow(sequence, *stringIndex, units, &window, &windowOffset)) {
+        SBUInteger windowIndex = *stringIndex - windowOffset;
+
+        codepoint = SBCodepointSequenceGetCodepointAt(&window, &windowIndex);
+        *stringIndex = windowOffset + windowIndex;
+    }
+
+    return codepoint;
+}
+
+SB_INTERNAL SBUInteger SBCodepointIndexGetUnitOffset(const SBCodepointIndex *codepointIndex,
+    SBUInteger stringIndex)
+{
+    SBUInteger unitOffset = codepointIndex->unitOffsets[stringIndex / SBCodepointIndexInterval];
+    SBUInteger remaining;
+
+    /* Decode forward from the nearest kept offset. */
+    for (remaining = stringIndex % SBCodepointIndexInterval; remaining > 0; remaining--) {
+        SBCodepointSequenceGetCodepointAt(&codepointIndex->source, &unitOffset);
+    }
+
+    return unitOffset;
+}
+
+static SBCodepoint GetIndexedCodepointBefore(const SBCodepointSequence *sequence, SBUInteger *stringIndex)
+{
+    const SBCodepointIndex *codepointIndex = sequence->stringBuffer;
+    SBUInteger unitOffset;
+
+    *stringIndex -= 1;
+    unitOffset = SBCodepointIndexGetUnitOffset(codepointIndex, *stringIndex);
+
+    return SBCodepointSequenceGetCodepointAt(&codepointIndex->source, &unitOffset);
+}
+
+static SBCodepoint GetIndexedCodepointAt(const SBCodepointSequence *sequence, SBUInteger *stringIndex)
+{
+    const SBCodepointIndex *codepointIndex = sequence->stringBuffer;
+    SBUInteger unitOffset = SBCodepointIndexGetUnitOffset(codepointIndex, *stringIndex);
+
+    *stringIndex += 1;
+
+    return SBCodepointSequenceGetCodepointAt(&codepointIndex->source, &unitOffset);
+}
+
+static void CopyIndexedCodepoints(const SBCodepointIndex *codepointIndex,
+    SBUInteger stringOffset, SBUInteger length, SBUInt32 *destination)
+{
+    SBUInteger unitOffset = SBCodepointIndexGetUnitOffset(codepointIndex, stringOffset);
+    SBUInteger index;
+
+    /* Locate the first code point only, as the rest of them follow it in the source string. */
+    for (index = 0; index < length; index++) {
+        destination[index] = SBCodepointSequenceGetCodepointAt(&codepointIndex->source, &unitOffset);
+    }
+}
+
+SB_INTERNAL void SBCodepointSequenceCopyUnits(const SBCodepointSequence *codepointSequence,
+    SBUInteger stringOffset, SBUInteger length, void *buffer)
+{
+    SBUInteger unitSize = SBCodepointSequenceGetUnitSize(codepointSequence);
+
+    if (SBCodepointSequenceIsChunked(codepointSequence)) {
+        const SBStringChunks *text = codepointSequence->stringBuffer;
+        CopyChunkUnits(text, unitSize, text->offset + stringOffset, length, buffer);
+    } else if (SBCodepointSequenceIsIndexed(codepointSequence)) {
+        /* The code units of an indexed sequence are the UTF-32 code points of its source. */
+        CopyIndexedCodepoints(codepointSequence->stringBuffer, stringOffset, length, buffer);
+    } else {
+        const SBUInt8 *source = codepointSequence->stringBuffer;
+        memcpy(buffer, source + (stringOffset * unitSize), length * unitSize);
+    }
+}
+
+SB_INTERNAL SBUInteger SBCodepointSequenceGetRangeSize(const SBCodepointSequence *codepointSequence)
+{
+    if (SBCodepointSequenceIsChunked(codepointSequence)) {
+        return sizeof(SBStringChunks);
+    }
+
+    return 0;
+}
+
+SB_INTERNAL void SBCodepointSequenceMakeRange(const SBCodepointSequence *codepointSequence,
+    SBUInteger stringOffset, SBUInteger length, void *memory, SBCodepointSequence *range)
+{
+    range->stringEncoding = codepointSequence->stringEncoding;
+    range->stringLength = length;
+
+    if (SBCodepointSequenceIsChunked(codepointSequence)) {
+        SBStringChunks *text = memory;
+
+        /* Share the chunks, only moving the start of the string within them. */
+        *text = *(const SBStringChunks *)codepointSequence->stringBuffer;
+        text->offset += stringOffset;
+
+        range->stringBuffer = text;
+    } else {
+        SBUInteger unitSize = SBCodepointSequenceGetUnitSize(codepointSequence);
+        range->stringBuffer = (SBUInt8 *)codepointSequence->stringBuffer + (stringOffset * unitSize);
+    }
+}
+
 SBCodepoint SBCodepointSequenceGetCodepointBefore(const SBCodepointSequence *codepointSequence, SBUInteger *stringIndex)
 {
     SBCodepoint codepoint = SBCodepointInvalid;
@@ -110,11 +431,32 @@ SBCodepoint SBCodepointSequenceGetCodepointBefore(const SBCodepointSequence *cod
             break;
 
         case SBStringEncodingUTF16:
-            codepoint = GetUTF16CodepointBefore(codepointSequence, stringIndex);
+            codepoint = GetUTF16CodepointBefore(codepointSequence, stringIndex, SBFalse);
             break;
 
         case SBStringEncodingUTF32:
-            codepoint = GetUTF32CodepointBefore(codepointSequence, stringIndex);
+            codepoint = GetUTF32CodepointBefore(codepointSequence, stringIndex, SBFalse);
+            break;
+
+        case SBStringEncodingLatin1:
+            *stringIndex -= 1;
+            codepoint = ((const SBUInt8 *)codepointSequence->stringBuffer)[*stringIndex];
+            break;
+
+        case SBStringEncodingUTF16Swapped:
+            codepoint = GetUTF16CodepointBefore(codepointSequence, stringIndex, SBTrue);
+            break;
+
+        case SBStringEncodingUTF32Swapped:
+            codepoint = GetUTF32CodepointBefore(codepointSequence, stringIndex, SBTrue);
+            break;
+
+        default:
+            if (SBCodepointSequenceIsChunked(codepointSequence)) {
+                codepoint = GetChunkedCodepointBefore(codepointSequence, stringIndex);
+            } else if (SBCodepointSequenceIsIndexed(codepointSequence)) {
+                codepoint = GetIndexedCodepointBefore(codepointSequence, stringIndex);
+            }
             break;
         }
     }
@@ -133,11 +475,32 @@ SBCodepoint SBCodepointSequenceGetCodepointAt(const SBCodepointSequence *codepoi
             break;
 
         case SBStringEncodingUTF16:
-            codepoint = GetUTF16CodepointAt(codepointSequence, stringIndex);
+            codepoint = GetUTF16CodepointAt(codepointSequence, stringIndex, SBFalse);
             break;
 
         case SBStringEncodingUTF32:
-            codepoint = GetUTF32CodepointAt(codepointSequence, stringIndex);
+            codepoint = GetUTF32CodepointAt(codepointSequence, stringIndex, SBFalse);
+            break;
+
+        case SBStringEncodingLatin1:
+            codepoint = ((const SBUInt8 *)codepointSequence->stringBuffer)[*stringIndex];
+            *stringIndex += 1;
+            break;
+
+        case SBStringEncodingUTF16Swapped:
+            codepoint = GetUTF16CodepointAt(codepointSequence, stringIndex, SBTrue);
+            break;
+
+        case SBStringEncodingUTF32Swapped:
+            codepoint = GetUTF32CodepointAt(codepointSequence, stringIndex, SBTrue);
+            break;
+
+        default:
+            if (SBCodepointSequenceIsChunked(codepointSequence)) {
+                codepoint = GetChunkedCodepointAt(codepointSequence, stringIndex);
+            } else if (SBCodepointSequenceIsIndexed(codepointSequence)) {
+                codepoint = GetIndexedCodepointAt(codepointSequence, stringIndex);
+            }
             break;
         }
     }
@@ -186,6 +549,229 @@ static SBCodepoint GetUTF8CodepointAt(const SBCodepointSequence *sequence, SBUIn
     return SBCodepointFaulty;
 }
 
+/*
+ * Classifies a block of UTF-8 bytes into masks having one bit for each byte of the block.
+ */
+static void ClassifyUTF8BlockScalar(const SBUInt8 *block,
+    SBUInt32 *asciiMask, SBUInt32 *leadMask, SBUInt32 *trailMask)
+{
+    SBUInt32 ascii = 0;
+    SBUInt32 lead = 0;
+    SBUInt32 trail = 0;
+    SBUInteger index;
+
+    for (index = 0; index < SBCodepointSequenceBlockSize; index++) {
+        SBUInt8 byte = block[index];
+
+        ascii |= (SBUInt32)(byte < 0x80) << index;
+        lead |= (SBUInt32)(byte >= 0xC2 && byte <= 0xDF) << index;
+        trail |= (SBUInt32)(byte >= 0x80 && byte <= 0xBF) << index;
+    }
+
+    *asciiMask = ascii;
+    *leadMask = lead;
+    *trailMask = trail;
+}
+
+#ifdef SB_USE_SSE2
+static void ClassifyUTF8BlockSSE2(const SBUInt8 *block,
+    SBUInt32 *asciiMask, SBUInt32 *leadMask, SBUInt32 *trailMask)
+{
+    __m128i bytes = _mm_loadu_si128((const __m128i *)block);
+    /* Signed comparisons: 80..BF map to -128..-65 and C2..DF map to -62..-33. */
+    __m128i trails = _mm_cmplt_epi8(bytes, _mm_set1_epi8(-64));
+    __m128i leads = _mm_and_si128(_mm_cmpgt_epi8(bytes, _mm_set1_epi8(-63)),
+                                  _mm_cmplt_epi8(bytes, _mm_set1_epi8(-32)));
+
+    *asciiMask = (SBUInt32)(~_mm_movemask_epi8(bytes) & 0xFFFF);
+    *leadMask = (SBUInt32)_mm_movemask_epi8(leads);
+    *trailMask = (SBUInt32)_mm_movemask_epi8(trails);
+}
+#endif
+
+/*
+ * Decodes a block made up of one and two byte sequences only, which covers ASCII along with Latin,
+ * Greek, Cyrillic, Hebrew, Arabic and similar scripts. Any other block is left for the scalar
+ * decoder so that faulty sequences are handled exactly in the same way.
+ */
+static SBUInteger DecodeUTF8Block(const SBUInt8 *block, SBCodepoint *codepoints,
+    SBDispatchLevel level)
+{
+    const SBUInt32 blockMask = (1UL << SBCodepointSequenceBlockSize) - 1;
+    const SBUInt32 lastBit = 1UL << (SBCodepointSequenceBlockSize - 1);
+    SBUInt32 asciiMask;
+    SBUInt32 leadMask;
+    SBUInt32 trailMask;
+    SBUInteger count;
+    SBUInteger index;
+
+#ifdef SB_USE_SSE2
+    if (level >= SBDispatchLevelSSE2) {
+        ClassifyUTF8BlockSSE2(block, &asciiMask, &leadMask, &trailMask);
+    } else
+#endif
+    {
+        ClassifyUTF8BlockScalar(block, &asciiMask, &leadMask, &trailMask);
+    }
+
+    /* Each byte must belong to a class, and each lead must be followed by exactly one trail. */
+    if ((asciiMask | leadMask | trailMask) != blockMask
+        || ((leadMask << 1) & blockMask) != trailMask) {
+        return 0;
+    }
+
+    /* A lead at the end of the block is decoded with the next block. */
+    count = SBCodepointSequenceBlockSize - ((leadMask & lastBit) != 0);
+
+    for (index = 0; index < count; index++) {
+        SBUInt32 bit = (SBUInt32)1 << index;
+        SBCodepoint unit = block[index];
+
+        if (leadMask & bit) {
+            codepoints[index] = ((unit & 0x1F) << 6) | (block[index + 1] & 0x3F);
+        } else if (trailMask & bit) {
+            codepoints[index] = SBCodepointInvalid;
+        } else {
+            codepoints[index] = unit;
+        }
+    }
+
+    return count;
+}
+
+/*
+ * Checks whether a block of UTF-16 units contains any surrogate.
+ */
+static SBBoolean HasSurrogatesScalar(const SBUInt16 *block, SBBoolean swapped)
+{
+    SBUInt16 surrogates = 0;
+    SBUInteger index;
+
+    for (index = 0; index < SBCodepointSequenceBlockSize; index++) {
+        SBUInt16 unit = (swapped ? SwapUInt16(block[index]) : block[index]);
+        surrogates |= ((unit & 0xF800) == 0xD800);
+    }
+
+    return (surrogates != 0);
+}
+
+#ifdef SB_USE_SSE2
+static SBBoolean HasSurrogatesSSE2(const SBUInt16 *block, SBBoolean swapped)
+{
+    const __m128i surrogateMask = _mm_set1_epi16((short)0xF800);
+    const __m128i surrogateBase = _mm_set1_epi16((short)0xD800);
+    __m128i first = _mm_loadu_si128((const __m128i *)block);
+    __m128i second = _mm_loadu_si128((const __m128i *)(block + 8));
+    __m128i surrogates;
+
+    if (swapped) {
+        first = _mm_or_si128(_mm_slli_epi16(first, 8), _mm_srli_epi16(first, 8));
+        second = _mm_or_si128(_mm_slli_epi16(second, 8), _mm_srli_epi16(second, 8));
+    }
+
+    surrogates = _mm_or_si128(
+        _mm_cmpeq_epi16(_mm_and_si128(first, surrogateMask), surrogateBase),
+        _mm_cmpeq_epi16(_mm_and_si128(second, surrogateMask), surrogateBase));
+
+    return (_mm_movemask_epi8(surrogates) != 0);
+}
+#endif
+
+#ifdef SB_DISPATCH_X86
+/* The whole block fits in a single register. */
+static SB_TARGET_AVX2 SBBoolean HasSurrogatesAVX2(const SBUInt16 *block, SBBoolean swapped)
+{
+    __m256i units = _mm256_loadu_si256((const __m256i *)block);
+    __m256i surrogates;
+
+    if (swapped) {
+        units = _mm256_or_si256(_mm256_slli_epi16(units, 8), _mm256_srli_epi16(units, 8));
+    }
+
+    surrogates = _mm256_cmpeq_epi16(_mm256_and_si256(units, _mm256_set1_epi16((short)0xF800)),
+                                    _mm256_set1_epi16((short)0xD800));
+
+    return !_mm256_testz_si256(surrogates, surrogates);
+}
+#endif
+
+/*
+ * Decodes a block of UTF-16 units having no surrogates, which is the case for almost all text
+ * outside of emoji and historic scripts. Any other block is left for the scalar decoder.
+ */
+static SBUInteger DecodeUTF16Block(const SBUInt16 *block, SBCodepoint *codepoints,
+    SBBoolean swapped, SBDispatchLevel level)
+{
+    SBBoolean hasSurrogates;
+    SBUInteger index;
+
+#ifdef SB_DISPATCH_X86
+    if (level >= SBDispatchLevelAVX2) {
+        hasSurrogates = HasSurrogatesAVX2(block, swapped);
+    } else
+#endif
+#ifdef SB_USE_SSE2
+    if (level >= SBDispatchLevelSSE2) {
+        hasSurrogates = HasSurrogatesSSE2(block, swapped);
+    } else
+#endif
+    {
+        hasSurrogates = HasSurrogatesScalar(block, swapped);
+    }
+
+    if (hasSurrogates) {
+        return 0;
+    }
+
+    for (index = 0; index < SBCodepointSequenceBlockSize; index++) {
+        codepoints[index] = (swapped ? SwapUInt16(block[index]) : block[index]);
+    }
+
+    return SBCodepointSequenceBlockSize;
+}
+
+/*
+ * Decodes a block of Latin-1 bytes, each of which is a code point of its own.
+ */
+static SBUInteger DecodeLatin1Block(const SBUInt8 *block, SBCodepoint *codepoints)
+{
+    SBUInteger index;
+
+    for (index = 0; index < SBCodepointSequenceBlockSize; index++) {
+        codepoints[index] = block[index];
+    }
+
+    return SBCodepointSequenceBlockSize;
+}
+
+SB_INTERNAL SBUInteger SBCodepointSequenceDecodeBlock(const SBCodepointSequence *codepointSequence,
+    SBUInteger stringIndex, SBCodepoint *codepoints)
+{
+    if (stringIndex + SBCodepointSequenceBlockSize <= codepointSequence->stringLength) {
+        SBDispatchLevel level = SBDispatchGetLevel();
+
+        switch (codepointSequence->stringEncoding) {
+        case SBStringEncodingUTF8:
+            return DecodeUTF8Block((const SBUInt8 *)codepointSequence->stringBuffer + stringIndex,
+                                   codepoints, level);
+
+        case SBStringEncodingUTF16:
+            return DecodeUTF16Block((const SBUInt16 *)codepointSequence->stringBuffer + stringIndex,
+                                    codepoints, SBFalse, level);
+
+        case SBStringEncodingLatin1:
+            return DecodeLatin1Block((const SBUInt8 *)codepointSequence->stringBuffer + stringIndex,
+                                     codepoints);
+
+        case SBStringEncodingUTF16Swapped:
+            return DecodeUTF16Block((const SBUInt16 *)codepointSequence->stringBuffer + stringIndex,
+                                    codepoints, SBTrue, level);
+        }
+    }
+
+    return 0;
+}
+
 static SBCodepoint GetUTF8CodepointBefore(const SBCodepointSequence *sequence, SBUInteger *index)
 {
     const SBUInt8 *buffer = sequence->stringBuffer;
@@ -217,7 +803,11 @@ static SBCodepoint GetUTF8CodepointBefore(const SBCodepointSequence *sequence, S
     return codepoint;
 }
 
-static SBCodepoint GetUTF16CodepointAt(const SBCodepointSequence *sequence, SBUInteger *index)
+#define ReadUTF16Unit(buffer, index, swapped) \
+    ((swapped) ? SwapUInt16((buffer)[index]) : (buffer)[index])
+
+static SBCodepoint GetUTF16CodepointAt(const SBCodepointSequence *sequence, SBUInteger *index,
+    SBBoolean swapped)
 {
     const SBUInt16 *buffer = sequence->stringBuffer;
     SBUInteger length = sequence->stringLength;
@@ -226,14 +816,14 @@ static SBCodepoint GetUTF16CodepointAt(const SBCodepointSequence *sequence, SBUI
 
     codepoint = SBCodepointFaulty;
 
-    lead = buffer[*index];
+    lead = ReadUTF16Unit(buffer, *index, swapped);
     *index += 1;
 
     if (!SBCodepointIsSurrogate(lead)) {
         codepoint = lead;
     } else if (lead <= 0xDBFF) {
         if (*index < length) {
-            SBUInt16 trail = buffer[*index];
+            SBUInt16 trail = ReadUTF16Unit(buffer, *index, swapped);
 
             if (SBUInt16InRange(trail, 0xDC00, 0xDFFF)) {
                 codepoint = (lead << 10) + trail - ((0xD800 << 10) + 0xDC00 - 0x10000);
@@ -245,7 +835,8 @@ static SBCodepoint GetUTF16CodepointAt(const SBCodepointSequence *sequence, SBUI
     return codepoint;
 }
 
-static SBCodepoint GetUTF16CodepointBefore(const SBCodepointSequence *sequence, SBUInteger *index)
+static SBCodepoint GetUTF16CodepointBefore(const SBCodepointSequence *sequence, SBUInteger *index,
+    SBBoolean swapped)
 {
     const SBUInt16 *buffer = sequence->stringBuffer;
     SBCodepoint codepoint;
@@ -254,13 +845,13 @@ static SBCodepoint GetUTF16CodepointBefore(const SBCodepointSequence *sequence,
     codepoint = SBCodepointFaulty;
 
     *index -= 1;
-    trail = buffer[*index];
+    trail = ReadUTF16Unit(buffer, *index, swapped);
 
     if (!SBCodepointIsSurrogate(trail)) {
         codepoint = trail;
     } else if (trail >= 0xDC00) {
         if (*index > 0) {
-            SBUInt16 lead = buffer[*index - 1];
+            SBUInt16 lead = ReadUTF16Unit(buffer, *index - 1, swapped);
 
             if (SBUInt16InRange(lead, 0xD800, 0xDBFF)) {
                 codepoint = (lead << 10) + trail - ((0xD800 << 10) + 0xDC00 - 0x10000);
@@ -272,7 +863,8 @@ static SBCodepoint GetUTF16CodepointBefore(const SBCodepointSequence *sequence,
     return codepoint;
 }
 
-static SBCodepoint GetUTF32CodepointAt(const SBCodepointSequence *sequence, SBUInteger *index)
+static SBCodepoint GetUTF32CodepointAt(const SBCodepointSequence *sequence, SBUInteger *index,
+    SBBoolean swapped)
 {
     const SBUInt32 *buffer = sequence->stringBuffer;
     SBCodepoint codepoint;
@@ -280,6 +872,10 @@ static SBCodepoint GetUTF32CodepointAt(const SBCodepointSequence *sequence, SBUI
     codepoint = buffer[*index];
     *index += 1;
 
+    if (swapped) {
+        codepoint = SwapUInt32(codepoint);
+    }
+
     if (SBCodepointIsValid(codepoint)) {
         return codepoint;
     }
@@ -287,7 +883,8 @@ static SBCodepoint GetUTF32CodepointAt(const SBCodepointSequence *sequence, SBUI
     return SBCodepointFaulty;
 }
 
-static SBCodepoint GetUTF32CodepointBefore(const SBCodepointSequence *sequence, SBUInteger *index)
+static SBCodepoint GetUTF32CodepointBefore(const SBCodepointSequence *sequence, SBUInteger *index,
+    SBBoolean swapped)
 {
     const SBUInt32 *buffer = sequence->stringBuffer;
     SBCodepoint codepoint;
@@ -295,9 +892,57 @@ static SBCodepoint GetUTF32CodepointBefore(const SBCodepointSequence *sequence,
     *index -= 1;
     codepoint = buffer[*index];
 
+    if (swapped) {
+        codepoint = SwapUInt32(codepoint);
+    }
+
     if (SBCodepointIsValid(codepoint)) {
         return codepoint;
     }
 
     return SBCodepointFaulty;
 }
+
+static void PutUTF8Codepoint(SBUInt8 *buffer, SBUInteger index, SBCodepoint codepoint)
+{
+    buffer += index;
+
+    if (codepoint <= 0x7F) {
+        buffer[0] = (SBUInt8)codepoint;
+    } else if (codepoint <= 0x7FF) {
+        buffer[0] = (SBUInt8)(0xC0 | (codepoint >> 6));
+        buffer[1] = (SBUInt8)(0x80 | (codepoint & 0x3F));
+    } else if (codepoint <= 0xFFFF) {
+        buffer[0] = (SBUInt8)(0xE0 | (codepoint >> 12));
+        buffer[1] = (SBUInt8)(0x80 | ((codepoint >> 6) & 0x3F));
+        buffer[2] = (SBUInt8)(0x80 | (codepoint & 0x3F));
+    } else {
+        buffer[0] = (SBUInt8)(0xF0 | (codepoint >> 18));
+        buffer[1] = (SBUInt8)(0x80 | ((codepoint >> 12) & 0x3F));
+        buffer[2] = (SBUInt8)(0x80 | ((codepoint >> 6) & 0x3F));
+        buffer[3] = (SBUInt8)(0x80 | (codepoint & 0x3F));
+    }
+}
+
+static void PutUTF16Codepoint(SBUInt16 *buffer, SBUInteger index, SBCodepoint codepoint,
+    SBBoolean swapped)
+{
+    SBUInt16 units[2];
+    SBUInteger count = 1;
+
+    if (codepoint <= 0xFFFF) {
+        units[0] = (SBUInt16)codepoint;
+    } else {
+        codepoint -= 0x10000;
+        units[0] = (SBUInt16)(0xD800 | (codepoint >> 10));
+        units[1] = (SBUInt16)(0xDC00 | (codepoint & 0x3FF));
+        count = 2;
+    }
+
+    buffer += index;
+    buffer[0] = (swapped ? SwapUInt16(units[0]) : units[0]);
+
+    if (count == 2) {
+        buffer[1] = (swapped ? SwapUInt16(units[1]) : units[1]);
+    }
+}
@@ -20,6 +20,60 @@
 #include <SBConfig.h>
 #include <SBCodepointSequence.h>
 
+/*
+ * An internal flag combined with an encoding, indicating that the string buffer points to an
+ * SBCodepointIndex structure. It is never accepted from the public interface.
+ */
+#define SBStringEncodingIndexed         0x40
+
+#define SBCodepointSequenceIsChunked(sequence) \
+    (((sequence)->stringEncoding & SBStringEncodingChunked) != 0)
+#define SBCodepointSequenceIsIndexed(sequence) \
+    (((sequence)->stringEncoding & SBStringEncodingIndexed) != 0)
+#define SBCodepointSequenceIsFlat(sequence) \
+    (((sequence)->stringEncoding & (SBStringEncodingChunked | SBStringEncodingIndexed)) == 0)
+#define SBCodepointSequenceGetEncoding(sequence) \
+    ((sequence)->stringEncoding & ~(SBStringEncoding)(SBStringEncodingChunked | SBStringEncodingIndexed))
+
+/*
+ * The number of code units examined at once by SBCodepointSequenceDecodeBlock. A decoded block only
+ * contains code points of BMP, having SBCodepointInvalid at trailing code units.
+ */
+#define SBCodepointSequenceBlockSize    16
+
+/* The number of code points between two code unit offsets kept by a code point index. */
+#define SBCodepointIndexInterval        32
+
+/*
+ * Presents a source string as a sequence of UTF-32 code points without copying it. Only the offset
+ * of every SBCodepointIndexInterval-th code point is kept, followed by the end of the string if
+ * the number of code points is a multiple of the interval. Other code points are found by decoding
+ * forward from the nearest offset.
+ */
+typedef struct _SBCodepointIndex {
+    SBCodepointSequence source;
+    const SBUInteger *unitOffsets;
+} SBCodepointIndex;
+
 SB_INTERNAL SBBoolean SBCodepointSequenceIsValid(const SBCodepointSequence *codepointSequence);
 
+SB_INTERNAL const void *SBCodepointSequenceGetSourceBuffer(const SBCodepointSequence *codepointSequence);
+
+SB_INTERNAL SBUInteger SBCodepointSequenceGetUnitSize(const SBCodepointSequence *codepointSequence);
+SB_INTERNAL void SBCodepointSequencePutCodepoint(const SBCodepointSequence *codepointSequence,
+    void *buffer, SBUInteger index, SBCodepoint codepoint);
+
+SB_INTERNAL void SBCodepointSequenceCopyUnits(const SBCodepointSequence *codepointSequence,
+    SBUInteger stringOffset, SBUInteger length, void *buffer);
+
+SB_INTERNAL SBUInteger SBCodepointSequenceDecodeBlock(const SBCodepointSequence *codepointSequence,
+    SBUInteger stringIndex, SBCodepoint *codepoints);
+
+SB_INTERNAL SBUInteger SBCodepointIndexGetUnitOffset(const SBCodepointIndex *codepointIndex,
+    SBUInteger stringIndex);
+
+SB_INTERNAL SBUInteger SBCodepointSequenceGetRangeSize(const SBCodepointSequence *codepointSequence);
+SB_INTERNAL void SBCodepointSequenceMakeRange(const SBCodepointSequence *codepointSequence,
+    SBUInteger stringOffset, SBUInteger length, void *memory, SBCodepointSequence *range);
+
 #endif
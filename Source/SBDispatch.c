@@ -0,0 +1,188 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <SBConfig.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(SB_DISPATCH_X86) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include "SBBase.h"
+#include "SBDispatch.h"
+
+#if defined(SB_DISPATCH_X86) && !defined(_MSC_VER)
+#include <cpuid.h>
+#endif
+
+/* The environment variable which can lower the level, for example to benchmark scalar kernels. */
+#define DispatchEnvironmentVariable "SHEENBIDI_DISPATCH"
+
+#define LevelUnknown 0xFF
+
+/*
+ * The level is detected once and then only read. Every thread detects the same value, so the
+ * accesses only need to be atomic, not ordered.
+ */
+#if defined(_MSC_VER)
+static volatile long DetectedLevel = LevelUnknown;
+#define LoadLevel()         ((SBDispatchLevel)DetectedLevel)
+#define StoreLevel(level)   (DetectedLevel = (level))
+#elif defined(__GNUC__) || defined(__clang__)
+static SBDispatchLevel DetectedLevel = LevelUnknown;
+#define LoadLevel()         __atomic_load_n(&DetectedLevel, __ATOMIC_RELAXED)
+#define StoreLevel(level)   __atomic_store_n(&DetectedLevel, (level), __ATOMIC_RELAXED)
+#else
+static SBDispatchLevel DetectedLevel = LevelUnknown;
+#define LoadLevel()         (DetectedLevel)
+#define StoreLevel(level)   (DetectedLevel = (level))
+#endif
+
+#ifdef SB_DISPATCH_X86
+
+static void QueryCPUID(SBUInt32 leaf, SBUInt32 *registers)
+{
+#ifdef _MSC_VER
+    int values[4];
+    __cpuidex(values, (int)leaf, 0);
+
+    registers[0] = (SBUInt32)values[0];
+    registers[1] = (SBUInt32)values[1];
+    registers[2] = (SBUInt32)values[2];
+    registers[3] = (SBUInt32)values[3];
+#else
+    unsigned int eax, ebx, ecx, edx;
+    __cpuid_count(leaf, 0, eax, ebx, ecx, edx);
+
+    registers[0] = eax;
+    registers[1] = ebx;
+    registers[2] = ecx;
+    registers[3] = edx;
+#endif
+}
+
+static SBUInt32 QueryEnabledStates(void)
+{
+#ifdef _MSC_VER
+    return (SBUInt32)_xgetbv(0);
+#else
+    SBUInt32 eax, edx;
+    __asm__ __volatile__ ("xgetbv" : "=a" (eax), "=d" (edx) : "c" (0));
+
+    return eax;
+#endif
+}
+
+static SBDispatchLevel DetectLevel(void)
+{
+    SBDispatchLevel level = SBDispatchLevelScalar;
+    SBUInt32 registers[4];
+    SBUInt32 maxLeaf;
+
+    QueryCPUID(0, registers);
+    maxLeaf = registers[0];
+
+    if (maxLeaf < 1) {
+        return level;
+    }
+
+    QueryCPUID(1, registers);
+
+    if (registers[3] & (1UL << 26)) {
+        level = SBDispatchLevelSSE2;
+
+        if (registers[2] & (1UL << 20)) {
+            level = SBDispatchLevelSSE42;
+        }
+    }
+
+    /*
+     * The wider registers are only usable if the operating system saves them. AVX is checked as
+     * well, since some hypervisors hide it while still reporting AVX2 in leaf 7.
+     */
+    if (level == SBDispatchLevelSSE42 && maxLeaf >= 7
+        && (registers[2] & (1UL << 27)) && (registers[2] & (1UL << 28))) {
+        SBUInt32 states = QueryEnabledStates();
+
+        if ((states & 0x06) == 0x06) {
+            QueryCPUID(7, registers);
+
+            if (registers[1] & (1UL << 5)) {
+                level = SBDispatchLevelAVX2;
+
+                if ((states & 0xE0) == 0xE0
+                    && (registers[1] & (1UL << 16)) && (registers[1] & (1UL << 30))) {
+                    level = SBDispatchLevelAVX512;
+                }
+            }
+        }
+    }
+
+    return level;
+}
+
+#else
+
+static SBDispatchLevel DetectLevel(void)
+{
+    return SBDispatchLevelScalar;
+}
+
+#endif
+
+/* A level beyond the detected one would not run, so never raise it. */
+#define LimitLevel(level, detected) ((level) < (detected) ? (level) : (detected))
+
+static SBDispatchLevel ParseLevel(const char *name, SBDispatchLevel detected)
+{
+    static const char *const LevelNames[] = { "scalar", "sse2", "sse4.2", "avx2", "avx512" };
+    SBDispatchLevel level;
+
+    for (level = SBDispatchLevelScalar; level <= SBDispatchLevelAVX512; level++) {
+        if (strcmp(name, LevelNames[level]) == 0) {
+            return LimitLevel(level, detected);
+        }
+    }
+
+    return detected;
+}
+
+SB_INTERNAL SBDispatchLevel SBDispatchGetLevel(void)
+{
+    SBDispatchLevel level = LoadLevel();
+
+    if (level == LevelUnknown) {
+        const char *name = getenv(DispatchEnvironmentVariable);
+
+        level = DetectLevel();
+        if (name) {
+            level = ParseLevel(name, level);
+        }
+
+        StoreLevel(level);
+    }
+
+    return level;
+}
+
+void SBDispatchSetLevel(SBDispatchLevel level)
+{
+    SBDispatchLevel detected = DetectLevel();
+    StoreLevel(LimitLevel(level, detected));
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _SB_INTERNAL_DISPATCH_H
+#define _SB_INTERNAL_DISPATCH_H
+
+#include <SBBase.h>
+#include <SBConfig.h>
+
+#if defined(__GNUC__) || defined(__clang__)
+#if defined(__x86_64__) || defined(__i386__)
+#define SB_DISPATCH_X86
+#define SB_TARGET_AVX2      __attribute__((target("avx2")))
+#endif
+#elif defined(_MSC_VER)
+#if defined(_M_X64) || defined(_M_IX86)
+#define SB_DISPATCH_X86
+#define SB_TARGET_AVX2
+#endif
+#endif
+
+enum {
+    SBDispatchLevelScalar = 0,
+    SBDispatchLevelSSE2   = 1,
+    SBDispatchLevelSSE42  = 2,
+    SBDispatchLevelAVX2   = 3,
+    SBDispatchLevelAVX512 = 4
+};
+typedef SBUInt8 SBDispatchLevel;
+
+SB_INTERNAL SBDispatchLevel SBDispatchGetLevel(void);
+
+/*
+ * Pins the level used by the kernels, overriding the environment variable. The level is lowered
+ * to the one supported by the processor if needed. It is not declared with SB_INTERNAL so that
+ * tests and embedders can call it in unity builds as well.
+ */
+void SBDispatchSetLevel(SBDispatchLevel level);
+
+#endif
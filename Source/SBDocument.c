@@ -0,0 +1,282 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <SBConfig.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#include "SBAlgorithm.h"
+#include "SBBase.h"
+#include "SBParagraph.h"
+#include "SBDocument.h"
+
+#define InitialParagraphCapacity    16
+
+SBDocumentRef SBDocumentCreate(SBAlgorithmRef algorithm, SBLevel baseLevel, SBUInteger residentCapacity)
+{
+    SBDocumentRef document;
+
+    if (residentCapacity == 0) {
+        return NULL;
+    }
+
+    document = malloc(sizeof(SBDocument));
+
+    if (document) {
+        document->_paragraphs = malloc(sizeof(DocumentParagraph) * InitialParagraphCapacity);
+
+        if (document->_paragraphs) {
+            document->_algorithm = SBAlgorithmRetain(algorithm);
+            document->_capacity = InitialParagraphCapacity;
+            document->_count = 0;
+            document->_indexedLength = 0;
+            document->_first = SBInvalidIndex;
+            document->_last = SBInvalidIndex;
+            document->_residentCapacity = residentCapacity;
+            document->_residentCount = 0;
+            document->_baseLevel = baseLevel;
+            document->retainCount = 1;
+        } else {
+            free(document);
+            document = NULL;
+        }
+    }
+
+    return document;
+}
+
+static SBUInteger GetStringLength(SBDocumentRef document)
+{
+    return document->_algorithm->codepointSequence.stringLength;
+}
+
+static SBBoolean IndexNextParagraph(SBDocumentRef document)
+{
+    SBUInteger offset = document->_indexedLength;
+    SBUInteger count = document->_count;
+    DocumentParagraph *paragraphs = document->_paragraphs;
+    SBUInteger length;
+
+    if (offset >= GetStringLength(document)) {
+        return SBFalse;
+    }
+
+    if (count == document->_capacity) {
+        SBUInteger capacity = count * 2;
+
+        paragraphs = realloc(paragraphs, sizeof(DocumentParagraph) * capacity);
+        if (!paragraphs) {
+            return SBFalse;
+        }
+
+        document->_paragraphs = paragraphs;
+        document->_capacity = capacity;
+    }
+
+    SBAlgorithmGetParagraphBoundary(document->_algorithm,
+        offset, GetStringLength(document) - offset, &length, NULL);
+
+    paragraphs[count].offset = offset;
+    paragraphs[count].length = length;
+    paragraphs[count].paragraph = NULL;
+    paragraphs[count].previous = SBInvalidIndex;
+    paragraphs[count].next = SBInvalidIndex;
+
+    document->_count = count + 1;
+    document->_indexedLength = offset + length;
+
+    return SBTrue;
+}
+
+static SBBoolean IndexParagraphsUpTo(SBDocumentRef document, SBUInteger paragraphIndex)
+{
+    while (paragraphIndex >= document->_count) {
+        if (!IndexNextParagraph(document)) {
+            return SBFalse;
+        }
+    }
+
+    return SBTrue;
+}
+
+SBUInteger SBDocumentGetParagraphCount(SBDocumentRef document)
+{
+    while (IndexNextParagraph(document));
+
+    return document->_count;
+}
+
+SBUInteger SBDocumentGetParagraphIndex(SBDocumentRef document, SBUInteger stringOffset)
+{
+    const DocumentParagraph *paragraphs;
+    SBUInteger low = 0;
+    SBUInteger high;
+
+    /* Index the paragraphs only as far as the offset is covered. */
+    while (stringOffset >= document->_indexedLength) {
+        if (!IndexNextParagraph(document)) {
+            return SBInvalidIndex;
+        }
+    }
+
+    paragraphs = document->_paragraphs;
+    high = document->_count;
+
+    while (low < high) {
+        SBUInteger mid = low + (high - low) / 2;
+
+        if (stringOffset < paragraphs[mid].offset) {
+            high = mid;
+        } else if (stringOffset >= paragraphs[mid].offset + paragraphs[mid].length) {
+            low = mid + 1;
+        } else {
+            return mid;
+        }
+    }
+
+    return SBInvalidIndex;
+}
+
+SBBoolean SBDocumentGetParagraphRange(SBDocumentRef document, SBUInteger paragraphIndex,
+    SBUInteger *paragraphOffset, SBUInteger *paragraphLength)
+{
+    const DocumentParagraph *paragraph;
+
+    if (!IndexParagraphsUpTo(document, paragraphIndex)) {
+        return SBFalse;
+    }
+
+    paragraph = &document->_paragraphs[paragraphIndex];
+
+    if (paragraphOffset) {
+        *paragraphOffset = paragraph->offset;
+    }
+    if (paragraphLength) {
+        *paragraphLength = paragraph->length;
+    }
+
+    return SBTrue;
+}
+
+static void DetachParagraph(SBDocumentRef document, SBUInteger paragraphIndex)
+{
+    DocumentParagraph *paragraphs = document->_paragraphs;
+    DocumentParagraph *paragraph = &paragraphs[paragraphIndex];
+
+    if (paragraph->previous != SBInvalidIndex) {
+        paragraphs[paragraph->previous].next = paragraph->next;
+    } else {
+        document->_first = paragraph->next;
+    }
+
+    if (paragraph->next != SBInvalidIndex) {
+        paragraphs[paragraph->next].previous = paragraph->previous;
+    } else {
+        document->_last = paragraph->previous;
+    }
+}
+
+static void AttachParagraph(SBDocumentRef document, SBUInteger paragraphIndex)
+{
+    DocumentParagraph *paragraphs = document->_paragraphs;
+    DocumentParagraph *paragraph = &paragraphs[paragraphIndex];
+
+    paragraph->previous = SBInvalidIndex;
+    paragraph->next = document->_first;
+
+    if (document->_first != SBInvalidIndex) {
+        paragraphs[document->_first].previous = paragraphIndex;
+    } else {
+        document->_last = paragraphIndex;
+    }
+
+    document->_first = paragraphIndex;
+}
+
+static void EvictLastParagraph(SBDocumentRef document)
+{
+    SBUInteger paragraphIndex = document->_last;
+    DocumentParagraph *paragraph = &document->_paragraphs[paragraphIndex];
+
+    DetachParagraph(document, paragraphIndex);
+
+    SBParagraphRelease(paragraph->paragraph);
+    paragraph->paragraph = NULL;
+
+    document->_residentCount -= 1;
+}
+
+SBParagraphRef SBDocumentGetParagraph(SBDocumentRef document, SBUInteger paragraphIndex)
+{
+    DocumentParagraph *paragraph;
+
+    if (!IndexParagraphsUpTo(document, paragraphIndex)) {
+        return NULL;
+    }
+
+    paragraph = &document->_paragraphs[paragraphIndex];
+
+    if (paragraph->paragraph) {
+        /* Move the paragraph to the front as the most recently used one. */
+        DetachParagraph(document, paragraphIndex);
+        AttachParagraph(document, paragraphIndex);
+    } else {
+        SBParagraphRef resolved = SBAlgorithmCreateParagraph(document->_algorithm,
+            paragraph->offset, paragraph->length, document->_baseLevel);
+
+        if (!resolved) {
+            return NULL;
+        }
+
+        if (document->_residentCount == document->_residentCapacity) {
+            EvictLastParagraph(document);
+        }
+
+        paragraph->paragraph = resolved;
+        AttachParagraph(document, paragraphIndex);
+        document->_residentCount += 1;
+    }
+
+    return paragraph->paragraph;
+}
+
+SBUInteger SBDocumentGetResidentCount(SBDocumentRef document)
+{
+    return document->_residentCount;
+}
+
+SBDocumentRef SBDocumentRetain(SBDocumentRef document)
+{
+    if (document) {
+        SBRetainCountIncrement(&document->retainCount);
+    }
+
+    return document;
+}
+
+void SBDocumentRelease(SBDocumentRef document)
+{
+    if (document && SBRetainCountDecrement(&document->retainCount) == 0) {
+        while (document->_residentCount > 0) {
+            EvictLastParagraph(document);
+        }
+
+        SBAlgorithmRelease(document->_algorithm);
+        free(document->_paragraphs);
+        free(document);
+    }
+}
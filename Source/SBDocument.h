@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _SB_INTERNAL_DOCUMENT_H
+#define _SB_INTERNAL_DOCUMENT_H
+
+#include <SBAlgorithm.h>
+#include <SBBase.h>
+#include <SBConfig.h>
+#include <SBDocument.h>
+#include <SBParagraph.h>
+
+typedef struct _DocumentParagraph {
+    SBUInteger offset;
+    SBUInteger length;
+    SBParagraphRef paragraph;
+    SBUInteger previous;
+    SBUInteger next;
+} DocumentParagraph;
+
+typedef struct _SBDocument {
+    SBAlgorithmRef _algorithm;
+    DocumentParagraph *_paragraphs;
+    SBUInteger _capacity;
+    SBUInteger _count;
+    SBUInteger _indexedLength;
+    SBUInteger _first;
+    SBUInteger _last;
+    SBUInteger _residentCapacity;
+    SBUInteger _residentCount;
+    SBLevel _baseLevel;
+    SBUInteger retainCount;
+} SBDocument;
+
+#endif
@@ -0,0 +1,230 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stddef.h>
+#include <stdlib.h>
+
+#include "PropertyLookup.h"
+#include "SBBase.h"
+#include "SBCodepointSequence.h"
+#include "SBLine.h"
+#include "SBScriptLocator.h"
+#include "ScriptStack.h"
+#include "SBItemizer.h"
+
+#define InitialMirrorCapacity   16
+
+SBItemizerRef SBItemizerCreate(void)
+{
+    SBItemizerRef itemizer = malloc(sizeof(SBItemizer));
+
+    if (itemizer) {
+        itemizer->_mirrors = malloc(sizeof(SBMirrorAgent) * InitialMirrorCapacity);
+
+        if (itemizer->_mirrors) {
+            itemizer->_line = NULL;
+            itemizer->_mirrorCapacity = InitialMirrorCapacity;
+            itemizer->retainCount = 1;
+
+            SBItemizerReset(itemizer);
+        } else {
+            free(itemizer);
+            itemizer = NULL;
+        }
+    }
+
+    return itemizer;
+}
+
+void SBItemizerLoadLine(SBItemizerRef itemizer, SBLineRef line, void *stringBuffer)
+{
+    SBLineRelease(itemizer->_line);
+    itemizer->_line = NULL;
+
+    if (line && stringBuffer == SBCodepointSequenceGetSourceBuffer(&line->codepointSequence)) {
+        itemizer->_line = SBLineRetain(line);
+    }
+
+    SBItemizerReset(itemizer);
+}
+
+const SBItemAgent *SBItemizerGetAgent(SBItemizerRef itemizer)
+{
+    return &itemizer->agent;
+}
+
+static SBBoolean AddMirror(SBItemizerRef itemizer,
+    SBUInteger index, SBCodepoint codepoint, SBCodepoint mirror)
+{
+    SBUInteger count = itemizer->agent.mirrorCount;
+    SBMirrorAgent *mirrors = itemizer->_mirrors;
+
+    if (count == itemizer->_mirrorCapacity) {
+        SBUInteger capacity = count * 2;
+
+        mirrors = realloc(mirrors, sizeof(SBMirrorAgent) * capacity);
+        if (!mirrors) {
+            return SBFalse;
+        }
+
+        itemizer->_mirrors = mirrors;
+        itemizer->_mirrorCapacity = capacity;
+    }
+
+    mirrors[count].index = index;
+    mirrors[count].mirror = mirror;
+    mirrors[count].codepoint = codepoint;
+    itemizer->agent.mirrorCount = count + 1;
+
+    return SBTrue;
+}
+
+static const SBRun *LocateRun(SBItemizerRef itemizer, SBUInteger offset)
+{
+    SBLineRef line = itemizer->_line;
+    SBUInteger runIndex = itemizer->_runIndex;
+    const SBRun *run;
+
+    if (runIndex != SBInvalidIndex) {
+        run = &line->fixedRuns[runIndex];
+
+        if (offset >= run->offset && offset < run->offset + run->length) {
+            return run;
+        }
+    }
+
+    /* Look up the run containing the offset with the binary search of the line. */
+    runIndex = SBLineGetRunIndex(line, offset);
+
+    if (runIndex != SBInvalidIndex) {
+        /* Each level run starts a fresh script resolution. */
+        ScriptStackReset(&itemizer->_scriptStack);
+        itemizer->_runIndex = runIndex;
+
+        return &line->fixedRuns[runIndex];
+    }
+
+    return NULL;
+}
+
+static void ResolveItem(SBItemizerRef itemizer, const SBRun *run, SBUInteger offset)
+{
+    const SBCodepointSequence *sequence = &itemizer->_line->codepointSequence;
+    ScriptStackRef stack = &itemizer->_scriptStack;
+    SBUInteger runLimit = run->offset + run->length;
+    SBBoolean isOdd = (run->level & 1);
+    SBScript result = SBScriptZYYY;
+    SBUInteger current = offset;
+    SBUInteger next = offset;
+
+    itemizer->agent.mirrorCount = 0;
+
+    /*
+     * Decode each code point only once and take its script, general category and mirror from a
+     * single lookup.
+     */
+    while (next < runLimit) {
+        SBCodepoint codepoint = SBCodepointSequenceGetCodepointAt(sequence, &next);
+        const PropertyRecord *record = LookupProperties(codepoint);
+        SBCodepoint mirror = 0;
+
+        if (isOdd) {
+            mirror = PropertyRecordGetMirror(record, codepoint);
+
+            /*
+             * End the item early if the mirror could not be saved. It cannot happen for the first
+             * code point as the mirrors always have some initial capacity.
+             */
+            if (mirror && !AddMirror(itemizer, current, codepoint, mirror)) {
+                break;
+            }
+        }
+
+        if (!ResolveCodepointScript(stack, &result, codepoint, record)) {
+            if (mirror) {
+                /* The code point belongs to next item, so discard its mirror. */
+                itemizer->agent.mirrorCount -= 1;
+            }
+            break;
+        }
+
+        current = next;
+    }
+
+    ScriptStackLeavePairs(stack);
+
+    /* Set the item info in agent. */
+    itemizer->agent.offset = offset;
+    itemizer->agent.length = current - offset;
+    itemizer->agent.level = run->level;
+    itemizer->agent.script = result;
+    itemizer->agent.mirrors = (itemizer->agent.mirrorCount ? itemizer->_mirrors : NULL);
+}
+
+SBBoolean SBItemizerMoveNext(SBItemizerRef itemizer)
+{
+    SBLineRef line = itemizer->_line;
+
+    if (line) {
+        SBUInteger offset = itemizer->agent.offset + itemizer->agent.length;
+        const SBRun *run = NULL;
+
+        if (offset < line->offset + line->length) {
+            run = LocateRun(itemizer, offset);
+        }
+
+        if (run) {
+            ResolveItem(itemizer, run, offset);
+            return SBTrue;
+        }
+
+        SBItemizerReset(itemizer);
+    }
+
+    return SBFalse;
+}
+
+void SBItemizerReset(SBItemizerRef itemizer)
+{
+    SBLineRef line = itemizer->_line;
+
+    ScriptStackReset(&itemizer->_scriptStack);
+    itemizer->_runIndex = SBInvalidIndex;
+    itemizer->agent.offset = (line ? line->offset : 0);
+    itemizer->agent.length = 0;
+    itemizer->agent.level = SBLevelInvalid;
+    itemizer->agent.script = SBScriptNil;
+    itemizer->agent.mirrors = NULL;
+    itemizer->agent.mirrorCount = 0;
+}
+
+SBItemizerRef SBItemizerRetain(SBItemizerRef itemizer)
+{
+    if (itemizer) {
+        SBRetainCountIncrement(&itemizer->retainCount);
+    }
+
+    return itemizer;
+}
+
+void SBItemizerRelease(SBItemizerRef itemizer)
+{
+    if (itemizer && SBRetainCountDecrement(&itemizer->retainCount) == 0) {
+        SBLineRelease(itemizer->_line);
+        free(itemizer->_mirrors);
+        free(itemizer);
+    }
+}
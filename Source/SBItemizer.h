@@ -0,0 +1,37 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _SB_INTERNAL_ITEMIZER_H
+#define _SB_INTERNAL_ITEMIZER_H
+
+#include <SBBase.h>
+#include <SBItemizer.h>
+#include <SBLine.h>
+#include <SBMirrorLocator.h>
+
+#include "ScriptStack.h"
+
+typedef struct _SBItemizer {
+    SBLineRef _line;
+    SBMirrorAgent *_mirrors;
+    SBUInteger _mirrorCapacity;
+    SBUInteger _runIndex;
+    ScriptStack _scriptStack;
+    SBItemAgent agent;
+    SBUInteger retainCount;
+} SBItemizer;
+
+#endif
@@ -19,6 +19,7 @@
 #include <stdlib.h>
 
 #include "PairingLookup.h"
+#include "PropertyLookup.h"
 #include "SBAlgorithm.h"
 #include "SBAssert.h"
 #include "SBBase.h"
@@ -92,21 +93,25 @@ static void DisposeLineContext(LineContextRef context)
 
 static SBLineRef AllocateLine(SBUInteger runCount)
 {
-    const SBUInteger sizeLine   = sizeof(SBLine);
-    const SBUInteger sizeRuns   = sizeof(SBRun) * runCount;
-    const SBUInteger sizeMemory = sizeLine + sizeRuns;
+    const SBUInteger sizeLine    = sizeof(SBLine);
+    const SBUInteger sizeRuns    = sizeof(SBRun) * runCount;
+    const SBUInteger sizeIndexes = sizeof(SBUInteger) * runCount;
+    const SBUInteger sizeMemory  = sizeLine + sizeRuns + sizeIndexes;
 
     void *pointer = malloc(sizeMemory);
 
     if (pointer) {
-        const SBUInteger offsetLine = 0;
-        const SBUInteger offsetRuns = offsetLine + sizeLine;
+        const SBUInteger offsetLine    = 0;
+        const SBUInteger offsetRuns    = offsetLine + sizeLine;
+        const SBUInteger offsetIndexes = offsetRuns + sizeRuns;
 
         SBUInt8 *memory = (SBUInt8 *)pointer;
         SBLineRef line = (SBLineRef)(memory + offsetLine);
         SBRun *runs = (SBRun *)(memory + offsetRuns);
+        SBUInteger *indexes = (SBUInteger *)(memory + offsetIndexes);
 
         line->fixedRuns = runs;
+        line->visualIndexes = indexes;
 
         return line;
     }
@@ -205,7 +210,7 @@ static SBUInteger InitializeRuns(SBRun *runs,
     return runCount;
 }
 
-static void ReverseRunSequence(SBRun *runs, SBUInteger runCount)
+static void ReverseRunSequence(SBRun *runs, SBUInteger *indexes, SBUInteger runCount)
 {
     SBUInteger halfCount = runCount / 2;
     SBUInteger finalIndex = runCount - 1;
@@ -213,6 +218,7 @@ static void ReverseRunSequence(SBRun *runs, SBUInteger runCount)
 
     for (index = 0; index < halfCount; index++) {
         SBUInteger tieIndex;
+        SBUInteger tempIndex;
         SBRun tempRun;
 
         tieIndex = finalIndex - index;
@@ -220,10 +226,14 @@ static void ReverseRunSequence(SBRun *runs, SBUInteger runCount)
         tempRun = runs[index];
         runs[index] = runs[tieIndex];
         runs[tieIndex] = tempRun;
+
+        tempIndex = indexes[index];
+        indexes[index] = indexes[tieIndex];
+        indexes[tieIndex] = tempIndex;
     }
 }
 
-static void ReorderRuns(SBRun *runs, SBUInteger runCount, SBLevel maxLevel)
+static void ReorderRuns(SBRun *runs, SBUInteger *indexes, SBUInteger runCount, SBLevel maxLevel)
 {
     SBLevel newLevel;
 
@@ -238,12 +248,49 @@ static void ReorderRuns(SBRun *runs, SBUInteger runCount, SBLevel maxLevel)
                     count += 1;
                 }
 
-                ReverseRunSequence(runs + start, count);
+                ReverseRunSequence(runs + start, indexes + start, count);
             }
         }
     }
 }
 
+static void InitializeVisualIndexes(SBRun *runs, SBUInteger *indexes, SBUInteger runCount, SBLevel maxLevel)
+{
+    SBUInteger index;
+
+    /* Reorder the logical indexes of runs along with them. */
+    for (index = 0; index < runCount; index++) {
+        indexes[index] = index;
+    }
+
+    ReorderRuns(runs, indexes, runCount, maxLevel);
+
+    /*
+     * Invert the indexes in place by following each cycle of the permutation, so that they map
+     * the logical position of a run to its visual one. The processed entries are marked by adding
+     * the run count to them.
+     */
+    for (index = 0; index < runCount; index++) {
+        if (indexes[index] < runCount) {
+            SBUInteger current = index;
+            SBUInteger next = indexes[index];
+
+            while (next != index) {
+                SBUInteger following = indexes[next];
+                indexes[next] = current + runCount;
+                current = next;
+                next = following;
+            }
+
+            indexes[index] = current + runCount;
+        }
+    }
+
+    for (index = 0; index < runCount; index++) {
+        indexes[index] -= runCount;
+    }
+}
+
 SB_INTERNAL SBLineRef SBLineCreate(SBParagraphRef paragraph,
     SBUInteger lineOffset, SBUInteger lineLength)
 {
@@ -267,7 +314,7 @@ SB_INTERNAL SBLineRef SBLineCreate(SBParagraphRef paragraph,
 
         if (line) {
             line->runCount = InitializeRuns(line->fixedRuns, context->fixedLevels, lineLength, lineOffset);
-            ReorderRuns(line->fixedRuns, line->runCount, context->maxLevel);
+            InitializeVisualIndexes(line->fixedRuns, line->visualIndexes, line->runCount, context->maxLevel);
 
             line->codepointSequence = paragraph->algorithm->codepointSequence;
             line->offset = lineOffset;
@@ -283,6 +330,33 @@ SB_INTERNAL SBLineRef SBLineCreate(SBParagraphRef paragraph,
     return NULL;
 }
 
+SB_INTERNAL SBUInteger SBLineGetScratchSize(SBUInteger lineLength)
+{
+    return (sizeof(SBUInteger) + sizeof(SBLevel)) * lineLength;
+}
+
+SB_INTERNAL SBUInteger SBLineResolveRuns(const SBBidiType *types, const SBLevel *levels,
+    SBUInteger lineOffset, SBUInteger lineLength, SBLevel baseLevel, void *scratch, SBRun *runs)
+{
+    const SBUInteger sizeIndexes = sizeof(SBUInteger) * lineLength;
+
+    SBUInt8 *memory = (SBUInt8 *)scratch;
+    SBUInteger *indexes = (SBUInteger *)memory;
+    LineContext context;
+    SBUInteger runCount;
+
+    context.refTypes = types;
+    context.fixedLevels = (SBLevel *)(memory + sizeIndexes);
+    context.maxLevel = CopyLevels(context.fixedLevels, levels, lineLength, &context.runCount);
+
+    ResetLevels(&context, baseLevel, lineLength);
+
+    runCount = InitializeRuns(runs, context.fixedLevels, lineLength, lineOffset);
+    InitializeVisualIndexes(runs, indexes, runCount, context.maxLevel);
+
+    return runCount;
+}
+
 SBUInteger SBLineGetOffset(SBLineRef line)
 {
     return line->offset;
@@ -303,10 +377,274 @@ const SBRun *SBLineGetRunsPtr(SBLineRef line)
     return line->fixedRuns;
 }
 
+static SBUInteger LocateRunIndex(SBLineRef line, SBUInteger stringIndex)
+{
+    SBUInteger low = 0;
+    SBUInteger high = line->runCount;
+
+    if (stringIndex < line->offset || stringIndex >= line->offset + line->length) {
+        return SBInvalidIndex;
+    }
+
+    /* Binary search the logical runs for the one containing the string index. */
+    while (low + 1 < high) {
+        SBUInteger middle = low + (high - low) / 2;
+        const SBRun *run = &line->fixedRuns[line->visualIndexes[middle]];
+
+        if (stringIndex < run->offset) {
+            high = middle;
+        } else {
+            low = middle;
+        }
+    }
+
+    return line->visualIndexes[low];
+}
+
+SBUInteger SBLineGetRunIndex(SBLineRef line, SBUInteger stringIndex)
+{
+    return LocateRunIndex(line, stringIndex);
+}
+
+static SBUInteger GetLastCodepointIndex(SBLineRef line, const SBRun *run)
+{
+    SBUInteger stringIndex = run->offset + run->length;
+    SBCodepointSequenceGetCodepointBefore(&line->codepointSequence, &stringIndex);
+
+    /* Do not cross the start of run in case of an unpaired trail. */
+    if (stringIndex < run->offset) {
+        stringIndex = run->offset;
+    }
+
+    return stringIndex;
+}
+
+static SBUInteger GetLeftmostIndex(SBLineRef line, SBUInteger runIndex)
+{
+    const SBRun *run = &line->fixedRuns[runIndex];
+    return (run->level & 1 ? GetLastCodepointIndex(line, run) : run->offset);
+}
+
+static SBUInteger GetRightmostIndex(SBLineRef line, SBUInteger runIndex)
+{
+    const SBRun *run = &line->fixedRuns[runIndex];
+    return (run->level & 1 ? run->offset : GetLastCodepointIndex(line, run));
+}
+
+static SBUInteger GetNextIndex(SBLineRef line, const SBRun *run, SBUInteger stringIndex)
+{
+    SBCodepointSequenceGetCodepointAt(&line->codepointSequence, &stringIndex);
+
+    if (stringIndex < run->offset + run->length) {
+        return stringIndex;
+    }
+
+    return SBInvalidIndex;
+}
+
+static SBUInteger GetPreviousIndex(SBLineRef line, const SBRun *run, SBUInteger stringIndex)
+{
+    if (stringIndex > run->offset) {
+        SBCodepointSequenceGetCodepointBefore(&line->codepointSequence, &stringIndex);
+        return (stringIndex < run->offset ? run->offset : stringIndex);
+    }
+
+    return SBInvalidIndex;
+}
+
+SBUInteger SBLineGetLeftIndex(SBLineRef line, SBUInteger stringIndex)
+{
+    SBUInteger runIndex = LocateRunIndex(line, stringIndex);
+
+    if (runIndex != SBInvalidIndex) {
+        const SBRun *run = &line->fixedRuns[runIndex];
+        SBUInteger leftIndex;
+
+        if (run->level & 1) {
+            leftIndex = GetNextIndex(line, run, stringIndex);
+        } else {
+            leftIndex = GetPreviousIndex(line, run, stringIndex);
+        }
+
+        /* Move to the rightmost code point of previous visual run at the edge. */
+        if (leftIndex == SBInvalidIndex && runIndex > 0) {
+            leftIndex = GetRightmostIndex(line, runIndex - 1);
+        }
+
+        return leftIndex;
+    }
+
+    return SBInvalidIndex;
+}
+
+SBUInteger SBLineGetRightIndex(SBLineRef line, SBUInteger stringIndex)
+{
+    SBUInteger runIndex = LocateRunIndex(line, stringIndex);
+
+    if (runIndex != SBInvalidIndex) {
+        const SBRun *run = &line->fixedRuns[runIndex];
+        SBUInteger rightIndex;
+
+        if (run->level & 1) {
+            rightIndex = GetPreviousIndex(line, run, stringIndex);
+        } else {
+            rightIndex = GetNextIndex(line, run, stringIndex);
+        }
+
+        /* Move to the leftmost code point of next visual run at the edge. */
+        if (rightIndex == SBInvalidIndex && runIndex + 1 < line->runCount) {
+            rightIndex = GetLeftmostIndex(line, runIndex + 1);
+        }
+
+        return rightIndex;
+    }
+
+    return SBInvalidIndex;
+}
+
+SBUInteger SBLineGetSelectionRuns(SBLineRef line,
+    SBUInteger selectionOffset, SBUInteger selectionLength, SBRun *runs)
+{
+    SBUInteger selectionLimit = selectionOffset + selectionLength;
+    SBUInteger runCount = 0;
+    SBUInteger runIndex;
+
+    /* Clip the selection to the line. */
+    if (selectionOffset < line->offset) {
+        selectionOffset = line->offset;
+    }
+    if (selectionLimit > line->offset + line->length) {
+        selectionLimit = line->offset + line->length;
+    }
+    if (selectionOffset >= selectionLimit) {
+        return 0;
+    }
+
+    /* Clip the runs in visual order, as the selected ones need not be visually contiguous. */
+    for (runIndex = 0; runIndex < line->runCount; runIndex++) {
+        const SBRun *run = &line->fixedRuns[runIndex];
+        SBUInteger runOffset = run->offset;
+        SBUInteger runLimit = run->offset + run->length;
+
+        if (runOffset < selectionOffset) {
+            runOffset = selectionOffset;
+        }
+        if (runLimit > selectionLimit) {
+            runLimit = selectionLimit;
+        }
+
+        if (runOffset < runLimit) {
+            runs[runCount].offset = runOffset;
+            runs[runCount].length = runLimit - runOffset;
+            runs[runCount].level = run->level;
+
+            runCount += 1;
+        }
+    }
+
+    return runCount;
+}
+
+void SBLineCopyMirroredString(SBLineRef line, void *buffer)
+{
+    const SBCodepointSequence *sequence = &line->codepointSequence;
+    SBUInteger runIndex;
+
+    SBCodepointSequenceCopyUnits(sequence, line->offset, line->length, buffer);
+
+    for (runIndex = 0; runIndex < line->runCount; runIndex++) {
+        const SBRun *run = &line->fixedRuns[runIndex];
+
+        if (run->level & 1) {
+            SBUInteger stringIndex = run->offset;
+            SBUInteger stringLimit = run->offset + run->length;
+
+            while (stringIndex < stringLimit) {
+                SBUInteger initialIndex = stringIndex;
+                SBCodepoint codepoint = SBCodepointSequenceGetCodepointAt(sequence, &stringIndex);
+                SBCodepoint mirror = LookupMirror(codepoint);
+
+                /*
+                 * A mirror always takes as many code units as the original code point, so it can
+                 * be written in place.
+                 */
+                if (mirror) {
+                    SBCodepointSequencePutCodepoint(sequence, buffer, initialIndex - line->offset, mirror);
+                }
+            }
+        }
+    }
+}
+
+static void WriteReversedCluster(const SBCodepointSequence *sequence, const SBRun *run,
+    SBUInt8 *destination, SBUInteger clusterStart, SBUInteger clusterEnd, SBCodepoint mirror)
+{
+    SBUInteger unitSize = SBCodepointSequenceGetUnitSize(sequence);
+    SBUInteger clusterIndex = run->offset + run->length - clusterEnd;
+
+    SBCodepointSequenceCopyUnits(sequence, clusterStart, clusterEnd - clusterStart,
+                                 destination + (clusterIndex * unitSize));
+
+    /* The mirror of base takes as many code units as the base itself. */
+    if (mirror) {
+        SBCodepointSequencePutCodepoint(sequence, destination, clusterIndex, mirror);
+    }
+}
+
+static void CopyReversedRun(const SBCodepointSequence *sequence, const SBRun *run, SBUInt8 *destination)
+{
+    SBUInteger stringIndex = run->offset;
+    SBUInteger stringLimit = run->offset + run->length;
+    SBUInteger clusterStart = stringIndex;
+    SBCodepoint mirror = 0;
+
+    /*
+     * Walk the run in logical order and place each base along with its following combining marks
+     * at the mirrored position, so that the marks keep following their base after reversal.
+     */
+    while (stringIndex < stringLimit) {
+        SBUInteger initialIndex = stringIndex;
+        SBCodepoint codepoint = SBCodepointSequenceGetCodepointAt(sequence, &stringIndex);
+        const PropertyRecord *record = LookupProperties(codepoint);
+
+        if (initialIndex != clusterStart && !SBGeneralCategoryIsMark(record->generalCategory)) {
+            WriteReversedCluster(sequence, run, destination, clusterStart, initialIndex, mirror);
+            clusterStart = initialIndex;
+        }
+
+        if (initialIndex == clusterStart) {
+            mirror = PropertyRecordGetMirror(record, codepoint);
+        }
+    }
+
+    WriteReversedCluster(sequence, run, destination, clusterStart, stringLimit, mirror);
+}
+
+void SBLineCopyVisualString(SBLineRef line, void *buffer)
+{
+    const SBCodepointSequence *sequence = &line->codepointSequence;
+    SBUInteger unitSize = SBCodepointSequenceGetUnitSize(sequence);
+    SBUInt8 *destination = buffer;
+    SBUInteger runIndex;
+
+    /* The runs are already in visual order. */
+    for (runIndex = 0; runIndex < line->runCount; runIndex++) {
+        const SBRun *run = &line->fixedRuns[runIndex];
+
+        if (run->level & 1) {
+            CopyReversedRun(sequence, run, destination);
+        } else {
+            SBCodepointSequenceCopyUnits(sequence, run->offset, run->length, destination);
+        }
+
+        destination += run->length * unitSize;
+    }
+}
+
 SBLineRef SBLineRetain(SBLineRef line)
 {
     if (line) {
-        line->retainCount += 1;
+        SBRetainCountIncrement(&line->retainCount);
     }
     
     return line;
@@ -314,7 +652,7 @@ SBLineRef SBLineRetain(SBLineRef line)
 
 void SBLineRelease(SBLineRef line)
 {
-    if (line && --line->retainCount == 0) {
+    if (line && SBRetainCountDecrement(&line->retainCount) == 0) {
         free(line);
     }
 }
@@ -27,6 +27,7 @@
 typedef struct _SBLine {
     SBCodepointSequence codepointSequence;
     SBRun *fixedRuns;
+    SBUInteger *visualIndexes;
     SBUInteger runCount;
     SBUInteger offset;
     SBUInteger length;
@@ -36,4 +37,9 @@ typedef struct _SBLine {
 SB_INTERNAL SBLineRef SBLineCreate(SBParagraphRef paragraph,
     SBUInteger lineOffset, SBUInteger lineLength);
 
+SB_INTERNAL SBUInteger SBLineGetScratchSize(SBUInteger lineLength);
+
+SB_INTERNAL SBUInteger SBLineResolveRuns(const SBBidiType *types, const SBLevel *levels,
+    SBUInteger lineOffset, SBUInteger lineLength, SBLevel baseLevel, void *scratch, SBRun *runs);
+
 #endif
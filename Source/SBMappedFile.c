@@ -0,0 +1,234 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <SBConfig.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#if defined(SB_CONFIG_MAPPED_FILE) && !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "SBBase.h"
+#include "SBCodepointSequence.h"
+#include "SBMappedFile.h"
+
+#if !defined(SB_CONFIG_MAPPED_FILE)
+
+/* Files cannot be mapped, so creating a mapped file always fails. */
+
+static SBBoolean MapFile(SBMappedFileRef file, const char *filePath)
+{
+    return SBFalse;
+}
+
+static void UnmapFile(SBMappedFileRef file)
+{
+}
+
+#elif defined(_WIN32)
+
+static SBBoolean MapFile(SBMappedFileRef file, const char *filePath)
+{
+    LARGE_INTEGER fileSize;
+
+    file->_file = CreateFileA(filePath, GENERIC_READ, FILE_SHARE_READ, NULL,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    file->_mapping = NULL;
+    file->_data = NULL;
+    file->_size = 0;
+
+    if (file->_file == INVALID_HANDLE_VALUE) {
+        return SBFalse;
+    }
+
+    if (GetFileSizeEx(file->_file, &fileSize) && (ULONGLONG)fileSize.QuadPart <= (SBUInteger)-1) {
+        file->_size = (SBUInteger)fileSize.QuadPart;
+
+        /* An empty file cannot be mapped, so leave the data empty. */
+        if (file->_size == 0) {
+            return SBTrue;
+        }
+
+        file->_mapping = CreateFileMappingA(file->_file, NULL, PAGE_READONLY, 0, 0, NULL);
+
+        if (file->_mapping) {
+            file->_data = MapViewOfFile(file->_mapping, FILE_MAP_READ, 0, 0, 0);
+
+            if (file->_data) {
+                return SBTrue;
+            }
+
+            CloseHandle(file->_mapping);
+        }
+    }
+
+    CloseHandle(file->_file);
+
+    return SBFalse;
+}
+
+static void UnmapFile(SBMappedFileRef file)
+{
+    if (file->_data) {
+        UnmapViewOfFile(file->_data);
+        CloseHandle(file->_mapping);
+    }
+
+    CloseHandle(file->_file);
+}
+
+#else
+
+static SBBoolean MapFile(SBMappedFileRef file, const char *filePath)
+{
+    SBBoolean isMapped = SBFalse;
+    struct stat status;
+    int descriptor;
+
+    file->_data = NULL;
+    file->_size = 0;
+
+    descriptor = open(filePath, O_RDONLY);
+    if (descriptor == -1) {
+        return SBFalse;
+    }
+
+    if (fstat(descriptor, &status) == 0 && (off_t)(SBUInteger)status.st_size == status.st_size) {
+        file->_size = (SBUInteger)status.st_size;
+
+        if (file->_size == 0) {
+            /* An empty file cannot be mapped, so leave the data empty. */
+            isMapped = SBTrue;
+        } else {
+            void *data = mmap(NULL, file->_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+
+            if (data != MAP_FAILED) {
+                file->_data = data;
+                isMapped = SBTrue;
+            }
+        }
+    }
+
+    /* The mapping stays valid after closing the descriptor. */
+    close(descriptor);
+
+    return isMapped;
+}
+
+static void UnmapFile(SBMappedFileRef file)
+{
+    if (file->_data) {
+        munmap(file->_data, file->_size);
+    }
+}
+
+#endif
+
+static SBUInteger GetByteOrderMarkSize(const SBUInt8 *data, SBUInteger size, SBStringEncoding encoding)
+{
+    switch (encoding) {
+    case SBStringEncodingUTF8:
+        if (size >= 3 && data[0] == 0xEF && data[1] == 0xBB && data[2] == 0xBF) {
+            return 3;
+        }
+        break;
+
+    case SBStringEncodingUTF16:
+        if (size >= 2 && *(const SBUInt16 *)data == 0xFEFF) {
+            return 2;
+        }
+        break;
+
+    case SBStringEncodingUTF32:
+        if (size >= 4 && *(const SBUInt32 *)data == 0xFEFF) {
+            return 4;
+        }
+        break;
+
+    case SBStringEncodingUTF16Swapped:
+        if (size >= 2 && *(const SBUInt16 *)data == 0xFFFE) {
+            return 2;
+        }
+        break;
+
+    case SBStringEncodingUTF32Swapped:
+        if (size >= 4 && *(const SBUInt32 *)data == 0xFFFE0000) {
+            return 4;
+        }
+        break;
+    }
+
+    return 0;
+}
+
+SBMappedFileRef SBMappedFileCreate(const char *filePath, SBStringEncoding stringEncoding)
+{
+    SBMappedFileRef file = malloc(sizeof(SBMappedFile));
+
+    if (file) {
+        SBCodepointSequence *sequence = &file->codepointSequence;
+        SBUInteger unitSize;
+
+        sequence->stringEncoding = stringEncoding;
+        unitSize = SBCodepointSequenceGetUnitSize(sequence);
+
+        if (unitSize && !SBCodepointSequenceIsChunked(sequence) && MapFile(file, filePath)) {
+            if (file->_size % unitSize == 0) {
+                SBUInt8 *data = (SBUInt8 *)file->_data;
+                SBUInteger bomSize = GetByteOrderMarkSize(data, file->_size, stringEncoding);
+
+                sequence->stringBuffer = (data ? data + bomSize : NULL);
+                sequence->stringLength = (file->_size - bomSize) / unitSize;
+                file->retainCount = 1;
+
+                return file;
+            }
+
+            UnmapFile(file);
+        }
+
+        free(file);
+    }
+
+    return NULL;
+}
+
+void SBMappedFileGetCodepointSequence(SBMappedFileRef file, SBCodepointSequence *codepointSequence)
+{
+    *codepointSequence = file->codepointSequence;
+}
+
+SBMappedFileRef SBMappedFileRetain(SBMappedFileRef file)
+{
+    if (file) {
+        SBRetainCountIncrement(&file->retainCount);
+    }
+
+    return file;
+}
+
+void SBMappedFileRelease(SBMappedFileRef file)
+{
+    if (file && SBRetainCountDecrement(&file->retainCount) == 0) {
+        UnmapFile(file);
+        free(file);
+    }
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _SB_INTERNAL_MAPPED_FILE_H
+#define _SB_INTERNAL_MAPPED_FILE_H
+
+#include <SBBase.h>
+#include <SBCodepointSequence.h>
+#include <SBConfig.h>
+#include <SBMappedFile.h>
+
+#if defined(SB_CONFIG_MAPPED_FILE) && defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#endif
+
+typedef struct _SBMappedFile {
+#if defined(SB_CONFIG_MAPPED_FILE) && defined(_WIN32)
+    HANDLE _file;
+    HANDLE _mapping;
+#endif
+    void *_data;
+    SBUInteger _size;
+    SBCodepointSequence codepointSequence;
+    SBUInteger retainCount;
+} SBMappedFile;
+
+#endif
@@ -19,6 +19,7 @@
 
 #include "PairingLookup.h"
 #include "SBBase.h"
+#include "SBCodepointSequence.h"
 #include "SBLine.h"
 #include "SBMirrorLocator.h"
 
@@ -39,8 +40,9 @@ SBMirrorLocatorRef SBMirrorLocatorCreate(void)
 void SBMirrorLocatorLoadLine(SBMirrorLocatorRef locator, SBLineRef line, void *stringBuffer)
 {
     SBLineRelease(locator->_line);
+    locator->_line = NULL;
 
-    if (line && stringBuffer == line->codepointSequence.stringBuffer) {
+    if (line && stringBuffer == SBCodepointSequenceGetSourceBuffer(&line->codepointSequence)) {
         locator->_line = SBLineRetain(line);
     }
 
@@ -52,51 +54,81 @@ const SBMirrorAgent *SBMirrorLocatorGetAgent(SBMirrorLocatorRef locator)
     return &locator->agent;
 }
 
-SBBoolean SBMirrorLocatorMoveNext(SBMirrorLocatorRef locator)
+static SBBoolean LocateNextMirror(SBMirrorLocatorRef locator, SBMirrorAgent *agent)
 {
     SBLineRef line = locator->_line;
+    const SBCodepointSequence *sequence = &line->codepointSequence;
 
-    if (line) {
-        const SBCodepointSequence *sequence = &line->codepointSequence;
-
-        do {
-            const SBRun *run = &line->fixedRuns[locator->_runIndex];
+    while (locator->_runIndex < line->runCount) {
+        const SBRun *run = &line->fixedRuns[locator->_runIndex];
 
-            if (run->level & 1) {
-                SBUInteger stringIndex;
-                SBUInteger stringLimit;
+        if (run->level & 1) {
+            SBUInteger stringIndex;
+            SBUInteger stringLimit;
 
-                stringIndex = locator->_stringIndex;
-                if (stringIndex == SBInvalidIndex) {
-                    stringIndex = run->offset;
-                }
-                stringLimit = run->offset + run->length;
+            stringIndex = locator->_stringIndex;
+            if (stringIndex == SBInvalidIndex) {
+                stringIndex = run->offset;
+            }
+            stringLimit = run->offset + run->length;
 
-                while (stringIndex < stringLimit) {
-                    SBUInteger initialIndex = stringIndex;
-                    SBCodepoint codepoint = SBCodepointSequenceGetCodepointAt(sequence, &stringIndex);
-                    SBCodepoint mirror = LookupMirror(codepoint);
+            while (stringIndex < stringLimit) {
+                SBUInteger initialIndex = stringIndex;
+                SBCodepoint codepoint = SBCodepointSequenceGetCodepointAt(sequence, &stringIndex);
+                SBCodepoint mirror = LookupMirror(codepoint);
 
-                    if (mirror) {
-                        locator->_stringIndex = stringIndex;
-                        locator->agent.index = initialIndex;
-                        locator->agent.mirror = mirror;
-                        locator->agent.codepoint = codepoint;
+                if (mirror) {
+                    locator->_stringIndex = stringIndex;
+                    agent->index = initialIndex;
+                    agent->mirror = mirror;
+                    agent->codepoint = codepoint;
 
-                        return SBTrue;
-                    }
+                    return SBTrue;
                 }
             }
-            
-            locator->_stringIndex = SBInvalidIndex;
-        } while (++locator->_runIndex < line->runCount);
-        
+        }
+
+        locator->_stringIndex = SBInvalidIndex;
+        locator->_runIndex += 1;
+    }
+
+    return SBFalse;
+}
+
+SBBoolean SBMirrorLocatorMoveNext(SBMirrorLocatorRef locator)
+{
+    if (locator->_line) {
+        if (LocateNextMirror(locator, &locator->agent)) {
+            return SBTrue;
+        }
+
         SBMirrorLocatorReset(locator);
     }
     
     return SBFalse;
 }
 
+SBUInteger SBMirrorLocatorCopyMirrors(SBMirrorLocatorRef locator, SBMirrorAgent *mirrors, SBUInteger capacity)
+{
+    SBUInteger count = 0;
+
+    if (locator->_line) {
+        /* Locate the mirrors directly into the output array. */
+        while (count < capacity && LocateNextMirror(locator, &mirrors[count])) {
+            count += 1;
+        }
+    }
+
+    if (count) {
+        /* Keep the last copied mirror in the agent so that the locator can be resumed. */
+        locator->agent = mirrors[count - 1];
+    } else {
+        SBMirrorLocatorReset(locator);
+    }
+
+    return count;
+}
+
 void SBMirrorLocatorReset(SBMirrorLocatorRef locator)
 {
     locator->_runIndex = 0;
@@ -108,7 +140,7 @@ void SBMirrorLocatorReset(SBMirrorLocatorRef locator)
 SBMirrorLocatorRef SBMirrorLocatorRetain(SBMirrorLocatorRef locator)
 {
     if (locator) {
-        locator->retainCount += 1;
+        SBRetainCountIncrement(&locator->retainCount);
     }
 
     return locator;
@@ -116,7 +148,7 @@ SBMirrorLocatorRef SBMirrorLocatorRetain(SBMirrorLocatorRef locator)
 
 void SBMirrorLocatorRelease(SBMirrorLocatorRef locator)
 {
-    if (locator && --locator->retainCount == 0) {
+    if (locator && SBRetainCountDecrement(&locator->retainCount) == 0) {
         SBLineRelease(locator->_line);
         free(locator);
     }
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <SBConfig.h>
+
+#include "SBBase.h"
+#include "SBMutex.h"
+
+#ifdef SB_CONFIG_THREADS
+
+SB_INTERNAL SBBoolean SBMutexInitialize(SBMutex *mutex)
+{
+#ifdef _WIN32
+    InitializeCriticalSection(mutex);
+    return SBTrue;
+#else
+    return (pthread_mutex_init(mutex, NULL) == 0);
+#endif
+}
+
+SB_INTERNAL void SBMutexFinalize(SBMutex *mutex)
+{
+#ifdef _WIN32
+    DeleteCriticalSection(mutex);
+#else
+    pthread_mutex_destroy(mutex);
+#endif
+}
+
+SB_INTERNAL void SBMutexLock(SBMutex *mutex)
+{
+#ifdef _WIN32
+    EnterCriticalSection(mutex);
+#else
+    pthread_mutex_lock(mutex);
+#endif
+}
+
+SB_INTERNAL void SBMutexUnlock(SBMutex *mutex)
+{
+#ifdef _WIN32
+    LeaveCriticalSection(mutex);
+#else
+    pthread_mutex_unlock(mutex);
+#endif
+}
+
+#else
+
+/* There is a single thread, so the mutex does nothing. */
+
+SB_INTERNAL SBBoolean SBMutexInitialize(SBMutex *mutex)
+{
+    *mutex = 0;
+    return SBTrue;
+}
+
+SB_INTERNAL void SBMutexFinalize(SBMutex *mutex)
+{
+}
+
+SB_INTERNAL void SBMutexLock(SBMutex *mutex)
+{
+}
+
+SB_INTERNAL void SBMutexUnlock(SBMutex *mutex)
+{
+}
+
+#endif
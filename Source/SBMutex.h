@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _SB_INTERNAL_MUTEX_H
+#define _SB_INTERNAL_MUTEX_H
+
+#include <SBBase.h>
+#include <SBConfig.h>
+
+#if !defined(SB_CONFIG_THREADS)
+typedef SBUInt8 SBMutex;
+#elif defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+typedef CRITICAL_SECTION SBMutex;
+#else
+#include <pthread.h>
+typedef pthread_mutex_t SBMutex;
+#endif
+
+SB_INTERNAL SBBoolean SBMutexInitialize(SBMutex *mutex);
+SB_INTERNAL void SBMutexFinalize(SBMutex *mutex);
+
+SB_INTERNAL void SBMutexLock(SBMutex *mutex);
+SB_INTERNAL void SBMutexUnlock(SBMutex *mutex);
+
+#endif
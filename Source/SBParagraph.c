@@ -42,43 +42,61 @@ typedef struct _ParagraphContext {
 static void PopulateBidiChain(BidiChainRef chain, const SBBidiType *types, SBUInteger length);
 static SBBoolean ProcessRun(ParagraphContextRef context, const LevelRunRef levelRun, SBBoolean forceFinish);
 
-static ParagraphContextRef CreateParagraphContext(const SBBidiType *types, SBLevel *levels, SBUInteger length)
+static SBUInteger GetParagraphContextSize(SBUInteger length)
 {
     const SBUInteger sizeContext = sizeof(ParagraphContext);
     const SBUInteger sizeLinks   = sizeof(BidiLink) * (length + 2);
     const SBUInteger sizeTypes   = sizeof(SBBidiType) * (length + 2);
-    const SBUInteger sizeMemory  = sizeContext + sizeLinks + sizeTypes;
 
-    void *pointer = malloc(sizeMemory);
+    return (sizeContext + sizeLinks + sizeTypes);
+}
 
-    if (pointer) {
-        const SBUInteger offsetContext = 0;
-        const SBUInteger offsetLinks   = offsetContext + sizeContext;
-        const SBUInteger offsetTypes   = offsetLinks + sizeLinks;
+static ParagraphContextRef InitializeParagraphContext(void *pointer,
+    const SBBidiType *types, SBLevel *levels, SBUInteger length)
+{
+    const SBUInteger sizeContext = sizeof(ParagraphContext);
+    const SBUInteger sizeLinks   = sizeof(BidiLink) * (length + 2);
 
-        SBUInt8 *memory = (SBUInt8 *)pointer;
-        ParagraphContextRef context = (ParagraphContextRef)(memory + offsetContext);
-        BidiLink *fixedLinks = (BidiLink *)(memory + offsetLinks);
-        SBBidiType *fixedTypes = (SBBidiType *)(memory + offsetTypes);
+    const SBUInteger offsetContext = 0;
+    const SBUInteger offsetLinks   = offsetContext + sizeContext;
+    const SBUInteger offsetTypes   = offsetLinks + sizeLinks;
 
-        BidiChainInitialize(&context->bidiChain, fixedTypes, levels, fixedLinks);
-        StatusStackInitialize(&context->statusStack);
-        RunQueueInitialize(&context->runQueue);
-        IsolatingRunInitialize(&context->isolatingRun);
+    SBUInt8 *memory = (SBUInt8 *)pointer;
+    ParagraphContextRef context = (ParagraphContextRef)(memory + offsetContext);
+    BidiLink *fixedLinks = (BidiLink *)(memory + offsetLinks);
+    SBBidiType *fixedTypes = (SBBidiType *)(memory + offsetTypes);
 
-        PopulateBidiChain(&context->bidiChain, types, length);
+    BidiChainInitialize(&context->bidiChain, fixedTypes, levels, fixedLinks);
+    StatusStackInitialize(&context->statusStack);
+    RunQueueInitialize(&context->runQueue);
+    IsolatingRunInitialize(&context->isolatingRun);
 
-        return context;
-    }
+    PopulateBidiChain(&context->bidiChain, types, length);
 
-    return NULL;
+    return context;
 }
 
-static void DisposeParagraphContext(ParagraphContextRef context)
+static void FinalizeParagraphContext(ParagraphContextRef context)
 {
     StatusStackFinalize(&context->statusStack);
     RunQueueFinalize(&context->runQueue);
     IsolatingRunFinalize(&context->isolatingRun);
+}
+
+static ParagraphContextRef CreateParagraphContext(const SBBidiType *types, SBLevel *levels, SBUInteger length)
+{
+    void *pointer = malloc(GetParagraphContextSize(length));
+
+    if (pointer) {
+        return InitializeParagraphContext(pointer, types, levels, length);
+    }
+
+    return NULL;
+}
+
+static void DisposeParagraphContext(ParagraphContextRef context)
+{
+    FinalizeParagraphContext(context);
     free(context);
 }
 
@@ -138,6 +156,9 @@ static void PopulateBidiChain(BidiChainRef chain, const SBBidiType *types, SBUIn
         SBBidiType priorType = type;
         type = types[index];
 
+        /* Keep the types of in between code units as they are checked while testing single links. */
+        BidiChainSetType(chain, index + 1, type);
+
         switch (type) {
         case SBBidiTypeB:
         case SBBidiTypeON:
@@ -263,6 +284,7 @@ static SBBoolean DetermineLevels(ParagraphContextRef context, SBLevel baseLevel)
     BidiLink lastLink;
 
     SBLevel priorLevel;
+    SBUInt32 typeMask;
     SBBidiType sor;
     SBBidiType eor;
 
@@ -275,6 +297,7 @@ static SBBoolean DetermineLevels(ParagraphContextRef context, SBLevel baseLevel)
     lastLink = BidiLinkNone;
 
     priorLevel = baseLevel;
+    typeMask = 0;
     sor = SBBidiTypeNil;
 
     /* Rule X1 */
@@ -496,7 +519,7 @@ static SBBoolean DetermineLevels(ParagraphContextRef context, SBLevel baseLevel)
              */
             eor = SBLevelAsNormalBidiType(SBNumberGetMax(priorLevel, currentLevel));
 
-            LevelRunInitialize(&levelRun, chain, firstLink, lastLink, sor, eor);
+            LevelRunInitialize(&levelRun, chain, firstLink, lastLink, typeMask, sor, eor);
 
             if (!ProcessRun(context, &levelRun, forceFinish)) {
                 return SBFalse;
@@ -506,10 +529,13 @@ static SBBoolean DetermineLevels(ParagraphContextRef context, SBLevel baseLevel)
             sor = eor;
             /* The next run (if any) will start from this index. */
             firstLink = link;
+            typeMask = 0;
 
             priorLevel = currentLevel;
         }
 
+        /* Record the type of this link for the run it belongs to. */
+        typeMask |= SBBidiTypeMask(BidiChainGetType(chain, link));
         priorLink = link;
     }
 
@@ -565,41 +591,52 @@ static void SaveLevels(BidiChainRef chain, SBLevel *levels, SBLevel baseLevel)
     }
 }
 
+static SBBoolean ResolveLevels(ParagraphContextRef context, SBAlgorithmRef algorithm,
+    SBUInteger offset, SBLevel *levels, SBLevel *baseLevel)
+{
+    SBLevel resolvedLevel = DetermineParagraphLevel(&context->bidiChain, *baseLevel);
+
+    SB_LOG_BLOCK_OPENER("Determined Paragraph Level");
+    SB_LOG_STATEMENT("Base Level", 1, SB_LOG_LEVEL(resolvedLevel));
+    SB_LOG_BLOCK_CLOSER();
+
+    context->isolatingRun.codepointSequence = &algorithm->codepointSequence;
+    context->isolatingRun.bidiTypes = algorithm->fixedTypes + offset;
+    context->isolatingRun.bidiChain = &context->bidiChain;
+    context->isolatingRun.paragraphOffset = offset;
+    context->isolatingRun.paragraphLevel = resolvedLevel;
+
+    if (DetermineLevels(context, resolvedLevel)) {
+        SaveLevels(&context->bidiChain, levels, resolvedLevel);
+
+        SB_LOG_BLOCK_OPENER("Determined Embedding Levels");
+        SB_LOG_STATEMENT("Levels", 1, SB_LOG_LEVELS_ARRAY(levels, length));
+        SB_LOG_BLOCK_CLOSER();
+
+        *baseLevel = resolvedLevel;
+
+        return SBTrue;
+    }
+
+    return SBFalse;
+}
+
 static SBBoolean ResolveParagraph(SBParagraphRef paragraph,
     SBAlgorithmRef algorithm, SBUInteger offset, SBUInteger length, SBLevel baseLevel)
 {
     const SBBidiType *bidiTypes = algorithm->fixedTypes + offset;
     SBBoolean isSucceeded = SBFalse;
     ParagraphContextRef context;
-    SBLevel resolvedLevel;
 
     context = CreateParagraphContext(bidiTypes, paragraph->fixedLevels, length);
 
     if (context) {
-        resolvedLevel = DetermineParagraphLevel(&context->bidiChain, baseLevel);
-
-        SB_LOG_BLOCK_OPENER("Determined Paragraph Level");
-        SB_LOG_STATEMENT("Base Level", 1, SB_LOG_LEVEL(resolvedLevel));
-        SB_LOG_BLOCK_CLOSER();
-
-        context->isolatingRun.codepointSequence = &algorithm->codepointSequence;
-        context->isolatingRun.bidiTypes = bidiTypes;
-        context->isolatingRun.bidiChain = &context->bidiChain;
-        context->isolatingRun.paragraphOffset = offset;
-        context->isolatingRun.paragraphLevel = resolvedLevel;
-
-        if (DetermineLevels(context, resolvedLevel)) {
-            SaveLevels(&context->bidiChain, ++paragraph->fixedLevels, resolvedLevel);
-
-            SB_LOG_BLOCK_OPENER("Determined Embedding Levels");
-            SB_LOG_STATEMENT("Levels", 1, SB_LOG_LEVELS_ARRAY(paragraph->fixedLevels, length));
-            SB_LOG_BLOCK_CLOSER();
-
+        if (ResolveLevels(context, algorithm, offset, ++paragraph->fixedLevels, &baseLevel)) {
             paragraph->algorithm = SBAlgorithmRetain(algorithm);
             paragraph->refTypes = bidiTypes;
             paragraph->offset = offset;
             paragraph->length = length;
-            paragraph->baseLevel = resolvedLevel;
+            paragraph->baseLevel = baseLevel;
             paragraph->retainCount = 1;
 
             isSucceeded = SBTrue;
@@ -650,6 +687,55 @@ SB_INTERNAL SBParagraphRef SBParagraphCreate(SBAlgorithmRef algorithm,
     return NULL;
 }
 
+SB_INTERNAL SBParagraphRef SBParagraphCreateWithLevels(SBAlgorithmRef algorithm,
+    SBUInteger paragraphOffset, SBUInteger paragraphLength, SBLevel baseLevel, const SBLevel *levels)
+{
+    SBParagraphRef paragraph = AllocateParagraph(paragraphLength);
+
+    if (paragraph) {
+        SBLevel *fixedLevels = ++paragraph->fixedLevels;
+        SBUInteger index;
+
+        /* The levels are already resolved, so simply copy them. */
+        for (index = 0; index < paragraphLength; index++) {
+            fixedLevels[index] = levels[index];
+        }
+
+        paragraph->algorithm = SBAlgorithmRetain(algorithm);
+        paragraph->refTypes = algorithm->fixedTypes + paragraphOffset;
+        paragraph->offset = paragraphOffset;
+        paragraph->length = paragraphLength;
+        paragraph->baseLevel = baseLevel;
+        paragraph->retainCount = 1;
+    }
+
+    return paragraph;
+}
+
+SB_INTERNAL SBUInteger SBParagraphGetScratchSize(SBUInteger paragraphLength)
+{
+    return GetParagraphContextSize(paragraphLength) + (sizeof(SBLevel) * (paragraphLength + 2));
+}
+
+SB_INTERNAL SBBoolean SBParagraphResolveLevels(SBAlgorithmRef algorithm,
+    SBUInteger paragraphOffset, SBUInteger paragraphLength, SBLevel *baseLevel,
+    void *scratch, SBLevel **levels)
+{
+    const SBBidiType *bidiTypes = algorithm->fixedTypes + paragraphOffset;
+    SBUInt8 *memory = (SBUInt8 *)scratch;
+    SBLevel *fixedLevels = (SBLevel *)(memory + GetParagraphContextSize(paragraphLength));
+    ParagraphContextRef context;
+    SBBoolean isSucceeded;
+
+    context = InitializeParagraphContext(scratch, bidiTypes, fixedLevels, paragraphLength);
+    isSucceeded = ResolveLevels(context, algorithm, paragraphOffset, ++fixedLevels, baseLevel);
+    FinalizeParagraphContext(context);
+
+    *levels = fixedLevels;
+
+    return isSucceeded;
+}
+
 SBUInteger SBParagraphGetOffset(SBParagraphRef paragraph)
 {
     return paragraph->offset;
@@ -687,7 +773,7 @@ SBLineRef SBParagraphCreateLine(SBParagraphRef paragraph, SBUInteger lineOffset,
 SBParagraphRef SBParagraphRetain(SBParagraphRef paragraph)
 {
     if (paragraph) {
-        paragraph->retainCount += 1;
+        SBRetainCountIncrement(&paragraph->retainCount);
     }
     
     return paragraph;
@@ -695,7 +781,7 @@ SBParagraphRef SBParagraphRetain(SBParagraphRef paragraph)
 
 void SBParagraphRelease(SBParagraphRef paragraph)
 {
-    if (paragraph && --paragraph->retainCount == 0) {
+    if (paragraph && SBRetainCountDecrement(&paragraph->retainCount) == 0) {
         SBAlgorithmRelease(paragraph->algorithm);
         DisposeParagraph(paragraph);
     }
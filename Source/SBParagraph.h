@@ -35,4 +35,13 @@ typedef struct _SBParagraph {
 SB_INTERNAL SBParagraphRef SBParagraphCreate(SBAlgorithmRef algorithm,
     SBUInteger paragraphOffset, SBUInteger suggestedLength, SBLevel baseLevel);
 
+SB_INTERNAL SBParagraphRef SBParagraphCreateWithLevels(SBAlgorithmRef algorithm,
+    SBUInteger paragraphOffset, SBUInteger paragraphLength, SBLevel baseLevel, const SBLevel *levels);
+
+SB_INTERNAL SBUInteger SBParagraphGetScratchSize(SBUInteger paragraphLength);
+
+SB_INTERNAL SBBoolean SBParagraphResolveLevels(SBAlgorithmRef algorithm,
+    SBUInteger paragraphOffset, SBUInteger paragraphLength, SBLevel *baseLevel,
+    void *scratch, SBLevel **levels);
+
 #endif
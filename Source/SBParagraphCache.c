@@ -0,0 +1,344 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <SBConfig.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "SBAlgorithm.h"
+#include "SBBase.h"
+#include "SBCodepointSequence.h"
+#include "SBMutex.h"
+#include "SBParagraph.h"
+#include "SBParagraphCache.h"
+
+#define HashOffsetBasis 0x811C9DC5
+#define HashPrime       0x01000193
+
+static SBUInt32 HashParagraph(const SBUInt8 *content, SBUInteger size,
+    SBStringEncoding encoding, SBLevel inputLevel)
+{
+    SBUInt32 hash = HashOffsetBasis;
+    SBUInteger index;
+
+    /* Compute FNV-1a hash of the code units followed by the encoding and base level. */
+    for (index = 0; index < size; index++) {
+        hash ^= content[index];
+        hash *= HashPrime;
+    }
+
+    hash ^= encoding;
+    hash *= HashPrime;
+    hash ^= inputLevel;
+    hash *= HashPrime;
+
+    return hash;
+}
+
+static ParagraphCacheEntryRef CreateEntry(const SBUInt8 *content, SBUInteger size,
+    SBParagraphRef paragraph)
+{
+    const SBUInteger sizeEntry   = sizeof(ParagraphCacheEntry);
+    const SBUInteger sizeContent = size;
+    const SBUInteger sizeLevels  = sizeof(SBLevel) * paragraph->length;
+    const SBUInteger sizeMemory  = sizeEntry + sizeContent + sizeLevels;
+
+    void *pointer = malloc(sizeMemory);
+
+    if (pointer) {
+        const SBUInteger offsetEntry   = 0;
+        const SBUInteger offsetContent = offsetEntry + sizeEntry;
+        const SBUInteger offsetLevels  = offsetContent + sizeContent;
+
+        SBUInt8 *memory = (SBUInt8 *)pointer;
+        ParagraphCacheEntryRef entry = (ParagraphCacheEntryRef)(memory + offsetEntry);
+        SBUInt8 *copiedContent = memory + offsetContent;
+        SBLevel *copiedLevels = (SBLevel *)(memory + offsetLevels);
+
+        memcpy(copiedContent, content, sizeContent);
+        memcpy(copiedLevels, paragraph->fixedLevels, sizeLevels);
+
+        entry->content = copiedContent;
+        entry->levels = copiedLevels;
+        entry->length = paragraph->length;
+        entry->baseLevel = paragraph->baseLevel;
+
+        return entry;
+    }
+
+    return NULL;
+}
+
+static ParagraphCacheEntryRef *GetBucket(SBParagraphCacheRef cache, SBUInt32 hash)
+{
+    return &cache->_buckets[hash % cache->_capacity];
+}
+
+static ParagraphCacheEntryRef FindEntry(SBParagraphCacheRef cache, SBUInt32 hash,
+    const SBUInt8 *content, SBUInteger length, SBUInteger size,
+    SBStringEncoding encoding, SBLevel inputLevel)
+{
+    ParagraphCacheEntryRef entry = *GetBucket(cache, hash);
+
+    for (; entry; entry = entry->chained) {
+        if (entry->hash == hash
+            && entry->length == length
+            && entry->encoding == encoding
+            && entry->inputLevel == inputLevel
+            && memcmp(entry->content, content, size) == 0) {
+            break;
+        }
+    }
+
+    return entry;
+}
+
+static void DetachEntry(SBParagraphCacheRef cache, ParagraphCacheEntryRef entry)
+{
+    if (entry->previous) {
+        entry->previous->next = entry->next;
+    } else {
+        cache->_first = entry->next;
+    }
+
+    if (entry->next) {
+        entry->next->previous = entry->previous;
+    } else {
+        cache->_last = entry->previous;
+    }
+}
+
+static void AttachEntry(SBParagraphCacheRef cache, ParagraphCacheEntryRef entry)
+{
+    entry->previous = NULL;
+    entry->next = cache->_first;
+
+    if (cache->_first) {
+        cache->_first->previous = entry;
+    } else {
+        cache->_last = entry;
+    }
+
+    cache->_first = entry;
+}
+
+static void RemoveLastEntry(SBParagraphCacheRef cache)
+{
+    ParagraphCacheEntryRef entry = cache->_last;
+    ParagraphCacheEntryRef *link = GetBucket(cache, entry->hash);
+
+    /* Unlink the entry from its bucket. */
+    while (*link != entry) {
+        link = &(*link)->chained;
+    }
+    *link = entry->chained;
+
+    DetachEntry(cache, entry);
+    free(entry);
+
+    cache->_count -= 1;
+}
+
+static void InsertEntry(SBParagraphCacheRef cache, ParagraphCacheEntryRef entry)
+{
+    ParagraphCacheEntryRef *bucket = GetBucket(cache, entry->hash);
+
+    if (cache->_count == cache->_capacity) {
+        RemoveLastEntry(cache);
+    }
+
+    entry->chained = *bucket;
+    *bucket = entry;
+    AttachEntry(cache, entry);
+
+    cache->_count += 1;
+}
+
+SBParagraphCacheRef SBParagraphCacheCreate(SBUInteger capacity)
+{
+    if (capacity > 0) {
+        SBParagraphCacheRef cache = malloc(sizeof(SBParagraphCache));
+
+        if (cache) {
+            cache->_buckets = calloc(capacity, sizeof(ParagraphCacheEntryRef));
+
+            if (cache->_buckets && SBMutexInitialize(&cache->_mutex)) {
+                cache->_first = NULL;
+                cache->_last = NULL;
+                cache->_capacity = capacity;
+                cache->_count = 0;
+                cache->hitCount = 0;
+                cache->missCount = 0;
+                cache->retainCount = 1;
+
+                return cache;
+            }
+
+            free(cache->_buckets);
+            free(cache);
+        }
+    }
+
+    return NULL;
+}
+
+static SBParagraphRef CreateCachedParagraph(SBParagraphCacheRef cache, SBAlgorithmRef algorithm,
+    SBUInteger paragraphOffset, SBUInteger length, SBLevel baseLevel, const SBUInt8 *content)
+{
+    const SBCodepointSequence *codepointSequence = &algorithm->codepointSequence;
+    SBUInteger size = length * SBCodepointSequenceGetUnitSize(codepointSequence);
+    SBStringEncoding encoding = SBCodepointSequenceGetEncoding(codepointSequence);
+    ParagraphCacheEntryRef entry;
+    SBParagraphRef paragraph;
+    SBUInt32 hash;
+
+    hash = HashParagraph(content, size, encoding, baseLevel);
+
+    SBMutexLock(&cache->_mutex);
+
+    entry = FindEntry(cache, hash, content, length, size, encoding, baseLevel);
+
+    if (entry) {
+        /* Mark the entry as most recently used. */
+        DetachEntry(cache, entry);
+        AttachEntry(cache, entry);
+
+        cache->hitCount += 1;
+
+        /* Copy the levels while the entry cannot be discarded by another thread. */
+        paragraph = SBParagraphCreateWithLevels(algorithm, paragraphOffset, length,
+                                                entry->baseLevel, entry->levels);
+
+        SBMutexUnlock(&cache->_mutex);
+
+        return paragraph;
+    }
+
+    cache->missCount += 1;
+
+    SBMutexUnlock(&cache->_mutex);
+
+    /* Resolve the paragraph without holding the lock. */
+    paragraph = SBParagraphCreate(algorithm, paragraphOffset, length, baseLevel);
+
+    if (paragraph) {
+        SBMutexLock(&cache->_mutex);
+
+        /* Another thread might have stored the same paragraph in the meantime. */
+        if (!FindEntry(cache, hash, content, length, size, encoding, baseLevel)) {
+            entry = CreateEntry(content, size, paragraph);
+
+            if (entry) {
+                entry->hash = hash;
+                entry->encoding = encoding;
+                entry->inputLevel = baseLevel;
+
+                InsertEntry(cache, entry);
+            }
+        }
+
+        SBMutexUnlock(&cache->_mutex);
+    }
+
+    return paragraph;
+}
+
+SBParagraphRef SBParagraphCacheCreateParagraph(SBParagraphCacheRef cache, SBAlgorithmRef algorithm,
+    SBUInteger paragraphOffset, SBUInteger suggestedLength, SBLevel baseLevel)
+{
+    const SBCodepointSequence *codepointSequence = &algorithm->codepointSequence;
+    SBUInteger unitSize = SBCodepointSequenceGetUnitSize(codepointSequence);
+    SBParagraphRef paragraph;
+    SBUInt8 *gathered;
+    SBUInteger length;
+
+    SBUIntegerNormalizeRange(codepointSequence->stringLength, &paragraphOffset, &suggestedLength);
+
+    if (suggestedLength == 0) {
+        return NULL;
+    }
+
+    SBAlgorithmGetParagraphBoundary(algorithm, paragraphOffset, suggestedLength, &length, NULL);
+
+    /* The levels depend on the provided types rather than the code units, so don't cache them. */
+    if (algorithm->hasProvidedTypes) {
+        return SBParagraphCreate(algorithm, paragraphOffset, length, baseLevel);
+    }
+
+    if (SBCodepointSequenceIsFlat(codepointSequence)) {
+        const SBUInt8 *content = (const SBUInt8 *)codepointSequence->stringBuffer + (paragraphOffset * unitSize);
+        return CreateCachedParagraph(cache, algorithm, paragraphOffset, length, baseLevel, content);
+    }
+
+    /* The cache is keyed by contiguous code units, so gather the paragraph from its source. */
+    gathered = malloc(length * unitSize);
+
+    if (!gathered) {
+        return SBParagraphCreate(algorithm, paragraphOffset, length, baseLevel);
+    }
+
+    SBCodepointSequenceCopyUnits(codepointSequence, paragraphOffset, length, gathered);
+    paragraph = CreateCachedParagraph(cache, algorithm, paragraphOffset, length, baseLevel, gathered);
+    free(gathered);
+
+    return paragraph;
+}
+
+SBUInteger SBParagraphCacheGetHitCount(SBParagraphCacheRef cache)
+{
+    SBUInteger hitCount;
+
+    SBMutexLock(&cache->_mutex);
+    hitCount = cache->hitCount;
+    SBMutexUnlock(&cache->_mutex);
+
+    return hitCount;
+}
+
+SBUInteger SBParagraphCacheGetMissCount(SBParagraphCacheRef cache)
+{
+    SBUInteger missCount;
+
+    SBMutexLock(&cache->_mutex);
+    missCount = cache->missCount;
+    SBMutexUnlock(&cache->_mutex);
+
+    return missCount;
+}
+
+SBParagraphCacheRef SBParagraphCacheRetain(SBParagraphCacheRef cache)
+{
+    if (cache) {
+        SBRetainCountIncrement(&cache->retainCount);
+    }
+
+    return cache;
+}
+
+void SBParagraphCacheRelease(SBParagraphCacheRef cache)
+{
+    if (cache && SBRetainCountDecrement(&cache->retainCount) == 0) {
+        while (cache->_last) {
+            RemoveLastEntry(cache);
+        }
+
+        SBMutexFinalize(&cache->_mutex);
+        free(cache->_buckets);
+        free(cache);
+    }
+}
@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _SB_INTERNAL_PARAGRAPH_CACHE_H
+#define _SB_INTERNAL_PARAGRAPH_CACHE_H
+
+#include <SBBase.h>
+#include <SBCodepointSequence.h>
+#include <SBConfig.h>
+#include <SBParagraphCache.h>
+
+#include "SBMutex.h"
+
+typedef struct _ParagraphCacheEntry {
+    struct _ParagraphCacheEntry *previous;
+    struct _ParagraphCacheEntry *next;
+    struct _ParagraphCacheEntry *chained;
+    const SBUInt8 *content;
+    const SBLevel *levels;
+    SBUInteger length;
+    SBUInt32 hash;
+    SBStringEncoding encoding;
+    SBLevel inputLevel;
+    SBLevel baseLevel;
+} ParagraphCacheEntry, *ParagraphCacheEntryRef;
+
+typedef struct _SBParagraphCache {
+    SBMutex _mutex;
+    ParagraphCacheEntryRef *_buckets;
+    ParagraphCacheEntryRef _first;
+    ParagraphCacheEntryRef _last;
+    SBUInteger _capacity;
+    SBUInteger _count;
+    SBUInteger hitCount;
+    SBUInteger missCount;
+    SBUInteger retainCount;
+} SBParagraphCache;
+
+#endif
@@ -0,0 +1,153 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <SBConfig.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#include "BidiTypeLookup.h"
+#include "SBAlgorithm.h"
+#include "SBBase.h"
+#include "SBCodepointSequence.h"
+#include "SBParagraph.h"
+#include "SBParagraphLocator.h"
+
+SBParagraphLocatorRef SBParagraphLocatorCreate(void)
+{
+    SBParagraphLocatorRef locator = malloc(sizeof(SBParagraphLocator));
+
+    if (locator) {
+        locator->agent.paragraph = NULL;
+        locator->retainCount = 1;
+
+        SBParagraphLocatorLoadCodepoints(locator, NULL, SBLevelDefaultLTR);
+    }
+
+    return locator;
+}
+
+void SBParagraphLocatorLoadCodepoints(SBParagraphLocatorRef locator,
+    const SBCodepointSequence *codepointSequence, SBLevel baseLevel)
+{
+    if (codepointSequence) {
+        locator->_codepointSequence = *codepointSequence;
+    } else {
+        locator->_codepointSequence.stringEncoding = SBStringEncodingUTF8;
+        locator->_codepointSequence.stringBuffer = NULL;
+        locator->_codepointSequence.stringLength = 0;
+    }
+
+    locator->_baseLevel = baseLevel;
+
+    SBParagraphLocatorReset(locator);
+}
+
+const SBParagraphAgent *SBParagraphLocatorGetAgent(SBParagraphLocatorRef locator)
+{
+    return &locator->agent;
+}
+
+static SBUInteger DetermineParagraphLength(const SBCodepointSequence *sequence, SBUInteger offset)
+{
+    SBUInteger stringIndex = offset;
+    SBCodepoint codepoint;
+
+    /* Find the paragraph separator without determining the types of the whole string. */
+    while ((codepoint = SBCodepointSequenceGetCodepointAt(sequence, &stringIndex)) != SBCodepointInvalid) {
+        if (LookupBidiType(codepoint) == SBBidiTypeB) {
+            /* Don't break in between 'CR' and 'LF'. */
+            if (codepoint == '\r' && stringIndex < sequence->stringLength) {
+                SBUInteger nextIndex = stringIndex;
+
+                if (SBCodepointSequenceGetCodepointAt(sequence, &nextIndex) == '\n') {
+                    stringIndex = nextIndex;
+                }
+            }
+            break;
+        }
+    }
+
+    return stringIndex - offset;
+}
+
+static SBParagraphRef ResolveNextParagraph(const SBCodepointSequence *sequence,
+    SBUInteger offset, SBUInteger length, SBLevel baseLevel)
+{
+    SBAlgorithmRef algorithm = SBAlgorithmCreateWithRange(sequence, offset, length);
+    SBParagraphRef paragraph = NULL;
+
+    if (algorithm) {
+        paragraph = SBAlgorithmCreateParagraph(algorithm, 0, length, baseLevel);
+
+        /* The paragraph keeps the algorithm alive as long as it is needed. */
+        SBAlgorithmRelease(algorithm);
+    }
+
+    return paragraph;
+}
+
+SBBoolean SBParagraphLocatorMoveNext(SBParagraphLocatorRef locator)
+{
+    const SBCodepointSequence *sequence = &locator->_codepointSequence;
+    SBUInteger offset = locator->agent.offset + locator->agent.length;
+
+    SBParagraphRelease(locator->agent.paragraph);
+    locator->agent.paragraph = NULL;
+
+    if (offset < sequence->stringLength) {
+        SBUInteger length = DetermineParagraphLength(sequence, offset);
+        SBParagraphRef paragraph = ResolveNextParagraph(sequence, offset, length, locator->_baseLevel);
+
+        if (paragraph) {
+            locator->agent.offset = offset;
+            locator->agent.length = length;
+            locator->agent.paragraph = paragraph;
+
+            return SBTrue;
+        }
+    }
+
+    SBParagraphLocatorReset(locator);
+
+    return SBFalse;
+}
+
+void SBParagraphLocatorReset(SBParagraphLocatorRef locator)
+{
+    SBParagraphRelease(locator->agent.paragraph);
+
+    locator->agent.offset = 0;
+    locator->agent.length = 0;
+    locator->agent.paragraph = NULL;
+}
+
+SBParagraphLocatorRef SBParagraphLocatorRetain(SBParagraphLocatorRef locator)
+{
+    if (locator) {
+        SBRetainCountIncrement(&locator->retainCount);
+    }
+
+    return locator;
+}
+
+void SBParagraphLocatorRelease(SBParagraphLocatorRef locator)
+{
+    if (locator && SBRetainCountDecrement(&locator->retainCount) == 0) {
+        SBParagraphRelease(locator->agent.paragraph);
+        free(locator);
+    }
+}
@@ -17,11 +17,10 @@
 #include <stddef.h>
 #include <stdlib.h>
 
-#include "GeneralCategoryLookup.h"
-#include "PairingLookup.h"
+#include "PropertyLookup.h"
+#include "SBAssert.h"
 #include "SBBase.h"
 #include "SBCodepointSequence.h"
-#include "ScriptLookup.h"
 #include "ScriptStack.h"
 #include "SBScriptLocator.h"
 
@@ -40,6 +39,7 @@ SBScriptLocatorRef SBScriptLocatorCreate(void)
         locator->_codepointSequence.stringEncoding = SBStringEncodingUTF8;
         locator->_codepointSequence.stringBuffer = NULL;
         locator->_codepointSequence.stringLength = 0;
+        locator->_rangeOffset = 0;
         locator->retainCount = 1;
 
         SBScriptLocatorReset(locator);
@@ -48,82 +48,128 @@ SBScriptLocatorRef SBScriptLocatorCreate(void)
     return locator;
 }
 
-void SBScriptLocatorLoadCodepoints(SBScriptLocatorRef locator, const SBCodepointSequence *codepointSequence)
+SBScriptLocatorRef SBScriptLocatorCopy(SBScriptLocatorRef locator)
 {
+    SBScriptLocatorRef copy = malloc(sizeof(SBScriptLocator));
+
+    if (copy) {
+        *copy = *locator;
+        copy->retainCount = 1;
+    }
+
+    return copy;
+}
+
+static void LoadCodepointRange(SBScriptLocatorRef locator,
+    const SBCodepointSequence *codepointSequence, SBUInteger rangeOffset, SBUInteger rangeLength)
+{
+    /* Limit the sequence to the end of the range so that no code point is decoded beyond it. */
     locator->_codepointSequence = *codepointSequence;
+    locator->_codepointSequence.stringLength = rangeOffset + rangeLength;
+    locator->_rangeOffset = rangeOffset;
+
     SBScriptLocatorReset(locator);
 }
 
-const SBScriptAgent *SBScriptLocatorGetAgent(SBScriptLocatorRef locator)
+void SBScriptLocatorLoadCodepoints(SBScriptLocatorRef locator, const SBCodepointSequence *codepointSequence)
 {
-    return &locator->agent;
+    LoadCodepointRange(locator, codepointSequence, 0, codepointSequence->stringLength);
 }
 
-static void ResolveScriptRun(SBScriptLocatorRef locator, SBUInteger offset)
+void SBScriptLocatorLoadCodepointRange(SBScriptLocatorRef locator,
+    const SBCodepointSequence *codepointSequence, SBUInteger rangeOffset, SBUInteger rangeLength)
 {
-    const SBCodepointSequence *sequence = &locator->_codepointSequence;
-    ScriptStackRef stack = &locator->_scriptStack;
-    SBScript result = SBScriptZYYY;
-    SBUInteger current = offset;
-    SBUInteger next = offset;
-    SBCodepoint codepoint;
+    SBAssert(SBUIntegerVerifyRange(codepointSequence->stringLength, rangeOffset, rangeLength));
 
-    /* Iterate over the code points of specified string buffer. */
-    while ((codepoint = SBCodepointSequenceGetCodepointAt(sequence, &next)) != SBCodepointInvalid) {
-        SBBoolean isStacked = SBFalse;
-        SBScript script;
+    LoadCodepointRange(locator, codepointSequence, rangeOffset, rangeLength);
+}
 
-        script = LookupScript(codepoint);
+void SBScriptLocatorLoadState(SBScriptLocatorRef locator, SBScriptLocatorRef source)
+{
+    SBAssert(source->agent.offset >= locator->_rangeOffset
+             && source->agent.offset + source->agent.length <= locator->_codepointSequence.stringLength);
 
-        /* Handle paired punctuations in case of a common script. */
-        if (script == SBScriptZYYY) {
-            SBGeneralCategory generalCategory = LookupGeneralCategory(codepoint);
+    locator->_scriptStack = source->_scriptStack;
+    locator->agent = source->agent;
+}
 
-            /* Check if current code point is an open punctuation. */
-            if (generalCategory == SBGeneralCategoryPS) {
-                SBCodepoint mirror = LookupMirror(codepoint);
-                if (mirror) {
-                    /* A closing pair exists for this punctuation, so push it onto the stack. */
-                    ScriptStackPush(stack, result, mirror);
-                }
+const SBScriptAgent *SBScriptLocatorGetAgent(SBScriptLocatorRef locator)
+{
+    return &locator->agent;
+}
+
+SB_INTERNAL SBBoolean ResolveCodepointScript(ScriptStackRef stack, SBScript *result,
+    SBCodepoint codepoint, const PropertyRecord *record)
+{
+    SBBoolean isStacked = SBFalse;
+    SBScript script = record->script;
+
+    /* Handle paired punctuations in case of a common script. */
+    if (script == SBScriptZYYY) {
+        SBGeneralCategory generalCategory = record->generalCategory;
+
+        /* Check if current code point is an open punctuation. */
+        if (generalCategory == SBGeneralCategoryPS) {
+            SBCodepoint mirror = PropertyRecordGetMirror(record, codepoint);
+            if (mirror) {
+                /* A closing pair exists for this punctuation, so push it onto the stack. */
+                ScriptStackPush(stack, *result, mirror);
             }
-            /* Check if current code point is a close punctuation. */
-            else if (generalCategory == SBGeneralCategoryPE) {
-                SBBoolean isMirrored = (LookupMirror(codepoint) != 0);
-                if (isMirrored) {
-                    /* Find the matching entry in the stack, while popping the unmatched ones. */
-                    while (!ScriptStackIsEmpty(stack)) {
-                        SBCodepoint mirror = ScriptStackGetMirror(stack);
-                        if (mirror != codepoint) {
-                            ScriptStackPop(stack);
-                        } else {
-                            break;
-                        }
+        }
+        /* Check if current code point is a close punctuation. */
+        else if (generalCategory == SBGeneralCategoryPE) {
+            SBBoolean isMirrored = (PropertyRecordGetMirror(record, codepoint) != 0);
+            if (isMirrored) {
+                /* Find the matching entry in the stack, while popping the unmatched ones. */
+                while (!ScriptStackIsEmpty(stack)) {
+                    SBCodepoint mirror = ScriptStackGetMirror(stack);
+                    if (mirror != codepoint) {
+                        ScriptStackPop(stack);
+                    } else {
+                        break;
                     }
+                }
 
-                    if (!ScriptStackIsEmpty(stack)) {
-                        isStacked = SBTrue;
-                        /* Paired punctuation match the script of enclosing text. */
-                        script = ScriptStackGetScript(stack);
-                    }
+                if (!ScriptStackIsEmpty(stack)) {
+                    isStacked = SBTrue;
+                    /* Paired punctuation match the script of enclosing text. */
+                    script = ScriptStackGetScript(stack);
                 }
             }
         }
+    }
 
-        if (IsSimilarScript(result, script)) {
-            if (SBScriptIsCommonOrInherited(result) && !SBScriptIsCommonOrInherited(script)) {
-                /* Set the concrete script of this code point as the result. */
-                result = script;
-                /* Seal the pending punctuations with the result. */
-                ScriptStackSealPairs(stack, result);
-            }
+    if (IsSimilarScript(*result, script)) {
+        if (SBScriptIsCommonOrInherited(*result) && !SBScriptIsCommonOrInherited(script)) {
+            /* Set the concrete script of this code point as the result. */
+            *result = script;
+            /* Seal the pending punctuations with the result. */
+            ScriptStackSealPairs(stack, script);
+        }
 
-            if (isStacked) {
-                /* Pop the paired punctuation from the stack. */
-                ScriptStackPop(stack);
-            }
-        } else {
-            /* The current code point has a different script, so finish the run. */
+        if (isStacked) {
+            /* Pop the paired punctuation from the stack. */
+            ScriptStackPop(stack);
+        }
+
+        return SBTrue;
+    }
+
+    /* The current code point has a different script, so it begins a new run. */
+    return SBFalse;
+}
+
+static void ResolveScriptRun(const SBCodepointSequence *sequence, ScriptStackRef stack,
+    SBUInteger offset, SBScriptAgent *run)
+{
+    SBScript result = SBScriptZYYY;
+    SBUInteger current = offset;
+    SBUInteger next = offset;
+    SBCodepoint codepoint;
+
+    /* Iterate over the code points of specified string buffer. */
+    while ((codepoint = SBCodepointSequenceGetCodepointAt(sequence, &next)) != SBCodepointInvalid) {
+        if (!ResolveCodepointScript(stack, &result, codepoint, LookupProperties(codepoint))) {
             break;
         }
 
@@ -132,10 +178,10 @@ static void ResolveScriptRun(SBScriptLocatorRef locator, SBUInteger offset)
 
     ScriptStackLeavePairs(stack);
 
-    /* Set the run info in agent. */
-    locator->agent.offset = offset;
-    locator->agent.length = current - offset;
-    locator->agent.script = result;
+    /* Set the run info. */
+    run->offset = offset;
+    run->length = current - offset;
+    run->script = result;
 }
 
 SBBoolean SBScriptLocatorMoveNext(SBScriptLocatorRef locator)
@@ -143,7 +189,7 @@ SBBoolean SBScriptLocatorMoveNext(SBScriptLocatorRef locator)
     SBUInteger offset = locator->agent.offset + locator->agent.length;
 
     if (offset < locator->_codepointSequence.stringLength) {
-        ResolveScriptRun(locator, offset);
+        ResolveScriptRun(&locator->_codepointSequence, &locator->_scriptStack, offset, &locator->agent);
         return SBTrue;
     }
 
@@ -151,10 +197,39 @@ SBBoolean SBScriptLocatorMoveNext(SBScriptLocatorRef locator)
     return SBFalse;
 }
 
+SBUInteger SBScriptLocatorCopyRuns(SBScriptLocatorRef locator, SBScriptAgent *runs, SBUInteger capacity)
+{
+    const SBCodepointSequence *sequence = &locator->_codepointSequence;
+    ScriptStackRef stack = &locator->_scriptStack;
+    SBUInteger stringLength = sequence->stringLength;
+    SBUInteger offset = locator->agent.offset + locator->agent.length;
+    SBUInteger count = 0;
+
+    if (offset >= stringLength) {
+        SBScriptLocatorReset(locator);
+        return 0;
+    }
+
+    /* Resolve the runs directly into the output array. */
+    while (count < capacity && offset < stringLength) {
+        SBScriptAgent *run = &runs[count++];
+
+        ResolveScriptRun(sequence, stack, offset, run);
+        offset = run->offset + run->length;
+    }
+
+    /* Keep the last copied run in the agent so that the locator can be resumed. */
+    if (count) {
+        locator->agent = runs[count - 1];
+    }
+
+    return count;
+}
+
 void SBScriptLocatorReset(SBScriptLocatorRef locator)
 {
     ScriptStackReset(&locator->_scriptStack);
-    locator->agent.offset = 0;
+    locator->agent.offset = locator->_rangeOffset;
     locator->agent.length = 0;
     locator->agent.script = SBScriptNil;
 }
@@ -162,7 +237,7 @@ void SBScriptLocatorReset(SBScriptLocatorRef locator)
 SBScriptLocatorRef SBScriptLocatorRetain(SBScriptLocatorRef locator)
 {
     if (locator) {
-        locator->retainCount += 1;
+        SBRetainCountIncrement(&locator->retainCount);
     }
 
     return locator;
@@ -170,7 +245,7 @@ SBScriptLocatorRef SBScriptLocatorRetain(SBScriptLocatorRef locator)
 
 void SBScriptLocatorRelease(SBScriptLocatorRef locator)
 {
-    if (locator && --locator->retainCount == 0) {
+    if (locator && SBRetainCountDecrement(&locator->retainCount) == 0) {
         free(locator);
     }
 }
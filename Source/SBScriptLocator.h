@@ -21,13 +21,18 @@
 #include <SBCodepointSequence.h>
 #include <SBScriptLocator.h>
 
+#include "PropertyLookup.h"
 #include "ScriptStack.h"
 
 typedef struct _SBScriptLocator {
     SBCodepointSequence _codepointSequence;
+    SBUInteger _rangeOffset;
     ScriptStack _scriptStack;
     SBScriptAgent agent;
     SBUInteger retainCount;
 } SBScriptLocator;
 
+SB_INTERNAL SBBoolean ResolveCodepointScript(ScriptStackRef stack, SBScript *result,
+    SBCodepoint codepoint, const PropertyRecord *record);
+
 #endif
@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <SBConfig.h>
+
+#include "SBBase.h"
+#include "SBThread.h"
+
+#ifdef SB_CONFIG_THREADS
+
+#ifdef _WIN32
+static DWORD WINAPI ThreadEntry(LPVOID parameter)
+{
+    SBThread *thread = (SBThread *)parameter;
+    thread->function(thread->argument);
+
+    return 0;
+}
+#else
+static void *ThreadEntry(void *parameter)
+{
+    SBThread *thread = (SBThread *)parameter;
+    thread->function(thread->argument);
+
+    return NULL;
+}
+#endif
+
+SB_INTERNAL SBBoolean SBThreadStart(SBThread *thread, SBThreadFunction function, void *argument)
+{
+    thread->function = function;
+    thread->argument = argument;
+
+#ifdef _WIN32
+    thread->handle = CreateThread(NULL, 0, ThreadEntry, thread, 0, NULL);
+    return (thread->handle != NULL);
+#else
+    return (pthread_create(&thread->handle, NULL, ThreadEntry, thread) == 0);
+#endif
+}
+
+SB_INTERNAL void SBThreadJoin(SBThread *thread)
+{
+#ifdef _WIN32
+    WaitForSingleObject(thread->handle, INFINITE);
+    CloseHandle(thread->handle);
+#else
+    pthread_join(thread->handle, NULL);
+#endif
+}
+
+#endif
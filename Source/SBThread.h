@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _SB_INTERNAL_THREAD_H
+#define _SB_INTERNAL_THREAD_H
+
+#include <SBBase.h>
+#include <SBConfig.h>
+
+#ifdef SB_CONFIG_THREADS
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+typedef void (*SBThreadFunction)(void *argument);
+
+typedef struct _SBThread {
+#ifdef _WIN32
+    HANDLE handle;
+#else
+    pthread_t handle;
+#endif
+    SBThreadFunction function;
+    void *argument;
+} SBThread;
+
+SB_INTERNAL SBBoolean SBThreadStart(SBThread *thread, SBThreadFunction function, void *argument);
+SB_INTERNAL void SBThreadJoin(SBThread *thread);
+
+#endif
+
+#endif
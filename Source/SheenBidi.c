@@ -26,15 +26,25 @@
 #include "IsolatingRun.c"
 #include "LevelRun.c"
 #include "PairingLookup.c"
+#include "PropertyLookup.c"
 #include "RunQueue.c"
 #include "SBAlgorithm.c"
 #include "SBBase.c"
+#include "SBBatch.c"
 #include "SBCodepointSequence.c"
+#include "SBDispatch.c"
+#include "SBDocument.c"
+#include "SBItemizer.c"
 #include "SBLine.c"
 #include "SBLog.c"
+#include "SBMappedFile.c"
 #include "SBMirrorLocator.c"
+#include "SBMutex.c"
 #include "SBParagraph.c"
+#include "SBParagraphCache.c"
+#include "SBParagraphLocator.c"
 #include "SBScriptLocator.c"
+#include "SBThread.c"
 #include "ScriptLookup.c"
 #include "ScriptStack.c"
 #include "StatusStack.c"
@@ -0,0 +1,153 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <atomic>
+#include <cstddef>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#include "AllocationCounter.h"
+
+using namespace std;
+using namespace SheenBidi::Benchmark;
+
+static atomic<bool> Tracking(false);
+static atomic<size_t> AllocationCount(0);
+static atomic<ptrdiff_t> LiveBytes(0);
+static atomic<ptrdiff_t> PeakBytes(0);
+
+#ifdef __GLIBC__
+
+extern "C" {
+
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t count, size_t size);
+void *__libc_realloc(void *pointer, size_t size);
+void __libc_free(void *pointer);
+
+}
+
+static void trackAllocation(void *pointer) {
+    if (pointer && Tracking.load(memory_order_relaxed)) {
+        ptrdiff_t live = LiveBytes += ptrdiff_t(malloc_usable_size(pointer));
+        ptrdiff_t peak = PeakBytes.load(memory_order_relaxed);
+
+        while (live > peak && !PeakBytes.compare_exchange_weak(peak, live)) { }
+        AllocationCount += 1;
+    }
+}
+
+static void trackDeallocation(void *pointer) {
+    if (pointer && Tracking.load(memory_order_relaxed)) {
+        LiveBytes -= ptrdiff_t(malloc_usable_size(pointer));
+    }
+}
+
+extern "C" {
+
+void *malloc(size_t size) {
+    void *pointer = __libc_malloc(size);
+    trackAllocation(pointer);
+
+    return pointer;
+}
+
+void *calloc(size_t count, size_t size) {
+    void *pointer = __libc_calloc(count, size);
+    trackAllocation(pointer);
+
+    return pointer;
+}
+
+void *realloc(void *pointer, size_t size) {
+    void *result;
+
+    trackDeallocation(pointer);
+    result = __libc_realloc(pointer, size);
+
+    if (result) {
+        trackAllocation(result);
+    } else if (size) {
+        /* The original block is still alive. */
+        trackAllocation(pointer);
+    }
+
+    return result;
+}
+
+void free(void *pointer) {
+    trackDeallocation(pointer);
+    __libc_free(pointer);
+}
+
+}
+
+bool AllocationCounter::isAvailable() {
+    return true;
+}
+
+#else
+
+bool AllocationCounter::isAvailable() {
+    return false;
+}
+
+#endif
+
+void AllocationCounter::reset() {
+    AllocationCount = 0;
+    LiveBytes = 0;
+    PeakBytes = 0;
+}
+
+void AllocationCounter::start() {
+    Tracking = true;
+}
+
+void AllocationCounter::stop() {
+    Tracking = false;
+}
+
+size_t AllocationCounter::count() {
+    return AllocationCount;
+}
+
+size_t AllocationCounter::peakBytes() {
+    return size_t(PeakBytes.load());
+}
+
+size_t AllocationCounter::maxResidentKilobytes() {
+#if defined(__unix__) || defined(__APPLE__)
+    struct rusage usage;
+
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#ifdef __APPLE__
+        return size_t(usage.ru_maxrss) / 1024;
+#else
+        return size_t(usage.ru_maxrss);
+#endif
+    }
+#endif
+
+    return 0;
+}
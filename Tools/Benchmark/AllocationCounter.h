@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _SHEENBIDI__BENCHMARK__ALLOCATION_COUNTER_H
+#define _SHEENBIDI__BENCHMARK__ALLOCATION_COUNTER_H
+
+#include <cstddef>
+
+namespace SheenBidi {
+namespace Benchmark {
+
+/**
+ * Counts the heap allocations made between `start()` and `stop()` since the last `reset()`. The
+ * library allocates with plain malloc, so the counting needs replacing the allocator of C runtime,
+ * which is only done with glibc.
+ */
+class AllocationCounter {
+public:
+    static bool isAvailable();
+
+    static void reset();
+    static void start();
+    static void stop();
+
+    static size_t count();
+    static size_t peakBytes();
+
+    /* Returns the peak resident memory of the process in kilobytes, or zero if unknown. */
+    static size_t maxResidentKilobytes();
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,257 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+extern "C" {
+#include <Headers/SheenBidi.h>
+}
+
+#include "AllocationCounter.h"
+#include "Corpus.h"
+#include "Benchmark.h"
+
+using namespace std;
+using namespace std::chrono;
+using namespace SheenBidi::Benchmark;
+
+typedef steady_clock Clock;
+
+static const double Percentiles[] = { 50.0, 90.0, 99.0, 100.0 };
+static const char *const PercentileNames[] = { "p50", "p90", "p99", "max" };
+
+static uint64_t percentile(const vector<uint64_t> &sorted, double rank) {
+    size_t index = size_t((rank / 100.0) * double(sorted.size()) + 0.5);
+    if (index > 0) {
+        index -= 1;
+    }
+
+    return sorted[min(index, sorted.size() - 1)];
+}
+
+Benchmark::Benchmark(const vector<Corpus> &corpora, size_t rounds) :
+    m_corpora(corpora),
+    m_rounds(rounds)
+{
+}
+
+template<class Operation, class Release>
+Benchmark::StageResult Benchmark::measure(const Corpus &corpus, const char *name,
+                                          Operation operation, Release release) const {
+    size_t stringCount = corpus.strings.size();
+    vector<uint64_t> latencies;
+    latencies.reserve(stringCount * m_rounds);
+
+    /* Warm up the caches and the allocator before measuring anything. */
+    for (size_t i = 0; i < stringCount; i++) {
+        operation(i);
+        release(i);
+    }
+
+    AllocationCounter::reset();
+
+    for (size_t round = 0; round < m_rounds; round++) {
+        for (size_t i = 0; i < stringCount; i++) {
+            AllocationCounter::start();
+
+            auto begin = Clock::now();
+            operation(i);
+            auto end = Clock::now();
+
+            /* The release is tracked as well so that the live bytes return to zero. */
+            release(i);
+            AllocationCounter::stop();
+
+            latencies.push_back(uint64_t(duration_cast<nanoseconds>(end - begin).count()));
+        }
+    }
+
+    StageResult result;
+    uint64_t total = 0;
+
+    for (uint64_t latency : latencies) {
+        total += latency;
+    }
+    sort(latencies.begin(), latencies.end());
+
+    result.name = name;
+    result.seconds = double(total) / 1e9;
+    result.megabytesPerSecond = double(corpus.byteCount * m_rounds) / result.seconds / 1e6;
+    result.stringsPerSecond = double(latencies.size()) / result.seconds;
+    result.allocationsPerString = double(AllocationCounter::count()) / double(latencies.size());
+    result.peakBytes = AllocationCounter::peakBytes();
+
+    for (size_t i = 0; i < 4; i++) {
+        result.percentiles[i] = percentile(latencies, Percentiles[i]);
+    }
+
+    return result;
+}
+
+Benchmark::CorpusResult Benchmark::runCorpus(const Corpus &corpus) const {
+    size_t stringCount = corpus.strings.size();
+    vector<SBCodepointSequence> sequences(stringCount);
+    vector<SBAlgorithmRef> algorithms(stringCount);
+    vector<SBParagraphRef> paragraphs(stringCount);
+    vector<SBLineRef> lines(stringCount);
+    CorpusResult result;
+
+    result.corpus = &corpus;
+
+    for (size_t i = 0; i < stringCount; i++) {
+        const string &text = corpus.strings[i];
+
+        sequences[i].stringEncoding = SBStringEncodingUTF8;
+        sequences[i].stringBuffer = (void *)text.data();
+        sequences[i].stringLength = text.length();
+    }
+
+    /* Each stage is timed alone, so the objects it depends upon are created beforehand. */
+    result.stages.push_back(measure(corpus, "algorithm",
+        [&](size_t i) { algorithms[i] = SBAlgorithmCreate(&sequences[i]); },
+        [&](size_t i) { SBAlgorithmRelease(algorithms[i]); }));
+
+    for (size_t i = 0; i < stringCount; i++) {
+        algorithms[i] = SBAlgorithmCreate(&sequences[i]);
+    }
+
+    result.stages.push_back(measure(corpus, "paragraph",
+        [&](size_t i) {
+            paragraphs[i] = SBAlgorithmCreateParagraph(algorithms[i], 0,
+                                                       sequences[i].stringLength, SBLevelDefaultLTR);
+        },
+        [&](size_t i) { SBParagraphRelease(paragraphs[i]); }));
+
+    for (size_t i = 0; i < stringCount; i++) {
+        paragraphs[i] = SBAlgorithmCreateParagraph(algorithms[i], 0,
+                                                   sequences[i].stringLength, SBLevelDefaultLTR);
+    }
+
+    result.stages.push_back(measure(corpus, "line",
+        [&](size_t i) {
+            lines[i] = SBParagraphCreateLine(paragraphs[i], SBParagraphGetOffset(paragraphs[i]),
+                                             SBParagraphGetLength(paragraphs[i]));
+        },
+        [&](size_t i) { SBLineRelease(lines[i]); }));
+
+    for (size_t i = 0; i < stringCount; i++) {
+        lines[i] = SBParagraphCreateLine(paragraphs[i], SBParagraphGetOffset(paragraphs[i]),
+                                         SBParagraphGetLength(paragraphs[i]));
+    }
+
+    SBMirrorLocatorRef mirrorLocator = SBMirrorLocatorCreate();
+
+    result.stages.push_back(measure(corpus, "mirror",
+        [&](size_t i) {
+            SBMirrorLocatorLoadLine(mirrorLocator, lines[i], sequences[i].stringBuffer);
+            while (SBMirrorLocatorMoveNext(mirrorLocator)) { }
+        },
+        [&](size_t) { SBMirrorLocatorLoadLine(mirrorLocator, NULL, NULL); }));
+
+    SBScriptLocatorRef scriptLocator = SBScriptLocatorCreate();
+
+    result.stages.push_back(measure(corpus, "script",
+        [&](size_t i) {
+            SBScriptLocatorLoadCodepoints(scriptLocator, &sequences[i]);
+            while (SBScriptLocatorMoveNext(scriptLocator)) { }
+        },
+        [&](size_t) { }));
+
+    SBScriptLocatorRelease(scriptLocator);
+    SBMirrorLocatorRelease(mirrorLocator);
+
+    for (size_t i = 0; i < stringCount; i++) {
+        SBLineRelease(lines[i]);
+        SBParagraphRelease(paragraphs[i]);
+        SBAlgorithmRelease(algorithms[i]);
+    }
+
+    return result;
+}
+
+void Benchmark::run() {
+    m_results.clear();
+
+    for (const Corpus &corpus : m_corpora) {
+        m_results.push_back(runCorpus(corpus));
+    }
+}
+
+void Benchmark::writeJSON(ostream &stream) const {
+    bool counting = AllocationCounter::isAvailable();
+
+    stream << "{\n";
+    stream << "  \"rounds\": " << m_rounds << ",\n";
+    stream << "  \"corpora\": [";
+
+    for (size_t c = 0; c < m_results.size(); c++) {
+        const CorpusResult &corpusResult = m_results[c];
+        const Corpus &corpus = *corpusResult.corpus;
+
+        stream << (c ? "," : "") << "\n    {\n";
+        stream << "      \"name\": \"" << corpus.name << "\",\n";
+        stream << "      \"strings\": " << corpus.strings.size() << ",\n";
+        stream << "      \"bytes\": " << corpus.byteCount << ",\n";
+        stream << "      \"codepoints\": " << corpus.codepointCount << ",\n";
+        stream << "      \"stages\": [";
+
+        for (size_t s = 0; s < corpusResult.stages.size(); s++) {
+            const StageResult &stage = corpusResult.stages[s];
+
+            stream << (s ? "," : "") << "\n        {\n";
+            stream << "          \"name\": \"" << stage.name << "\",\n";
+            stream << "          \"megabytesPerSecond\": " << stage.megabytesPerSecond << ",\n";
+            stream << "          \"stringsPerSecond\": " << stage.stringsPerSecond << ",\n";
+            stream << "          \"latencyNanoseconds\": {";
+
+            for (size_t p = 0; p < 4; p++) {
+                stream << (p ? ", " : " ")
+                       << "\"" << PercentileNames[p] << "\": " << stage.percentiles[p];
+            }
+
+            stream << " },\n";
+
+            if (counting) {
+                stream << "          \"allocationsPerString\": " << stage.allocationsPerString << ",\n";
+                stream << "          \"peakBytes\": " << stage.peakBytes << "\n";
+            } else {
+                stream << "          \"allocationsPerString\": null,\n";
+                stream << "          \"peakBytes\": null\n";
+            }
+
+            stream << "        }";
+        }
+
+        stream << "\n      ]\n    }";
+    }
+
+    stream << "\n  ],\n";
+
+    size_t maxResident = AllocationCounter::maxResidentKilobytes();
+    if (maxResident) {
+        stream << "  \"maxResidentKilobytes\": " << maxResident << "\n";
+    } else {
+        stream << "  \"maxResidentKilobytes\": null\n";
+    }
+
+    stream << "}\n";
+}
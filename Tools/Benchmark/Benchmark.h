@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _SHEENBIDI__BENCHMARK__BENCHMARK_H
+#define _SHEENBIDI__BENCHMARK__BENCHMARK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "Corpus.h"
+
+namespace SheenBidi {
+namespace Benchmark {
+
+class Benchmark {
+public:
+    Benchmark(const std::vector<Corpus> &corpora, size_t rounds);
+
+    void run();
+    void writeJSON(std::ostream &stream) const;
+
+private:
+    struct StageResult {
+        std::string name;
+        double seconds;
+        double megabytesPerSecond;
+        double stringsPerSecond;
+        uint64_t percentiles[4];
+        double allocationsPerString;
+        size_t peakBytes;
+    };
+
+    struct CorpusResult {
+        const Corpus *corpus;
+        std::vector<StageResult> stages;
+    };
+
+    const std::vector<Corpus> &m_corpora;
+    size_t m_rounds;
+    std::vector<CorpusResult> m_results;
+
+    template<class Operation, class Release>
+    StageResult measure(const Corpus &corpus, const char *name,
+                        Operation operation, Release release) const;
+
+    CorpusResult runCorpus(const Corpus &corpus) const;
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,344 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <Parser/BidiBrackets.h>
+#include <Parser/DerivedBidiClass.h>
+#include <Parser/Scripts.h>
+#include <Parser/UnicodeData.h>
+
+#include "Corpus.h"
+
+using namespace std;
+using namespace SheenBidi::Benchmark;
+using namespace SheenBidi::Parser;
+
+/* The corpora are made of the characters of basic multilingual plane. */
+static const uint32_t LastCodePoint = 0xFFFF;
+
+static const size_t MinimumWordCount = 8;
+static const size_t MaximumWordCount = 64;
+static const size_t MaximumEmbeddingDepth = 48;
+
+/*
+ * Only the output of mt19937 is fixed by the standard, not the one of the distributions, so the
+ * values are bounded by hand to get the same corpora on every platform.
+ */
+static size_t randomIndex(mt19937 &engine, size_t bound) {
+    return engine() % bound;
+}
+
+static size_t randomCount(mt19937 &engine, size_t lower, size_t upper) {
+    return lower + randomIndex(engine, upper - lower + 1);
+}
+
+static bool randomChance(mt19937 &engine, size_t percent) {
+    return randomIndex(engine, 100) < percent;
+}
+
+static uint32_t randomPick(mt19937 &engine, const vector<uint32_t> &pool) {
+    return pool[randomIndex(engine, pool.size())];
+}
+
+static void collectCodePoints(vector<uint32_t> &pool, uint32_t first, uint32_t last,
+                              const DerivedBidiClass &derivedBidiClass, const string &bidiClass,
+                              const UnicodeData &unicodeData, const string &generalCategory,
+                              const Scripts &scripts, const string &script) {
+    string category;
+
+    for (uint32_t codePoint = first; codePoint <= last; codePoint++) {
+        if (derivedBidiClass.bidiClassForCodePoint(codePoint) != bidiClass) {
+            continue;
+        }
+        if (!script.empty() && scripts.scriptForCodePoint(codePoint) != script) {
+            continue;
+        }
+
+        unicodeData.getGeneralCategory(codePoint, category);
+        if (!category.empty() && category.compare(0, generalCategory.length(), generalCategory) == 0) {
+            pool.push_back(codePoint);
+        }
+    }
+}
+
+static void collectBidiClass(vector<uint32_t> &pool,
+                             const DerivedBidiClass &derivedBidiClass, const string &bidiClass) {
+    for (uint32_t codePoint = 0; codePoint <= LastCodePoint; codePoint++) {
+        if (derivedBidiClass.bidiClassForCodePoint(codePoint) == bidiClass) {
+            pool.push_back(codePoint);
+        }
+    }
+}
+
+static string toUTF8(const u32string &text) {
+    string utf8;
+    utf8.reserve(text.length() * 2);
+
+    for (char32_t codePoint : text) {
+        if (codePoint < 0x80) {
+            utf8.push_back(char(codePoint));
+        } else if (codePoint < 0x800) {
+            utf8.push_back(char(0xC0 | (codePoint >> 6)));
+            utf8.push_back(char(0x80 | (codePoint & 0x3F)));
+        } else {
+            utf8.push_back(char(0xE0 | (codePoint >> 12)));
+            utf8.push_back(char(0x80 | ((codePoint >> 6) & 0x3F)));
+            utf8.push_back(char(0x80 | (codePoint & 0x3F)));
+        }
+    }
+
+    return utf8;
+}
+
+CorpusBuilder::CorpusBuilder(const UnicodeData &unicodeData,
+                             const DerivedBidiClass &derivedBidiClass,
+                             const Scripts &scripts,
+                             const BidiBrackets &bidiBrackets) :
+    m_popEmbedding(0),
+    m_popIsolate(0)
+{
+    collectCodePoints(m_latinLetters, 0x0041, 0x024F,
+                      derivedBidiClass, "L", unicodeData, "L", scripts, "Latin");
+    collectCodePoints(m_arabicLetters, 0x0620, 0x06FF,
+                      derivedBidiClass, "AL", unicodeData, "Lo", scripts, "Arabic");
+    collectCodePoints(m_arabicMarks, 0x064B, 0x065F,
+                      derivedBidiClass, "NSM", unicodeData, "Mn", scripts, "");
+    collectCodePoints(m_europeanDigits, 0x0030, 0x0039,
+                      derivedBidiClass, "EN", unicodeData, "Nd", scripts, "");
+    collectCodePoints(m_arabicDigits, 0x0660, 0x0669,
+                      derivedBidiClass, "AN", unicodeData, "Nd", scripts, "");
+    collectCodePoints(m_punctuations, 0x0021, 0x007E,
+                      derivedBidiClass, "CS", unicodeData, "Po", scripts, "");
+    collectCodePoints(m_punctuations, 0x0021, 0x007E,
+                      derivedBidiClass, "ON", unicodeData, "Po", scripts, "");
+
+    for (uint32_t codePoint = 0; codePoint <= LastCodePoint; codePoint++) {
+        if (bidiBrackets.pairedBracketTypeForCodePoint(codePoint) == 'o') {
+            m_openingBrackets.push_back(codePoint);
+            m_closingBrackets.push_back(bidiBrackets.pairedBracketForCodePoint(codePoint));
+        }
+    }
+
+    collectBidiClass(m_embeddings, derivedBidiClass, "LRE");
+    collectBidiClass(m_embeddings, derivedBidiClass, "RLE");
+    collectBidiClass(m_embeddings, derivedBidiClass, "LRO");
+    collectBidiClass(m_embeddings, derivedBidiClass, "RLO");
+    collectBidiClass(m_isolates, derivedBidiClass, "LRI");
+    collectBidiClass(m_isolates, derivedBidiClass, "RLI");
+    collectBidiClass(m_isolates, derivedBidiClass, "FSI");
+
+    Pool pops;
+    collectBidiClass(pops, derivedBidiClass, "PDF");
+    collectBidiClass(pops, derivedBidiClass, "PDI");
+    m_popEmbedding = pops.at(0);
+    m_popIsolate = pops.at(1);
+}
+
+vector<Corpus> CorpusBuilder::build(size_t stringCount, uint32_t seed) const {
+    typedef u32string (CorpusBuilder::*Maker)(mt19937 &) const;
+
+    static const struct {
+        const char *name;
+        Maker maker;
+    } Kinds[] = {
+        { "latin", &CorpusBuilder::makeLatin },
+        { "arabic", &CorpusBuilder::makeArabic },
+        { "mixed", &CorpusBuilder::makeMixed },
+        { "brackets", &CorpusBuilder::makeBrackets },
+        { "embedded", &CorpusBuilder::makeEmbedded },
+    };
+
+    vector<Corpus> corpora;
+
+    for (const auto &kind : Kinds) {
+        /* Each corpus has its own sequence so that adding one does not change the others. */
+        mt19937 engine(seed + uint32_t(corpora.size()));
+        Corpus corpus;
+        corpus.name = kind.name;
+        corpus.byteCount = 0;
+        corpus.codepointCount = 0;
+
+        for (size_t i = 0; i < stringCount; i++) {
+            u32string text = (this->*kind.maker)(engine);
+            string utf8 = toUTF8(text);
+
+            corpus.byteCount += utf8.length();
+            corpus.codepointCount += text.length();
+            corpus.strings.push_back(move(utf8));
+        }
+
+        corpora.push_back(move(corpus));
+    }
+
+    return corpora;
+}
+
+void CorpusBuilder::appendWord(mt19937 &engine, u32string &text, bool arabic) const {
+    size_t length = randomCount(engine, 2, 10);
+
+    for (size_t i = 0; i < length; i++) {
+        if (arabic) {
+            text.push_back(randomPick(engine, m_arabicLetters));
+
+            if (randomChance(engine, 10)) {
+                text.push_back(randomPick(engine, m_arabicMarks));
+            }
+        } else {
+            text.push_back(randomPick(engine, m_latinLetters));
+        }
+    }
+}
+
+void CorpusBuilder::appendNumber(mt19937 &engine, u32string &text, bool arabic) const {
+    const Pool &digits = (arabic ? m_arabicDigits : m_europeanDigits);
+    size_t length = randomCount(engine, 1, 6);
+
+    for (size_t i = 0; i < length; i++) {
+        text.push_back(randomPick(engine, digits));
+    }
+
+    /* Add a fraction like in prices and measurements. */
+    if (randomChance(engine, 30)) {
+        text.push_back(U'.');
+        text.push_back(randomPick(engine, digits));
+        text.push_back(randomPick(engine, digits));
+    }
+}
+
+void CorpusBuilder::appendSeparator(mt19937 &engine, u32string &text) const {
+    if (randomChance(engine, 12)) {
+        text.push_back(randomPick(engine, m_punctuations));
+    }
+
+    text.push_back(U' ');
+}
+
+u32string CorpusBuilder::makeLatin(mt19937 &engine) const {
+    size_t wordCount = randomCount(engine, MinimumWordCount, MaximumWordCount);
+    u32string text;
+
+    for (size_t i = 0; i < wordCount; i++) {
+        appendWord(engine, text, false);
+        appendSeparator(engine, text);
+    }
+
+    return text;
+}
+
+u32string CorpusBuilder::makeArabic(mt19937 &engine) const {
+    size_t wordCount = randomCount(engine, MinimumWordCount, MaximumWordCount);
+    u32string text;
+
+    for (size_t i = 0; i < wordCount; i++) {
+        appendWord(engine, text, true);
+        appendSeparator(engine, text);
+    }
+
+    return text;
+}
+
+u32string CorpusBuilder::makeMixed(mt19937 &engine) const {
+    size_t wordCount = randomCount(engine, MinimumWordCount, MaximumWordCount);
+    bool arabic = randomChance(engine, 50);
+    u32string text;
+
+    for (size_t i = 0; i < wordCount; i++) {
+        /* Switch the language after a few words like a quote or a name would do. */
+        if (randomChance(engine, 25)) {
+            arabic = !arabic;
+        }
+
+        if (randomChance(engine, 20)) {
+            appendNumber(engine, text, arabic && randomChance(engine, 50));
+        } else {
+            appendWord(engine, text, arabic);
+        }
+
+        appendSeparator(engine, text);
+    }
+
+    return text;
+}
+
+u32string CorpusBuilder::makeBrackets(mt19937 &engine) const {
+    size_t wordCount = randomCount(engine, MinimumWordCount, MaximumWordCount);
+    vector<size_t> openers;
+    u32string text;
+
+    for (size_t i = 0; i < wordCount; i++) {
+        if (randomChance(engine, 30)) {
+            size_t bracket = randomIndex(engine, m_openingBrackets.size());
+            openers.push_back(bracket);
+            text.push_back(m_openingBrackets[bracket]);
+        }
+
+        appendWord(engine, text, randomChance(engine, 50));
+
+        if (!openers.empty() && randomChance(engine, 30)) {
+            text.push_back(m_closingBrackets[openers.back()]);
+            openers.pop_back();
+        }
+
+        appendSeparator(engine, text);
+    }
+
+    /* Leave some brackets unmatched as the real text does. */
+    while (!openers.empty()) {
+        if (randomChance(engine, 80)) {
+            text.push_back(m_closingBrackets[openers.back()]);
+        }
+        openers.pop_back();
+    }
+
+    return text;
+}
+
+u32string CorpusBuilder::makeEmbedded(mt19937 &engine) const {
+    size_t wordCount = randomCount(engine, MinimumWordCount, MaximumWordCount);
+    vector<uint32_t> terminators;
+    u32string text;
+
+    for (size_t i = 0; i < wordCount; i++) {
+        if (terminators.size() < MaximumEmbeddingDepth && randomChance(engine, 40)) {
+            if (randomChance(engine, 50)) {
+                text.push_back(randomPick(engine, m_embeddings));
+                terminators.push_back(m_popEmbedding);
+            } else {
+                text.push_back(randomPick(engine, m_isolates));
+                terminators.push_back(m_popIsolate);
+            }
+        } else if (!terminators.empty() && randomChance(engine, 25)) {
+            text.push_back(terminators.back());
+            terminators.pop_back();
+        }
+
+        appendWord(engine, text, randomChance(engine, 50));
+        appendSeparator(engine, text);
+    }
+
+    while (!terminators.empty()) {
+        text.push_back(terminators.back());
+        terminators.pop_back();
+    }
+
+    return text;
+}
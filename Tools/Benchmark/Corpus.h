@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _SHEENBIDI__BENCHMARK__CORPUS_H
+#define _SHEENBIDI__BENCHMARK__CORPUS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <Parser/BidiBrackets.h>
+#include <Parser/DerivedBidiClass.h>
+#include <Parser/Scripts.h>
+#include <Parser/UnicodeData.h>
+
+namespace SheenBidi {
+namespace Benchmark {
+
+struct Corpus {
+    std::string name;
+    std::vector<std::string> strings;
+    size_t byteCount;
+    size_t codepointCount;
+};
+
+class CorpusBuilder {
+public:
+    CorpusBuilder(const Parser::UnicodeData &unicodeData,
+                  const Parser::DerivedBidiClass &derivedBidiClass,
+                  const Parser::Scripts &scripts,
+                  const Parser::BidiBrackets &bidiBrackets);
+
+    std::vector<Corpus> build(size_t stringCount, uint32_t seed) const;
+
+private:
+    typedef std::vector<uint32_t> Pool;
+
+    Pool m_latinLetters;
+    Pool m_arabicLetters;
+    Pool m_arabicMarks;
+    Pool m_europeanDigits;
+    Pool m_arabicDigits;
+    Pool m_punctuations;
+    Pool m_openingBrackets;
+    Pool m_closingBrackets;
+    Pool m_embeddings;
+    Pool m_isolates;
+    uint32_t m_popEmbedding;
+    uint32_t m_popIsolate;
+
+    std::u32string makeLatin(std::mt19937 &engine) const;
+    std::u32string makeArabic(std::mt19937 &engine) const;
+    std::u32string makeMixed(std::mt19937 &engine) const;
+    std::u32string makeBrackets(std::mt19937 &engine) const;
+    std::u32string makeEmbedded(std::mt19937 &engine) const;
+
+    void appendWord(std::mt19937 &engine, std::u32string &text, bool arabic) const;
+    void appendNumber(std::mt19937 &engine, std::u32string &text, bool arabic) const;
+    void appendSeparator(std::mt19937 &engine, std::u32string &text) const;
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include <Parser/BidiBrackets.h>
+#include <Parser/DerivedBidiClass.h>
+#include <Parser/Scripts.h>
+#include <Parser/UnicodeData.h>
+
+#include "Benchmark.h"
+#include "Corpus.h"
+
+using namespace std;
+using namespace SheenBidi::Parser;
+using namespace SheenBidi::Benchmark;
+
+static const size_t DefaultStringCount = 512;
+static const size_t DefaultRounds = 8;
+static const uint32_t CorpusSeed = 0x5B1D1;
+
+int main(int argc, const char *argv[]) {
+    if (argc < 2) {
+        cerr << "Usage: " << argv[0] << " <unicode directory> [rounds] [output file]" << endl;
+        return 1;
+    }
+
+    const char *dir = argv[1];
+    size_t rounds = (argc > 2 ? size_t(strtoul(argv[2], nullptr, 10)) : DefaultRounds);
+
+    if (rounds == 0) {
+        rounds = DefaultRounds;
+    }
+
+    UnicodeData unicodeData(dir);
+    DerivedBidiClass derivedBidiClass(dir);
+    Scripts scripts(dir);
+    BidiBrackets bidiBrackets(dir);
+
+    CorpusBuilder builder(unicodeData, derivedBidiClass, scripts, bidiBrackets);
+    vector<Corpus> corpora = builder.build(DefaultStringCount, CorpusSeed);
+
+    Benchmark benchmark(corpora, rounds);
+    benchmark.run();
+
+    if (argc > 3) {
+        ofstream stream(argv[3]);
+        benchmark.writeJSON(stream);
+    } else {
+        benchmark.writeJSON(cout);
+    }
+
+    return 0;
+}
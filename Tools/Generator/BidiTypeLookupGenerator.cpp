@@ -20,13 +20,19 @@
 #include <map>
 #include <set>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
+extern "C" {
+#include <Headers/SBBidiType.h>
+}
+
 #include "Utilities/Math.h"
 #include "Utilities/Converter.h"
 #include "Utilities/ArrayBuilder.h"
 #include "Utilities/FileBuilder.h"
+#include "Utilities/LookupTuner.h"
 
 #include "BidiTypeLookupGenerator.h"
 
@@ -50,6 +56,38 @@ static const string MAIN_INDEXES_ARRAY_NAME = "MainBidiTypeIndexes";
 static const string BRANCH_INDEXES_ARRAY_TYPE = "static const SBUInt16";
 static const string BRANCH_INDEXES_ARRAY_NAME = "BranchBidiTypeIndexes";
 
+static const string BMP_INDEXES_ARRAY_TYPE = "static const SBUInt16";
+static const string BMP_INDEXES_ARRAY_NAME = "BMPBidiTypeIndexes";
+
+static const string PACKED_DATA_ARRAY_TYPE = "static const SBUInt8";
+static const string PACKED_DATA_ARRAY_NAME = "PackedBidiTypeData";
+
+static const string TWO_STAGE_DATA_ARRAY_TYPE = "static const SBUInt8";
+static const string TWO_STAGE_DATA_ARRAY_NAME = "TwoStageBidiTypeData";
+
+static const string TWO_STAGE_INDEXES_ARRAY_TYPE = "static const SBUInt16";
+static const string TWO_STAGE_INDEXES_ARRAY_NAME = "TwoStageBidiTypeIndexes";
+
+static const uint32_t BMP_CODE_POINT_COUNT = 0x10000;
+
+static const size_t PACKED_BITS = 5;
+static const size_t TWO_STAGE_SEGMENT_SIZE = 0x100;
+
+static SBBidiType bidiTypeValue(const string &name) {
+    static const map<string, SBBidiType> values = {
+        { "L", SBBidiTypeL }, { "R", SBBidiTypeR }, { "AL", SBBidiTypeAL },
+        { "BN", SBBidiTypeBN }, { "NSM", SBBidiTypeNSM }, { "AN", SBBidiTypeAN },
+        { "EN", SBBidiTypeEN }, { "ET", SBBidiTypeET }, { "ES", SBBidiTypeES },
+        { "CS", SBBidiTypeCS }, { "WS", SBBidiTypeWS }, { "S", SBBidiTypeS },
+        { "B", SBBidiTypeB }, { "ON", SBBidiTypeON }, { "LRI", SBBidiTypeLRI },
+        { "RLI", SBBidiTypeRLI }, { "FSI", SBBidiTypeFSI }, { "PDI", SBBidiTypePDI },
+        { "LRE", SBBidiTypeLRE }, { "RLE", SBBidiTypeRLE }, { "LRO", SBBidiTypeLRO },
+        { "RLO", SBBidiTypeRLO }, { "PDF", SBBidiTypePDF }
+    };
+
+    return values.at(name);
+}
+
 BidiTypeLookupGenerator::MainDataSegment::MainDataSegment(size_t index, MainDataSet dataset)
     : index(index)
     , dataset(dataset)
@@ -134,6 +172,57 @@ void BidiTypeLookupGenerator::analyzeData() {
     cout << "  Required Memory: " << minMemory << " bytes";
 }
 
+void BidiTypeLookupGenerator::tuneSegmentSizes(ostream &report) {
+    cout << "Tuning segment sizes for bidi type lookup." << endl;
+
+    LookupTuner tuner("BidiTypeLookup", m_lastCodePoint);
+    vector<size_t> mainSizes = LookupTuner::candidateSizes(m_mainSegmentSize);
+    vector<size_t> branchSizes = LookupTuner::candidateSizes(m_branchSegmentSize);
+
+    for (size_t mainSize : mainSizes) {
+        m_mainSegmentSize = mainSize;
+        collectMainData();
+
+        vector<uint8_t> data;
+        for (const MainDataSegment &segment : m_dataSegments) {
+            data.insert(data.end(), segment.dataset->begin(), segment.dataset->end());
+        }
+
+        for (size_t branchSize : branchSizes) {
+            m_branchSegmentSize = branchSize;
+            collectBranchData();
+
+            /* The indexes would not fit in the generated arrays. */
+            if (m_dataSize > 0x10000 || m_mainIndexesSize > 0x10000) {
+                continue;
+            }
+
+            vector<uint16_t> mainIndexes;
+            for (const BranchDataSegment &segment : m_branchSegments) {
+                for (const MainDataSegment *reference : *segment.dataset) {
+                    mainIndexes.push_back((uint16_t)reference->index);
+                }
+            }
+
+            vector<uint16_t> branchIndexes;
+            for (const BranchDataSegment *reference : m_branchReferences) {
+                branchIndexes.push_back((uint16_t)reference->index);
+            }
+
+            size_t memory = m_dataSize + ((m_mainIndexesSize + m_branchIndexesSize) * 2)
+                          + ((BMP_CODE_POINT_COUNT / mainSize) * 2);
+            tuner.addCandidate(mainSize, branchSize, memory, data, mainIndexes, branchIndexes);
+        }
+    }
+
+    m_mainSegmentSize = tuner.bestMainSegmentSize();
+    m_branchSegmentSize = tuner.bestBranchSegmentSize();
+    tuner.writeReport(report);
+
+    cout << "  Main Segment Size: " << m_mainSegmentSize << endl;
+    cout << "  Branch Segment Size: " << m_branchSegmentSize << endl << endl;
+}
+
 void BidiTypeLookupGenerator::collectMainData() {
     size_t maxSegments = Math::FastCeil(m_lastCodePoint, m_mainSegmentSize);
 
@@ -226,41 +315,108 @@ void BidiTypeLookupGenerator::collectBranchData() {
     m_branchIndexesSize = m_branchReferences.size();
 }
 
-void BidiTypeLookupGenerator::generateFile(const std::string &directory) {
-    collectMainData();
-    collectBranchData();
-
-    std::set<string> bidiTypes;
-
-    ArrayBuilder arrData;
-    arrData.setDataType(DATA_ARRAY_TYPE);
-    arrData.setName(DATA_ARRAY_NAME);
-    arrData.setElementSpace(3);
-    arrData.setSizeDescriptor(Converter::toString((int)m_dataSize));
-
+void BidiTypeLookupGenerator::fillDataArray(ArrayBuilder &array, set<string> &bidiTypes) const {
     auto dataPtr = m_dataSegments.begin();
     auto dataEnd = m_dataSegments.end();
     for (; dataPtr != dataEnd; dataPtr++) {
         const MainDataSegment &segment = *dataPtr;
         bool isLast = (dataPtr == (dataEnd - 1));
 
-        arrData.append(segment.hintLine());
-        arrData.newLine();
+        array.append(segment.hintLine());
+        array.newLine();
 
         size_t length = segment.dataset->size();
 
         for (size_t j = 0; j < length; j++) {
             const string &bidiType = m_bidiClassDetector.numberToName(segment.dataset->at(j));
             bidiTypes.insert(bidiType);
-            arrData.appendElement(bidiType);
+            array.appendElement(bidiType);
 
             if (!isLast || j != (length - 1)) {
-                arrData.newElement();
+                array.newElement();
             }
         }
 
         if (!isLast) {
-            arrData.newLine();
+            array.newLine();
+        }
+    }
+}
+
+void BidiTypeLookupGenerator::generateFile(const std::string &directory) {
+    std::set<string> bidiTypes;
+
+    /* Collect the two-stage table first as it needs its own segment size. */
+    size_t mainSegmentSize = m_mainSegmentSize;
+    m_mainSegmentSize = TWO_STAGE_SEGMENT_SIZE;
+    collectMainData();
+
+    if (m_dataSize > 0x10000) {
+        throw length_error("The two-stage bidi type data cannot be indexed with 16 bits.");
+    }
+
+    size_t twoStageDataSize = m_dataSize;
+    size_t twoStageIndexesSize = m_dataReferences.size();
+
+    ArrayBuilder arrTwoStageData;
+    arrTwoStageData.setDataType(TWO_STAGE_DATA_ARRAY_TYPE);
+    arrTwoStageData.setName(TWO_STAGE_DATA_ARRAY_NAME);
+    arrTwoStageData.setElementSpace(3);
+    arrTwoStageData.setSizeDescriptor(Converter::toString((int)twoStageDataSize));
+    fillDataArray(arrTwoStageData, bidiTypes);
+
+    ArrayBuilder arrTwoStageIndexes;
+    arrTwoStageIndexes.setDataType(TWO_STAGE_INDEXES_ARRAY_TYPE);
+    arrTwoStageIndexes.setName(TWO_STAGE_INDEXES_ARRAY_NAME);
+    arrTwoStageIndexes.setSizeDescriptor(Converter::toString((int)twoStageIndexesSize));
+
+    for (size_t i = 0; i < twoStageIndexesSize; i++) {
+        string element = "0x" + Converter::toHex(m_dataReferences.at(i)->index, 4);
+        arrTwoStageIndexes.appendElement(element);
+
+        if (i != (twoStageIndexesSize - 1)) {
+            arrTwoStageIndexes.newElement();
+        }
+    }
+
+    m_mainSegmentSize = mainSegmentSize;
+    collectMainData();
+    collectBranchData();
+
+    ArrayBuilder arrData;
+    arrData.setDataType(DATA_ARRAY_TYPE);
+    arrData.setName(DATA_ARRAY_NAME);
+    arrData.setElementSpace(3);
+    arrData.setSizeDescriptor(Converter::toString((int)m_dataSize));
+    fillDataArray(arrData, bidiTypes);
+
+    /* Pack the same data in 5 bits so that the trie indexes can be shared. */
+    vector<uint8_t> packedData((m_dataSize * PACKED_BITS + 7) / 8 + 1, 0);
+    size_t bitOffset = 0;
+
+    for (const MainDataSegment &segment : m_dataSegments) {
+        for (uint8_t number : *segment.dataset) {
+            uint32_t value = bidiTypeValue(m_bidiClassDetector.numberToName(number));
+            value <<= (bitOffset % 8);
+
+            packedData[bitOffset / 8] |= (uint8_t)value;
+            packedData[bitOffset / 8 + 1] |= (uint8_t)(value >> 8);
+
+            bitOffset += PACKED_BITS;
+        }
+    }
+
+    ArrayBuilder arrPackedData;
+    arrPackedData.setDataType(PACKED_DATA_ARRAY_TYPE);
+    arrPackedData.setName(PACKED_DATA_ARRAY_NAME);
+    arrPackedData.setSizeDescriptor(Converter::toString((int)packedData.size()));
+
+    for (size_t i = 0; i < packedData.size(); i++) {
+        string element = "0x" + Converter::toHex(packedData[i], 2);
+        arrPackedData.appendElement(element);
+
+        if (i != (packedData.size() - 1)) {
+            arrPackedData.newElement();
         }
     }
 
@@ -318,11 +474,31 @@ void BidiTypeLookupGenerator::generateFile(const std::string &directory) {
         segmentStart += m_branchSegmentSize;
     }
 
+    /* Index the data of BMP directly so that 16-bit code units need a single indirection. */
+    size_t bmpIndexesSize = BMP_CODE_POINT_COUNT / m_mainSegmentSize;
+
+    ArrayBuilder arrBMPIndexes;
+    arrBMPIndexes.setDataType(BMP_INDEXES_ARRAY_TYPE);
+    arrBMPIndexes.setName(BMP_INDEXES_ARRAY_NAME);
+    arrBMPIndexes.setSizeDescriptor(Converter::toString((int)bmpIndexesSize));
+
+    for (size_t i = 0; i < bmpIndexesSize; i++) {
+        string element = "0x" + Converter::toHex(m_dataReferences.at(i)->index, 4);
+        arrBMPIndexes.appendElement(element);
+
+        if (i != (bmpIndexesSize - 1)) {
+            arrBMPIndexes.newElement();
+        }
+    }
+
     TextBuilder lookupFunction;
     string maxUnicode = "0x" + Converter::toHex(m_lastCodePoint, 6);
     string mainDivider = "0x" + Converter::toHex(m_mainSegmentSize, 4);
     string branchDivider = "0x" + Converter::toHex(m_mainSegmentSize * m_branchSegmentSize, 4);
-    lookupFunction.append("SB_INTERNAL SBBidiType LookupBidiType(SBCodepoint codepoint)").newLine();
+    string twoStageDivider = "0x" + Converter::toHex(TWO_STAGE_SEGMENT_SIZE, 4);
+    lookupFunction.append("#ifdef BIDI_TYPE_TRIE_LAYOUT").newLine();
+    lookupFunction.newLine();
+    lookupFunction.append("LAYOUT_FUNCTION SBBidiType LookupBidiTypeTrie(SBCodepoint codepoint)").newLine();
     lookupFunction.append("{").newLine();
     lookupFunction.appendTabs(1).append("if (codepoint <= " + maxUnicode + ") {").newLine();
     lookupFunction.appendTabs(2).append("return PrimaryBidiTypeData[").newLine();
@@ -336,6 +512,98 @@ void BidiTypeLookupGenerator::generateFile(const std::string &directory) {
     lookupFunction.newLine();
     lookupFunction.appendTabs(1).append("return ON;").newLine();
     lookupFunction.append("}").newLine();
+    lookupFunction.newLine();
+    lookupFunction.append("LAYOUT_FUNCTION SBBidiType LookupBidiTypeTrieBMP(SBUInt16 codeunit)").newLine();
+    lookupFunction.append("{").newLine();
+    lookupFunction.appendTabs(1).append("return PrimaryBidiTypeData[").newLine();
+    lookupFunction.appendTabs(1).append("        BMPBidiTypeIndexes[codeunit / " + mainDivider + "]").newLine();
+    lookupFunction.appendTabs(1).append("         + codeunit % " + mainDivider).newLine();
+    lookupFunction.appendTabs(1).append("       ];").newLine();
+    lookupFunction.append("}").newLine();
+    lookupFunction.newLine();
+    lookupFunction.append("#endif").newLine();
+    lookupFunction.newLine();
+    lookupFunction.append("#ifdef BIDI_TYPE_PACKED_LAYOUT").newLine();
+    lookupFunction.newLine();
+    lookupFunction.append("static SBBidiType GetPackedBidiType(SBUInt32 index)").newLine();
+    lookupFunction.append("{").newLine();
+    lookupFunction.appendTabs(1).append("SBUInt32 bit = index * " + Converter::toString((int)PACKED_BITS) + ";").newLine();
+    lookupFunction.appendTabs(1).append("SBUInt32 unit = PackedBidiTypeData[bit / 8]").newLine();
+    lookupFunction.appendTabs(1).append("             | (PackedBidiTypeData[bit / 8 + 1] << 8);").newLine();
+    lookupFunction.newLine();
+    lookupFunction.appendTabs(1).append("return (SBBidiType)((unit >> (bit % 8)) & 0x" + Converter::toHex((1 << PACKED_BITS) - 1, 2) + ");").newLine();
+    lookupFunction.append("}").newLine();
+    lookupFunction.newLine();
+    lookupFunction.append("LAYOUT_FUNCTION SBBidiType LookupBidiTypePacked(SBCodepoint codepoint)").newLine();
+    lookupFunction.append("{").newLine();
+    lookupFunction.appendTabs(1).append("if (codepoint <= " + maxUnicode + ") {").newLine();
+    lookupFunction.appendTabs(2).append("return GetPackedBidiType(").newLine();
+    lookupFunction.appendTabs(2).append("        MainBidiTypeIndexes[").newLine();
+    lookupFunction.appendTabs(2).append("         BranchBidiTypeIndexes[").newLine();
+    lookupFunction.appendTabs(2).append("              codepoint / " + branchDivider).newLine();
+    lookupFunction.appendTabs(2).append("         ] + (codepoint % " + branchDivider + ") / " + mainDivider).newLine();
+    lookupFunction.appendTabs(2).append("        ] + codepoint % " + mainDivider).newLine();
+    lookupFunction.appendTabs(2).append("       );").newLine();
+    lookupFunction.appendTabs(1).append("}").newLine();
+    lookupFunction.newLine();
+    lookupFunction.appendTabs(1).append("return ON;").newLine();
+    lookupFunction.append("}").newLine();
+    lookupFunction.newLine();
+    lookupFunction.append("LAYOUT_FUNCTION SBBidiType LookupBidiTypePackedBMP(SBUInt16 codeunit)").newLine();
+    lookupFunction.append("{").newLine();
+    lookupFunction.appendTabs(1).append("return GetPackedBidiType(").newLine();
+    lookupFunction.appendTabs(1).append("        BMPBidiTypeIndexes[codeunit / " + mainDivider + "]").newLine();
+    lookupFunction.appendTabs(1).append("         + codeunit % " + mainDivider).newLine();
+    lookupFunction.appendTabs(1).append("       );").newLine();
+    lookupFunction.append("}").newLine();
+    lookupFunction.newLine();
+    lookupFunction.append("#endif").newLine();
+    lookupFunction.newLine();
+    lookupFunction.append("#ifdef BIDI_TYPE_TWO_STAGE_LAYOUT").newLine();
+    lookupFunction.newLine();
+    lookupFunction.append("LAYOUT_FUNCTION SBBidiType LookupBidiTypeTwoStage(SBCodepoint codepoint)").newLine();
+    lookupFunction.append("{").newLine();
+    lookupFunction.appendTabs(1).append("if (codepoint <= " + maxUnicode + ") {").newLine();
+    lookupFunction.appendTabs(2).append("return TwoStageBidiTypeData[").newLine();
+    lookupFunction.appendTabs(2).append("        TwoStageBidiTypeIndexes[codepoint / " + twoStageDivider + "]").newLine();
+    lookupFunction.appendTabs(2).append("         + codepoint % " + twoStageDivider).newLine();
+    lookupFunction.appendTabs(2).append("       ];").newLine();
+    lookupFunction.appendTabs(1).append("}").newLine();
+    lookupFunction.newLine();
+    lookupFunction.appendTabs(1).append("return ON;").newLine();
+    lookupFunction.append("}").newLine();
+    lookupFunction.newLine();
+    lookupFunction.append("LAYOUT_FUNCTION SBBidiType LookupBidiTypeTwoStageBMP(SBUInt16 codeunit)").newLine();
+    lookupFunction.append("{").newLine();
+    lookupFunction.appendTabs(1).append("return TwoStageBidiTypeData[").newLine();
+    lookupFunction.appendTabs(1).append("        TwoStageBidiTypeIndexes[codeunit / " + twoStageDivider + "]").newLine();
+    lookupFunction.appendTabs(1).append("         + codeunit % " + twoStageDivider).newLine();
+    lookupFunction.appendTabs(1).append("       ];").newLine();
+    lookupFunction.append("}").newLine();
+    lookupFunction.newLine();
+    lookupFunction.append("#endif").newLine();
+    lookupFunction.newLine();
+    lookupFunction.append("SB_INTERNAL SBBidiType LookupBidiType(SBCodepoint codepoint)").newLine();
+    lookupFunction.append("{").newLine();
+    lookupFunction.append("#if defined(SB_CONFIG_BIDI_TYPE_PACKED)").newLine();
+    lookupFunction.appendTabs(1).append("return LookupBidiTypePacked(codepoint);").newLine();
+    lookupFunction.append("#elif defined(SB_CONFIG_BIDI_TYPE_TWO_STAGE)").newLine();
+    lookupFunction.appendTabs(1).append("return LookupBidiTypeTwoStage(codepoint);").newLine();
+    lookupFunction.append("#else").newLine();
+    lookupFunction.appendTabs(1).append("return LookupBidiTypeTrie(codepoint);").newLine();
+    lookupFunction.append("#endif").newLine();
+    lookupFunction.append("}").newLine();
+    lookupFunction.newLine();
+    lookupFunction.append("SB_INTERNAL SBBidiType LookupBidiTypeBMP(SBUInt16 codeunit)").newLine();
+    lookupFunction.append("{").newLine();
+    lookupFunction.append("#if defined(SB_CONFIG_BIDI_TYPE_PACKED)").newLine();
+    lookupFunction.appendTabs(1).append("return LookupBidiTypePackedBMP(codeunit);").newLine();
+    lookupFunction.append("#elif defined(SB_CONFIG_BIDI_TYPE_TWO_STAGE)").newLine();
+    lookupFunction.appendTabs(1).append("return LookupBidiTypeTwoStageBMP(codeunit);").newLine();
+    lookupFunction.append("#else").newLine();
+    lookupFunction.appendTabs(1).append("return LookupBidiTypeTrieBMP(codeunit);").newLine();
+    lookupFunction.append("#endif").newLine();
+    lookupFunction.append("}").newLine();
 
     FileBuilder header(directory + "/BidiTypeLookup.h");
     header.append("/*").newLine();
@@ -352,6 +620,18 @@ void BidiTypeLookupGenerator::generateFile(const std::string &directory) {
     header.append("#include \"SBBase.h\"").newLine();
     header.newLine();
     header.append("SB_INTERNAL SBBidiType LookupBidiType(SBCodepoint codepoint);").newLine();
+    header.append("SB_INTERNAL SBBidiType LookupBidiTypeBMP(SBUInt16 codeunit);").newLine();
+    header.newLine();
+    header.append("#ifdef SB_CONFIG_ALL_LOOKUP_LAYOUTS").newLine();
+    header.newLine();
+    header.append("SB_INTERNAL SBBidiType LookupBidiTypeTrie(SBCodepoint codepoint);").newLine();
+    header.append("SB_INTERNAL SBBidiType LookupBidiTypeTrieBMP(SBUInt16 codeunit);").newLine();
+    header.append("SB_INTERNAL SBBidiType LookupBidiTypePacked(SBCodepoint codepoint);").newLine();
+    header.append("SB_INTERNAL SBBidiType LookupBidiTypePackedBMP(SBUInt16 codeunit);").newLine();
+    header.append("SB_INTERNAL SBBidiType LookupBidiTypeTwoStage(SBCodepoint codepoint);").newLine();
+    header.append("SB_INTERNAL SBBidiType LookupBidiTypeTwoStageBMP(SBUInt16 codeunit);").newLine();
+    header.newLine();
+    header.append("#endif").newLine();
     header.newLine();
     header.append("#endif").newLine();
 
@@ -362,23 +642,81 @@ void BidiTypeLookupGenerator::generateFile(const std::string &directory) {
     source.append(" *").newLine();
     source.append(" * REQUIRED MEMORY: " + Converter::toString((int)m_dataSize)
                   + "+(" + Converter::toString((int)m_mainIndexesSize) + "*2)+("
-                  + Converter::toString((int)m_branchIndexesSize) + "*2) = "
-                  + Converter::toString((int)(m_dataSize + m_mainIndexesSize*2 + m_branchIndexesSize*2))
+                  + Converter::toString((int)m_branchIndexesSize) + "*2)+("
+                  + Converter::toString((int)bmpIndexesSize) + "*2) = "
+                  + Converter::toString((int)(m_dataSize + m_mainIndexesSize*2 + m_branchIndexesSize*2
+                                              + bmpIndexesSize*2))
+                  + " Bytes").newLine();
+    source.append(" * PACKED LAYOUT MEMORY: " + Converter::toString((int)packedData.size())
+                  + "+(" + Converter::toString((int)m_mainIndexesSize) + "*2)+("
+                  + Converter::toString((int)m_branchIndexesSize) + "*2)+("
+                  + Converter::toString((int)bmpIndexesSize) + "*2) = "
+                  + Converter::toString((int)(packedData.size() + m_mainIndexesSize*2 + m_branchIndexesSize*2
+                                              + bmpIndexesSize*2))
+                  + " Bytes").newLine();
+    source.append(" * TWO STAGE LAYOUT MEMORY: " + Converter::toString((int)twoStageDataSize)
+                  + "+(" + Converter::toString((int)twoStageIndexesSize) + "*2) = "
+                  + Converter::toString((int)(twoStageDataSize + twoStageIndexesSize*2))
                   + " Bytes").newLine();
     source.append(" */").newLine();
     source.newLine();
     source.append("#include \"BidiTypeLookup.h\"").newLine();
     source.newLine();
+    source.append("#if defined(SB_CONFIG_BIDI_TYPE_PACKED) && defined(SB_CONFIG_BIDI_TYPE_TWO_STAGE)").newLine();
+    source.append("#error Only one bidi type layout can be configured.").newLine();
+    source.append("#endif").newLine();
+    source.newLine();
+    source.append("#ifdef SB_CONFIG_ALL_LOOKUP_LAYOUTS").newLine();
+    source.append("#define BIDI_TYPE_TRIE_LAYOUT").newLine();
+    source.append("#define BIDI_TYPE_PACKED_LAYOUT").newLine();
+    source.append("#define BIDI_TYPE_TWO_STAGE_LAYOUT").newLine();
+    source.append("#define LAYOUT_FUNCTION SB_INTERNAL").newLine();
+    source.append("#else").newLine();
+    source.append("#if defined(SB_CONFIG_BIDI_TYPE_PACKED)").newLine();
+    source.append("#define BIDI_TYPE_PACKED_LAYOUT").newLine();
+    source.append("#elif defined(SB_CONFIG_BIDI_TYPE_TWO_STAGE)").newLine();
+    source.append("#define BIDI_TYPE_TWO_STAGE_LAYOUT").newLine();
+    source.append("#else").newLine();
+    source.append("#define BIDI_TYPE_TRIE_LAYOUT").newLine();
+    source.append("#endif").newLine();
+    source.append("#define LAYOUT_FUNCTION static").newLine();
+    source.append("#endif").newLine();
+    source.newLine();
     for (auto ct : bidiTypes) {
         string str = ct + string(3 - ct.length(), ' ');
         source.append("#define " + str).appendTab().append(" SBBidiType" + str).newLine();
     }
     source.newLine();
+    source.append("#ifdef BIDI_TYPE_TRIE_LAYOUT").newLine();
+    source.newLine();
     source.append(arrData).newLine();
+    source.append("#endif").newLine();
+    source.newLine();
+    source.append("#ifdef BIDI_TYPE_PACKED_LAYOUT").newLine();
+    source.newLine();
+    source.append(arrPackedData).newLine();
+    source.append("#endif").newLine();
+    source.newLine();
+    source.append("#if defined(BIDI_TYPE_TRIE_LAYOUT) || defined(BIDI_TYPE_PACKED_LAYOUT)").newLine();
+    source.newLine();
     source.append(arrMainIndexes).newLine();
     source.append(arrBranchIndexes).newLine();
+    source.append(arrBMPIndexes).newLine();
+    source.append("#endif").newLine();
+    source.newLine();
+    source.append("#ifdef BIDI_TYPE_TWO_STAGE_LAYOUT").newLine();
+    source.newLine();
+    source.append(arrTwoStageData).newLine();
+    source.append(arrTwoStageIndexes).newLine();
+    source.append("#endif").newLine();
+    source.newLine();
     source.append(lookupFunction).newLine();
     for (auto ct : bidiTypes) {
         source.append("#undef " + ct).newLine();
     }
+    source.newLine();
+    source.append("#undef BIDI_TYPE_TRIE_LAYOUT").newLine();
+    source.append("#undef BIDI_TYPE_PACKED_LAYOUT").newLine();
+    source.append("#undef BIDI_TYPE_TWO_STAGE_LAYOUT").newLine();
+    source.append("#undef LAYOUT_FUNCTION").newLine();
 }
@@ -19,10 +19,14 @@
 
 #include <map>
 #include <memory>
+#include <ostream>
+#include <set>
 #include <sstream>
+#include <string>
 
 #include <Parser/DerivedBidiClass.h>
 
+#include "Utilities/ArrayBuilder.h"
 #include "Utilities/BidiClassDetector.h"
 
 namespace SheenBidi {
@@ -38,6 +42,7 @@ public:
     void displayBidiClassesFrequency();
 
     void analyzeData();
+    void tuneSegmentSizes(std::ostream &report);
     void generateFile(const std::string &directory);
 
 private:
@@ -81,6 +86,8 @@ private:
 
     void collectMainData();
     void collectBranchData();
+
+    void fillDataArray(Utilities::ArrayBuilder &array, std::set<std::string> &bidiTypes) const;
 };
 
 }
@@ -19,6 +19,7 @@
 
 #include <map>
 #include <memory>
+#include <ostream>
 #include <sstream>
 
 #include <Parser/UnicodeData.h>
@@ -38,6 +39,7 @@ public:
     void displayGeneralCategoriesFrequency();
 
     void analyzeData();
+    void tuneSegmentSizes(std::ostream &report);
     void generateFile(const std::string &directory);
 
 private:
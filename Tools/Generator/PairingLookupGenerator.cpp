@@ -28,6 +28,7 @@ extern "C" {
 #include "Utilities/Converter.h"
 #include "Utilities/ArrayBuilder.h"
 #include "Utilities/FileBuilder.h"
+#include "Utilities/LookupTuner.h"
 
 #include "PairingLookupGenerator.h"
 
@@ -48,6 +49,12 @@ static const string DATA_ARRAY_NAME = "PairData";
 static const string INDEXES_ARRAY_TYPE = "static const SBUInt16";
 static const string INDEXES_ARRAY_NAME = "PairIndexes";
 
+static const string RANGE_STARTS_ARRAY_TYPE = "static const SBUInt16";
+static const string RANGE_STARTS_ARRAY_NAME = "PairRangeStarts";
+
+static const string RANGE_DATA_ARRAY_TYPE = "static const SBUInt8";
+static const string RANGE_DATA_ARRAY_NAME = "PairRangeData";
+
 PairingLookupGenerator::DataSegment::DataSegment(size_t index, DataSet dataset)
     : index(index)
     , dataset(dataset)
@@ -97,6 +104,35 @@ void PairingLookupGenerator::analyzeData() {
     cout << "Finished analysis." << endl << endl;
 }
 
+void PairingLookupGenerator::tuneSegmentSizes(ostream &report) {
+    cout << "Tuning segment size for pairing lookup." << endl;
+
+    LookupTuner tuner("PairingLookup", m_lastCodePoint);
+
+    for (size_t segmentSize : LookupTuner::candidateSizes(m_segmentSize)) {
+        m_segmentSize = segmentSize;
+        collectData();
+
+        vector<uint8_t> data;
+        for (const DataSegment &segment : m_data) {
+            data.insert(data.end(), segment.dataset->begin(), segment.dataset->end());
+        }
+
+        vector<uint16_t> indexes;
+        for (const DataSegment *reference : m_indexes) {
+            indexes.push_back((uint16_t)reference->index);
+        }
+
+        size_t memory = m_dataSize + (m_differencesSize * 2) + (m_indexesSize * 2);
+        tuner.addCandidate(segmentSize, memory, data, indexes);
+    }
+
+    m_segmentSize = tuner.bestMainSegmentSize();
+    tuner.writeReport(report);
+
+    cout << "  Segment Size: " << m_segmentSize << endl << endl;
+}
+
 void PairingLookupGenerator::collectData() {
     size_t pairCount = m_lastCodePoint - m_firstCodePoint;
     size_t maxSegments = Math::FastCeil(pairCount, m_segmentSize);
@@ -249,52 +285,102 @@ void PairingLookupGenerator::generateFile(const std::string &directory) {
         segmentStart += m_segmentSize;
     }
 
-    TextBuilder mirror;
+    /* Merge the consecutive code points having same data into ranges. */
+    vector<uint32_t> rangeStarts;
+    vector<uint8_t> rangeData;
+
+    for (uint32_t codePoint = m_firstCodePoint; codePoint <= m_lastCodePoint; codePoint++) {
+        size_t offset = codePoint - m_firstCodePoint;
+        uint8_t data = m_indexes.at(offset / m_segmentSize)->dataset->at(offset % m_segmentSize);
+
+        if (rangeData.empty() || rangeData.back() != data) {
+            rangeStarts.push_back(codePoint);
+            rangeData.push_back(data);
+        }
+    }
+
+    size_t rangesSize = rangeStarts.size();
+
+    ArrayBuilder arrRangeStarts;
+    arrRangeStarts.setDataType(RANGE_STARTS_ARRAY_TYPE);
+    arrRangeStarts.setName(RANGE_STARTS_ARRAY_NAME);
+    arrRangeStarts.setSizeDescriptor(Converter::toString((int)rangesSize));
+
+    ArrayBuilder arrRangeData;
+    arrRangeData.setDataType(RANGE_DATA_ARRAY_TYPE);
+    arrRangeData.setName(RANGE_DATA_ARRAY_NAME);
+    arrRangeData.setElementSpace(3);
+    arrRangeData.setSizeDescriptor(Converter::toString((int)rangesSize));
+
+    for (size_t i = 0; i < rangesSize; i++) {
+        bool isLast = (i == (rangesSize - 1));
+
+        arrRangeStarts.appendElement("0x" + Converter::toHex(rangeStarts[i], 4));
+        arrRangeData.appendElement(Converter::toString(rangeData[i]));
+
+        if (!isLast) {
+            arrRangeStarts.newElement();
+            arrRangeData.newElement();
+        }
+    }
+
     string maxCodePoint = "0x" + Converter::toHex(m_lastCodePoint, 4);
     string segmentSize = "0x" + Converter::toHex(m_segmentSize, 3);
-    mirror.append("").newLine();
-    mirror.append("SB_INTERNAL SBCodepoint LookupMirror(SBCodepoint codepoint)").newLine();
-    mirror.append("{").newLine();
-    mirror.appendTabs(1).append("if (codepoint <= " + maxCodePoint + ") {").newLine();
-    mirror.appendTabs(2).append("SBInt16 diff = PairDifferences[").newLine();
-    mirror.appendTabs(2).append("                PairData[").newLine();
-    mirror.appendTabs(2).append("                 PairIndexes[").newLine();
-    mirror.appendTabs(2).append("                      codepoint / " + segmentSize).newLine();
-    mirror.appendTabs(2).append("                 ] + (codepoint % " + segmentSize + ")").newLine();
-    mirror.appendTabs(2).append("                ] & BracketTypeInverseMask").newLine();
-    mirror.appendTabs(2).append("               ];").newLine();
-    mirror.newLine();
-    mirror.appendTabs(2).append("if (diff != 0) {").newLine();
-    mirror.appendTabs(3).append("return (codepoint + diff);").newLine();
-    mirror.appendTabs(2).append("}").newLine();
-    mirror.appendTabs(1).append("}").newLine();
-    mirror.newLine();
-    mirror.appendTabs(1).append("return 0;").newLine();
-    mirror.append("}").newLine();
-
-    TextBuilder bracket;
-    bracket.append("SB_INTERNAL SBCodepoint LookupBracketPair(SBCodepoint codepoint, BracketType *type)").newLine();
-    bracket.append("{").newLine();
-    bracket.appendTabs(1).append("if (codepoint <= " + maxCodePoint + ") {").newLine();
-    bracket.appendTabs(2).append("SBUInt8 data = PairData[").newLine();
-    bracket.appendTabs(2).append("                PairIndexes[").newLine();
-    bracket.appendTabs(2).append("                     codepoint / " + segmentSize).newLine();
-    bracket.appendTabs(2).append("                ] + (codepoint % " + segmentSize + ")").newLine();
-    bracket.appendTabs(2).append("               ];").newLine();
-    bracket.appendTabs(2).append("*type = (data & BracketTypePrimaryMask);").newLine();
-    bracket.newLine();
-    bracket.appendTabs(2).append("if (*type != 0) {").newLine();
-    bracket.appendTabs(3).append("SBInt16 diff = PairDifferences[").newLine();
-    bracket.appendTabs(3).append("                data & BracketTypeInverseMask").newLine();
-    bracket.appendTabs(3).append("               ];").newLine();
-    bracket.appendTabs(3).append("return (codepoint + diff);").newLine();
-    bracket.appendTabs(2).append("}").newLine();
-    bracket.appendTabs(1).append("} else {").newLine();
-    bracket.appendTabs(2).append("*type = BracketTypeNone;").newLine();
-    bracket.appendTabs(1).append("}").newLine();
-    bracket.newLine();
-    bracket.appendTabs(1).append("return 0;").newLine();
-    bracket.append("}").newLine();
+
+    string tableData = "PairData[PairIndexes[codepoint / " + segmentSize + "] + (codepoint % " + segmentSize + ")]";
+    string rangesData = "SearchPairRange(codepoint)";
+
+    TextBuilder search;
+    search.append("static SBUInt8 SearchPairRange(SBCodepoint codepoint)").newLine();
+    search.append("{").newLine();
+    search.appendTabs(1).append("const SBUInt16 *start = PairRangeStarts;").newLine();
+    search.appendTabs(1).append("SBUInteger length = " + Converter::toString((int)rangesSize) + ";").newLine();
+    search.newLine();
+    search.appendTabs(1).append("/* Narrow down the range without branching on the comparison. */").newLine();
+    search.appendTabs(1).append("while (length > 1) {").newLine();
+    search.appendTabs(2).append("SBUInteger half = length / 2;").newLine();
+    search.appendTabs(2).append("start = (start[half] <= codepoint ? start + half : start);").newLine();
+    search.appendTabs(2).append("length -= half;").newLine();
+    search.appendTabs(1).append("}").newLine();
+    search.newLine();
+    search.appendTabs(1).append("return PairRangeData[start - PairRangeStarts];").newLine();
+    search.append("}").newLine();
+
+    TextBuilder lookup;
+    lookup.append("#ifdef PAIRING_TABLE_LAYOUT").newLine();
+    lookup.newLine();
+    appendMirrorFunction(lookup, "LookupMirrorTable", maxCodePoint, tableData);
+    lookup.newLine();
+    appendBracketFunction(lookup, "LookupBracketPairTable", maxCodePoint, tableData);
+    lookup.newLine();
+    lookup.append("#endif").newLine();
+    lookup.newLine();
+    lookup.append("#ifdef PAIRING_RANGES_LAYOUT").newLine();
+    lookup.newLine();
+    lookup.append(search).newLine();
+    appendMirrorFunction(lookup, "LookupMirrorRanges", maxCodePoint, rangesData);
+    lookup.newLine();
+    appendBracketFunction(lookup, "LookupBracketPairRanges", maxCodePoint, rangesData);
+    lookup.newLine();
+    lookup.append("#endif").newLine();
+    lookup.newLine();
+    lookup.append("SB_INTERNAL SBCodepoint LookupMirror(SBCodepoint codepoint)").newLine();
+    lookup.append("{").newLine();
+    lookup.append("#ifdef SB_CONFIG_PAIRING_RANGES").newLine();
+    lookup.appendTabs(1).append("return LookupMirrorRanges(codepoint);").newLine();
+    lookup.append("#else").newLine();
+    lookup.appendTabs(1).append("return LookupMirrorTable(codepoint);").newLine();
+    lookup.append("#endif").newLine();
+    lookup.append("}").newLine();
+    lookup.newLine();
+    lookup.append("SB_INTERNAL SBCodepoint LookupBracketPair(SBCodepoint codepoint, BracketType *type)").newLine();
+    lookup.append("{").newLine();
+    lookup.append("#ifdef SB_CONFIG_PAIRING_RANGES").newLine();
+    lookup.appendTabs(1).append("return LookupBracketPairRanges(codepoint, type);").newLine();
+    lookup.append("#else").newLine();
+    lookup.appendTabs(1).append("return LookupBracketPairTable(codepoint, type);").newLine();
+    lookup.append("#endif").newLine();
+    lookup.append("}").newLine();
 
     FileBuilder header(directory + "/PairingLookup.h");
     header.append("/*").newLine();
@@ -313,6 +399,15 @@ void PairingLookupGenerator::generateFile(const std::string &directory) {
     header.append("SB_INTERNAL SBCodepoint LookupMirror(SBCodepoint codepoint);").newLine();
     header.append("SB_INTERNAL SBCodepoint LookupBracketPair(SBCodepoint codepoint, BracketType *bracketType);").newLine();
     header.newLine();
+    header.append("#ifdef SB_CONFIG_ALL_LOOKUP_LAYOUTS").newLine();
+    header.newLine();
+    header.append("SB_INTERNAL SBCodepoint LookupMirrorTable(SBCodepoint codepoint);").newLine();
+    header.append("SB_INTERNAL SBCodepoint LookupBracketPairTable(SBCodepoint codepoint, BracketType *bracketType);").newLine();
+    header.append("SB_INTERNAL SBCodepoint LookupMirrorRanges(SBCodepoint codepoint);").newLine();
+    header.append("SB_INTERNAL SBCodepoint LookupBracketPairRanges(SBCodepoint codepoint, BracketType *bracketType);").newLine();
+    header.newLine();
+    header.append("#endif").newLine();
+    header.newLine();
     header.append("#endif").newLine();
 
     FileBuilder source(directory + "/PairingLookup.c");
@@ -325,15 +420,88 @@ void PairingLookupGenerator::generateFile(const std::string &directory) {
                   + Converter::toString((int)m_indexesSize) + "*2) = "
                   + Converter::toString((int)(m_differencesSize*2 + m_dataSize + m_indexesSize*2))
                   + " Bytes").newLine();
+    source.append(" * RANGES LAYOUT MEMORY: (" + Converter::toString((int)m_differencesSize)
+                  + ")+(" + Converter::toString((int)rangesSize) + "*2)+"
+                  + Converter::toString((int)rangesSize) + " = "
+                  + Converter::toString((int)(m_differencesSize*2 + rangesSize*3))
+                  + " Bytes").newLine();
     source.append(" */").newLine();
     source.newLine();
     source.append("#include \"PairingLookup.h\"").newLine();
     source.newLine();
+    source.append("#ifdef SB_CONFIG_ALL_LOOKUP_LAYOUTS").newLine();
+    source.append("#define PAIRING_TABLE_LAYOUT").newLine();
+    source.append("#define PAIRING_RANGES_LAYOUT").newLine();
+    source.append("#define LAYOUT_FUNCTION SB_INTERNAL").newLine();
+    source.append("#else").newLine();
+    source.append("#ifdef SB_CONFIG_PAIRING_RANGES").newLine();
+    source.append("#define PAIRING_RANGES_LAYOUT").newLine();
+    source.append("#else").newLine();
+    source.append("#define PAIRING_TABLE_LAYOUT").newLine();
+    source.append("#endif").newLine();
+    source.append("#define LAYOUT_FUNCTION static").newLine();
+    source.append("#endif").newLine();
+    source.newLine();
     source.append(arrDifferences);
     source.newLine();
+    source.append("#ifdef PAIRING_TABLE_LAYOUT").newLine();
+    source.newLine();
     source.append(arrData);
     source.newLine();
     source.append(arrIndexes);
-    source.append(mirror).newLine();
-    source.append(bracket);
+    source.newLine();
+    source.append("#endif").newLine();
+    source.newLine();
+    source.append("#ifdef PAIRING_RANGES_LAYOUT").newLine();
+    source.newLine();
+    source.append(arrRangeStarts);
+    source.newLine();
+    source.append(arrRangeData);
+    source.newLine();
+    source.append("#endif").newLine();
+    source.newLine();
+    source.append(lookup).newLine();
+    source.append("#undef PAIRING_TABLE_LAYOUT").newLine();
+    source.append("#undef PAIRING_RANGES_LAYOUT").newLine();
+    source.append("#undef LAYOUT_FUNCTION").newLine();
+}
+
+void PairingLookupGenerator::appendMirrorFunction(TextBuilder &builder, const string &name,
+    const string &maxCodePoint, const string &data) {
+    builder.append("LAYOUT_FUNCTION SBCodepoint " + name + "(SBCodepoint codepoint)").newLine();
+    builder.append("{").newLine();
+    builder.appendTabs(1).append("if (codepoint <= " + maxCodePoint + ") {").newLine();
+    builder.appendTabs(2).append("SBInt16 diff = PairDifferences[").newLine();
+    builder.appendTabs(2).append("                " + data + " & BracketTypeInverseMask").newLine();
+    builder.appendTabs(2).append("               ];").newLine();
+    builder.newLine();
+    builder.appendTabs(2).append("if (diff != 0) {").newLine();
+    builder.appendTabs(3).append("return (codepoint + diff);").newLine();
+    builder.appendTabs(2).append("}").newLine();
+    builder.appendTabs(1).append("}").newLine();
+    builder.newLine();
+    builder.appendTabs(1).append("return 0;").newLine();
+    builder.append("}").newLine();
+}
+
+void PairingLookupGenerator::appendBracketFunction(TextBuilder &builder, const string &name,
+    const string &maxCodePoint, const string &data) {
+    builder.append("LAYOUT_FUNCTION SBCodepoint " + name + "(SBCodepoint codepoint, BracketType *type)").newLine();
+    builder.append("{").newLine();
+    builder.appendTabs(1).append("if (codepoint <= " + maxCodePoint + ") {").newLine();
+    builder.appendTabs(2).append("SBUInt8 data = " + data + ";").newLine();
+    builder.appendTabs(2).append("*type = (data & BracketTypePrimaryMask);").newLine();
+    builder.newLine();
+    builder.appendTabs(2).append("if (*type != 0) {").newLine();
+    builder.appendTabs(3).append("SBInt16 diff = PairDifferences[").newLine();
+    builder.appendTabs(3).append("                data & BracketTypeInverseMask").newLine();
+    builder.appendTabs(3).append("               ];").newLine();
+    builder.appendTabs(3).append("return (codepoint + diff);").newLine();
+    builder.appendTabs(2).append("}").newLine();
+    builder.appendTabs(1).append("} else {").newLine();
+    builder.appendTabs(2).append("*type = BracketTypeNone;").newLine();
+    builder.appendTabs(1).append("}").newLine();
+    builder.newLine();
+    builder.appendTabs(1).append("return 0;").newLine();
+    builder.append("}").newLine();
 }
@@ -19,11 +19,14 @@
 
 #include <iomanip>
 #include <memory>
+#include <ostream>
 #include <sstream>
 
 #include <Parser/BidiMirroring.h>
 #include <Parser/BidiBrackets.h>
 
+#include "Utilities/TextBuilder.h"
+
 namespace SheenBidi {
 namespace Generator {
 
@@ -34,6 +37,7 @@ public:
     void setSegmentSize(size_t);
 
     void analyzeData();
+    void tuneSegmentSizes(std::ostream &report);
     void generateFile(const std::string &directory);
 
 private:
@@ -64,6 +68,11 @@ private:
     size_t m_indexesSize;
 
     void collectData();
+
+    static void appendMirrorFunction(Utilities::TextBuilder &builder, const std::string &name,
+        const std::string &maxCodePoint, const std::string &data);
+    static void appendBracketFunction(Utilities::TextBuilder &builder, const std::string &name,
+        const std::string &maxCodePoint, const std::string &data);
 };
 
 }
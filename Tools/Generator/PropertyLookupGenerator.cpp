@@ -0,0 +1,574 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+extern "C" {
+#include <Source/BracketType.h>
+}
+
+#include "Utilities/Math.h"
+#include "Utilities/Converter.h"
+#include "Utilities/ArrayBuilder.h"
+#include "Utilities/FileBuilder.h"
+#include "Utilities/LookupTuner.h"
+
+#include "PropertyLookupGenerator.h"
+
+using namespace std;
+using namespace SheenBidi::Parser;
+using namespace SheenBidi::Generator;
+using namespace SheenBidi::Generator::Utilities;
+
+static const size_t MIN_MAIN_SEGMENT_SIZE = 8;
+static const size_t MAX_MAIN_SEGMENT_SIZE = 512;
+
+static const size_t MIN_BRANCH_SEGMENT_SIZE = 8;
+static const size_t MAX_BRANCH_SEGMENT_SIZE = 512;
+
+static const string DIFFERENCES_ARRAY_TYPE = "static const SBInt16";
+static const string DIFFERENCES_ARRAY_NAME = "PropertyPairDifferences";
+
+static const string RECORDS_ARRAY_TYPE = "static const PropertyRecord";
+static const string RECORDS_ARRAY_NAME = "PropertyRecords";
+
+static const string DATA_ARRAY_TYPE = "static const SBUInt16";
+static const string DATA_ARRAY_NAME = "PrimaryPropertyData";
+
+static const string MAIN_INDEXES_ARRAY_TYPE = "static const SBUInt16";
+static const string MAIN_INDEXES_ARRAY_NAME = "MainPropertyIndexes";
+
+static const string BRANCH_INDEXES_ARRAY_TYPE = "static const SBUInt16";
+static const string BRANCH_INDEXES_ARRAY_NAME = "BranchPropertyIndexes";
+
+PropertyLookupGenerator::MainDataSegment::MainDataSegment(size_t index, MainDataSet dataset)
+    : index(index)
+    , dataset(dataset)
+{
+}
+
+const string PropertyLookupGenerator::MainDataSegment::hintLine() const {
+    return ("/* DATA_BLOCK: -- 0x" + Converter::toHex(index, 4) + "..0x" + Converter::toHex(index + dataset->size() - 1, 4) + " -- */");
+}
+
+PropertyLookupGenerator::BranchDataSegment::BranchDataSegment(size_t index, BranchDataSet dataset)
+    : index(index)
+    , dataset(dataset)
+{
+}
+
+const string PropertyLookupGenerator::BranchDataSegment::hintLine() const {
+    return ("/* INDEX_BLOCK: -- 0x" + Converter::toHex(index, 4) + "..0x" + Converter::toHex(index + dataset->size() - 1, 4) + " -- */");
+}
+
+PropertyLookupGenerator::PropertyLookupGenerator(const DerivedBidiClass &derivedBidiClass,
+                                                 const UnicodeData &unicodeData,
+                                                 const Scripts &scripts,
+                                                 const PropertyValueAliases &propertyValueAliases,
+                                                 const BidiMirroring &bidiMirroring,
+                                                 const BidiBrackets &bidiBrackets)
+    : m_bidiClassDetector(derivedBidiClass)
+    , m_generalCategoryDetector(unicodeData)
+    , m_scriptDetector(scripts, propertyValueAliases)
+    , m_bidiMirroring(bidiMirroring)
+    , m_bidiBrackets(bidiBrackets)
+    , m_lastCodePoint(max({ derivedBidiClass.lastCodePoint(), unicodeData.lastCodePoint(),
+                            scripts.lastCodePoint(), bidiMirroring.lastCodePoint(),
+                            bidiBrackets.lastCodePoint() }))
+    , m_mainSegmentSize(0)
+    , m_branchSegmentSize(0)
+{
+}
+
+void PropertyLookupGenerator::setMainSegmentSize(size_t segmentSize) {
+    m_mainSegmentSize = min(MAX_MAIN_SEGMENT_SIZE, max(MIN_MAIN_SEGMENT_SIZE, segmentSize));
+}
+
+void PropertyLookupGenerator::setBranchSegmentSize(size_t segmentSize) {
+    m_branchSegmentSize = min(MAX_BRANCH_SEGMENT_SIZE, max(MIN_BRANCH_SEGMENT_SIZE, segmentSize));
+}
+
+void PropertyLookupGenerator::analyzeData() {
+    cout << "Analyzing data for property lookup." << endl;
+
+    size_t minMemory = SIZE_MAX;
+    size_t mainSegmentSize = 0;
+    size_t branchSegmentSize = 0;
+
+    collectRecords();
+
+    m_mainSegmentSize = MIN_MAIN_SEGMENT_SIZE;
+    while (m_mainSegmentSize <= MAX_MAIN_SEGMENT_SIZE) {
+        collectMainData();
+
+        m_branchSegmentSize = MIN_BRANCH_SEGMENT_SIZE;
+        while (m_branchSegmentSize <= MAX_BRANCH_SEGMENT_SIZE) {
+            collectBranchData();
+
+            size_t memory = (m_dataSize + m_mainIndexesSize + m_branchIndexesSize) * 2;
+            if (memory < minMemory) {
+                mainSegmentSize = m_mainSegmentSize;
+                branchSegmentSize = m_branchSegmentSize;
+                minMemory = memory;
+            }
+
+            m_branchSegmentSize++;
+        }
+
+        m_mainSegmentSize++;
+    }
+
+    m_mainSegmentSize = mainSegmentSize;
+    m_branchSegmentSize = branchSegmentSize;
+
+    cout << "  Main Segment Size: " << mainSegmentSize << endl;
+    cout << "  Branch Segment Size: " << branchSegmentSize << endl;
+    cout << "  Required Memory: " << (minMemory + (m_records.size() * 4) + (m_differences.size() * 2)) << " bytes";
+}
+
+void PropertyLookupGenerator::collectRecords() {
+    uint8_t defaultBidiClass = m_bidiClassDetector.nameToNumber("ON");
+    map<Record, uint16_t> recordNumbers;
+
+    m_differences.clear();
+    m_differences.push_back(0);
+
+    m_records.clear();
+    m_recordIndexes.clear();
+    m_recordIndexes.reserve(m_lastCodePoint + 1);
+
+    /* The first record holds the properties of the code points beyond the last one. */
+    Record defaultRecord(defaultBidiClass, 0, 0, 0);
+    recordNumbers[defaultRecord] = 0;
+    m_records.push_back(defaultRecord);
+
+    for (uint32_t codePoint = 0; codePoint <= m_lastCodePoint; codePoint++) {
+        uint8_t bidiClass = m_bidiClassDetector.numberForCodePoint(codePoint);
+        uint8_t generalCategory = m_generalCategoryDetector.numberForCodePoint(codePoint);
+        uint8_t script = m_scriptDetector.numberForCodePoint(codePoint);
+
+        uint32_t mirror = m_bidiMirroring.mirrorForCodePoint(codePoint);
+        char bracketType = m_bidiBrackets.pairedBracketTypeForCodePoint(codePoint);
+        int16_t difference = (mirror ? mirror - codePoint : 0);
+
+        auto begin = m_differences.begin();
+        auto end = m_differences.end();
+        auto match = find(begin, end, difference);
+
+        uint8_t pairing;
+        if (match != end) {
+            pairing = distance(begin, match);
+        } else {
+            pairing = m_differences.size();
+            m_differences.push_back(difference);
+        }
+
+        switch (bracketType) {
+        case 'o':
+            pairing |= BracketTypeOpen;
+            break;
+
+        case 'c':
+            pairing |= BracketTypeClose;
+            break;
+        }
+
+        Record record(bidiClass ? bidiClass : defaultBidiClass, generalCategory, script, pairing);
+        uint16_t number;
+
+        auto recordMatch = recordNumbers.find(record);
+        if (recordMatch != recordNumbers.end()) {
+            number = recordMatch->second;
+        } else {
+            number = m_records.size();
+            recordNumbers[record] = number;
+            m_records.push_back(record);
+        }
+
+        m_recordIndexes.push_back(number);
+    }
+}
+
+void PropertyLookupGenerator::tuneSegmentSizes(ostream &report) {
+    cout << "Tuning segment sizes for property lookup." << endl;
+
+    collectRecords();
+
+    LookupTuner tuner("PropertyLookup", m_lastCodePoint);
+    vector<size_t> mainSizes = LookupTuner::candidateSizes(m_mainSegmentSize);
+    vector<size_t> branchSizes = LookupTuner::candidateSizes(m_branchSegmentSize);
+
+    for (size_t mainSize : mainSizes) {
+        m_mainSegmentSize = mainSize;
+        collectMainData();
+
+        vector<uint16_t> data;
+        for (const MainDataSegment &segment : m_dataSegments) {
+            data.insert(data.end(), segment.dataset->begin(), segment.dataset->end());
+        }
+
+        for (size_t branchSize : branchSizes) {
+            m_branchSegmentSize = branchSize;
+            collectBranchData();
+
+            /* The indexes would not fit in the generated arrays. */
+            if (m_dataSize > 0x10000 || m_mainIndexesSize > 0x10000) {
+                continue;
+            }
+
+            vector<uint16_t> mainIndexes;
+            for (const BranchDataSegment &segment : m_branchSegments) {
+                for (const MainDataSegment *reference : *segment.dataset) {
+                    mainIndexes.push_back((uint16_t)reference->index);
+                }
+            }
+
+            vector<uint16_t> branchIndexes;
+            for (const BranchDataSegment *reference : m_branchReferences) {
+                branchIndexes.push_back((uint16_t)reference->index);
+            }
+
+            size_t memory = (m_dataSize + m_mainIndexesSize + m_branchIndexesSize) * 2;
+            tuner.addCandidate(mainSize, branchSize, memory, data, mainIndexes, branchIndexes);
+        }
+    }
+
+    m_mainSegmentSize = tuner.bestMainSegmentSize();
+    m_branchSegmentSize = tuner.bestBranchSegmentSize();
+    tuner.writeReport(report);
+
+    cout << "  Main Segment Size: " << m_mainSegmentSize << endl;
+    cout << "  Branch Segment Size: " << m_branchSegmentSize << endl << endl;
+}
+
+void PropertyLookupGenerator::collectMainData() {
+    size_t maxSegments = Math::FastCeil(m_lastCodePoint, m_mainSegmentSize);
+
+    m_dataSegments.clear();
+    m_dataSegments.reserve(maxSegments);
+
+    m_dataReferences.clear();
+    m_dataReferences.reserve(maxSegments);
+
+    m_dataSize = 0;
+
+    for (size_t i = 0; i < maxSegments; i++) {
+        uint32_t segmentStart = (uint32_t)(i * m_mainSegmentSize);
+        uint32_t segmentEnd = min(m_lastCodePoint, (uint32_t)(segmentStart + m_mainSegmentSize - 1));
+
+        MainDataSet dataset(new UnsafeMainDataSet());
+        dataset->reserve(m_mainSegmentSize);
+
+        for (uint32_t codePoint = segmentStart; codePoint <= segmentEnd; codePoint++) {
+            dataset->push_back(m_recordIndexes.at(codePoint));
+        }
+
+        size_t segmentIndex = SIZE_MAX;
+        size_t segmentCount = m_dataSegments.size();
+        for (size_t j = 0; j < segmentCount; j++) {
+            if (*m_dataSegments[j].dataset == *dataset) {
+                segmentIndex = j;
+                break;
+            }
+        }
+
+        if (segmentIndex == SIZE_MAX) {
+            segmentIndex = m_dataSegments.size();
+            m_dataSegments.push_back(MainDataSegment(m_dataSize, dataset));
+            m_dataSize += dataset->size();
+        }
+
+        m_dataReferences.push_back(&m_dataSegments.at(segmentIndex));
+    }
+
+    m_mainIndexesSize = m_dataReferences.size();
+}
+
+void PropertyLookupGenerator::collectBranchData() {
+    size_t mainIndexesCount = m_dataReferences.size() - 1;
+    size_t maxSegments = Math::FastCeil(mainIndexesCount, m_branchSegmentSize);
+
+    m_branchSegments.clear();
+    m_branchSegments.reserve(maxSegments);
+
+    m_branchReferences.clear();
+    m_branchReferences.reserve(maxSegments);
+
+    m_mainIndexesSize = 0;
+
+    for (size_t i = 0; i < maxSegments; i++) {
+        size_t segmentStart = (i * m_branchSegmentSize);
+        size_t segmentEnd = min(mainIndexesCount, segmentStart + m_branchSegmentSize - 1);
+
+        BranchDataSet dataset(new UnsafeBranchDataSet());
+        dataset->reserve(m_branchSegmentSize);
+
+        for (size_t j = segmentStart; j <= segmentEnd; j++) {
+            dataset->push_back(m_dataReferences.at(j));
+        }
+
+        size_t segmentIndex = SIZE_MAX;
+        size_t segmentCount = m_branchSegments.size();
+        for (size_t j = 0; j < segmentCount; j++) {
+            if (*m_branchSegments[j].dataset == *dataset) {
+                segmentIndex = j;
+                break;
+            }
+        }
+
+        if (segmentIndex == SIZE_MAX) {
+            segmentIndex = m_branchSegments.size();
+            m_branchSegments.push_back(BranchDataSegment(m_mainIndexesSize, dataset));
+            m_mainIndexesSize += dataset->size();
+        }
+
+        m_branchReferences.push_back(&m_branchSegments.at(segmentIndex));
+    }
+
+    m_branchIndexesSize = m_branchReferences.size();
+}
+
+void PropertyLookupGenerator::generateFile(const std::string &directory) {
+    collectRecords();
+    collectMainData();
+    collectBranchData();
+
+    ArrayBuilder arrDifferences;
+    arrDifferences.setDataType(DIFFERENCES_ARRAY_TYPE);
+    arrDifferences.setName(DIFFERENCES_ARRAY_NAME);
+    arrDifferences.setElementSpace(5);
+    arrDifferences.setSizeDescriptor(Converter::toString((int)m_differences.size()));
+
+    auto diffPtr = m_differences.begin();
+    auto diffEnd = m_differences.end();
+    for (; diffPtr != diffEnd; diffPtr++) {
+        const string &element = Converter::toString(*diffPtr);
+        bool isLast = (diffPtr == (diffEnd - 1));
+
+        arrDifferences.appendElement(element);
+        if (!isLast) {
+            arrDifferences.newElement();
+        }
+    }
+
+    ArrayBuilder arrRecords;
+    arrRecords.setDataType(RECORDS_ARRAY_TYPE);
+    arrRecords.setName(RECORDS_ARRAY_NAME);
+    arrRecords.setSizeDescriptor(Converter::toString((int)m_records.size()));
+
+    auto recordPtr = m_records.begin();
+    auto recordEnd = m_records.end();
+    for (; recordPtr != recordEnd; recordPtr++) {
+        const Record &record = *recordPtr;
+        bool isLast = (recordPtr == (recordEnd - 1));
+
+        string generalCategory = m_generalCategoryDetector.numberToName(get<1>(record));
+        string script = m_scriptDetector.numberToAlias(get<2>(record));
+        Converter::toUpper(generalCategory);
+        Converter::toUpper(script);
+
+        string element = "{ SBBidiType" + m_bidiClassDetector.numberToName(get<0>(record))
+                       + ", SBGeneralCategory" + generalCategory
+                       + ", SBScript" + script
+                       + ", 0x" + Converter::toHex(get<3>(record), 2) + " }";
+        arrRecords.appendElement(element);
+
+        if (!isLast) {
+            arrRecords.newElement();
+            arrRecords.newLine();
+        }
+    }
+
+    ArrayBuilder arrData;
+    arrData.setDataType(DATA_ARRAY_TYPE);
+    arrData.setName(DATA_ARRAY_NAME);
+    arrData.setElementSpace(6);
+    arrData.setSizeDescriptor(Converter::toString((int)m_dataSize));
+
+    auto dataPtr = m_dataSegments.begin();
+    auto dataEnd = m_dataSegments.end();
+    for (; dataPtr != dataEnd; dataPtr++) {
+        const MainDataSegment &segment = *dataPtr;
+        bool isLast = (dataPtr == (dataEnd - 1));
+
+        arrData.append(segment.hintLine());
+        arrData.newLine();
+
+        size_t length = segment.dataset->size();
+
+        for (size_t j = 0; j < length; j++) {
+            string element = "0x" + Converter::toHex(segment.dataset->at(j), 4);
+            arrData.appendElement(element);
+
+            if (!isLast || j != (length - 1)) {
+                arrData.newElement();
+            }
+        }
+
+        if (!isLast) {
+            arrData.newLine();
+        }
+    }
+
+    ArrayBuilder arrMainIndexes;
+    arrMainIndexes.setDataType(MAIN_INDEXES_ARRAY_TYPE);
+    arrMainIndexes.setName(MAIN_INDEXES_ARRAY_NAME);
+    arrMainIndexes.setSizeDescriptor(Converter::toString((int)m_mainIndexesSize));
+
+    auto mainIndexPtr = m_branchSegments.begin();
+    auto mainIndexEnd = m_branchSegments.end();
+    for (; mainIndexPtr != mainIndexEnd; mainIndexPtr++) {
+        const BranchDataSegment &segment = *mainIndexPtr;
+        bool isLast = (mainIndexPtr == (mainIndexEnd - 1));
+
+        arrMainIndexes.append(segment.hintLine());
+        arrMainIndexes.newLine();
+
+        size_t length = segment.dataset->size();
+
+        for (size_t j = 0; j < length; j++) {
+            string element = "0x" + Converter::toHex(segment.dataset->at(j)->index, 4);
+            arrMainIndexes.appendElement(element);
+
+            if (!isLast || j != (length - 1)) {
+                arrMainIndexes.newElement();
+            }
+        }
+
+        if (!isLast) {
+            arrMainIndexes.newLine();
+        }
+    }
+
+    ArrayBuilder arrBranchIndexes;
+    arrBranchIndexes.setDataType(BRANCH_INDEXES_ARRAY_TYPE);
+    arrBranchIndexes.setName(BRANCH_INDEXES_ARRAY_NAME);
+    arrBranchIndexes.setSizeDescriptor(Converter::toString((int)m_branchIndexesSize));
+
+    auto branchIndexPtr = m_branchReferences.begin();
+    auto branchIndexEnd = m_branchReferences.end();
+    for (; branchIndexPtr != branchIndexEnd; branchIndexPtr++) {
+        const BranchDataSegment &segment = **branchIndexPtr;
+        bool isLast = (branchIndexPtr == (branchIndexEnd - 1));
+        string element = "0x" + Converter::toHex(segment.index, 4);
+
+        arrBranchIndexes.appendElement(element);
+        if (!isLast) {
+            arrBranchIndexes.newElement();
+        }
+    }
+
+    TextBuilder lookupFunction;
+    string maxCodePoint = "0x" + Converter::toHex(m_lastCodePoint, 6);
+    string mainDivider = "0x" + Converter::toHex(m_mainSegmentSize, 4);
+    string branchDivider = "0x" + Converter::toHex(m_mainSegmentSize * m_branchSegmentSize, 4);
+    lookupFunction.append("SB_INTERNAL const PropertyRecord *LookupProperties(SBCodepoint codepoint)").newLine();
+    lookupFunction.append("{").newLine();
+    lookupFunction.appendTabs(1).append("if (codepoint <= " + maxCodePoint + ") {").newLine();
+    lookupFunction.appendTabs(2).append("return &PropertyRecords[").newLine();
+    lookupFunction.appendTabs(2).append("         PrimaryPropertyData[").newLine();
+    lookupFunction.appendTabs(2).append("          MainPropertyIndexes[").newLine();
+    lookupFunction.appendTabs(2).append("           BranchPropertyIndexes[").newLine();
+    lookupFunction.appendTabs(2).append("                codepoint / " + branchDivider).newLine();
+    lookupFunction.appendTabs(2).append("           ] + (codepoint % " + branchDivider + ") / " + mainDivider).newLine();
+    lookupFunction.appendTabs(2).append("          ] + codepoint % " + mainDivider).newLine();
+    lookupFunction.appendTabs(2).append("         ]").newLine();
+    lookupFunction.appendTabs(2).append("        ];").newLine();
+    lookupFunction.appendTabs(1).append("}").newLine();
+    lookupFunction.newLine();
+    lookupFunction.appendTabs(1).append("return &PropertyRecords[0];").newLine();
+    lookupFunction.append("}").newLine();
+
+    TextBuilder mirrorFunction;
+    mirrorFunction.append("SB_INTERNAL SBCodepoint PropertyRecordGetMirror(const PropertyRecord *record, SBCodepoint codepoint)").newLine();
+    mirrorFunction.append("{").newLine();
+    mirrorFunction.appendTabs(1).append("SBInt16 diff = PropertyPairDifferences[").newLine();
+    mirrorFunction.appendTabs(1).append("                record->pairing & BracketTypeInverseMask").newLine();
+    mirrorFunction.appendTabs(1).append("               ];").newLine();
+    mirrorFunction.newLine();
+    mirrorFunction.appendTabs(1).append("if (diff != 0) {").newLine();
+    mirrorFunction.appendTabs(2).append("return (codepoint + diff);").newLine();
+    mirrorFunction.appendTabs(1).append("}").newLine();
+    mirrorFunction.newLine();
+    mirrorFunction.appendTabs(1).append("return 0;").newLine();
+    mirrorFunction.append("}").newLine();
+
+    FileBuilder header(directory + "/PropertyLookup.h");
+    header.append("/*").newLine();
+    header.append(" * Automatically generated by SheenBidiGenerator tool.").newLine();
+    header.append(" * DO NOT EDIT!!").newLine();
+    header.append(" */").newLine();
+    header.newLine();
+    header.append("#ifndef _SB_INTERNAL_PROPERTY_LOOKUP_H").newLine();
+    header.append("#define _SB_INTERNAL_PROPERTY_LOOKUP_H").newLine();
+    header.newLine();
+    header.append("#include <SBConfig.h>").newLine();
+    header.newLine();
+    header.append("#include \"BracketType.h\"").newLine();
+    header.append("#include \"SBBase.h\"").newLine();
+    header.newLine();
+    header.append("typedef struct _PropertyRecord {").newLine();
+    header.appendTabs(1).append("SBUInt8 bidiType;          /**< Bidirectional type of the code point. */").newLine();
+    header.appendTabs(1).append("SBUInt8 generalCategory;   /**< General category of the code point. */").newLine();
+    header.appendTabs(1).append("SBUInt8 script;            /**< Script of the code point. */").newLine();
+    header.appendTabs(1).append("SBUInt8 pairing;           /**< Bracket type and mirror difference index. */").newLine();
+    header.append("} PropertyRecord;").newLine();
+    header.newLine();
+    header.append("#define PropertyRecordGetBracketType(record)   \\").newLine();
+    header.append("(                                              \\").newLine();
+    header.append("    (record)->pairing & BracketTypePrimaryMask \\").newLine();
+    header.append(")").newLine();
+    header.newLine();
+    header.append("SB_INTERNAL const PropertyRecord *LookupProperties(SBCodepoint codepoint);").newLine();
+    header.append("SB_INTERNAL SBCodepoint PropertyRecordGetMirror(const PropertyRecord *record, SBCodepoint codepoint);").newLine();
+    header.newLine();
+    header.append("#endif").newLine();
+
+    FileBuilder source(directory + "/PropertyLookup.c");
+    source.append("/*").newLine();
+    source.append(" * Automatically generated by SheenBidiGenerator tool.").newLine();
+    source.append(" * DO NOT EDIT!!").newLine();
+    source.append(" *").newLine();
+    source.append(" * REQUIRED MEMORY: (" + Converter::toString((int)m_differences.size())
+                  + "*2)+(" + Converter::toString((int)m_records.size())
+                  + "*4)+(" + Converter::toString((int)m_dataSize)
+                  + "*2)+(" + Converter::toString((int)m_mainIndexesSize)
+                  + "*2)+(" + Converter::toString((int)m_branchIndexesSize) + "*2) = "
+                  + Converter::toString((int)(m_differences.size()*2 + m_records.size()*4
+                                              + (m_dataSize + m_mainIndexesSize + m_branchIndexesSize)*2))
+                  + " Bytes").newLine();
+    source.append(" */").newLine();
+    source.newLine();
+    source.append("#include <SBBidiType.h>").newLine();
+    source.append("#include <SBGeneralCategory.h>").newLine();
+    source.append("#include <SBScript.h>").newLine();
+    source.newLine();
+    source.append("#include \"PropertyLookup.h\"").newLine();
+    source.newLine();
+    source.append(arrDifferences).newLine();
+    source.append(arrRecords).newLine();
+    source.append(arrData).newLine();
+    source.append(arrMainIndexes).newLine();
+    source.append(arrBranchIndexes).newLine();
+    source.append(lookupFunction).newLine();
+    source.append(mirrorFunction);
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SHEENBIDI_GENERATOR_PROPERTY_LOOKUP_GENERATOR_H
+#define SHEENBIDI_GENERATOR_PROPERTY_LOOKUP_GENERATOR_H
+
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <Parser/BidiBrackets.h>
+#include <Parser/BidiMirroring.h>
+#include <Parser/DerivedBidiClass.h>
+#include <Parser/PropertyValueAliases.h>
+#include <Parser/Scripts.h>
+#include <Parser/UnicodeData.h>
+
+#include "Utilities/BidiClassDetector.h"
+#include "Utilities/GeneralCategoryDetector.h"
+#include "Utilities/ScriptDetector.h"
+
+namespace SheenBidi {
+namespace Generator {
+
+class PropertyLookupGenerator {
+public:
+    PropertyLookupGenerator(const Parser::DerivedBidiClass &derivedBidiClass,
+                            const Parser::UnicodeData &unicodeData,
+                            const Parser::Scripts &scripts,
+                            const Parser::PropertyValueAliases &propertyValueAliases,
+                            const Parser::BidiMirroring &bidiMirroring,
+                            const Parser::BidiBrackets &bidiBrackets);
+
+    void setMainSegmentSize(size_t);
+    void setBranchSegmentSize(size_t);
+
+    void analyzeData();
+    void tuneSegmentSizes(std::ostream &report);
+    void generateFile(const std::string &directory);
+
+private:
+    typedef std::tuple<uint8_t, uint8_t, uint8_t, uint8_t> Record;
+
+    typedef std::vector<uint16_t> UnsafeMainDataSet;
+    typedef std::shared_ptr<UnsafeMainDataSet> MainDataSet;
+
+    struct MainDataSegment {
+        const size_t index;
+        const MainDataSet dataset;
+
+        MainDataSegment(size_t index, MainDataSet dataset);
+        const std::string hintLine() const;
+    };
+
+    typedef std::vector<MainDataSegment *> UnsafeBranchDataSet;
+    typedef std::shared_ptr<UnsafeBranchDataSet> BranchDataSet;
+
+    struct BranchDataSegment {
+        const size_t index;
+        const BranchDataSet dataset;
+
+        BranchDataSegment(size_t index, BranchDataSet dataset);
+        const std::string hintLine() const;
+    };
+
+    const Utilities::BidiClassDetector m_bidiClassDetector;
+    const Utilities::GeneralCategoryDetector m_generalCategoryDetector;
+    const Utilities::ScriptDetector m_scriptDetector;
+    const Parser::BidiMirroring &m_bidiMirroring;
+    const Parser::BidiBrackets &m_bidiBrackets;
+    uint32_t m_lastCodePoint;
+
+    size_t m_mainSegmentSize;
+    size_t m_branchSegmentSize;
+
+    std::vector<int16_t> m_differences;
+    std::vector<Record> m_records;
+    std::vector<uint16_t> m_recordIndexes;
+
+    std::vector<MainDataSegment> m_dataSegments;
+    std::vector<MainDataSegment *> m_dataReferences;
+
+    std::vector<BranchDataSegment> m_branchSegments;
+    std::vector<BranchDataSegment *> m_branchReferences;
+
+    size_t m_dataSize;
+    size_t m_mainIndexesSize;
+    size_t m_branchIndexesSize;
+
+    void collectRecords();
+    void collectMainData();
+    void collectBranchData();
+};
+
+}
+}
+
+#endif
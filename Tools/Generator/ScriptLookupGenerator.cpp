@@ -25,6 +25,7 @@
 
 #include "Utilities/ArrayBuilder.h"
 #include "Utilities/FileBuilder.h"
+#include "Utilities/LookupTuner.h"
 #include "Utilities/Converter.h"
 #include "Utilities/Math.h"
 
@@ -135,6 +136,56 @@ void ScriptLookupGenerator::analyzeData() {
     cout << "  Required Memory: " << minMemory << " bytes";
 }
 
+void ScriptLookupGenerator::tuneSegmentSizes(ostream &report) {
+    cout << "Tuning segment sizes for script lookup." << endl;
+
+    LookupTuner tuner("ScriptLookup", m_lastCodePoint);
+    vector<size_t> mainSizes = LookupTuner::candidateSizes(m_mainSegmentSize);
+    vector<size_t> branchSizes = LookupTuner::candidateSizes(m_branchSegmentSize);
+
+    for (size_t mainSize : mainSizes) {
+        m_mainSegmentSize = mainSize;
+        collectMainData();
+
+        vector<uint8_t> data;
+        for (const MainDataSegment &segment : m_dataSegments) {
+            data.insert(data.end(), segment.dataset->begin(), segment.dataset->end());
+        }
+
+        for (size_t branchSize : branchSizes) {
+            m_branchSegmentSize = branchSize;
+            collectBranchData();
+
+            /* The indexes would not fit in the generated arrays. */
+            if (m_dataSize > 0x10000 || m_mainIndexesSize > 0x10000) {
+                continue;
+            }
+
+            vector<uint16_t> mainIndexes;
+            for (const BranchDataSegment &segment : m_branchSegments) {
+                for (const MainDataSegment *reference : *segment.dataset) {
+                    mainIndexes.push_back((uint16_t)reference->index);
+                }
+            }
+
+            vector<uint16_t> branchIndexes;
+            for (const BranchDataSegment *reference : m_branchReferences) {
+                branchIndexes.push_back((uint16_t)reference->index);
+            }
+
+            size_t memory = m_dataSize + ((m_mainIndexesSize + m_branchIndexesSize) * 2);
+            tuner.addCandidate(mainSize, branchSize, memory, data, mainIndexes, branchIndexes);
+        }
+    }
+
+    m_mainSegmentSize = tuner.bestMainSegmentSize();
+    m_branchSegmentSize = tuner.bestBranchSegmentSize();
+    tuner.writeReport(report);
+
+    cout << "  Main Segment Size: " << m_mainSegmentSize << endl;
+    cout << "  Branch Segment Size: " << m_branchSegmentSize << endl << endl;
+}
+
 void ScriptLookupGenerator::collectMainData() {
     size_t unicodeCount = m_lastCodePoint - m_firstCodePoint;
     size_t maxSegments = Math::FastCeil(unicodeCount, m_mainSegmentSize);
@@ -19,6 +19,7 @@
 
 #include <map>
 #include <memory>
+#include <ostream>
 #include <sstream>
 
 #include <Parser/PropertyValueAliases.h>
@@ -39,6 +40,7 @@ public:
     void displayScriptsFrequency();
 
     void analyzeData();
+    void tuneSegmentSizes(std::ostream &report);
     void generateFile(const std::string &directory);
 
 private:
@@ -0,0 +1,341 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <limits>
+#include <ostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "LookupTuner.h"
+
+using namespace std;
+using namespace std::chrono;
+using namespace SheenBidi::Generator::Utilities;
+
+static const size_t MIN_SEGMENT_SIZE = 8;
+static const size_t MAX_SEGMENT_SIZE = 512;
+
+static const size_t SAMPLE_SIZE = 32768;
+static const size_t REPETITIONS = 7;
+static const uint32_t SAMPLE_SEED = 0x5B1D1;
+
+/* A candidate may take this much more memory than the smallest one if it is faster. */
+static const double MEMORY_TOLERANCE = 1.25;
+/* The latencies closer than this are treated as noise and the smaller candidate is preferred. */
+static const double LATENCY_TOLERANCE = 1.03;
+
+/* Read at run time so that the compiler cannot break the dependency between the lookups. */
+static volatile uint32_t ZERO_MASK = 0;
+static volatile uint32_t SINK = 0;
+
+namespace {
+
+struct Range {
+    uint32_t first;
+    uint32_t last;
+    size_t weight;
+};
+
+/* Divides by a fixed divisor with a multiplication as compilers do for the generated lookups. */
+struct Divider {
+    uint64_t multiplier;
+    unsigned shift;
+    uint32_t divisor;
+
+    Divider(uint32_t divisor)
+        : multiplier(0)
+        , shift(32)
+        , divisor(divisor)
+    {
+        while ((UINT64_C(1) << (shift - 32)) < divisor) {
+            shift++;
+        }
+
+        multiplier = (UINT64_C(1) << shift) / divisor + 1;
+    }
+
+    uint32_t quotient(uint32_t dividend) const {
+        return (uint32_t)((dividend * multiplier) >> shift);
+    }
+};
+
+}
+
+static vector<uint32_t> makeSample(mt19937 &engine, const vector<Range> &ranges) {
+    size_t totalWeight = 0;
+    for (const Range &range : ranges) {
+        totalWeight += range.weight;
+    }
+
+    vector<uint32_t> sample;
+    sample.reserve(SAMPLE_SIZE);
+
+    /* The values are bounded by hand to get the same sample on every platform. */
+    for (size_t i = 0; i < SAMPLE_SIZE; i++) {
+        size_t choice = engine() % totalWeight;
+
+        for (const Range &range : ranges) {
+            if (choice < range.weight) {
+                sample.push_back(range.first + engine() % (range.last - range.first + 1));
+                break;
+            }
+
+            choice -= range.weight;
+        }
+    }
+
+    return sample;
+}
+
+template<class Lookup>
+static double measureLatency(const vector<uint32_t> &codePoints, Lookup lookup) {
+    double best = numeric_limits<double>::max();
+    uint32_t mask = ZERO_MASK;
+    uint32_t value = 0;
+
+    for (size_t i = 0; i < REPETITIONS; i++) {
+        auto begin = steady_clock::now();
+
+        /* Each lookup waits for the previous one so that the latency is measured, not throughput. */
+        for (uint32_t codePoint : codePoints) {
+            value = lookup(codePoint | (value & mask));
+        }
+
+        auto end = steady_clock::now();
+        double latency = duration<double, nano>(end - begin).count() / codePoints.size();
+
+        best = min(best, latency);
+    }
+
+    SINK = value;
+
+    return best;
+}
+
+LookupTuner::LookupTuner(const string &lookupName, uint32_t lastCodePoint)
+    : m_lookupName(lookupName)
+    , m_lastCodePoint(lastCodePoint)
+{
+    mt19937 engine(SAMPLE_SEED);
+
+    m_distributions.push_back({ "latin", makeSample(engine, {
+        { 0x0020, 0x007E, 85 }, { 0x00A0, 0x024F, 15 } }) });
+    m_distributions.push_back({ "arabic", makeSample(engine, {
+        { 0x0621, 0x064A, 70 }, { 0x064B, 0x0652, 15 }, { 0x0020, 0x0020, 10 }, { 0x0660, 0x0669, 5 } }) });
+    m_distributions.push_back({ "cjk", makeSample(engine, {
+        { 0x4E00, 0x9FFF, 70 }, { 0x3040, 0x30FF, 20 }, { 0x3000, 0x303F, 10 } }) });
+    m_distributions.push_back({ "emoji", makeSample(engine, {
+        { 0x0020, 0x007E, 50 }, { 0x1F300, 0x1FAFF, 30 }, { 0x2000, 0x2BFF, 20 } }) });
+    m_distributions.push_back({ "uniform", makeSample(engine, {
+        { 0x0000, 0x10FFFF, 1 } }) });
+}
+
+vector<size_t> LookupTuner::candidateSizes(size_t configuredSize) {
+    vector<size_t> sizes;
+
+    /* Powers of two let the compiler replace divisions with shifts. */
+    for (size_t size = MIN_SEGMENT_SIZE; size <= MAX_SEGMENT_SIZE; size *= 2) {
+        sizes.push_back(size);
+    }
+
+    if (find(sizes.begin(), sizes.end(), configuredSize) == sizes.end()) {
+        sizes.push_back(configuredSize);
+        sort(sizes.begin(), sizes.end());
+    }
+
+    return sizes;
+}
+
+template<class DataType>
+void LookupTuner::addThreeLevel(size_t mainSegmentSize, size_t branchSegmentSize, size_t memory,
+                                const vector<DataType> &data,
+                                const vector<uint16_t> &mainIndexes,
+                                const vector<uint16_t> &branchIndexes) {
+    const DataType *dataArray = data.data();
+    const uint16_t *mainArray = mainIndexes.data();
+    const uint16_t *branchArray = branchIndexes.data();
+    uint32_t lastCodePoint = m_lastCodePoint;
+    Divider mainDivider((uint32_t)mainSegmentSize);
+    Divider branchDivider((uint32_t)(mainSegmentSize * branchSegmentSize));
+
+    auto lookup = [=](uint32_t codePoint) -> uint32_t {
+        if (codePoint <= lastCodePoint) {
+            uint32_t branch = branchDivider.quotient(codePoint);
+            uint32_t remainder = codePoint - branch * branchDivider.divisor;
+            uint32_t main = mainDivider.quotient(remainder);
+
+            return dataArray[
+                    mainArray[
+                     branchArray[branch] + main
+                    ] + (remainder - main * mainDivider.divisor)
+                   ];
+        }
+
+        return 0;
+    };
+
+    Candidate candidate;
+    candidate.mainSegmentSize = mainSegmentSize;
+    candidate.branchSegmentSize = branchSegmentSize;
+    candidate.memory = memory;
+
+    vector<double> latencies;
+    for (const Distribution &distribution : m_distributions) {
+        latencies.push_back(measureLatency(distribution.codePoints, lookup));
+    }
+
+    addLatencies(candidate, latencies);
+    m_candidates.push_back(candidate);
+}
+
+void LookupTuner::addCandidate(size_t mainSegmentSize, size_t branchSegmentSize, size_t memory,
+                               const vector<uint8_t> &data,
+                               const vector<uint16_t> &mainIndexes,
+                               const vector<uint16_t> &branchIndexes) {
+    addThreeLevel(mainSegmentSize, branchSegmentSize, memory, data, mainIndexes, branchIndexes);
+}
+
+void LookupTuner::addCandidate(size_t mainSegmentSize, size_t branchSegmentSize, size_t memory,
+                               const vector<uint16_t> &data,
+                               const vector<uint16_t> &mainIndexes,
+                               const vector<uint16_t> &branchIndexes) {
+    addThreeLevel(mainSegmentSize, branchSegmentSize, memory, data, mainIndexes, branchIndexes);
+}
+
+void LookupTuner::addCandidate(size_t segmentSize, size_t memory,
+                               const vector<uint8_t> &data,
+                               const vector<uint16_t> &indexes) {
+    const uint8_t *dataArray = data.data();
+    const uint16_t *indexArray = indexes.data();
+    uint32_t lastCodePoint = m_lastCodePoint;
+    Divider divider((uint32_t)segmentSize);
+
+    auto lookup = [=](uint32_t codePoint) -> uint32_t {
+        if (codePoint <= lastCodePoint) {
+            uint32_t segment = divider.quotient(codePoint);
+
+            return dataArray[
+                    indexArray[segment] + (codePoint - segment * divider.divisor)
+                   ];
+        }
+
+        return 0;
+    };
+
+    Candidate candidate;
+    candidate.mainSegmentSize = segmentSize;
+    candidate.branchSegmentSize = 0;
+    candidate.memory = memory;
+
+    vector<double> latencies;
+    for (const Distribution &distribution : m_distributions) {
+        latencies.push_back(measureLatency(distribution.codePoints, lookup));
+    }
+
+    addLatencies(candidate, latencies);
+    m_candidates.push_back(candidate);
+}
+
+void LookupTuner::addLatencies(Candidate &candidate, vector<double> latencies) {
+    double total = 0.0;
+    for (double latency : latencies) {
+        total += latency;
+    }
+
+    candidate.latencies = move(latencies);
+    candidate.meanLatency = total / candidate.latencies.size();
+}
+
+const LookupTuner::Candidate &LookupTuner::bestCandidate() const {
+    size_t minMemory = SIZE_MAX;
+    for (const Candidate &candidate : m_candidates) {
+        minMemory = min(minMemory, candidate.memory);
+    }
+
+    double minLatency = numeric_limits<double>::max();
+    for (const Candidate &candidate : m_candidates) {
+        if (candidate.memory <= minMemory * MEMORY_TOLERANCE) {
+            minLatency = min(minLatency, candidate.meanLatency);
+        }
+    }
+
+    const Candidate *best = nullptr;
+    for (const Candidate &candidate : m_candidates) {
+        if (candidate.memory <= minMemory * MEMORY_TOLERANCE
+                && candidate.meanLatency <= minLatency * LATENCY_TOLERANCE) {
+            if (!best || candidate.memory < best->memory) {
+                best = &candidate;
+            }
+        }
+    }
+
+    return *best;
+}
+
+size_t LookupTuner::bestMainSegmentSize() const {
+    return bestCandidate().mainSegmentSize;
+}
+
+size_t LookupTuner::bestBranchSegmentSize() const {
+    return bestCandidate().branchSegmentSize;
+}
+
+void LookupTuner::writeReport(ostream &stream) const {
+    const Candidate &best = bestCandidate();
+
+    stream << m_lookupName << endl;
+    stream << "  " << setw(6) << "main" << setw(8) << "branch" << setw(10) << "memory";
+    for (const Distribution &distribution : m_distributions) {
+        stream << setw(9) << distribution.name;
+    }
+    stream << setw(9) << "mean" << endl;
+
+    stream << fixed << setprecision(2);
+
+    for (const Candidate &candidate : m_candidates) {
+        stream << (&candidate == &best ? "* " : "  ");
+        stream << setw(6) << candidate.mainSegmentSize;
+
+        if (candidate.branchSegmentSize) {
+            stream << setw(8) << candidate.branchSegmentSize;
+        } else {
+            stream << setw(8) << "-";
+        }
+
+        stream << setw(10) << candidate.memory;
+
+        for (double latency : candidate.latencies) {
+            stream << setw(9) << latency;
+        }
+
+        stream << setw(9) << candidate.meanLatency << endl;
+    }
+
+    stream << "  Latencies are in nanoseconds per dependent lookup. The selected candidate (*) is"
+           << " the smallest one within " << setprecision(0) << (LATENCY_TOLERANCE - 1.0) * 100
+           << "% of the fastest latency among those taking at most "
+           << (MEMORY_TOLERANCE - 1.0) * 100 << "% more memory than the smallest." << endl << endl;
+
+    stream.unsetf(ios_base::floatfield);
+    stream << setprecision(6);
+}
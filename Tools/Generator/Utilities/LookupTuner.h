@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef SHEENBIDI_GENERATOR_UTILITIES_LOOKUP_TUNER_H
+#define SHEENBIDI_GENERATOR_UTILITIES_LOOKUP_TUNER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace SheenBidi {
+namespace Generator {
+namespace Utilities {
+
+/**
+ * Measures the size and the lookup latency of the tables built with different segment sizes and
+ * selects the fastest one among those close to the smallest size.
+ */
+class LookupTuner {
+public:
+    LookupTuner(const std::string &lookupName, uint32_t lastCodePoint);
+
+    static std::vector<size_t> candidateSizes(size_t configuredSize);
+
+    void addCandidate(size_t mainSegmentSize, size_t branchSegmentSize, size_t memory,
+                      const std::vector<uint8_t> &data,
+                      const std::vector<uint16_t> &mainIndexes,
+                      const std::vector<uint16_t> &branchIndexes);
+    void addCandidate(size_t mainSegmentSize, size_t branchSegmentSize, size_t memory,
+                      const std::vector<uint16_t> &data,
+                      const std::vector<uint16_t> &mainIndexes,
+                      const std::vector<uint16_t> &branchIndexes);
+    void addCandidate(size_t segmentSize, size_t memory,
+                      const std::vector<uint8_t> &data,
+                      const std::vector<uint16_t> &indexes);
+
+    size_t bestMainSegmentSize() const;
+    size_t bestBranchSegmentSize() const;
+
+    void writeReport(std::ostream &stream) const;
+
+private:
+    struct Distribution {
+        std::string name;
+        std::vector<uint32_t> codePoints;
+    };
+
+    struct Candidate {
+        size_t mainSegmentSize;
+        size_t branchSegmentSize;
+        size_t memory;
+        std::vector<double> latencies;
+        double meanLatency;
+    };
+
+    std::string m_lookupName;
+    uint32_t m_lastCodePoint;
+    std::vector<Distribution> m_distributions;
+    std::vector<Candidate> m_candidates;
+
+    template<class DataType>
+    void addThreeLevel(size_t mainSegmentSize, size_t branchSegmentSize, size_t memory,
+                       const std::vector<DataType> &data,
+                       const std::vector<uint16_t> &mainIndexes,
+                       const std::vector<uint16_t> &branchIndexes);
+
+    void addLatencies(Candidate &candidate, std::vector<double> latencies);
+    const Candidate &bestCandidate() const;
+};
+
+}
+}
+}
+
+#endif
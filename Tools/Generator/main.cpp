@@ -15,6 +15,7 @@
  */
 
 #include <cstdio>
+#include <fstream>
 #include <iostream>
 #include <string>
 
@@ -30,6 +31,7 @@
 #include "BidiTypeLookupGenerator.h"
 #include "GeneralCategoryLookupGenerator.h"
 #include "PairingLookupGenerator.h"
+#include "PropertyLookupGenerator.h"
 #include "ScriptLookupGenerator.h"
 
 using namespace std;
@@ -41,6 +43,16 @@ int main(int argc, const char * argv[])
     const string in = "/path/to/input";
     const string out = "/path/to/output";
 
+    /*
+     * In tuning mode, the segment sizes set below are compared with other candidates, the fastest
+     * tables close to the smallest size are generated and the measurements are written in a report.
+     */
+    const bool tune = (argc > 1 && string(argv[1]) == "--tune");
+    ofstream report;
+    if (tune) {
+        report.open(out + "/LookupTuning.txt");
+    }
+
     UnicodeData unicodeData(in);
     BidiMirroring bidiMirroring(in);
     BidiBrackets bidiBrackets(in);
@@ -53,22 +65,43 @@ int main(int argc, const char * argv[])
     BidiTypeLookupGenerator bidiTypeLookup(derivedBidiClass);
     bidiTypeLookup.setMainSegmentSize(16);
     bidiTypeLookup.setBranchSegmentSize(64);
+    if (tune) {
+        bidiTypeLookup.tuneSegmentSizes(report);
+    }
     bidiTypeLookup.generateFile(out);
 
     PairingLookupGenerator pairingLookup(bidiMirroring, bidiBrackets);
     pairingLookup.setSegmentSize(106);
+    if (tune) {
+        pairingLookup.tuneSegmentSizes(report);
+    }
     pairingLookup.generateFile(out);
 
     GeneralCategoryLookupGenerator generalCategoryLookup(unicodeData);
     generalCategoryLookup.setMainSegmentSize(16);
     generalCategoryLookup.setBranchSegmentSize(49);
+    if (tune) {
+        generalCategoryLookup.tuneSegmentSizes(report);
+    }
     generalCategoryLookup.generateFile(out);
 
     ScriptLookupGenerator scriptLookup(scripts, propertyValueAliases);
     scriptLookup.setMainSegmentSize(16);
     scriptLookup.setBranchSegmentSize(32);
+    if (tune) {
+        scriptLookup.tuneSegmentSizes(report);
+    }
     scriptLookup.generateFile(out);
 
+    PropertyLookupGenerator propertyLookup(derivedBidiClass, unicodeData, scripts,
+                                           propertyValueAliases, bidiMirroring, bidiBrackets);
+    propertyLookup.setMainSegmentSize(16);
+    propertyLookup.setBranchSegmentSize(32);
+    if (tune) {
+        propertyLookup.tuneSegmentSizes(report);
+    }
+    propertyLookup.generateFile(out);
+
     cout << "Finished.";
 
     getchar();
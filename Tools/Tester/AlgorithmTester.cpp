@@ -14,7 +14,9 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <cstdint>
+#include <cstdlib>
 #include <iomanip>
 #include <iostream>
 #include <string>
@@ -125,10 +127,281 @@ void AlgorithmTester::testMulticharNewline()
     cout << failed << " error/s." << endl << endl;
 }
 
+void AlgorithmTester::testMirroredEncodings()
+{
+    cout << "Running mirrored string encoding tester." << endl;
+
+    size_t failed = 0;
+
+    /* The brackets are followed by code points taking two, three and four code units in UTF-8. */
+    const string u8Text = u8"(\u00AB\u2039\U0001F600)";
+    const string u8Expected = u8")\u00BB\u203A\U0001F600(";
+    const u16string u16Text = u"(\u00AB\u2039\U0001F600)";
+    const u16string u16Expected = u")\u00BB\u203A\U0001F600(";
+
+    SBCodepointSequence u8Sequence = { SBStringEncodingUTF8, (void *)u8Text.data(), u8Text.length() };
+    SBAlgorithmRef u8Algorithm = SBAlgorithmCreate(&u8Sequence);
+    SBParagraphRef u8Paragraph = SBAlgorithmCreateParagraph(u8Algorithm, 0, u8Text.length(), 1);
+    SBLineRef u8Line = SBParagraphCreateLine(u8Paragraph, 0, u8Text.length());
+    string u8Mirrored(u8Text.length(), '\0');
+    SBLineCopyMirroredString(u8Line, &u8Mirrored[0]);
+
+    if (u8Mirrored != u8Expected) {
+        failed += 1;
+
+        if (Configuration::DISPLAY_ERROR_DETAILS) {
+            cout << "Test failed due to mismatch in UTF-8 mirrored string." << endl;
+        }
+    }
+
+    SBLineRelease(u8Line);
+    SBParagraphRelease(u8Paragraph);
+    SBAlgorithmRelease(u8Algorithm);
+
+    SBCodepointSequence u16Sequence = { SBStringEncodingUTF16, (void *)u16Text.data(), u16Text.length() };
+    SBAlgorithmRef u16Algorithm = SBAlgorithmCreate(&u16Sequence);
+    SBParagraphRef u16Paragraph = SBAlgorithmCreateParagraph(u16Algorithm, 0, u16Text.length(), 1);
+    SBLineRef u16Line = SBParagraphCreateLine(u16Paragraph, 0, u16Text.length());
+    u16string u16Mirrored(u16Text.length(), u'\0');
+    SBLineCopyMirroredString(u16Line, &u16Mirrored[0]);
+
+    if (u16Mirrored != u16Expected) {
+        failed += 1;
+
+        if (Configuration::DISPLAY_ERROR_DETAILS) {
+            cout << "Test failed due to mismatch in UTF-16 mirrored string." << endl;
+        }
+    }
+
+    SBLineRelease(u16Line);
+    SBParagraphRelease(u16Paragraph);
+    SBAlgorithmRelease(u16Algorithm);
+
+    cout << failed << " error/s." << endl << endl;
+}
+
+template<class String>
+static bool testVisualText(SBStringEncoding encoding, const String &text, SBLevel baseLevel, const String &expected)
+{
+    SBCodepointSequence sequence = { encoding, (void *)text.data(), text.length() };
+    SBAlgorithmRef algorithm = SBAlgorithmCreate(&sequence);
+    SBParagraphRef paragraph = SBAlgorithmCreateParagraph(algorithm, 0, text.length(), baseLevel);
+    SBLineRef line = SBParagraphCreateLine(paragraph, 0, text.length());
+    String visual(text.length(), 0);
+    SBLineCopyVisualString(line, &visual[0]);
+
+    SBLineRelease(line);
+    SBParagraphRelease(paragraph);
+    SBAlgorithmRelease(algorithm);
+
+    if (visual != expected) {
+        if (Configuration::DISPLAY_ERROR_DETAILS) {
+            cout << "Test failed due to mismatch in visual string." << endl;
+            cout << "  String Encoding: " << (int)encoding << endl;
+        }
+
+        return false;
+    }
+
+    return true;
+}
+
+static u16string swapUnits(u16string text)
+{
+    for (auto &unit : text) {
+        unit = (char16_t)((unit << 8) | (unit >> 8));
+    }
+
+    return text;
+}
+
+static u32string swapUnits(u32string text)
+{
+    for (auto &unit : text) {
+        unit = (unit << 24) | ((unit & 0xFF00) << 8) | ((unit >> 8) & 0xFF00) | (unit >> 24);
+    }
+
+    return text;
+}
+
+void AlgorithmTester::testVisualString()
+{
+    cout << "Running visual string tester." << endl;
+
+    size_t failed = 0;
+
+    /* Test with a left-to-right paragraph containing a right-to-left run. */
+    failed += !testVisualText(SBStringEncodingUTF32, u32string(U"abc \u05D0\u05D1 def"), 0,
+                              u32string(U"abc \u05D1\u05D0 def"));
+    /* Test with mirrored brackets and a combining mark which must stay after its base. */
+    failed += !testVisualText(SBStringEncodingUTF32, u32string(U"\u05D0\u05B7\u05D1 (x)"), 1,
+                              u32string(U"(x) \u05D1\u05D0\u05B7"));
+    failed += !testVisualText(SBStringEncodingUTF16, u16string(u"\u05D0\u05B7\u05D1 (x)"), 1,
+                              u16string(u"(x) \u05D1\u05D0\u05B7"));
+    failed += !testVisualText(SBStringEncodingUTF8, string(u8"\u05D0\u05B7\u05D1 (x)"), 1,
+                              string(u8"(x) \u05D1\u05D0\u05B7"));
+    /* Test with encodings other than native UTF. */
+    failed += !testVisualText(SBStringEncodingLatin1, string("\xAB" "ab" "\xBB"), 1,
+                              string("\xAB" "ab" "\xBB"));
+    failed += !testVisualText(SBStringEncodingUTF16Swapped, swapUnits(u16string(u"\u05D0\u05B7\u05D1 (x)")), 1,
+                              swapUnits(u16string(u"(x) \u05D1\u05D0\u05B7")));
+    failed += !testVisualText(SBStringEncodingUTF32Swapped, swapUnits(u32string(U"\u05D0\U0001F600\u00AB")), 1,
+                              swapUnits(u32string(U"\u00BB\U0001F600\u05D0")));
+    /* Test with a supplementary code point in a reversed run. */
+    failed += !testVisualText(SBStringEncodingUTF16, u16string(u"\u05D0\U0001F600\u00AB"), 1,
+                              u16string(u"\u00BB\U0001F600\u05D0"));
+
+    cout << failed << " error/s." << endl << endl;
+}
+
+static vector<SBLevel> resolveLevels(SBAlgorithmRef algorithm, SBUInteger length, SBLevel baseLevel)
+{
+    SBParagraphRef paragraph = SBAlgorithmCreateParagraph(algorithm, 0, length, baseLevel);
+    const SBLevel *levels = SBParagraphGetLevelsPtr(paragraph);
+    vector<SBLevel> result(levels, levels + SBParagraphGetLength(paragraph));
+
+    SBParagraphRelease(paragraph);
+
+    return result;
+}
+
+void AlgorithmTester::testProvidedTypes()
+{
+    cout << "Running provided types tester." << endl;
+
+    size_t failed = 0;
+
+    const u16string text = u"abc (\u05D0\U00010900 [x]) \u2067\u05D1\u2069 123";
+    SBCodepointSequence sequence = { SBStringEncodingUTF16, (void *)text.data(), text.length() };
+    SBAlgorithmRef algorithm = SBAlgorithmCreate(&sequence);
+    const SBBidiType *bidiTypes = SBAlgorithmGetBidiTypesPtr(algorithm);
+    vector<SBBidiType> types(bidiTypes, bidiTypes + text.length());
+
+    /* Test that the determined types give the same result when provided explicitly. */
+    SBAlgorithmRef provided = SBAlgorithmCreateWithTypes(&sequence, types.data());
+    /* The types must have been copied, so changing them afterwards should have no effect. */
+    types.assign(types.size(), SBBidiTypeON);
+    failed += !equal(bidiTypes, bidiTypes + text.length(), SBAlgorithmGetBidiTypesPtr(provided));
+    for (SBLevel baseLevel : { SBLevel(0), SBLevel(1), SBLevel(SBLevelDefaultLTR) }) {
+        failed += resolveLevels(provided, text.length(), baseLevel)
+               != resolveLevels(algorithm, text.length(), baseLevel);
+    }
+
+    /* Test that the provided types are used instead of the ones of code points. */
+    types.assign(types.size(), SBBidiTypeL);
+    SBAlgorithmRef overridden = SBAlgorithmCreateWithTypes(&sequence, types.data());
+    failed += resolveLevels(overridden, text.length(), 1) != vector<SBLevel>(text.length(), 2);
+
+    /* Test that missing types are rejected. */
+    failed += SBAlgorithmCreateWithTypes(&sequence, NULL) != NULL;
+
+    SBAlgorithmRelease(overridden);
+    SBAlgorithmRelease(provided);
+    SBAlgorithmRelease(algorithm);
+
+    cout << failed << " error/s." << endl << endl;
+}
+
+void AlgorithmTester::testDecodedTypes()
+{
+    cout << "Running decoded types tester." << endl;
+
+    const uint8_t samples[][4] = {
+        { 0x61 }, { 0x20 }, { 0x28 }, { 0xD8, 0xA7 }, { 0xDB, 0x8C }, { 0xD7, 0x90 },
+        { 0xC2, 0xA0 }, { 0xE2, 0x80, 0x8F }, { 0xE4, 0xB8, 0xAD }, { 0xF0, 0x9F, 0x98, 0x80 },
+        { 0x80 }, { 0xC0 }, { 0xC2 }, { 0xE0, 0x80 }, { 0xED, 0xA0, 0x80 }, { 0xFF }
+    };
+    const size_t sampleCount = sizeof(samples) / sizeof(samples[0]);
+
+    size_t failed = 0;
+
+    srand(7);
+
+    /* Test that decoding whole blocks gives the same types as decoding one code point at a time. */
+    for (int i = 0; i < 1000; i++) {
+        size_t length = 16 + rand() % 64;
+        string text;
+
+        while (text.length() < length) {
+            /* Keep most of the text in one and two byte sequences so that blocks are decoded. */
+            const uint8_t *bytes = samples[rand() % (rand() % 4 ? 7 : sampleCount)];
+
+            text.push_back((char)bytes[0]);
+            for (size_t j = 1; j < 4 && bytes[j]; j++) {
+                text.push_back((char)bytes[j]);
+            }
+        }
+
+        SBCodepointSequence sequence = { SBStringEncodingUTF8, (void *)text.data(), text.length() };
+        SBAlgorithmRef algorithm = SBAlgorithmCreate(&sequence);
+        const SBBidiType *types = SBAlgorithmGetBidiTypesPtr(algorithm);
+        SBUInteger stringIndex = 0;
+        bool matched = true;
+
+        while (stringIndex < text.length()) {
+            SBUInteger firstIndex = stringIndex;
+            SBCodepoint codepoint = SBCodepointSequenceGetCodepointAt(&sequence, &stringIndex);
+
+            matched &= (types[firstIndex] == SBCodepointGetBidiType(codepoint));
+            while (++firstIndex < stringIndex) {
+                matched &= (types[firstIndex] == SBBidiTypeBN);
+            }
+        }
+
+        failed += !matched;
+
+        SBAlgorithmRelease(algorithm);
+    }
+
+    /* Test that UTF-16 blocks with and without surrogates give the same types as code points. */
+    for (int i = 0; i < 1000; i++) {
+        size_t length = 16 + rand() % 64;
+        u16string text;
+
+        while (text.length() < length) {
+            const char16_t units[] = { u'a', u' ', u'(', 0x05D0, 0x0627, 0x06F1, 0x4E2D, 0xFEFF, 0xD83D, 0xDE00 };
+            text.push_back(units[rand() % (rand() % 8 ? 8 : 10)]);
+        }
+
+        SBCodepointSequence sequence = { SBStringEncodingUTF16, (void *)text.data(), text.length() };
+        SBAlgorithmRef algorithm = SBAlgorithmCreate(&sequence);
+        const SBBidiType *types = SBAlgorithmGetBidiTypesPtr(algorithm);
+        SBUInteger stringIndex = 0;
+        bool matched = true;
+
+        /* Test that the byte swapped text is classified in the same way. */
+        u16string swapped = swapUnits(text);
+        SBCodepointSequence swappedSequence = { SBStringEncodingUTF16Swapped, (void *)swapped.data(), swapped.length() };
+        SBAlgorithmRef swappedAlgorithm = SBAlgorithmCreate(&swappedSequence);
+        matched &= equal(types, types + text.length(), SBAlgorithmGetBidiTypesPtr(swappedAlgorithm));
+        SBAlgorithmRelease(swappedAlgorithm);
+
+        while (stringIndex < text.length()) {
+            SBUInteger firstIndex = stringIndex;
+            SBCodepoint codepoint = SBCodepointSequenceGetCodepointAt(&sequence, &stringIndex);
+
+            matched &= (types[firstIndex] == SBCodepointGetBidiType(codepoint));
+            while (++firstIndex < stringIndex) {
+                matched &= (types[firstIndex] == SBBidiTypeBN);
+            }
+        }
+
+        failed += !matched;
+
+        SBAlgorithmRelease(algorithm);
+    }
+
+    cout << failed << " error/s." << endl << endl;
+}
+
 void AlgorithmTester::test()
 {
     testAlgorithm();
     testMulticharNewline();
+    testMirroredEncodings();
+    testVisualString();
+    testProvidedTypes();
+    testDecodedTypes();
 }
 
 void AlgorithmTester::loadCharacters(const vector<string> &types) {
@@ -324,6 +597,58 @@ bool AlgorithmTester::testMirrors() const {
         return false;
     }
 
+    SBMirrorAgent copiedMirrors[256];
+    SBUInteger copiedCount = SBMirrorLocatorCopyMirrors(m_mirrorLocator, copiedMirrors, 256);
+
+    if (copiedCount != m_mirrorCount) {
+        if (Configuration::DISPLAY_ERROR_DETAILS) {
+            cout << "Test failed due to mismatch in copied mirror count." << endl;
+            cout << "  Copied Mirrors: " << copiedCount << endl;
+            cout << "  Expected Mirrors: " << m_mirrorCount << endl;
+        }
+
+        return false;
+    }
+
+    for (SBUInteger i = 0; i < copiedCount; i++) {
+        if (copiedMirrors[i].mirror != m_genMirrors[copiedMirrors[i].index]) {
+            if (Configuration::DISPLAY_ERROR_DETAILS) {
+                cout << "Test failed due to copied mirror mismatch." << endl;
+                cout << "  Text Index: " << copiedMirrors[i].index << endl;
+            }
+
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool AlgorithmTester::testMirroredString(SBLineRef line) const {
+    SBCodepoint mirroredChars[256];
+    SBLineCopyMirroredString(line, mirroredChars);
+
+    for (size_t i = 0; i < m_charCount; i++) {
+        SBCodepoint expected = (m_genMirrors[i] ? m_genMirrors[i] : m_genChars[i]);
+
+        if (mirroredChars[i] != expected) {
+            if (Configuration::DISPLAY_ERROR_DETAILS) {
+                cout << "Test failed due to mirrored string mismatch." << endl;
+                cout << "  Text Index: " << i << endl;
+                cout << "  Discovered Code Point: "
+                     << uppercase << hex << setfill('0')
+                     << setw(4) << mirroredChars[i] << endl
+                     << nouppercase << dec << setfill('\0');
+                cout << "  Expected Code Point: "
+                     << uppercase << hex << setfill('0')
+                     << setw(4) << expected << endl
+                     << nouppercase << dec << setfill('\0');
+            }
+
+            return false;
+        }
+    }
+
     return true;
 }
 
@@ -354,6 +679,7 @@ bool AlgorithmTester::conductTest() {
             loadMirrors();
             SBMirrorLocatorLoadLine(m_mirrorLocator, line, (void *)m_genChars);
             passed &= testMirrors();
+            passed &= testMirroredString(line);
         }
 
         SBLineRelease(line);
@@ -38,6 +38,10 @@ public:
 
     void testAlgorithm();
     void testMulticharNewline();
+    void testMirroredEncodings();
+    void testVisualString();
+    void testProvidedTypes();
+    void testDecodedTypes();
     void test();
 
 private:
@@ -75,6 +79,7 @@ private:
     bool testLevels() const;
     bool testOrder() const;
     bool testMirrors() const;
+    bool testMirroredString(SBLineRef line) const;
 
     bool conductTest();
     void analyzeBidiTest();
@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+extern "C" {
+#include <Headers/SBAlgorithm.h>
+#include <Headers/SBBase.h>
+#include <Headers/SBBatch.h>
+#include <Headers/SBCodepointSequence.h>
+#include <Headers/SBLine.h>
+#include <Headers/SBParagraph.h>
+#include <Headers/SBRun.h>
+}
+
+#include <cassert>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "BatchTester.h"
+
+using namespace std;
+using namespace SheenBidi::Tester;
+
+struct Resolution {
+    vector<SBLevel> levels;
+    vector<SBRun> runs;
+    SBLevel baseLevel;
+};
+
+static bool operator==(const SBRun &first, const SBRun &second)
+{
+    return first.offset == second.offset
+        && first.length == second.length
+        && first.level == second.level;
+}
+
+static Resolution resolve(const SBCodepointSequence &sequence, SBLevel baseLevel)
+{
+    Resolution resolution;
+    resolution.baseLevel = SBLevelInvalid;
+
+    SBAlgorithmRef algorithm = SBAlgorithmCreate(&sequence);
+    if (!algorithm) {
+        return resolution;
+    }
+
+    SBUInteger offset = 0;
+    while (offset < sequence.stringLength) {
+        SBParagraphRef paragraph = SBAlgorithmCreateParagraph(algorithm, offset, sequence.stringLength - offset, baseLevel);
+        SBUInteger length = SBParagraphGetLength(paragraph);
+        SBLineRef line = SBParagraphCreateLine(paragraph, offset, length);
+        const SBLevel *levels = SBParagraphGetLevelsPtr(paragraph);
+        const SBRun *runs = SBLineGetRunsPtr(line);
+
+        if (offset == 0) {
+            resolution.baseLevel = SBParagraphGetBaseLevel(paragraph);
+        }
+        resolution.levels.insert(resolution.levels.end(), levels, levels + length);
+        resolution.runs.insert(resolution.runs.end(), runs, runs + SBLineGetRunCount(line));
+
+        SBLineRelease(line);
+        SBParagraphRelease(paragraph);
+
+        offset += length;
+    }
+
+    SBAlgorithmRelease(algorithm);
+
+    return resolution;
+}
+
+static void batchTest(const vector<SBCodepointSequence> &inputs, SBLevel baseLevel, SBUInteger threadCount)
+{
+    SBUInteger totalLength = 0;
+    for (const auto &input : inputs) {
+        totalLength += input.stringLength;
+    }
+
+    vector<SBLevel> levels(totalLength);
+    vector<SBRun> runs(totalLength);
+    vector<SBUInteger> runCounts(inputs.size());
+    vector<SBLevel> baseLevels(inputs.size());
+
+    SBBatchResult result;
+    result.levels = levels.data();
+    result.runs = runs.data();
+    result.runCounts = runCounts.data();
+    result.baseLevels = baseLevels.data();
+
+    assert(SBResolveBatch(inputs.data(), inputs.size(), baseLevel, threadCount, &result));
+
+    SBUInteger unitOffset = 0;
+    for (size_t i = 0; i < inputs.size(); i++) {
+        Resolution expected = resolve(inputs[i], baseLevel);
+        SBUInteger length = inputs[i].stringLength;
+
+        assert(baseLevels[i] == expected.baseLevel);
+        assert(runCounts[i] == expected.runs.size());
+        assert(vector<SBRun>(&runs[unitOffset], &runs[unitOffset] + runCounts[i]) == expected.runs);
+
+        assert(vector<SBLevel>(&levels[unitOffset], &levels[unitOffset] + length) == expected.levels);
+
+        unitOffset += length;
+    }
+
+    /* Test that the outputs which are not needed can be skipped. */
+    vector<SBLevel> onlyLevels(totalLength);
+    result.levels = onlyLevels.data();
+    result.runs = NULL;
+    result.runCounts = NULL;
+    result.baseLevels = NULL;
+
+    assert(SBResolveBatch(inputs.data(), inputs.size(), baseLevel, threadCount, &result));
+    assert(onlyLevels == levels);
+}
+
+BatchTester::BatchTester()
+{
+}
+
+void BatchTester::test()
+{
+    const char32_t pieces[] = {
+        U'a', U'א', U'ا', U'1', U'١', U' ', U'(', U')', U'\n', U' ',
+        U'\u202A', U'\u202B', U'\u202C', U'\u2066', U'\u2067', U'\u2069', U'\u0300'
+    };
+    const string utf8 = "abc \xD7\x90\xD7\x91 (\xD8\xA7) 123\r\n\xD7\x92 \xF0\x9D\x90\x80";
+    const u16string utf16 = u"\U00010900א \U0001D400 x y";
+
+    vector<u32string> strings;
+    srand(2);
+    for (int i = 0; i < 1000; i++) {
+        u32string string;
+        int length = rand() % 24;
+
+        for (int j = 0; j < length; j++) {
+            string.push_back(pieces[rand() % (sizeof(pieces) / sizeof(pieces[0]))]);
+        }
+
+        strings.push_back(string);
+    }
+
+    vector<SBCodepointSequence> inputs;
+    for (const auto &string : strings) {
+        inputs.push_back({ SBStringEncodingUTF32, (void *)string.data(), string.length() });
+    }
+    inputs.push_back({ SBStringEncodingUTF8, (void *)utf8.data(), utf8.length() });
+    inputs.push_back({ SBStringEncodingUTF16, (void *)utf16.data(), utf16.length() });
+    inputs.push_back({ SBStringEncodingUTF32, NULL, 0 });
+
+    /* Test that an empty batch is accepted. */
+    SBBatchResult empty = { NULL, NULL, NULL, NULL };
+    assert(SBResolveBatch(NULL, 0, SBLevelDefaultLTR, 1, &empty));
+
+    /* Test on the calling thread and with multiple threads. */
+    batchTest(inputs, SBLevelDefaultLTR, 1);
+    batchTest(inputs, SBLevelDefaultRTL, 1);
+    batchTest(inputs, 1, 4);
+    batchTest(inputs, SBLevelDefaultLTR, 8);
+    batchTest(vector<SBCodepointSequence>(inputs.begin(), inputs.begin() + 40), 0, 3);
+}
@@ -53,24 +53,52 @@ void BidiTypeLookupTester::test() {
 #else
     cout << "Running bidi type lookup tester." << endl;
 
+    struct Layout {
+        const char *name;
+        SBBidiType (*lookup)(SBCodepoint);
+        SBBidiType (*lookupBMP)(SBUInt16);
+    };
+
+    static const Layout layouts[] = {
+        { "configured", LookupBidiType, LookupBidiTypeBMP },
+#ifdef SB_CONFIG_ALL_LOOKUP_LAYOUTS
+        { "trie", LookupBidiTypeTrie, LookupBidiTypeTrieBMP },
+        { "packed", LookupBidiTypePacked, LookupBidiTypePackedBMP },
+        { "two stage", LookupBidiTypeTwoStage, LookupBidiTypeTwoStageBMP },
+#endif
+    };
+
     size_t failCounter = 0;
 
-    for (uint32_t codePoint = 0; codePoint <= Unicode::MAX_CODE_POINT; codePoint++) {
-        const string &uniBidiType = m_derivedBidiClass.bidiClassForCodePoint(codePoint);
-        const string &expBidiType = (uniBidiType.length() ? uniBidiType : BIDI_TYPE_DEFAULT);
+    for (const Layout &layout : layouts) {
+        for (uint32_t codePoint = 0; codePoint <= Unicode::MAX_CODE_POINT; codePoint++) {
+            const string &uniBidiType = m_derivedBidiClass.bidiClassForCodePoint(codePoint);
+            const string &expBidiType = (uniBidiType.length() ? uniBidiType : BIDI_TYPE_DEFAULT);
 
-        SBBidiType valBidiType = LookupBidiType(codePoint);
-        const string &genBidiType = Convert::bidiTypeToString(valBidiType);
+            SBBidiType valBidiType = layout.lookup(codePoint);
+            const string &genBidiType = Convert::bidiTypeToString(valBidiType);
 
-        if (genBidiType != expBidiType) {
-            if (Configuration::DISPLAY_ERROR_DETAILS) {
-                cout << "Invalid char type found: " << endl
-                     << "  Code Point: " << codePoint << endl
-                     << "  Expected Char Type: " << expBidiType << endl
-                     << "  Generated Char Type: " << genBidiType << endl;
+            if (genBidiType != expBidiType) {
+                if (Configuration::DISPLAY_ERROR_DETAILS) {
+                    cout << "Invalid char type found: " << endl
+                         << "  Layout: " << layout.name << endl
+                         << "  Code Point: " << codePoint << endl
+                         << "  Expected Char Type: " << expBidiType << endl
+                         << "  Generated Char Type: " << genBidiType << endl;
+                }
+
+                failCounter++;
             }
 
-            failCounter++;
+            if (codePoint <= 0xFFFF && layout.lookupBMP((SBUInt16)codePoint) != valBidiType) {
+                if (Configuration::DISPLAY_ERROR_DETAILS) {
+                    cout << "Mismatching BMP char type found: " << endl
+                         << "  Layout: " << layout.name << endl
+                         << "  Code Point: " << codePoint << endl;
+                }
+
+                failCounter++;
+            }
         }
     }
 
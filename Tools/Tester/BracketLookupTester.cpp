@@ -49,41 +49,57 @@ void BracketLookupTester::test() {
 #else
     cout << "Running bracket lookup tester." << endl;
 
+    struct Layout {
+        const char *name;
+        SBCodepoint (*lookup)(SBCodepoint, BracketType *);
+    };
+
+    static const Layout layouts[] = {
+        { "configured", LookupBracketPair },
+#ifdef SB_CONFIG_ALL_LOOKUP_LAYOUTS
+        { "table", LookupBracketPairTable },
+        { "ranges", LookupBracketPairRanges },
+#endif
+    };
+
     size_t failCounter = 0;
 
-    for (uint32_t codePoint = 0; codePoint <= Unicode::MAX_CODE_POINT; codePoint++) {
-        uint32_t expBracket = m_BidiBrackets.pairedBracketForCodePoint(codePoint);
-        char expType = m_BidiBrackets.pairedBracketTypeForCodePoint(codePoint);
+    for (const Layout &layout : layouts) {
+        for (uint32_t codePoint = 0; codePoint <= Unicode::MAX_CODE_POINT; codePoint++) {
+            uint32_t expBracket = m_BidiBrackets.pairedBracketForCodePoint(codePoint);
+            char expType = m_BidiBrackets.pairedBracketTypeForCodePoint(codePoint);
 
-        BracketType valType;
-        SBUInt32 genBracket = LookupBracketPair(codePoint, &valType);
+            BracketType valType;
+            SBUInt32 genBracket = layout.lookup(codePoint, &valType);
 
-        char genType;
-        switch (valType) {
-        case BracketTypeOpen:
-            genType = 'o';
-            break;
+            char genType;
+            switch (valType) {
+            case BracketTypeOpen:
+                genType = 'o';
+                break;
 
-        case BracketTypeClose:
-            genType = 'c';
-            break;
+            case BracketTypeClose:
+                genType = 'c';
+                break;
 
-        default:
-            genType = '\0';
-            break;
-        }
-
-        if (genBracket != expBracket || genType != expType) {
-            if (Configuration::DISPLAY_ERROR_DETAILS) {
-                cout << "Invalid bracket pair found: " << endl
-                     << "  Code Point: " << codePoint << endl
-                     << "  Expected Bracket: " << expBracket << endl
-                     << "  Expected Type: " << expBracket << endl
-                     << "  Generated Bracket: " << genBracket << endl
-                     << "  Generated Type: " << genType << endl;
+            default:
+                genType = '\0';
+                break;
             }
 
-            failCounter++;
+            if (genBracket != expBracket || genType != expType) {
+                if (Configuration::DISPLAY_ERROR_DETAILS) {
+                    cout << "Invalid bracket pair found: " << endl
+                         << "  Layout: " << layout.name << endl
+                         << "  Code Point: " << codePoint << endl
+                         << "  Expected Bracket: " << expBracket << endl
+                         << "  Expected Type: " << expBracket << endl
+                         << "  Generated Bracket: " << genBracket << endl
+                         << "  Generated Type: " << genType << endl;
+                }
+
+                failCounter++;
+            }
         }
     }
 
@@ -15,10 +15,13 @@
  */
 
 extern "C" {
+#include <SBAlgorithm.h>
 #include <SBBase.h>
 #include <SBCodepointSequence.h>
+#include <Source/SBDispatch.h>
 }
 
+#include <algorithm>
 #include <cassert>
 #include <vector>
 
@@ -29,14 +32,28 @@ using namespace SheenBidi::Tester;
 
 const SBCodepoint FAULTY = SBCodepointFaulty;
 
-template<class CodeUnitType>
-static void encTest(SBStringEncoding encoding, const vector<CodeUnitType> &buffer, const vector<uint32_t> &codepoints)
+static uint8_t swapUnit(uint8_t unit)
 {
-    SBCodepointSequence sequence;
-    sequence.stringEncoding = encoding;
-    sequence.stringBuffer = (void *)buffer.data();
-    sequence.stringLength = buffer.size();
+    return unit;
+}
+
+static uint16_t swapUnit(uint16_t unit)
+{
+    return (uint16_t)((unit << 8) | (unit >> 8));
+}
 
+static uint32_t swapUnit(uint32_t unit)
+{
+    return (unit << 24) | ((unit & 0xFF00) << 8) | ((unit >> 8) & 0xFF00) | (unit >> 24);
+}
+
+static bool isSwapped(SBStringEncoding encoding)
+{
+    return encoding == SBStringEncodingUTF16Swapped || encoding == SBStringEncodingUTF32Swapped;
+}
+
+static void decodeTest(const SBCodepointSequence &sequence, const vector<uint32_t> &codepoints)
+{
     SBUInteger index = 0;
     SBUInteger token = 0;
     SBCodepoint current;
@@ -60,19 +77,84 @@ static void encTest(SBStringEncoding encoding, const vector<CodeUnitType> &buffe
     assert(count == codepoints.size());
 }
 
+template<class CodeUnitType>
+static void encTest(SBStringEncoding encoding, const vector<CodeUnitType> &buffer, const vector<uint32_t> &codepoints)
+{
+    SBCodepointSequence sequence;
+    sequence.stringEncoding = encoding;
+    sequence.stringBuffer = (void *)buffer.data();
+    sequence.stringLength = buffer.size();
+
+    decodeTest(sequence, codepoints);
+
+    /*
+     * Chunked decoding test, surrounding the string with faulty code units which must stay hidden
+     * from the decoders.
+     */
+    CodeUnitType leading = (CodeUnitType)(encoding == SBStringEncodingUTF8 ? 0x80 : 0xDC00);
+    CodeUnitType trailing = (CodeUnitType)(encoding == SBStringEncodingUTF8 ? 0x80 : 0xD800);
+    if (isSwapped(encoding)) {
+        leading = swapUnit(leading);
+        trailing = swapUnit(trailing);
+    }
+
+    vector<CodeUnitType> text(3, leading);
+    text.insert(text.end(), buffer.begin(), buffer.end());
+    text.insert(text.end(), 3, trailing);
+
+    for (size_t size : { 1, 2, 3, 5, 64 }) {
+        vector<SBStringChunk> chunks;
+
+        for (size_t offset = 0; offset < text.size(); offset += size) {
+            SBStringChunk chunk;
+            chunk.buffer = (void *)&text[offset];
+            chunk.offset = offset;
+            chunk.length = min(size, text.size() - offset);
+
+            chunks.push_back(chunk);
+        }
+
+        SBStringChunks source = { chunks.data(), chunks.size(), 3 };
+        SBCodepointSequence chunked;
+        chunked.stringEncoding = encoding | SBStringEncodingChunked;
+        chunked.stringBuffer = &source;
+        chunked.stringLength = buffer.size();
+
+        decodeTest(chunked, codepoints);
+    }
+}
+
 static void u8Test(const vector<uint8_t> &buffer, const vector<uint32_t> &codepoints)
 {
     encTest(SBStringEncodingUTF8, buffer, codepoints);
 }
 
+template<class CodeUnitType>
+static vector<CodeUnitType> swapUnits(const vector<CodeUnitType> &buffer)
+{
+    vector<CodeUnitType> swapped;
+    for (auto unit : buffer) {
+        swapped.push_back(swapUnit(unit));
+    }
+
+    return swapped;
+}
+
 static void u16Test(const vector<uint16_t> &buffer, const vector<uint32_t> &codepoints)
 {
     encTest(SBStringEncodingUTF16, buffer, codepoints);
+    encTest(SBStringEncodingUTF16Swapped, swapUnits(buffer), codepoints);
 }
 
 static void u32Test(const vector<uint32_t> &buffer, const vector<uint32_t> &codepoints)
 {
     encTest(SBStringEncodingUTF32, buffer, codepoints);
+    encTest(SBStringEncodingUTF32Swapped, swapUnits(buffer), codepoints);
+}
+
+static void latin1Test(const vector<uint8_t> &buffer, const vector<uint32_t> &codepoints)
+{
+    encTest(SBStringEncodingLatin1, buffer, codepoints);
 }
 
 CodepointSequenceTester::CodepointSequenceTester()
@@ -327,9 +409,78 @@ void CodepointSequenceTester::testUTF32()
     u32Test({ 0x10FFFF }, { 0x10FFFF });
 }
 
+void CodepointSequenceTester::testLatin1()
+{
+    /* Empty sequence. */
+    latin1Test({ }, { });
+
+    /* Every byte maps to the code point of same value. */
+    vector<uint8_t> bytes;
+    vector<uint32_t> codepoints;
+    for (uint32_t value = 0; value <= 0xFF; value++) {
+        bytes.push_back((uint8_t)value);
+        codepoints.push_back(value);
+    }
+    latin1Test(bytes, codepoints);
+}
+
+template<class CodeUnitType>
+static vector<SBBidiType> determineTypes(SBStringEncoding encoding, const vector<CodeUnitType> &buffer)
+{
+    SBCodepointSequence sequence;
+    sequence.stringEncoding = encoding;
+    sequence.stringBuffer = (void *)buffer.data();
+    sequence.stringLength = buffer.size();
+
+    SBAlgorithmRef algorithm = SBAlgorithmCreate(&sequence);
+    const SBBidiType *types = SBAlgorithmGetBidiTypesPtr(algorithm);
+    vector<SBBidiType> output(types, types + buffer.size());
+    SBAlgorithmRelease(algorithm);
+
+    return output;
+}
+
+void CodepointSequenceTester::testDispatch()
+{
+    SBDispatchLevel initialLevel = SBDispatchGetLevel();
+
+    /* Mix blocks which the kernels decode with blocks left for the scalar decoder. */
+    vector<uint8_t> u8Buffer;
+    vector<uint16_t> u16Buffer;
+    for (int i = 0; i < 8; i++) {
+        u8Buffer.insert(u8Buffer.end(), {
+            'a', 'b', 0xD7, 0x90, ' ', 0xD8, 0xA7, '(', 0xE2, 0x80, 0xAB, 0x80, '1', ')'
+        });
+        u16Buffer.insert(u16Buffer.end(), {
+            'a', 0x05D0, ' ', 0x0627, '(', 0xD83D, 0xDE00, '1', ')', 0xDC00
+        });
+        u16Buffer.insert(u16Buffer.end(), 16, 0x05D1);
+    }
+
+    SBDispatchSetLevel(SBDispatchLevelScalar);
+    assert(SBDispatchGetLevel() == SBDispatchLevelScalar);
+
+    vector<SBBidiType> u8Types = determineTypes(SBStringEncodingUTF8, u8Buffer);
+    vector<SBBidiType> u16Types = determineTypes(SBStringEncodingUTF16, u16Buffer);
+
+    /* Test that every pinned level gives the same types as the scalar decoder. */
+    for (SBDispatchLevel level = SBDispatchLevelSSE2; level <= SBDispatchLevelAVX512; level++) {
+        SBDispatchSetLevel(level);
+        assert(SBDispatchGetLevel() <= level);
+
+        assert(determineTypes(SBStringEncodingUTF8, u8Buffer) == u8Types);
+        assert(determineTypes(SBStringEncodingUTF16, u16Buffer) == u16Types);
+    }
+
+    SBDispatchSetLevel(initialLevel);
+    assert(SBDispatchGetLevel() == initialLevel);
+}
+
 void CodepointSequenceTester::test()
 {
     testUTF8();
     testUTF16();
     testUTF32();
+    testLatin1();
+    testDispatch();
 }
@@ -30,6 +30,8 @@ private:
     void testUTF8();
     void testUTF16();
     void testUTF32();
+    void testLatin1();
+    void testDispatch();
 };
 
 }
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+extern "C" {
+#include <Headers/SBAlgorithm.h>
+#include <Headers/SBBase.h>
+#include <Headers/SBCodepointSequence.h>
+#include <Headers/SBDocument.h>
+#include <Headers/SBParagraph.h>
+}
+
+#include <cassert>
+#include <string>
+#include <vector>
+
+#include "DocumentTester.h"
+
+using namespace std;
+using namespace SheenBidi::Tester;
+
+DocumentTester::DocumentTester()
+{
+}
+
+void DocumentTester::test()
+{
+    const u32string paragraphs[] = {
+        U"abc אבג\n", U"אבג (abc) ١٢٣\r\n", U"\u2067xyz\u2069 ابت \u2029", U"123\n", U"\n", U"xyz\r"
+    };
+    u32string string;
+    vector<SBUInteger> offsets;
+
+    for (int i = 0; i < 200; i++) {
+        offsets.push_back(string.length());
+        string += paragraphs[i % 6];
+    }
+
+    SBCodepointSequence sequence;
+    sequence.stringEncoding = SBStringEncodingUTF32;
+    sequence.stringBuffer = (void *)string.data();
+    sequence.stringLength = string.length();
+
+    SBAlgorithmRef algorithm = SBAlgorithmCreate(&sequence);
+    SBDocumentRef document = SBDocumentCreate(algorithm, SBLevelDefaultLTR, 3);
+    SBUInteger offset;
+    SBUInteger length;
+
+    assert(SBDocumentCreate(algorithm, SBLevelDefaultLTR, 0) == NULL);
+
+    /* Test the lookup of paragraphs by offset, jumping around the text. */
+    assert(SBDocumentGetParagraphIndex(document, offsets[150] + 2) == 150);
+    assert(SBDocumentGetParagraphIndex(document, offsets[7]) == 7);
+    assert(SBDocumentGetParagraphIndex(document, offsets[8] - 1) == 7);
+    assert(SBDocumentGetParagraphIndex(document, string.length() - 1) == 199);
+    assert(SBDocumentGetParagraphIndex(document, string.length()) == SBInvalidIndex);
+    assert(SBDocumentGetResidentCount(document) == 0);
+
+    assert(SBDocumentGetParagraphRange(document, 13, &offset, &length));
+    assert(offset == offsets[13] && length == offsets[14] - offsets[13]);
+    assert(!SBDocumentGetParagraphRange(document, 200, &offset, &length));
+    assert(SBDocumentGetParagraphCount(document) == 200);
+
+    /* Test that the paragraphs are resolved on demand like the ones of the algorithm. */
+    for (SBUInteger index : { 5, 180, 42, 5, 99, 0, 199 }) {
+        SBParagraphRef paragraph = SBDocumentGetParagraph(document, index);
+        SBParagraphRef expected = SBAlgorithmCreateParagraph(algorithm, offsets[index],
+            string.length() - offsets[index], SBLevelDefaultLTR);
+        SBUInteger paragraphLength = SBParagraphGetLength(paragraph);
+
+        assert(SBParagraphGetOffset(paragraph) == offsets[index]);
+        assert(paragraphLength == SBParagraphGetLength(expected));
+        assert(SBParagraphGetBaseLevel(paragraph) == SBParagraphGetBaseLevel(expected));
+        assert(vector<SBLevel>(SBParagraphGetLevelsPtr(paragraph), SBParagraphGetLevelsPtr(paragraph) + paragraphLength)
+               == vector<SBLevel>(SBParagraphGetLevelsPtr(expected), SBParagraphGetLevelsPtr(expected) + paragraphLength));
+        assert(SBDocumentGetResidentCount(document) <= 3);
+
+        SBParagraphRelease(expected);
+    }
+    assert(SBDocumentGetParagraph(document, 200) == NULL);
+
+    /* Test that the recently used paragraphs stay resident while the others are released. */
+    SBParagraphRef first = SBDocumentGetParagraph(document, 10);
+    SBDocumentGetParagraph(document, 11);
+    SBParagraphRef retained = SBParagraphRetain(SBDocumentGetParagraph(document, 12));
+    assert(SBDocumentGetParagraph(document, 10) == first);
+    assert(SBDocumentGetParagraph(document, 13) != NULL);
+    assert(SBDocumentGetParagraph(document, 10) == first);
+    assert(SBDocumentGetResidentCount(document) == 3);
+    assert(SBParagraphGetOffset(retained) == offsets[12]);
+    SBParagraphRelease(retained);
+
+    SBDocumentRelease(document);
+    SBAlgorithmRelease(algorithm);
+}
@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+extern "C" {
+#include <Headers/SBAlgorithm.h>
+#include <Headers/SBBase.h>
+#include <Headers/SBCodepointSequence.h>
+#include <Headers/SBItemizer.h>
+#include <Headers/SBLine.h>
+#include <Headers/SBMirrorLocator.h>
+#include <Headers/SBParagraph.h>
+#include <Headers/SBScript.h>
+}
+
+#include <cassert>
+#include <string>
+#include <vector>
+
+#include "ItemizerTester.h"
+
+using namespace std;
+using namespace SheenBidi::Tester;
+
+struct item {
+    SBUInteger offset;
+    SBUInteger length;
+    SBLevel level;
+    SBScript script;
+    vector<SBUInteger> mirrors;
+
+    bool operator ==(const item& other) const {
+        return offset == other.offset
+            && length == other.length
+            && level == other.level
+            && script == other.script
+            && mirrors == other.mirrors;
+    }
+};
+
+static void u32Test(const u32string string, SBLevel baseLevel, const vector<item> items)
+{
+    SBCodepointSequence sequence;
+    sequence.stringEncoding = SBStringEncodingUTF32;
+    sequence.stringBuffer = (void *)&string[0];
+    sequence.stringLength = string.length();
+
+    SBAlgorithmRef algorithm = SBAlgorithmCreate(&sequence);
+    SBParagraphRef paragraph = SBAlgorithmCreateParagraph(algorithm, 0, string.length(), baseLevel);
+    SBLineRef line = SBParagraphCreateLine(paragraph, 0, string.length());
+
+    SBItemizerRef itemizer = SBItemizerCreate();
+    const SBItemAgent *agent = SBItemizerGetAgent(itemizer);
+
+    SBItemizerLoadLine(itemizer, line, sequence.stringBuffer);
+
+    vector<item> output;
+    while (SBItemizerMoveNext(itemizer)) {
+        vector<SBUInteger> mirrors;
+
+        for (SBUInteger i = 0; i < agent->mirrorCount; i++) {
+            const SBMirrorAgent *mirror = &agent->mirrors[i];
+            assert(mirror->codepoint == string[mirror->index]);
+
+            mirrors.push_back(mirror->index);
+        }
+
+        output.push_back({agent->offset, agent->length, agent->level, agent->script, mirrors});
+    }
+
+    SBItemizerRelease(itemizer);
+    SBLineRelease(line);
+    SBParagraphRelease(paragraph);
+    SBAlgorithmRelease(algorithm);
+
+    assert(items == output);
+}
+
+static void u8IndexedTest(const string string, SBLevel baseLevel, const vector<item> items)
+{
+    SBCodepointSequence sequence;
+    sequence.stringEncoding = SBStringEncodingUTF8;
+    sequence.stringBuffer = (void *)&string[0];
+    sequence.stringLength = string.length();
+
+    SBAlgorithmRef algorithm = SBAlgorithmCreateCodepointIndexed(&sequence);
+    SBParagraphRef paragraph = SBAlgorithmCreateParagraph(algorithm, 0, SBInvalidIndex, baseLevel);
+    SBUInteger length = SBParagraphGetLength(paragraph);
+    SBLineRef line = SBParagraphCreateLine(paragraph, 0, length);
+
+    SBItemizerRef itemizer = SBItemizerCreate();
+    const SBItemAgent *agent = SBItemizerGetAgent(itemizer);
+
+    /* Test that the line is loaded with the source buffer of an indexed algorithm. */
+    SBItemizerLoadLine(itemizer, line, sequence.stringBuffer);
+
+    vector<item> output;
+    vector<SBUInteger> allMirrors;
+    while (SBItemizerMoveNext(itemizer)) {
+        vector<SBUInteger> mirrors;
+
+        for (SBUInteger i = 0; i < agent->mirrorCount; i++) {
+            mirrors.push_back(agent->mirrors[i].index);
+            allMirrors.push_back(agent->mirrors[i].index);
+        }
+
+        output.push_back({agent->offset, agent->length, agent->level, agent->script, mirrors});
+    }
+
+    SBMirrorLocatorRef locator = SBMirrorLocatorCreate();
+    const SBMirrorAgent *mirror = SBMirrorLocatorGetAgent(locator);
+
+    SBMirrorLocatorLoadLine(locator, line, sequence.stringBuffer);
+
+    vector<SBUInteger> locatedMirrors;
+    while (SBMirrorLocatorMoveNext(locator)) {
+        locatedMirrors.push_back(mirror->index);
+    }
+
+    SBMirrorLocatorRelease(locator);
+    SBItemizerRelease(itemizer);
+    SBLineRelease(line);
+    SBParagraphRelease(paragraph);
+    SBAlgorithmRelease(algorithm);
+
+    assert(items == output);
+    assert(allMirrors == locatedMirrors);
+}
+
+ItemizerTester::ItemizerTester()
+{
+}
+
+void ItemizerTester::test()
+{
+    /* Test with a single script and level. */
+    u32Test(U"Script", 0, { {0, 6, 0, SBScriptLATN, {}} });
+
+    /* Test with different scripts in same level. */
+    u32Test(U"abcабв", 0, { {0, 3, 0, SBScriptLATN, {}}, {3, 3, 0, SBScriptCYRL, {}} });
+
+    /* Test with different levels. */
+    u32Test(U"abc אבג", 0, { {0, 4, 0, SBScriptLATN, {}}, {4, 3, 1, SBScriptHEBR, {}} });
+    u32Test(U"אב 12", 1, { {0, 3, 1, SBScriptHEBR, {}}, {3, 2, 2, SBScriptZYYY, {}} });
+
+    /* Test with mirrors in an odd level. */
+    u32Test(U"א(ב)", 1, { {0, 4, 1, SBScriptHEBR, {1, 3}} });
+    /* Test that mirrors are not collected in an even level. */
+    u32Test(U"a(b)", 0, { {0, 4, 0, SBScriptLATN, {}} });
+
+    /* Test with code point indexes of a UTF-8 string. */
+    u8IndexedTest(u8"א(ב)", 1, { {0, 4, 1, SBScriptHEBR, {1, 3}} });
+    u8IndexedTest(u8"abc אב(ג)", 0, { {0, 4, 0, SBScriptLATN, {}}, {4, 5, 1, SBScriptHEBR, {6, 8}} });
+}
@@ -0,0 +1,345 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+extern "C" {
+#include <Headers/SBAlgorithm.h>
+#include <Headers/SBBase.h>
+#include <Headers/SBCodepointSequence.h>
+#include <Headers/SBLine.h>
+#include <Headers/SBParagraph.h>
+#include <Headers/SBRun.h>
+}
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "LineTester.h"
+
+using namespace std;
+using namespace SheenBidi::Tester;
+
+static void testLine(SBLineRef line, SBUInteger unitCount, const vector<SBUInteger> &starts)
+{
+    SBUInteger runCount = SBLineGetRunCount(line);
+    const SBRun *runs = SBLineGetRunsPtr(line);
+
+    /* Derive the visual order of code points from the runs. */
+    vector<SBUInteger> visual;
+    for (SBUInteger i = 0; i < runCount; i++) {
+        vector<SBUInteger> run;
+        for (auto start : starts) {
+            if (start >= runs[i].offset && start < runs[i].offset + runs[i].length) {
+                run.push_back(start);
+            }
+        }
+        if (runs[i].level & 1) {
+            visual.insert(visual.end(), run.rbegin(), run.rend());
+        } else {
+            visual.insert(visual.end(), run.begin(), run.end());
+        }
+    }
+    assert(visual.size() == starts.size());
+
+    /* Test the caret movement in both directions. */
+    for (size_t i = 0; i < visual.size(); i++) {
+        SBUInteger left = (i > 0 ? visual[i - 1] : SBInvalidIndex);
+        SBUInteger right = (i + 1 < visual.size() ? visual[i + 1] : SBInvalidIndex);
+
+        assert(SBLineGetLeftIndex(line, visual[i]) == left);
+        assert(SBLineGetRightIndex(line, visual[i]) == right);
+    }
+
+    /* Test the run lookup for each code unit. */
+    for (SBUInteger i = 0; i < unitCount; i++) {
+        SBUInteger runIndex = SBLineGetRunIndex(line, i);
+
+        assert(runIndex < runCount);
+        assert(i >= runs[runIndex].offset && i < runs[runIndex].offset + runs[runIndex].length);
+    }
+    assert(SBLineGetRunIndex(line, unitCount) == SBInvalidIndex);
+
+    /* Test the selection runs for each range. */
+    vector<SBRun> selection(runCount);
+    for (SBUInteger offset = 0; offset < unitCount; offset++) {
+        for (SBUInteger length = 1; offset + length <= unitCount; length++) {
+            SBUInteger count = SBLineGetSelectionRuns(line, offset, length, &selection[0]);
+            SBUInteger index = 0;
+
+            for (SBUInteger i = 0; i < runCount; i++) {
+                SBUInteger start = max(offset, runs[i].offset);
+                SBUInteger end = min(offset + length, runs[i].offset + runs[i].length);
+
+                if (start < end) {
+                    assert(index < count);
+                    assert(selection[index].offset == start);
+                    assert(selection[index].length == end - start);
+                    assert(selection[index].level == runs[i].level);
+                    index += 1;
+                }
+            }
+            assert(index == count);
+        }
+    }
+}
+
+static void u32Test(const u32string string, SBLevel baseLevel)
+{
+    SBCodepointSequence sequence;
+    sequence.stringEncoding = SBStringEncodingUTF32;
+    sequence.stringBuffer = (void *)&string[0];
+    sequence.stringLength = string.length();
+
+    SBAlgorithmRef algorithm = SBAlgorithmCreate(&sequence);
+    SBParagraphRef paragraph = SBAlgorithmCreateParagraph(algorithm, 0, string.length(), baseLevel);
+    SBLineRef line = SBParagraphCreateLine(paragraph, 0, SBParagraphGetLength(paragraph));
+
+    vector<SBUInteger> starts;
+    for (SBUInteger i = 0; i < SBLineGetLength(line); i++) {
+        starts.push_back(i);
+    }
+
+    testLine(line, SBLineGetLength(line), starts);
+
+    SBLineRelease(line);
+    SBParagraphRelease(paragraph);
+    SBAlgorithmRelease(algorithm);
+}
+
+static void u16Test(const u16string string, SBLevel baseLevel)
+{
+    SBCodepointSequence sequence;
+    sequence.stringEncoding = SBStringEncodingUTF16;
+    sequence.stringBuffer = (void *)&string[0];
+    sequence.stringLength = string.length();
+
+    SBAlgorithmRef algorithm = SBAlgorithmCreate(&sequence);
+    SBParagraphRef paragraph = SBAlgorithmCreateParagraph(algorithm, 0, string.length(), baseLevel);
+    SBLineRef line = SBParagraphCreateLine(paragraph, 0, SBParagraphGetLength(paragraph));
+
+    vector<SBUInteger> starts;
+    SBUInteger index = 0;
+    while (index < SBLineGetLength(line)) {
+        starts.push_back(index);
+        SBCodepointSequenceGetCodepointAt(&sequence, &index);
+    }
+
+    testLine(line, SBLineGetLength(line), starts);
+
+    SBLineRelease(line);
+    SBParagraphRelease(paragraph);
+    SBAlgorithmRelease(algorithm);
+}
+
+static bool operator==(const SBRun &first, const SBRun &second)
+{
+    return first.offset == second.offset
+        && first.length == second.length
+        && first.level == second.level;
+}
+
+static vector<SBLevel> getLevels(SBParagraphRef paragraph)
+{
+    const SBLevel *levels = SBParagraphGetLevelsPtr(paragraph);
+    return vector<SBLevel>(levels, levels + SBParagraphGetLength(paragraph));
+}
+
+static vector<SBRun> getRuns(SBLineRef line)
+{
+    const SBRun *runs = SBLineGetRunsPtr(line);
+    return vector<SBRun>(runs, runs + SBLineGetRunCount(line));
+}
+
+static void chunkTest(const u16string string, SBLevel baseLevel, size_t chunkSize)
+{
+    SBCodepointSequence flat;
+    flat.stringEncoding = SBStringEncodingUTF16;
+    flat.stringBuffer = (void *)&string[0];
+    flat.stringLength = string.length();
+
+    vector<SBStringChunk> pieces;
+    for (size_t offset = 0; offset < string.length(); offset += chunkSize) {
+        SBStringChunk chunk;
+        chunk.buffer = (void *)&string[offset];
+        chunk.offset = offset;
+        chunk.length = min(chunkSize, string.length() - offset);
+
+        pieces.push_back(chunk);
+    }
+
+    SBStringChunks chunks = { pieces.data(), pieces.size(), 0 };
+    SBCodepointSequence chunked;
+    chunked.stringEncoding = SBStringEncodingUTF16 | SBStringEncodingChunked;
+    chunked.stringBuffer = &chunks;
+    chunked.stringLength = string.length();
+
+    SBAlgorithmRef flatAlgorithm = SBAlgorithmCreate(&flat);
+    SBAlgorithmRef chunkedAlgorithm = SBAlgorithmCreate(&chunked);
+    SBUInteger offset = 0;
+
+    /* Test that the chunked string is resolved exactly like the contiguous one. */
+    while (offset < string.length()) {
+        SBParagraphRef flatParagraph = SBAlgorithmCreateParagraph(flatAlgorithm, offset, SBInvalidIndex, baseLevel);
+        SBParagraphRef chunkedParagraph = SBAlgorithmCreateParagraph(chunkedAlgorithm, offset, SBInvalidIndex, baseLevel);
+        SBUInteger length = SBParagraphGetLength(flatParagraph);
+
+        assert(SBParagraphGetLength(chunkedParagraph) == length);
+        assert(getLevels(chunkedParagraph) == getLevels(flatParagraph));
+
+        SBLineRef flatLine = SBParagraphCreateLine(flatParagraph, offset, length);
+        SBLineRef chunkedLine = SBParagraphCreateLine(chunkedParagraph, offset, length);
+        u16string flatText(length, u'\0');
+        u16string chunkedText(length, u'\0');
+
+        assert(getRuns(chunkedLine) == getRuns(flatLine));
+
+        SBLineCopyVisualString(flatLine, &flatText[0]);
+        SBLineCopyVisualString(chunkedLine, &chunkedText[0]);
+        assert(chunkedText == flatText);
+
+        SBLineCopyMirroredString(flatLine, &flatText[0]);
+        SBLineCopyMirroredString(chunkedLine, &chunkedText[0]);
+        assert(chunkedText == flatText);
+
+        SBLineRelease(chunkedLine);
+        SBLineRelease(flatLine);
+        SBParagraphRelease(chunkedParagraph);
+        SBParagraphRelease(flatParagraph);
+
+        offset += length;
+    }
+
+    SBAlgorithmRelease(chunkedAlgorithm);
+    SBAlgorithmRelease(flatAlgorithm);
+}
+
+static void indexTest(const string string, SBLevel baseLevel)
+{
+    SBCodepointSequence sequence;
+    sequence.stringEncoding = SBStringEncodingUTF8;
+    sequence.stringBuffer = (void *)&string[0];
+    sequence.stringLength = string.length();
+
+    SBAlgorithmRef unitAlgorithm = SBAlgorithmCreate(&sequence);
+    SBAlgorithmRef indexedAlgorithm = SBAlgorithmCreateCodepointIndexed(&sequence);
+    SBUInteger codepointCount = 0;
+    SBUInteger index = 0;
+
+    while (SBCodepointSequenceGetCodepointAt(&sequence, &index) != SBCodepointInvalid) {
+        codepointCount += 1;
+    }
+    index = 0;
+
+    assert(SBAlgorithmGetCodeUnitOffset(indexedAlgorithm, codepointCount) == string.length());
+    assert(SBAlgorithmGetCodeUnitOffset(indexedAlgorithm, codepointCount + 1) == SBInvalidIndex);
+
+    /* Test that resolving code points gives the same result as resolving code units. */
+    while (index < codepointCount) {
+        SBUInteger offset = SBAlgorithmGetCodeUnitOffset(indexedAlgorithm, index);
+        SBParagraphRef unitParagraph = SBAlgorithmCreateParagraph(unitAlgorithm, offset, SBInvalidIndex, baseLevel);
+        SBParagraphRef indexedParagraph = SBAlgorithmCreateParagraph(indexedAlgorithm, index, SBInvalidIndex, baseLevel);
+        SBUInteger length = SBParagraphGetLength(indexedParagraph);
+        const SBLevel *unitLevels = SBParagraphGetLevelsPtr(unitParagraph);
+        const SBLevel *indexedLevels = SBParagraphGetLevelsPtr(indexedParagraph);
+
+        assert(SBAlgorithmGetCodeUnitOffset(indexedAlgorithm, index + length)
+               == offset + SBParagraphGetLength(unitParagraph));
+
+        for (SBUInteger i = 0; i < length; i++) {
+            SBUInteger unitIndex = SBAlgorithmGetCodeUnitOffset(indexedAlgorithm, index + i);
+            assert(indexedLevels[i] == unitLevels[unitIndex - offset]);
+        }
+
+        SBLineRef unitLine = SBParagraphCreateLine(unitParagraph, offset, SBParagraphGetLength(unitParagraph));
+        SBLineRef indexedLine = SBParagraphCreateLine(indexedParagraph, index, length);
+        vector<SBRun> runs = getRuns(indexedLine);
+
+        SBAlgorithmConvertRuns(indexedAlgorithm, runs.data(), runs.size());
+        assert(runs == getRuns(unitLine));
+
+        SBLineRelease(indexedLine);
+        SBLineRelease(unitLine);
+        SBParagraphRelease(indexedParagraph);
+        SBParagraphRelease(unitParagraph);
+
+        index += length;
+    }
+
+    SBAlgorithmRelease(indexedAlgorithm);
+    SBAlgorithmRelease(unitAlgorithm);
+}
+
+LineTester::LineTester()
+{
+}
+
+void LineTester::test()
+{
+    /* Test with a single run in both directions. */
+    u32Test(U"Line", 0);
+    u32Test(U"אבג", 1);
+
+    /* Test with mixed directions and nested levels. */
+    u32Test(U"abc אב 123 ג def", 0);
+    u32Test(U"א abc 123 ב \u2067xג\u2069 y", 1);
+
+    /* Test with supplementary code points at run edges. */
+    u16Test(u"\U0001D400a א\U00010900 b\U0001D401", 0);
+    u16Test(u"\U00010900א \U0001D400 \U00010901", 1);
+
+    /* Test with random strings mixing several bidi types. */
+    const char32_t pieces[] = {
+        U'a', U'א', U'ا', U'1', U'١', U' ', U'(', U')',
+        U'\u202A', U'\u202B', U'\u202C', U'\u2066', U'\u2067', U'\u2069', U'\u0300'
+    };
+    srand(1);
+    for (int i = 0; i < 500; i++) {
+        u32string string;
+        int length = rand() % 12 + 1;
+
+        for (int j = 0; j < length; j++) {
+            string.push_back(pieces[rand() % (sizeof(pieces) / sizeof(pieces[0]))]);
+        }
+
+        u32Test(string, (SBLevel)(rand() % 2));
+    }
+
+    /* Test with strings resolved by code point indexes. */
+    const string indexStrings[] = {
+        u8"abc \u05D0\u05D1 (\u0627\u0644) [\U00010900] 123\r\n\u2067xyz\u2069 \u202B\u05D0\u202C\n",
+        u8"\u4E2D\u6587 \u05D0\u05B7\u05D1\u2000\u0661\u0662 \U0001F600\u2000",
+        string("a\xD7\x90\xFF\xE2\x80 b\xF0\x9F\x98\xD7\x91", 13)
+    };
+    for (const auto &string : indexStrings) {
+        indexTest(string, SBLevelDefaultLTR);
+        indexTest(string, 0);
+        indexTest(string, 1);
+    }
+
+    /* Test with strings split into chunks, including inside surrogate pairs. */
+    const u16string chunkStrings[] = {
+        u"abc \U0001D400א (ב) [\U00010900] 123\r\n\u2067xyz\u2069 \u202Bא\u202C\n",
+        u"\U00010900\U00010901 abc\u0300 (x) \U0001D400\U0001D401 ١٢٣"
+    };
+    for (const auto &string : chunkStrings) {
+        for (size_t size : { 1, 2, 7 }) {
+            chunkTest(string, SBLevelDefaultLTR, size);
+            chunkTest(string, 1, size);
+        }
+    }
+}
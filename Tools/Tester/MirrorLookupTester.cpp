@@ -48,21 +48,37 @@ void MirrorLookupTester::test() {
 #else
     cout << "Running mirror lookup tester." << endl;
 
+    struct Layout {
+        const char *name;
+        SBCodepoint (*lookup)(SBCodepoint);
+    };
+
+    static const Layout layouts[] = {
+        { "configured", LookupMirror },
+#ifdef SB_CONFIG_ALL_LOOKUP_LAYOUTS
+        { "table", LookupMirrorTable },
+        { "ranges", LookupMirrorRanges },
+#endif
+    };
+
     size_t failCounter = 0;
 
-    for (uint32_t codePoint = 0; codePoint <= Unicode::MAX_CODE_POINT; codePoint++) {
-        uint32_t expMirror = m_BidiMirroring.mirrorForCodePoint(codePoint);
-        SBUInt32 genMirror = LookupMirror(codePoint);
+    for (const Layout &layout : layouts) {
+        for (uint32_t codePoint = 0; codePoint <= Unicode::MAX_CODE_POINT; codePoint++) {
+            uint32_t expMirror = m_BidiMirroring.mirrorForCodePoint(codePoint);
+            SBUInt32 genMirror = layout.lookup(codePoint);
 
-        if (genMirror != expMirror) {
-            if (Configuration::DISPLAY_ERROR_DETAILS) {
-                cout << "Invalid mirror found: " << endl
-                     << "  Code Point: " << codePoint << endl
-                     << "  Generated Mirror: " << genMirror << endl
-                     << "  Expected Mirror: " << expMirror << endl;
-            }
+            if (genMirror != expMirror) {
+                if (Configuration::DISPLAY_ERROR_DETAILS) {
+                    cout << "Invalid mirror found: " << endl
+                         << "  Layout: " << layout.name << endl
+                         << "  Code Point: " << codePoint << endl
+                         << "  Generated Mirror: " << genMirror << endl
+                         << "  Expected Mirror: " << expMirror << endl;
+                }
 
-            failCounter++;
+                failCounter++;
+            }
         }
     }
 
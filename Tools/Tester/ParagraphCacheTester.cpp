@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+extern "C" {
+#include <Headers/SBAlgorithm.h>
+#include <Headers/SBBase.h>
+#include <Headers/SBCodepointSequence.h>
+#include <Headers/SBParagraph.h>
+#include <Headers/SBParagraphCache.h>
+}
+
+#include <cassert>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ParagraphCacheTester.h"
+
+using namespace std;
+using namespace SheenBidi::Tester;
+
+static vector<SBLevel> resolve(SBParagraphCacheRef cache, const u32string &string, SBLevel baseLevel,
+    SBLevel *paragraphLevel = nullptr)
+{
+    SBCodepointSequence sequence;
+    sequence.stringEncoding = SBStringEncodingUTF32;
+    sequence.stringBuffer = (void *)&string[0];
+    sequence.stringLength = string.length();
+
+    SBAlgorithmRef algorithm = SBAlgorithmCreate(&sequence);
+    SBParagraphRef paragraph;
+
+    if (cache) {
+        paragraph = SBParagraphCacheCreateParagraph(cache, algorithm, 0, string.length(), baseLevel);
+    } else {
+        paragraph = SBAlgorithmCreateParagraph(algorithm, 0, string.length(), baseLevel);
+    }
+
+    const SBLevel *levels = SBParagraphGetLevelsPtr(paragraph);
+    vector<SBLevel> output(levels, levels + SBParagraphGetLength(paragraph));
+
+    if (paragraphLevel) {
+        *paragraphLevel = SBParagraphGetBaseLevel(paragraph);
+    }
+
+    SBParagraphRelease(paragraph);
+    SBAlgorithmRelease(algorithm);
+
+    return output;
+}
+
+ParagraphCacheTester::ParagraphCacheTester()
+{
+}
+
+void ParagraphCacheTester::test()
+{
+    const u32string first = U"abc אבג 123";
+    const u32string second = U"אבג (abc) ١٢٣";
+    const u32string third = U"\u202Bxyz\u202C ابت";
+
+    SBParagraphCacheRef cache = SBParagraphCacheCreate(2);
+    SBLevel cachedLevel;
+    SBLevel actualLevel;
+
+    assert(SBParagraphCacheCreate(0) == NULL);
+
+    /* Test that a repeated paragraph is taken from the cache with same levels. */
+    assert(resolve(cache, first, SBLevelDefaultLTR) == resolve(nullptr, first, SBLevelDefaultLTR));
+    assert(SBParagraphCacheGetMissCount(cache) == 1 && SBParagraphCacheGetHitCount(cache) == 0);
+    assert(resolve(cache, first, SBLevelDefaultLTR) == resolve(nullptr, first, SBLevelDefaultLTR));
+    assert(SBParagraphCacheGetMissCount(cache) == 1 && SBParagraphCacheGetHitCount(cache) == 1);
+
+    /* Test that the base level is a part of the key. */
+    assert(resolve(cache, first, 1, &cachedLevel) == resolve(nullptr, first, 1, &actualLevel));
+    assert(cachedLevel == actualLevel);
+    assert(SBParagraphCacheGetMissCount(cache) == 2);
+    resolve(cache, first, 1, &cachedLevel);
+    assert(cachedLevel == 1 && SBParagraphCacheGetHitCount(cache) == 2);
+
+    /* Test that the least recently used paragraph is discarded. */
+    resolve(cache, first, SBLevelDefaultLTR);
+    assert(SBParagraphCacheGetHitCount(cache) == 3);
+    assert(resolve(cache, second, SBLevelDefaultRTL) == resolve(nullptr, second, SBLevelDefaultRTL));
+    assert(SBParagraphCacheGetMissCount(cache) == 3);
+    resolve(cache, first, SBLevelDefaultLTR);
+    assert(SBParagraphCacheGetHitCount(cache) == 4);
+    resolve(cache, first, 1);
+    assert(SBParagraphCacheGetMissCount(cache) == 4);
+
+    /* Test that the cache can be shared by multiple threads. */
+    vector<thread> threads;
+    for (int i = 0; i < 4; i++) {
+        threads.emplace_back([&]() {
+            for (int j = 0; j < 1000; j++) {
+                const u32string &string = (j % 3 == 0 ? first : j % 3 == 1 ? second : third);
+                assert(resolve(cache, string, 0) == resolve(nullptr, string, 0));
+            }
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+    assert(SBParagraphCacheGetHitCount(cache) + SBParagraphCacheGetMissCount(cache) == 4 + 4 + 4000);
+
+    /* Test that the levels of an algorithm having provided types are not shared. */
+    const u32string fourth = U"abc def";
+    const vector<SBBidiType> types(fourth.length(), SBBidiTypeR);
+
+    SBCodepointSequence sequence;
+    sequence.stringEncoding = SBStringEncodingUTF32;
+    sequence.stringBuffer = (void *)&fourth[0];
+    sequence.stringLength = fourth.length();
+
+    SBUInteger hitCount = SBParagraphCacheGetHitCount(cache);
+    SBUInteger missCount = SBParagraphCacheGetMissCount(cache);
+
+    assert(resolve(cache, fourth, SBLevelDefaultLTR) == vector<SBLevel>(fourth.length(), 0));
+
+    SBAlgorithmRef algorithm = SBAlgorithmCreateWithTypes(&sequence, &types[0]);
+    SBParagraphRef paragraph = SBParagraphCacheCreateParagraph(cache, algorithm, 0, fourth.length(), SBLevelDefaultLTR);
+    const SBLevel *levels = SBParagraphGetLevelsPtr(paragraph);
+    assert(SBParagraphGetBaseLevel(paragraph) == 1);
+    assert(vector<SBLevel>(levels, levels + fourth.length()) == vector<SBLevel>(fourth.length(), 1));
+    assert(SBParagraphCacheGetHitCount(cache) == hitCount);
+    assert(SBParagraphCacheGetMissCount(cache) == missCount + 1);
+    SBParagraphRelease(paragraph);
+    SBAlgorithmRelease(algorithm);
+
+    SBParagraphCacheRelease(cache);
+}
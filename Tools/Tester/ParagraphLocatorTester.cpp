@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+extern "C" {
+#include <Headers/SBAlgorithm.h>
+#include <Headers/SBBase.h>
+#include <Headers/SBCodepointSequence.h>
+#include <Headers/SBMappedFile.h>
+#include <Headers/SBParagraph.h>
+#include <Headers/SBParagraphLocator.h>
+}
+
+#include <cassert>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "ParagraphLocatorTester.h"
+
+using namespace std;
+using namespace SheenBidi::Tester;
+
+static void locatorTest(const SBCodepointSequence &sequence, SBLevel baseLevel)
+{
+    SBAlgorithmRef algorithm = SBAlgorithmCreate(&sequence);
+    SBParagraphLocatorRef locator = SBParagraphLocatorCreate();
+    const SBParagraphAgent *agent = SBParagraphLocatorGetAgent(locator);
+    SBUInteger offset = 0;
+
+    SBParagraphLocatorLoadCodepoints(locator, &sequence, baseLevel);
+
+    /* Test that the paragraphs are same as the ones resolved over the whole string. */
+    while (SBParagraphLocatorMoveNext(locator)) {
+        SBParagraphRef expected = SBAlgorithmCreateParagraph(algorithm, offset,
+            sequence.stringLength - offset, baseLevel);
+        SBUInteger length = SBParagraphGetLength(expected);
+        const SBLevel *levels = SBParagraphGetLevelsPtr(agent->paragraph);
+
+        assert(agent->offset == offset);
+        assert(agent->length == length);
+        assert(SBParagraphGetOffset(agent->paragraph) == 0);
+        assert(SBParagraphGetLength(agent->paragraph) == length);
+        assert(SBParagraphGetBaseLevel(agent->paragraph) == SBParagraphGetBaseLevel(expected));
+        assert(vector<SBLevel>(levels, levels + length)
+               == vector<SBLevel>(SBParagraphGetLevelsPtr(expected), SBParagraphGetLevelsPtr(expected) + length));
+
+        SBParagraphRelease(expected);
+        offset += length;
+    }
+
+    assert(offset == sequence.stringLength);
+    assert(agent->offset == 0 && agent->length == 0 && agent->paragraph == NULL);
+
+    SBParagraphLocatorRelease(locator);
+    SBAlgorithmRelease(algorithm);
+}
+
+ParagraphLocatorTester::ParagraphLocatorTester()
+{
+}
+
+void ParagraphLocatorTester::mappedFileTest()
+{
+    const char *filePath = "sheenbidi_mapped_file.txt";
+    const string text = "abc \xD7\x90\xD7\x91\xD7\x92 (xyz)\r\n\xD8\xA7 123\n\nabc";
+    const string bom = "\xEF\xBB\xBF";
+
+    /* Test that a missing file is not mapped. */
+    assert(SBMappedFileCreate("sheenbidi_missing_file.txt", SBStringEncodingUTF8) == NULL);
+
+    for (const string &content : { text, bom + text, string() }) {
+        FILE *stream = fopen(filePath, "wb");
+        fwrite(content.data(), 1, content.size(), stream);
+        fclose(stream);
+
+        SBMappedFileRef file = SBMappedFileCreate(filePath, SBStringEncodingUTF8);
+        SBCodepointSequence sequence;
+
+        assert(file != NULL);
+        SBMappedFileGetCodepointSequence(file, &sequence);
+
+        if (content.empty()) {
+            assert(sequence.stringLength == 0);
+        } else {
+            assert(sequence.stringEncoding == SBStringEncodingUTF8);
+            assert(sequence.stringLength == text.length());
+            assert(string((const char *)sequence.stringBuffer, sequence.stringLength) == text);
+
+            locatorTest(sequence, SBLevelDefaultLTR);
+        }
+
+        SBMappedFileRelease(file);
+    }
+
+    /* Test that a file not fitting the code units is rejected. */
+    FILE *stream = fopen(filePath, "wb");
+    fwrite("abc", 1, 3, stream);
+    fclose(stream);
+    assert(SBMappedFileCreate(filePath, SBStringEncodingUTF16) == NULL);
+
+    remove(filePath);
+}
+
+void ParagraphLocatorTester::test()
+{
+    const u16string utf16 = u"abc אבג ا (\U0001D400)\r\n\r\nxyz\u2067a\u2069\r";
+    const u32string utf32 = U"א\nاب 123 abc\u001C\u202Bא\u202C";
+
+    SBCodepointSequence sequence;
+
+    sequence.stringEncoding = SBStringEncodingUTF16;
+    sequence.stringBuffer = (void *)utf16.data();
+    sequence.stringLength = utf16.length();
+    locatorTest(sequence, SBLevelDefaultLTR);
+    locatorTest(sequence, 1);
+
+    sequence.stringEncoding = SBStringEncodingUTF32;
+    sequence.stringBuffer = (void *)utf32.data();
+    sequence.stringLength = utf32.length();
+    locatorTest(sequence, SBLevelDefaultRTL);
+
+    /* Test that an empty locator has no paragraph. */
+    SBParagraphLocatorRef locator = SBParagraphLocatorCreate();
+    assert(!SBParagraphLocatorMoveNext(locator));
+    SBParagraphLocatorRelease(locator);
+
+    mappedFileTest();
+}
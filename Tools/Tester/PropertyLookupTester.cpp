@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2022 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+extern "C" {
+#include <Headers/SBBase.h>
+#include <Headers/SBConfig.h>
+#include <Source/BidiTypeLookup.h>
+#include <Source/GeneralCategoryLookup.h>
+#include <Source/PairingLookup.h>
+#include <Source/PropertyLookup.h>
+#include <Source/ScriptLookup.h>
+}
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+
+#include "Utilities/Unicode.h"
+
+#include "Configuration.h"
+#include "PropertyLookupTester.h"
+
+using namespace std;
+using namespace SheenBidi::Tester;
+using namespace SheenBidi::Tester::Utilities;
+
+PropertyLookupTester::PropertyLookupTester()
+{
+}
+
+void PropertyLookupTester::test() {
+#ifdef SB_CONFIG_UNITY
+    cout << "Cannot run property lookup tester in unity mode." << endl;
+#else
+    cout << "Running property lookup tester." << endl;
+
+    size_t failCounter = 0;
+
+    /* Go one code point beyond the range to check the default record as well. */
+    for (uint32_t codePoint = 0; codePoint <= Unicode::MAX_CODE_POINT + 1; codePoint++) {
+        const PropertyRecord *record = LookupProperties(codePoint);
+
+        BracketType expBracketType;
+        SBCodepoint expBracket = LookupBracketPair(codePoint, &expBracketType);
+        SBCodepoint expMirror = LookupMirror(codePoint);
+        BracketType genBracketType = PropertyRecordGetBracketType(record);
+        SBCodepoint genMirror = PropertyRecordGetMirror(record, codePoint);
+
+        if (record->bidiType != LookupBidiType(codePoint)
+            || record->generalCategory != LookupGeneralCategory(codePoint)
+            || record->script != LookupScript(codePoint)
+            || genMirror != expMirror
+            || genBracketType != expBracketType
+            || (expBracketType != BracketTypeNone && genMirror != expBracket)) {
+            if (Configuration::DISPLAY_ERROR_DETAILS) {
+                cout << "Invalid properties found: " << endl
+                     << "  Code Point: " << codePoint << endl
+                     << "  Expected Bidi Type: " << (int)LookupBidiType(codePoint) << endl
+                     << "  Generated Bidi Type: " << (int)record->bidiType << endl
+                     << "  Expected General Category: " << (int)LookupGeneralCategory(codePoint) << endl
+                     << "  Generated General Category: " << (int)record->generalCategory << endl
+                     << "  Expected Script: " << (int)LookupScript(codePoint) << endl
+                     << "  Generated Script: " << (int)record->script << endl
+                     << "  Expected Mirror: " << expMirror << endl
+                     << "  Generated Mirror: " << genMirror << endl;
+            }
+
+            failCounter++;
+        }
+    }
+
+    cout << failCounter << " error/s." << endl;
+    cout << endl;
+#endif
+}
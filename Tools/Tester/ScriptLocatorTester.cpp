@@ -59,9 +59,75 @@ static void u32Test(const u32string string, const vector<run> runs)
         output.push_back({agent->offset, agent->length, agent->script});
     }
 
+    assert(runs == output);
+
+    /* Copy the runs in batches of different sizes and compare with the located ones. */
+    for (SBUInteger capacity = 1; capacity <= runs.size() + 1; capacity++) {
+        vector<SBScriptAgent> batch(capacity);
+        SBUInteger count;
+
+        output.clear();
+
+        while ((count = SBScriptLocatorCopyRuns(locator, &batch[0], capacity)) > 0) {
+            assert(count <= capacity);
+
+            for (SBUInteger index = 0; index < count; index++) {
+                output.push_back({batch[index].offset, batch[index].length, batch[index].script});
+            }
+            assert(agent->offset == batch[count - 1].offset);
+        }
+
+        assert(runs == output);
+    }
+
     SBScriptLocatorRelease(locator);
+}
 
-    assert(runs == output);
+static void rangeTest()
+{
+    const u32string string = U"Scriptتحریر (Haste) Word";
+    SBCodepointSequence sequence;
+    sequence.stringEncoding = SBStringEncodingUTF32;
+    sequence.stringBuffer = (void *)&string[0];
+    sequence.stringLength = string.length();
+
+    SBScriptLocatorRef locator = SBScriptLocatorCreate();
+    const SBScriptAgent *agent = SBScriptLocatorGetAgent(locator);
+
+    /* Test that the runs are limited to the loaded range. */
+    SBScriptLocatorLoadCodepointRange(locator, &sequence, 3, 10);
+
+    vector<run> output;
+    while (SBScriptLocatorMoveNext(locator)) {
+        output.push_back({agent->offset, agent->length, agent->script});
+    }
+    assert(output == vector<run>({ {3, 3, SBScriptLATN}, {6, 7, SBScriptARAB} }));
+
+    /* Test that a saved state resumes with the pending brackets. */
+    SBScriptLocatorLoadCodepoints(locator, &sequence);
+
+    vector<run> runs;
+    while (SBScriptLocatorMoveNext(locator)) {
+        runs.push_back({agent->offset, agent->length, agent->script});
+    }
+    assert(runs.size() == 5);
+
+    SBScriptLocatorMoveNext(locator);
+    SBScriptLocatorMoveNext(locator);
+
+    SBScriptLocatorRef saved = SBScriptLocatorCopy(locator);
+    SBScriptLocatorReset(locator);
+    SBScriptLocatorLoadState(locator, saved);
+    SBScriptLocatorRelease(saved);
+
+    output.clear();
+    while (SBScriptLocatorMoveNext(locator)) {
+        output.push_back({agent->offset, agent->length, agent->script});
+    }
+    assert(output == vector<run>(runs.begin() + 2, runs.end()));
+    assert(output[1].script == SBScriptARAB);
+
+    SBScriptLocatorRelease(locator);
 }
 
 ScriptLocatorTester::ScriptLocatorTester()
@@ -95,4 +161,7 @@ void ScriptLocatorTester::test()
               {39, 1, SBScriptLATN}, {40, 2, SBScriptARAB} });
     /* Test with a starting bracket pair. */
     u32Test(U"[All is well]", { {0, 13, SBScriptLATN} });
+
+    /* Test with a limited range and a resumed state. */
+    rangeTest();
 }
@@ -30,11 +30,18 @@ extern "C" {
 #include <Parser/UnicodeData.h>
 
 #include "AlgorithmTester.h"
+#include "BatchTester.h"
 #include "BidiTypeLookupTester.h"
 #include "BracketLookupTester.h"
 #include "CodepointSequenceTester.h"
+#include "DocumentTester.h"
 #include "GeneralCategoryLookupTester.h"
+#include "ItemizerTester.h"
+#include "LineTester.h"
 #include "MirrorLookupTester.h"
+#include "ParagraphCacheTester.h"
+#include "ParagraphLocatorTester.h"
+#include "PropertyLookupTester.h"
 #include "ScriptLocatorTester.h"
 #include "ScriptLookupTester.h"
 
@@ -60,8 +67,15 @@ int main(int argc, const char *argv[]) {
     BracketLookupTester bracketLookupTester(bidiBrackets);
     GeneralCategoryLookupTester generalCategoryLookupTester(unicodeData);
     ScriptLookupTester scriptLookupTester(scripts, propertyValueAliases);
+    PropertyLookupTester propertyLookupTester;
     AlgorithmTester algorithmTester(&bidiTest, &bidiCharacterTest, &bidiMirroring);
     ScriptLocatorTester scriptLocatorTester;
+    ItemizerTester itemizerTester;
+    LineTester lineTester;
+    ParagraphCacheTester paragraphCacheTester;
+    BatchTester batchTester;
+    DocumentTester documentTester;
+    ParagraphLocatorTester paragraphLocatorTester;
 
     bidiTypeLookupTester.test();
     codepointSequenceTester.test();
@@ -69,8 +83,15 @@ int main(int argc, const char *argv[]) {
     bracketLookupTester.test();
     generalCategoryLookupTester.test();
     scriptLookupTester.test();
+    propertyLookupTester.test();
     algorithmTester.test();
     scriptLocatorTester.test();
+    itemizerTester.test();
+    lineTester.test();
+    paragraphCacheTester.test();
+    batchTester.test();
+    documentTester.test();
+    paragraphLocatorTester.test();
 
     return 0;
 }